@@ -52,6 +52,391 @@
                                                                 /* DEF_DISABLED     External argument check DISABLED    */
                                                                 /* DEF_ENABLED      External argument check ENABLED     */
 
+/*
+*********************************************************************************************************
+*                                   SNTPc SOCKET POOL CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_SOCK_POOL_NBR_ENTRIES with the number of UDP sockets kept open by the
+*               SNTP client between requests. One socket is kept per server & per address family, plus
+*               one per additional request in progress to the same server from other tasks. When all
+*               the sockets are in use, the request uses a socket closed at the end of the request.
+*
+*           (2) Configure SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX with the maximum length of a server hostname
+*               that can be kept in the socket pool & in the server address cache. Requests to a server
+*               with a longer hostname are still processed, but resolve the hostname & use a socket that
+*               is closed at the end of the request.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_SOCK_POOL_NBR_ENTRIES                   2u   /* See Note #1.                                         */
+#define  SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX                64u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                  SNTPc SHARED SOCKET CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_SOCK_SHARED_EN to enable/disable the shared socket mode :
+*
+*               (a) When ENABLED,  all the requests are carried by a single unconnected UDP socket per
+*                   address family, whatever the number of servers & of requests in progress. The socket
+*                   pool is not used.
+*
+*               (b) When DISABLED, each server uses its own socket from the socket pool.
+*
+*           (2) Configure SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX with the maximum number of requests waiting for
+*               their reply at the same time on the shared sockets, from all the tasks. A burst or a
+*               multi-server request uses one per request sent.
+*********************************************************************************************************
+*/
+                                                                /* Configure shared socket mode (see Note #1) :         */
+#define  SNTPc_CFG_SOCK_SHARED_EN                  DEF_DISABLED
+                                                                /* DEF_DISABLED     One socket per server               */
+                                                                /* DEF_ENABLED      One socket per address family       */
+
+#define  SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX                16u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                SNTPc SERVER ADDRESS CACHE CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES with the number of resolved server addresses kept
+*               by the SNTP client. One entry is kept per server hostname, port & address family.
+*
+*           (2) Configure SNTPc_CFG_ADDR_CACHE_TTL_SEC with the time during which a resolved server address
+*               is used without resolving the server hostname again.
+*
+*           (3) Configure SNTPc_CFG_ADDR_CACHE_REFRESH_SEC with the time before the expiration of an entry
+*               at which the SNTPc task resolves the server hostname again (see 'SNTPc TASK CONFIGURATION').
+*               Entries that were not used since they were last resolved are not refreshed & expire.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES                  2u   /* See Note #1.                                         */
+#define  SNTPc_CFG_ADDR_CACHE_TTL_SEC                   3600u   /* See Note #2.                                         */
+#define  SNTPc_CFG_ADDR_CACHE_REFRESH_SEC                300u   /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                SNTPc ADDRESS FAMILY SELECTION CONFIGURATION
+*
+* Note(s) : (1) When the server configuration does not specify an address family, the request is sent over
+*               IPv6 & then over IPv4 if no reply was received after SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS. The
+*               family of the first reply is remembered for the following requests to the same server.
+*
+*           (2) Racing both families requires the socket select feature of the network protocol suite
+*               (NET_SOCK_CFG_SEL_EN). When it is disabled, IPv4 is only tried after the IPv6 request failed.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS                50u   /* See Note #1.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                   SNTPc MULTI-SERVER CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_MULTI_SERVER_NBR_MAX with the maximum number of servers queried in
+*               parallel by SNTPc_ReqRemoteTimeMulti(). MUST be lower than or equal to 32.
+*
+*           (2) Configure SNTPc_CFG_SEL_SURVIVOR_NBR_MIN with the number of survivors under which the
+*               clustering algorithm stops discarding outliers (see RFC #5905, Section 11.2.2).
+*
+*           (3) Querying the servers in parallel requires the socket select feature of the network protocol
+*               suite (NET_SOCK_CFG_SEL_EN). When it is disabled, the servers are queried one after the other.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_MULTI_SERVER_NBR_MAX                    4u   /* See Note #1.                                         */
+#define  SNTPc_CFG_SEL_SURVIVOR_NBR_MIN                    3u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc BURST CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_BURST_REQ_NBR_MAX with the maximum number of requests sent in a burst
+*               by SNTPc_ReqRemoteTimeBurst(). RFC #5905 uses bursts of 8 requests at startup.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_BURST_REQ_NBR_MAX                       8u   /* See Note #1.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc KISS-O'-DEATH BACKOFF CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_BACKOFF_NBR_ENTRIES with the number of servers for which the SNTP client
+*               keeps the backoff state set by a Kiss-o'-Death reply. One entry is kept per server hostname
+*               & port. While a server is in backoff, requests to it fail without being sent.
+*
+*           (2) Configure SNTPc_CFG_BACKOFF_MIN_SEC & SNTPc_CFG_BACKOFF_MAX_SEC with the first & the
+*               largest backoff intervals. The interval is doubled by each "RATE" reply until a valid reply
+*               is received, & is at least the poll interval requested by the server. "DENY" & "RSTR"
+*               replies set the largest interval.
+*
+*           (3) Configure SNTPc_CFG_BACKOFF_JITTER_PCT with the maximum random time added to each backoff
+*               interval, in percent of the interval, so that clients do not retry all at the same time.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_BACKOFF_NBR_ENTRIES                     2u   /* See Note #1.                                         */
+#define  SNTPc_CFG_BACKOFF_MIN_SEC                        64u   /* See Note #2.                                         */
+#define  SNTPc_CFG_BACKOFF_MAX_SEC                     86400u   /* See Note #2.                                         */
+#define  SNTPc_CFG_BACKOFF_JITTER_PCT                     25u   /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc CLOCK FILTER CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_FILTER_NBR_ENTRIES with the number of servers for which the SNTP client
+*               keeps a clock filter. One filter is kept per server hostname & port, & holds the last eight
+*               samples of the server (see 'sntp-c_filter.c'). When the table is full, the filter of the
+*               server updated least recently is replaced.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_FILTER_NBR_ENTRIES                      2u   /* See Note #1.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                SNTPc LOCAL TIMESTAMP CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_EXT_TS_EN to enable/disable the external timestamp source. When enabled,
+*               the local timestamps of the SNTP packets & the disciplined clock are obtained from
+*               SNTPc_ExtTS_Get(), which the application implements from a high resolution timer (see
+*               'sntp-c_ext_ts.c'). When disabled, they are obtained from NetUtil_TS_Get_ms(), which limits
+*               the accuracy of the offsets to about 1 ms.
+*
+*           (2) Configure SNTPc_CFG_EXT_TS_RES_NS with the resolution of SNTPc_ExtTS_Get(), in nanoseconds.
+*
+*           (3) Configure SNTPc_CFG_NET_TS_EN to enable/disable the network layer timestamps. When enabled,
+*               the local transmit & receive times of the SNTP packets are obtained, when available, from
+*               SNTPc_NetTS_TxGet() & SNTPc_NetTS_RxGet(), which the application implements from the
+*               timestamps captured by the network driver (see 'sntp-c_net_ts.c'). This removes the delays
+*               of the network stack & of the task scheduling from the offsets. MUST be disabled when
+*               SNTPc_CFG_EXT_TS_EN is disabled.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_EXT_TS_EN                    DEF_DISABLED    /* See Note #1.                                         */
+#define  SNTPc_CFG_EXT_TS_RES_NS                        1000u   /* See Note #2.                                         */
+#define  SNTPc_CFG_NET_TS_EN                    DEF_DISABLED    /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc CLOCK DISCIPLINE CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_CLK_PANIC_THRESH_MS with the offset above which the disciplined clock is
+*               stepped to the server time instead of slewed (see SNTPc_ClkUpdate()). RFC #5905 steps the
+*               clock above 128 ms.
+*
+*           (2) Configure SNTPc_CFG_CLK_SLEW_MAX_PPM with the maximum rate at which an offset is slewed, in
+*               parts per million of the elapsed time. At 500 ppm, an offset of 100 ms is slewed in 200 s.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_CLK_PANIC_THRESH_MS                   128u   /* See Note #1.                                         */
+#define  SNTPc_CFG_CLK_SLEW_MAX_PPM                      500u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc ERA CONFIGURATION
+*
+* Note(s) : (1) NTP timestamps hold the seconds modulo 2^32 & wrap around every 136 years, the first time on
+*               2036-02-07 06:28:16 UTC. Configure SNTPc_CFG_ERA_PIVOT_SEC with a time close to the current
+*               time, such as the build time of the application, in seconds since 1900-01-01 00:00:00 UTC.
+*               Timestamps are converted to the time within 68 years of the pivot (see SNTPc_TS_ToTime64()).
+*
+*           (2) The pivot can be changed at run-time, e.g. restored from non-volatile memory, with
+*               SNTPc_EraPivotSet().
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_ERA_PIVOT_SEC                  3786825600u   /* 2020-01-01 00:00:00 UTC (see Note #1).               */
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc TASK CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_TASK_EN to enable/disable the SNTPc task. The SNTPc task performs the
+*               background operations of the SNTP client, such as the server address cache refresh, the
+*               asynchronous requests & the background synchronization.
+*
+*           (2) Configure SNTPc_CFG_TASK_PRIO & SNTPc_CFG_TASK_STK_SIZE_BYTES with the priority & the stack
+*               size of the SNTPc task. The stack is allocated by the kernel abstraction layer.
+*
+*           (3) Configure SNTPc_CFG_ASYNC_REQ_NBR_MAX with the maximum number of asynchronous requests
+*               (see SNTPc_ReqRemoteTimeAsync()) that can be queued to the SNTPc task at the same time.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_TASK_EN                       DEF_ENABLED    /* See Note #1.                                         */
+#define  SNTPc_CFG_TASK_PRIO                              25u   /* See Note #2.                                         */
+#define  SNTPc_CFG_TASK_STK_SIZE_BYTES                  2048u   /* See Note #2.                                         */
+#define  SNTPc_CFG_ASYNC_REQ_NBR_MAX                       4u   /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                  SNTPc SYNCHRONIZATION CONFIGURATION
+*
+* Note(s) : (1) The background synchronization (see SNTPc_SyncStart()) is performed by the SNTPc task &
+*               is available only if SNTPc_CFG_TASK_EN is enabled.
+*
+*           (2) Configure SNTPc_CFG_SYNC_POLL_EXP_MIN & SNTPc_CFG_SYNC_POLL_EXP_MAX with the limits of the
+*               poll interval, as powers of 2 seconds. The poll interval starts at the minimum & increases
+*               while the offsets measured stay within a few times the jitter. RFC #5905 uses 6 (64 s) &
+*               10 (1024 s) by default. Both MUST be between 4 (16 s) & 17 (36 h).
+*
+*           (3) Configure SNTPc_CFG_SYNC_BURST_REQ_NBR & SNTPc_CFG_SYNC_BURST_INTERVAL_MS with the number
+*               of requests & the interval between requests of the bursts sent when the synchronization
+*               starts & after a failed poll.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_SYNC_POLL_EXP_MIN                       6u   /* See Note #2.                                         */
+#define  SNTPc_CFG_SYNC_POLL_EXP_MAX                      10u   /* See Note #2.                                         */
+#define  SNTPc_CFG_SYNC_BURST_REQ_NBR                      4u   /* See Note #3.                                         */
+#define  SNTPc_CFG_SYNC_BURST_INTERVAL_MS               2000u   /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                              SNTPc FREQUENCY DRIFT ESTIMATION CONFIGURATION
+*
+* Note(s) : (1) The frequency error of the local time base is estimated from the offsets measured by the
+*               background synchronization & is available only if SNTPc_CFG_TASK_EN is enabled.
+*
+*           (2) Configure SNTPc_CFG_DRIFT_WIN_NBR with the number of polls over which the frequency error
+*               is estimated by least squares. A larger window averages more noise, but follows changes of
+*               the frequency, e.g. with the temperature, more slowly. MUST be between 3 & 32.
+*
+*           (3) Configure SNTPc_CFG_DRIFT_WANDER_PPB with the maximum change of the frequency of the local
+*               time base expected over the holdover, in parts per billion (e.g. 100 ppb for a TCXO, a few
+*               ppm for an uncompensated crystal). It increases the error bound of the predicted time with
+*               the time elapsed since the last poll.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_DRIFT_WIN_NBR                           8u   /* See Note #2.                                         */
+#define  SNTPc_CFG_DRIFT_WANDER_PPB                      500u   /* See Note #3.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc BROADCAST CLIENT CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_BCAST_EN to enable/disable the broadcast client (see SNTPc_BcastStart()).
+*               The broadcast client listens for the mode 5 packets of the NTP servers of the local network
+*               in its own task, so that the clock is disciplined without sending any request.
+*
+*           (2) Configure SNTPc_CFG_BCAST_TASK_PRIO & SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES with the priority &
+*               the stack size of the broadcast client task. The priority SHOULD be high, since the time at
+*               which a broadcast packet is read is its reception timestamp.
+*
+*           (3) Configure SNTPc_CFG_BCAST_CAL_REQ_NBR with the number of requests exchanged with a broadcast
+*               server to measure the network delay, before its broadcasts are used. MUST be >= 1.
+*
+*           (4) Configure SNTPc_CFG_BCAST_CAL_PERIOD_SEC with the period at which the network delay is
+*               measured again, in seconds. If 0, the delay is only measured again when the broadcast
+*               server changes. MUST be <= 604800 (one week).
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_BCAST_EN                      DEF_DISABLED   /* See Note #1.                                         */
+#define  SNTPc_CFG_BCAST_TASK_PRIO                        24u   /* See Note #2.                                         */
+#define  SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES            2048u   /* See Note #2.                                         */
+#define  SNTPc_CFG_BCAST_CAL_REQ_NBR                       4u   /* See Note #3.                                         */
+#define  SNTPc_CFG_BCAST_CAL_PERIOD_SEC                86400u   /* See Note #4.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                SNTPc MANYCAST DISCOVERY CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_MANYCAST_EN to enable/disable the manycast server discovery (see
+*               SNTPc_ManycastDiscover()). The discovered servers replace the default server configuration.
+*
+*           (2) Configure SNTPc_CFG_MANYCAST_GRP_ADDR with the IPv4 multicast address the requests are sent
+*               to when the application does not pass one. 224.0.1.1 is the address assigned to NTP.
+*
+*           (3) Configure SNTPc_CFG_MANYCAST_TTL_MAX with the highest TTL of the requests. The TTL starts at
+*               1 & is doubled until enough servers answered or the maximum is reached. MUST be >= 1.
+*
+*           (4) Configure SNTPc_CFG_MANYCAST_SERVER_NBR_MAX with the number of servers kept, best first.
+*               The servers found are ranked on the stack of the task calling SNTPc_ManycastDiscover().
+*               MUST be >= 1.
+*
+*           (5) Configure SNTPc_CFG_MANYCAST_RX_WINDOW_MS with the time during which the replies to each
+*               request are collected, in milliseconds. MUST be >= 1.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_MANYCAST_EN                   DEF_DISABLED   /* See Note #1.                                         */
+#define  SNTPc_CFG_MANYCAST_GRP_ADDR              "224.0.1.1"   /* See Note #2.                                         */
+#define  SNTPc_CFG_MANYCAST_TTL_MAX                        8u   /* See Note #3.                                         */
+#define  SNTPc_CFG_MANYCAST_SERVER_NBR_MAX                 3u   /* See Note #4.                                         */
+#define  SNTPc_CFG_MANYCAST_RX_WINDOW_MS                 500u   /* See Note #5.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc NETWORK TIME SECURITY CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_NTS_EN to enable/disable the authenticated requests with Network Time
+*               Security (see SNTPc_ReqRemoteTimeNTS()). The NTS functions of the product's BSP MUST be
+*               provided (see 'sntp-c_nts_crypto.c').
+*
+*           (2) Configure SNTPc_CFG_NTS_SERVER_NBR_MAX with the number of NTS key establishment servers whose
+*               keys & cookies are kept. MUST be >= 1.
+*
+*           (3) Configure SNTPc_CFG_NTS_COOKIE_NBR_MAX with the number of cookies kept for each server. RFC
+*               #8915 recommends 8. MUST be >= 1 && <= 16.
+*
+*           (4) Configure SNTPc_CFG_NTS_COOKIE_LEN_MAX with the maximum length of a cookie, in octets. Longer
+*               cookies are discarded. MUST be >= 16 && <= 256 & a multiple of 4.
+*
+*               (a) Two packet buffers of about (SNTPc_CFG_NTS_COOKIE_NBR_MAX * (SNTPc_CFG_NTS_COOKIE_LEN_MAX
+*                   + 4) + 124) octets are allocated on the stack of the task calling
+*                   SNTPc_ReqRemoteTimeNTS(). A key establishment allocates two buffers of about the same size,
+*                   in addition to the stack used by the TLS library.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_NTS_EN                        DEF_DISABLED   /* See Note #1.                                         */
+#define  SNTPc_CFG_NTS_SERVER_NBR_MAX                      2u   /* See Note #2.                                         */
+#define  SNTPc_CFG_NTS_COOKIE_NBR_MAX                      8u   /* See Note #3.                                         */
+#define  SNTPc_CFG_NTS_COOKIE_LEN_MAX                    128u   /* See Note #4.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                    SNTPc STATISTICS CONFIGURATION
+*
+* Note(s) : (1) Configure SNTPc_CFG_STAT_EN to enable/disable the request statistics (see SNTPc_StatGet()).
+*               The requests, their failures by error code & by stage, & the histograms of the round trip
+*               delays, of the offsets & of the waits on the module lock are counted.
+*
+*           (2) Configure SNTPc_CFG_STAT_NBR_ENTRIES with the number of servers for which the statistics are
+*               also kept separately (see SNTPc_StatServerGet()). One entry is kept per server hostname &
+*               port. When the table is full, the entry of the server updated least recently is replaced.
+*               MUST be >= 1.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CFG_STAT_EN                       DEF_DISABLED   /* See Note #1.                                         */
+#define  SNTPc_CFG_STAT_NBR_ENTRIES                        2u   /* See Note #2.                                         */
+
+
 /*
 *********************************************************************************************************
 *                                SNTPc RUN-TIME STRUCTURE CONFIGURATION
@@ -66,6 +451,23 @@ extern  const  SNTPc_CFG  SNTPc_Cfg;
 /*
 *********************************************************************************************************
 *                                                TRACING
+*
+* Note(s) : (1) Configure SNTPc_TRACE_LEVEL to select the trace events compiled in :
+*
+*               (a) TRACE_LEVEL_OFF     No trace event. The trace points compile to nothing.
+*               (b) TRACE_LEVEL_INFO    Request completions, Kiss-o'-Death, backoffs, NTS key establishments
+*                                       & synchronization polls.
+*               (c) TRACE_LEVEL_DBG     Also each packet transmitted & received.
+*
+*           (2) Configure SNTPc_TRACE_BIN_EN to enable/disable the binary trace backend. If enabled, each
+*               event is written as a compact record (identifier, timestamp & arguments) in a ring buffer of
+*               SNTPc_TRACE_BIN_NBR_RECORDS records, without lock & without formatting, so that tracing
+*               does not distort the timing it records. The buffer is decoded on the host (see
+*               'sntp-c.h  SNTPc TRACE DATA TYPES'). Otherwise, the trace points compile to nothing : the
+*               events are never printed with SNTPc_TRACE.
+*
+*           (3) Configure SNTPc_TRACE_BIN_NBR_RECORDS with the number of records of the ring buffer, each
+*               of 24 octets. The oldest records are overwritten. MUST be a power of 2.
 *********************************************************************************************************
 */
 
@@ -84,4 +486,7 @@ extern  const  SNTPc_CFG  SNTPc_Cfg;
 #define  SNTPc_TRACE_LEVEL                      TRACE_LEVEL_INFO
 #define  SNTPc_TRACE                            printf
 
+#define  SNTPc_TRACE_BIN_EN                      DEF_DISABLED   /* See Note #2.                                         */
+#define  SNTPc_TRACE_BIN_NBR_RECORDS                      64u   /* See Note #3.                                         */
+
 #endif
@@ -0,0 +1,95 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT EXTERNAL TIMESTAMP SOURCE
+*
+*                                              TEMPLATE
+*
+* Filename : sntp-c_ext_ts.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This file is used only if SNTPc_CFG_EXT_TS_EN is enabled in 'sntp-c_cfg.h'.
+*
+*            (2) This template obtains the local time from the 64-bit CPU timestamps of uC/CPU, which are
+*                usually based on a cycle counter. It requires CPU_CFG_TS_64_EN to be enabled in
+*                'cpu_cfg.h'. Any other free-running high resolution timer can be used instead.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <cpu_core.h>
+#include  <lib_def.h>
+#include  <Source/sntp-c.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_ExtTS_Get()
+*
+* Description : Get the local time from a high resolution timer.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Local time since an arbitrary origin, in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_ClkLocalGet().
+*
+* Note(s)     : (1) The timer frequency MUST be lower than 2^32 Hz, so that the fraction of a second can be
+*                   computed without overflow.
+*
+*               (2) Set SNTPc_CFG_EXT_TS_RES_NS to the period of the timer, rounded up to the next
+*                   nanosecond (e.g. 10 ns for a 100 MHz cycle counter).
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_EXT_TS_EN == DEF_ENABLED)
+SNTP_FIXED_TS  SNTPc_ExtTS_Get (void)
+{
+    CPU_TS64         ts;
+    CPU_TS_TMR_FREQ  freq_hz;
+    CPU_ERR          err;
+
+
+    freq_hz = CPU_TS_TmrFreqGet(&err);                          /* See Note #1.                                         */
+    if ((err     != CPU_ERR_NONE) ||
+        (freq_hz == 0u)) {
+        return (0u);
+    }
+
+    ts = CPU_TS_Get64();
+
+    return (((SNTP_FIXED_TS)(ts / freq_hz) << 32u) +
+            (((SNTP_FIXED_TS)(ts % freq_hz) << 32u) / freq_hz));
+}
+#endif
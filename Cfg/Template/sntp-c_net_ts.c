@@ -0,0 +1,393 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT NETWORK LAYER TIMESTAMPS
+*
+*                                              TEMPLATE
+*
+* Filename : sntp-c_net_ts.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This file is used only if SNTPc_CFG_NET_TS_EN is enabled in 'sntp-c_cfg.h'.
+*
+*            (2) The network driver captures the time at which each SNTP packet (UDP port 123) is transmitted
+*                or received, as close as possible to the wire, e.g. from its Rx/Tx ISR or from the hardware
+*                timestamps of the Ethernet controller. It reports them with App_SNTPc_NetTS_TxCapture() &
+*                App_SNTPc_NetTS_RxCapture(). The times MUST be in the time base of SNTPc_ExtTS_Get().
+*
+*            (3) The times are kept in small tables, indexed by the timestamp that identifies the exchange,
+*                until the SNTP client reads them with SNTPc_NetTS_TxGet() & SNTPc_NetTS_RxGet().
+*
+*            (4) The times can be withheld from the SNTP client at run time with App_SNTPc_NetTS_OffSet(),
+*                so that the client falls back to its own timestamps, e.g. to measure the benefit of the
+*                network layer timestamps (see 'sntp-c_net_ts_bench.c').
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <cpu_core.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <Source/sntp-c.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  APP_SNTPc_NET_TS_TBL_SIZE                         8u   /* Nbr of times kept in each tbl.                       */
+
+#define  APP_SNTPc_NET_TS_PKT_OFFSET_ORIGINATE            24u   /* Offset of the originate timestamp in the pkt.        */
+#define  APP_SNTPc_NET_TS_PKT_OFFSET_TX                   40u   /* Offset of the transmit  timestamp in the pkt.        */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct app_sntpc_net_ts {
+    CPU_BOOLEAN    IsValid;
+    SNTP_TS        Key;                                         /* Transmit timestamp of the req, in network order.     */
+    SNTP_FIXED_TS  TS;                                          /* Time captured by the driver.                         */
+} APP_SNTPc_NET_TS;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NET_TS_EN == DEF_ENABLED)
+static  APP_SNTPc_NET_TS  App_SNTPc_NetTS_TxTbl[APP_SNTPc_NET_TS_TBL_SIZE];
+static  APP_SNTPc_NET_TS  App_SNTPc_NetTS_RxTbl[APP_SNTPc_NET_TS_TBL_SIZE];
+
+static  CPU_INT08U        App_SNTPc_NetTS_TxIxNext;
+static  CPU_INT08U        App_SNTPc_NetTS_RxIxNext;
+
+static  CPU_BOOLEAN       App_SNTPc_NetTS_IsOff;                /* Times withheld from the client (see Note #4).        */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void         App_SNTPc_NetTS_Add  (      APP_SNTPc_NET_TS  *p_tbl,
+                                                 CPU_INT08U        *p_ix_next,
+                                           const CPU_INT08U        *p_key,
+                                                 SNTP_FIXED_TS      ts);
+
+static  CPU_BOOLEAN  App_SNTPc_NetTS_Srch (      APP_SNTPc_NET_TS  *p_tbl,
+                                           const SNTP_TS           *p_key,
+                                                 SNTP_FIXED_TS     *p_ts);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_NetTS_TxCapture()
+*
+* Description : Report the time at which an SNTP request was transmitted.
+*
+* Argument(s) : p_payload   Pointer to the UDP payload of the transmitted frame.
+*
+*               ts          Time at which the frame was transmitted, in the time base of SNTPc_ExtTS_Get().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Network driver.
+*
+* Note(s)     : (1) May be called from an ISR.
+*********************************************************************************************************
+*/
+
+void  App_SNTPc_NetTS_TxCapture (const CPU_INT08U     *p_payload,
+                                       SNTP_FIXED_TS   ts)
+{
+    App_SNTPc_NetTS_Add( App_SNTPc_NetTS_TxTbl,
+                        &App_SNTPc_NetTS_TxIxNext,
+                        &p_payload[APP_SNTPc_NET_TS_PKT_OFFSET_TX],
+                         ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_NetTS_RxCapture()
+*
+* Description : Report the time at which an SNTP reply was received.
+*
+* Argument(s) : p_payload   Pointer to the UDP payload of the received frame.
+*
+*               ts          Time at which the frame was received, in the time base of SNTPc_ExtTS_Get().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Network driver.
+*
+* Note(s)     : (1) May be called from an ISR.
+*
+*               (2) A reply is identified by its originate timestamp, i.e. the transmit timestamp of the
+*                   request it answers.
+*********************************************************************************************************
+*/
+
+void  App_SNTPc_NetTS_RxCapture (const CPU_INT08U     *p_payload,
+                                       SNTP_FIXED_TS   ts)
+{
+    App_SNTPc_NetTS_Add( App_SNTPc_NetTS_RxTbl,                 /* See Note #2.                                         */
+                        &App_SNTPc_NetTS_RxIxNext,
+                        &p_payload[APP_SNTPc_NET_TS_PKT_OFFSET_ORIGINATE],
+                         ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       App_SNTPc_NetTS_OffSet()
+*
+* Description : Withhold or provide the captured times to the SNTP client.
+*
+* Argument(s) : is_off      DEF_YES, to withhold the captured times.
+*
+*                           DEF_NO,  to provide them (default).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) While the times are withheld, they are still captured & consumed, so that no stale time
+*                   is provided after they are provided again.
+*********************************************************************************************************
+*/
+
+void  App_SNTPc_NetTS_OffSet (CPU_BOOLEAN  is_off)
+{
+    App_SNTPc_NetTS_IsOff = is_off;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_NetTS_TxGet()
+*
+* Description : Get the time at which the network layer transmitted an SNTP request.
+*
+* Argument(s) : p_ts_tx     Pointer to the transmit timestamp of the request, in network order.
+*
+*               p_ts        Pointer to a variable that will receive the transmit time.
+*
+* Return(s)   : DEF_OK,   if the transmit time is available.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_TxTS_Apply().
+*
+* Note(s)     : (1) The transmit time is not available while the times are withheld (see
+*                   App_SNTPc_NetTS_OffSet()). The variable is not modified when it is not available.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NetTS_TxGet (const SNTP_TS        *p_ts_tx,
+                                      SNTP_FIXED_TS  *p_ts)
+{
+    SNTP_FIXED_TS  ts;
+    CPU_BOOLEAN    result;
+
+
+    result = App_SNTPc_NetTS_Srch(App_SNTPc_NetTS_TxTbl, p_ts_tx, &ts);
+    if (App_SNTPc_NetTS_IsOff == DEF_YES) {                     /* See Note #1.                                         */
+        result = DEF_FAIL;
+    }
+    if (result == DEF_OK) {
+       *p_ts = ts;
+    }
+
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_NetTS_RxGet()
+*
+* Description : Get the time at which the network layer received an SNTP reply.
+*
+* Argument(s) : ppkt        Pointer to the received SNTP packet.
+*
+*               p_ts        Pointer to a variable that will receive the receive time.
+*
+* Return(s)   : DEF_OK,   if the receive time is available.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_RxTS_Set().
+*
+* Note(s)     : (1) The receive time is not available while the times are withheld (see
+*                   App_SNTPc_NetTS_OffSet()). The variable is not modified when it is not available.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NetTS_RxGet (const SNTP_PKT       *ppkt,
+                                      SNTP_FIXED_TS  *p_ts)
+{
+    SNTP_FIXED_TS  ts;
+    CPU_BOOLEAN    result;
+
+
+    result = App_SNTPc_NetTS_Srch(App_SNTPc_NetTS_RxTbl, &ppkt->TS_Originate, &ts);
+    if (App_SNTPc_NetTS_IsOff == DEF_YES) {                     /* See Note #1.                                         */
+        result = DEF_FAIL;
+    }
+    if (result == DEF_OK) {
+       *p_ts = ts;
+    }
+
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        App_SNTPc_NetTS_Add()
+*
+* Description : Add a captured time to a table, replacing the oldest one.
+*
+* Argument(s) : p_tbl       Pointer to the table.
+*
+*               p_ix_next   Pointer to the index of the next entry to replace.
+*
+*               p_key       Pointer to the timestamp that identifies the exchange, in the frame payload.
+*
+*               ts          Captured time.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_SNTPc_NetTS_RxCapture(),
+*               App_SNTPc_NetTS_TxCapture().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_SNTPc_NetTS_Add (      APP_SNTPc_NET_TS  *p_tbl,
+                                         CPU_INT08U        *p_ix_next,
+                                   const CPU_INT08U        *p_key,
+                                         SNTP_FIXED_TS      ts)
+{
+    APP_SNTPc_NET_TS  *p_entry;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_entry = &p_tbl[*p_ix_next];
+    Mem_Copy(&p_entry->Key, p_key, sizeof(SNTP_TS));            /* Payload may not be aligned.                          */
+    p_entry->TS      = ts;
+    p_entry->IsValid = DEF_YES;
+   *p_ix_next        = (*p_ix_next + 1u) % APP_SNTPc_NET_TS_TBL_SIZE;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       App_SNTPc_NetTS_Srch()
+*
+* Description : Search a table for the time captured for an exchange & remove it.
+*
+* Argument(s) : p_tbl       Pointer to the table.
+*
+*               p_key       Pointer to the timestamp that identifies the exchange, in network order.
+*
+*               p_ts        Pointer to a variable that will receive the captured time.
+*
+* Return(s)   : DEF_OK,   if the time was found.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NetTS_RxGet(),
+*               SNTPc_NetTS_TxGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  App_SNTPc_NetTS_Srch (      APP_SNTPc_NET_TS  *p_tbl,
+                                           const SNTP_TS           *p_key,
+                                                 SNTP_FIXED_TS     *p_ts)
+{
+    CPU_INT08U   ix;
+    CPU_BOOLEAN  result;
+    CPU_SR_ALLOC();
+
+
+    result = DEF_FAIL;
+
+    CPU_CRITICAL_ENTER();
+    for (ix = 0u; ix < APP_SNTPc_NET_TS_TBL_SIZE; ix++) {
+        if ((p_tbl[ix].IsValid  == DEF_YES     ) &&
+            (p_tbl[ix].Key.Sec  == p_key->Sec  ) &&
+            (p_tbl[ix].Key.Frac == p_key->Frac )) {
+           *p_ts              = p_tbl[ix].TS;
+            p_tbl[ix].IsValid = DEF_NO;
+            result            = DEF_OK;
+            break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (result);
+}
+#endif
@@ -0,0 +1,273 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                             SNTP CLIENT NTS CRYPTOGRAPHIC FUNCTIONS
+*
+*                                              TEMPLATE
+*
+* Filename : sntp-c_nts_crypto.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This file is used only if SNTPc_CFG_NTS_EN is enabled in 'sntp-c_cfg.h'.
+*
+*            (2) The functions of this template MUST be implemented with the TLS & cryptographic libraries of
+*                the product. As provided, they fail, so that SNTPc_ReqRemoteTimeNTS() never accepts a
+*                reply.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <lib_def.h>
+#include  <Source/sntp-c.h>
+
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_NTS_KE_Exchange()
+*
+* Description : Perform a NTS key establishment with a server.
+*
+* Argument(s) : p_hostname      Pointer to the hostname or address of the NTS-KE server.
+*
+*               port_nbr        TCP port of the NTS-KE server.
+*
+*               p_req           Pointer to the request records.
+*
+*               req_len         Length of the request records, in octets.
+*
+*               p_resp          Pointer to a buffer that will receive the response records.
+*
+*               resp_size       Size of the response buffer, in octets.
+*
+*               p_resp_len      Pointer to a variable that will receive the length of the response records.
+*
+*               p_key_c2s       Pointer to a buffer that will receive the client to server key
+*                               (SNTPc_NTS_KEY_LEN octets).
+*
+*               p_key_s2c       Pointer to a buffer that will receive the server to client key
+*                               (SNTPc_NTS_KEY_LEN octets).
+*
+* Return(s)   : DEF_OK,   if the exchange completed & the keys were exported.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_KE().
+*
+* Note(s)     : (1) The TLS session MUST use TLS 1.3 or later, verify the certificate of the server against
+*                   its hostname, & negotiate the ALPN protocol "ntske/1" (see RFC #8915, Section 4).
+*
+*               (2) The response records are read until the server closes the connection. A response larger
+*                   than the buffer MUST fail the exchange.
+*
+*               (3) The keys are exported with the TLS exporter (see RFC #8446, Section 7.5) :
+*
+*                   (a) Label   : "EXPORTER-network-time-security".
+*
+*                   (b) Context : 0x00 0x00 (NTPv4), 0x00 0x0F (AEAD_AES_SIV_CMAC_256), then 0x00 for the
+*                                 client to server key or 0x01 for the server to client key.
+*
+*                   (c) Length  : SNTPc_NTS_KEY_LEN octets.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_KE_Exchange (const CPU_CHAR      *p_hostname,
+                                          NET_PORT_NBR   port_nbr,
+                                    const CPU_INT08U    *p_req,
+                                          CPU_INT16U     req_len,
+                                          CPU_INT08U    *p_resp,
+                                          CPU_INT16U     resp_size,
+                                          CPU_INT16U    *p_resp_len,
+                                          CPU_INT08U    *p_key_c2s,
+                                          CPU_INT08U    *p_key_s2c)
+{
+    (void)&p_hostname;
+    (void)&port_nbr;
+    (void)&p_req;
+    (void)&req_len;
+    (void)&p_resp;
+    (void)&resp_size;
+    (void)&p_key_c2s;
+    (void)&p_key_s2c;
+
+   *p_resp_len = 0u;
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_AEAD_Seal()
+*
+* Description : Encrypt & authenticate with AEAD_AES_SIV_CMAC_256.
+*
+* Argument(s) : p_key       Pointer to the key (SNTPc_NTS_KEY_LEN octets).
+*
+*               p_nonce     Pointer to the nonce.
+*
+*               nonce_len   Length of the nonce, in octets.
+*
+*               p_ad        Pointer to the associated data.
+*
+*               ad_len      Length of the associated data, in octets.
+*
+*               p_pt        Pointer to the plaintext. May be DEF_NULL if the plaintext is empty.
+*
+*               pt_len      Length of the plaintext, in octets.
+*
+*               p_ct        Pointer to a buffer that will receive the ciphertext (pt_len + SNTPc_NTS_TAG_LEN
+*                           octets).
+*
+* Return(s)   : DEF_OK,   if the plaintext was encrypted.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_ReqBuild().
+*
+* Note(s)     : (1) The ciphertext is the synthetic IV (the authentication tag) followed by the encrypted
+*                   plaintext (see RFC #5297, Section 2.6). The nonce is the last component of the associated
+*                   data vector (see RFC #5297, Section 3).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_AEAD_Seal (const CPU_INT08U  *p_key,
+                                  const CPU_INT08U  *p_nonce,
+                                        CPU_INT16U   nonce_len,
+                                  const CPU_INT08U  *p_ad,
+                                        CPU_INT16U   ad_len,
+                                  const CPU_INT08U  *p_pt,
+                                        CPU_INT16U   pt_len,
+                                        CPU_INT08U  *p_ct)
+{
+    (void)&p_key;
+    (void)&p_nonce;
+    (void)&nonce_len;
+    (void)&p_ad;
+    (void)&ad_len;
+    (void)&p_pt;
+    (void)&pt_len;
+    (void)&p_ct;
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_AEAD_Open()
+*
+* Description : Authenticate & decrypt with AEAD_AES_SIV_CMAC_256.
+*
+* Argument(s) : p_key       Pointer to the key (SNTPc_NTS_KEY_LEN octets).
+*
+*               p_nonce     Pointer to the nonce.
+*
+*               nonce_len   Length of the nonce, in octets.
+*
+*               p_ad        Pointer to the associated data.
+*
+*               ad_len      Length of the associated data, in octets.
+*
+*               p_ct        Pointer to the ciphertext.
+*
+*               ct_len      Length of the ciphertext, in octets.
+*
+*               p_pt        Pointer to a buffer that will receive the plaintext (ct_len - SNTPc_NTS_TAG_LEN
+*                           octets).
+*
+* Return(s)   : DEF_OK,   if the ciphertext is authentic.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_RespParse().
+*
+* Note(s)     : (1) See SNTPc_NTS_AEAD_Seal() Note #1. The tag MUST be compared in constant time.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_AEAD_Open (const CPU_INT08U  *p_key,
+                                  const CPU_INT08U  *p_nonce,
+                                        CPU_INT16U   nonce_len,
+                                  const CPU_INT08U  *p_ad,
+                                        CPU_INT16U   ad_len,
+                                  const CPU_INT08U  *p_ct,
+                                        CPU_INT16U   ct_len,
+                                        CPU_INT08U  *p_pt)
+{
+    (void)&p_key;
+    (void)&p_nonce;
+    (void)&nonce_len;
+    (void)&p_ad;
+    (void)&ad_len;
+    (void)&p_ct;
+    (void)&ct_len;
+    (void)&p_pt;
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_NTS_RandGet()
+*
+* Description : Get cryptographically secure random octets.
+*
+* Argument(s) : p_buf       Pointer to the buffer that will receive the random octets.
+*
+*               len         Number of random octets.
+*
+* Return(s)   : DEF_OK,   if the buffer was filled.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeNTS(),
+*               SNTPc_NTS_ReqBuild().
+*
+* Note(s)     : (1) The octets are used as unique identifiers, nonces & origin timestamps. They MUST come from
+*                   a cryptographically secure generator (e.g. a seeded DRBG or a true random generator of the
+*                   CPU).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_RandGet (CPU_INT08U  *p_buf,
+                                CPU_INT16U   len)
+{
+    (void)&p_buf;
+    (void)&len;
+
+    return (DEF_FAIL);
+}
+#endif
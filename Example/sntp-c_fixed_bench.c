@@ -0,0 +1,314 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                               EXAMPLE
+*
+*                                             SNTP CLIENT
+*
+* Filename : sntp-c_fixed_bench.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This example shows how to compare the cost of the 32.32 fixed-point round trip delay of
+*                SNTPc_GetRoundTripDly_us() & offset of SNTPc_PktDecode() with the CPU_FP64 computations
+*                they replaced, on the same packet.
+*
+*            (2) The execution time is measured with the CPU timestamp of uC/CPU : CPU_CFG_TS_32_EN MUST be
+*                enabled in 'cpu_cfg.h'.
+*
+*            (3) The code size is compared in the linker map : the size of SNTPc_GetRoundTripDly_us() &
+*                SNTPc_PktDecode() against the size of App_SNTPc_FixedBenchDlyFP64_us(),
+*                App_SNTPc_FixedBenchOffsetFP64_us() & of the double-precision floating-point library
+*                functions they pull in (e.g. __aeabi_dadd(), __aeabi_ddiv() & __aeabi_d2lz() on an ARM
+*                Cortex-M without FPU).
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <Source/sntp-c.h>
+#include  <sntp-c_cfg.h>
+#include  <Source/net_util.h>
+#include  <cpu_core.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE  4294967296.0   /* Equivalent to 2^32.                                  */
+
+
+/*
+*********************************************************************************************************
+*                                  App_SNTPc_FixedBenchDlyFP64_us()
+*
+* Description : Compute the round trip delay of a packet with CPU_FP64, as SNTPc_GetRoundTripDly_us() did
+*               before the 32.32 fixed-point arithmetic.
+*
+* Argument(s) : ppkt        Pointer to the received packet.
+*
+* Return(s)   : Round trip delay, in microseconds.
+*
+* Caller(s)   : App_SNTPc_FixedBench().
+*
+* Note(s)     : (1) Only the integer part of the round trip delay is returned.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  App_SNTPc_FixedBenchDlyFP64_us (SNTP_PKT  *ppkt)
+{
+    CPU_FP64  ts_originate;
+    CPU_FP64  ts_rx;
+    CPU_FP64  ts_tx;
+    CPU_FP64  ts_terminate;
+    CPU_FP64  round_trip_dly;
+
+
+    ts_originate   = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Sec)  +
+                     (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Frac) /
+                      APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_rx          = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Sec)         +
+                     (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Frac)        /
+                      APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_tx          = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Sec)         +
+                     (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Frac)        /
+                      APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_terminate   = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Sec)        +
+                     (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Frac)       /
+                      APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    round_trip_dly = ((ts_terminate - ts_originate) -
+                      (ts_tx        - ts_rx)) * 1000000.0;
+
+    return ((CPU_INT32U)round_trip_dly);                        /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                 App_SNTPc_FixedBenchOffsetFP64_us()
+*
+* Description : Compute the offset of the server clock from the local clock with CPU_FP64, as
+*               SNTPc_GetRemoteTime() did before the 32.32 fixed-point arithmetic.
+*
+* Argument(s) : ppkt        Pointer to the received packet.
+*
+* Return(s)   : Offset, in microseconds.
+*
+* Caller(s)   : App_SNTPc_FixedBench().
+*
+* Note(s)     : (1) Only the integer part of the offset is returned, truncated toward zero.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64S  App_SNTPc_FixedBenchOffsetFP64_us (SNTP_PKT  *ppkt)
+{
+    CPU_FP64  ts_originate;
+    CPU_FP64  ts_rx;
+    CPU_FP64  ts_tx;
+    CPU_FP64  ts_terminate;
+    CPU_FP64  offset;
+
+
+    ts_originate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Sec)  +
+                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Frac) /
+                    APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_rx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Sec)         +
+                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Frac)        /
+                    APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_tx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Sec)         +
+                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Frac)        /
+                    APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    ts_terminate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Sec)        +
+                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Frac)       /
+                    APP_SNTPc_FIXED_BENCH_TS_SEC_FRAC_SIZE;
+
+    offset       = (((ts_rx - ts_originate) +
+                     (ts_tx - ts_terminate)) / 2.0) * 1000000.0;
+
+    return ((CPU_INT64S)offset);                                /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_FixedBenchAvg_ns()
+*
+* Description : Convert the CPU timestamp ticks of several computations to the average time of one.
+*
+* Argument(s) : ts          Number of CPU timestamp ticks of all the computations.
+*
+*               freq        Frequency of the CPU timestamp timer, in Hz.
+*
+*               iter_nbr    Number of computations.
+*
+* Return(s)   : Average time of a computation, in nanoseconds.
+*
+* Caller(s)   : App_SNTPc_FixedBench().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  App_SNTPc_FixedBenchAvg_ns (CPU_TS32         ts,
+                                                CPU_TS_TMR_FREQ  freq,
+                                                CPU_INT32U       iter_nbr)
+{
+    return ((CPU_INT32U)(((CPU_INT64U)ts * DEF_TIME_NBR_nS_PER_SEC) / ((CPU_INT64U)freq * iter_nbr)));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_SNTPc_FixedBench()
+*
+* Description : Measure the average execution time of the fixed-point & of the CPU_FP64 round trip delay &
+*               offset of a packet.
+*
+* Argument(s) : ppkt                Pointer to a packet received by SNTPc_ReqRemoteTime().
+*
+*               iter_nbr            Number of computations to time.
+*
+*               p_dly_fixed_ns      Pointer to the variable that will receive the average time of the
+*                                   fixed-point round trip delay, in nanoseconds.
+*
+*               p_dly_fp64_ns       Pointer to the variable that will receive the average time of the
+*                                   CPU_FP64 round trip delay, in nanoseconds.
+*
+*               p_offset_fixed_ns   Pointer to the variable that will receive the average time of the
+*                                   fixed-point offset, in nanoseconds (see Note #3).
+*
+*               p_offset_fp64_ns    Pointer to the variable that will receive the average time of the
+*                                   CPU_FP64 offset, in nanoseconds.
+*
+* Return(s)   : DEF_FAIL,   Null number of iterations, invalid packet or results differing by more than 1 us.
+*               DEF_OK,     Operation is successful.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : (1) The CPU_FP64 results are truncated after a rounded floating-point computation & the
+*                   fixed-point ones are truncated from the exact values : they may differ by 1 microsecond.
+*
+*               (2) The loop overhead is included in all the times.
+*
+*               (3) The fixed-point offset is timed through SNTPc_PktDecode(), which also decodes the round
+*                   trip delay & the header of the packet : its time is an upper bound of the offset's.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  App_SNTPc_FixedBench (SNTP_PKT    *ppkt,
+                                   CPU_INT32U   iter_nbr,
+                                   CPU_INT32U  *p_dly_fixed_ns,
+                                   CPU_INT32U  *p_dly_fp64_ns,
+                                   CPU_INT32U  *p_offset_fixed_ns,
+                                   CPU_INT32U  *p_offset_fp64_ns)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          cpu_err;
+    SNTPc_ERR        sntp_err;
+    SNTPc_SAMPLE     sample;
+    CPU_TS32         ts_start;
+    CPU_TS32         dly_fixed_ts;
+    CPU_TS32         dly_fp64_ts;
+    CPU_TS32         offset_fixed_ts;
+    CPU_TS32         offset_fp64_ts;
+    CPU_INT32U       dly_fixed_us;
+    CPU_INT32U       dly_fp64_us;
+    CPU_INT64S       offset_fixed_us;
+    CPU_INT64S       offset_fp64_us;
+    CPU_INT32U       ix;
+
+
+    if (iter_nbr == 0u) {
+        return (DEF_FAIL);
+    }
+
+    freq = CPU_TS_TmrFreqGet(&cpu_err);
+    if ((cpu_err != CPU_ERR_NONE) ||
+        (freq    == 0u)) {
+        return (DEF_FAIL);
+    }
+                                                                /* -------------- CHECK THE TWO RESULTS --------------- */
+    dly_fixed_us = SNTPc_GetRoundTripDly_us(ppkt, &sntp_err);
+    if (sntp_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+    dly_fp64_us  = App_SNTPc_FixedBenchDlyFP64_us(ppkt);
+    if ((DEF_MAX(dly_fixed_us, dly_fp64_us) -                   /* See Note #1.                                         */
+         DEF_MIN(dly_fixed_us, dly_fp64_us)) > 1u) {
+        return (DEF_FAIL);
+    }
+
+    SNTPc_PktDecode(ppkt, &sample, &sntp_err);
+    if (sntp_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+    offset_fixed_us = sample.Offset_ns / 1000;
+    offset_fp64_us  = App_SNTPc_FixedBenchOffsetFP64_us(ppkt);
+    if ((DEF_MAX(offset_fixed_us, offset_fp64_us) -
+         DEF_MIN(offset_fixed_us, offset_fp64_us)) > 1) {
+        return (DEF_FAIL);
+    }
+                                                                /* -------------- TIME FIXED-POINT DLY ---------------- */
+    ts_start        = CPU_TS_Get32();
+    for (ix = 0u; ix < iter_nbr; ix++) {
+        (void)SNTPc_GetRoundTripDly_us(ppkt, &sntp_err);
+    }
+    dly_fixed_ts    = CPU_TS_Get32() - ts_start;
+                                                                /* ---------------- TIME CPU_FP64 DLY ----------------- */
+    ts_start        = CPU_TS_Get32();
+    for (ix = 0u; ix < iter_nbr; ix++) {
+        (void)App_SNTPc_FixedBenchDlyFP64_us(ppkt);
+    }
+    dly_fp64_ts     = CPU_TS_Get32() - ts_start;
+                                                                /* ------------ TIME FIXED-POINT OFFSET --------------- */
+    ts_start        = CPU_TS_Get32();
+    for (ix = 0u; ix < iter_nbr; ix++) {                        /* See Note #3.                                         */
+        SNTPc_PktDecode(ppkt, &sample, &sntp_err);
+    }
+    offset_fixed_ts = CPU_TS_Get32() - ts_start;
+                                                                /* --------------- TIME CPU_FP64 OFFSET --------------- */
+    ts_start        = CPU_TS_Get32();
+    for (ix = 0u; ix < iter_nbr; ix++) {
+        (void)App_SNTPc_FixedBenchOffsetFP64_us(ppkt);
+    }
+    offset_fp64_ts  = CPU_TS_Get32() - ts_start;
+                                                                /* See Note #2.                                         */
+   *p_dly_fixed_ns    = App_SNTPc_FixedBenchAvg_ns(dly_fixed_ts,    freq, iter_nbr);
+   *p_dly_fp64_ns     = App_SNTPc_FixedBenchAvg_ns(dly_fp64_ts,     freq, iter_nbr);
+   *p_offset_fixed_ns = App_SNTPc_FixedBenchAvg_ns(offset_fixed_ts, freq, iter_nbr);
+   *p_offset_fp64_ns  = App_SNTPc_FixedBenchAvg_ns(offset_fp64_ts,  freq, iter_nbr);
+
+    return (DEF_OK);
+}
@@ -0,0 +1,167 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                               EXAMPLE
+*
+*                                             SNTP CLIENT
+*
+* Filename : sntp-c_lock_bench.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This example shows how to measure the number of SNTPc_ReqRemoteTime() requests completed
+*                per second by several tasks at once, to check that concurrent requests are not serialized
+*                by the module lock.
+*
+*            (2) The requests MUST be sent to a NTP server of the local network run for the measurement : a
+*                public server would rate limit the requests & reply with Kiss-o'-Death packets.
+*
+*            (3) The measurement is repeated with 1, 2, 4, ... tasks. The number of requests per second
+*                SHOULD grow with the number of tasks, until the network or the server is saturated.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <Source/sntp-c.h>
+#include  <sntp-c_cfg.h>
+#include  <Source/net_util.h>
+#include  <KAL/kal.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct app_sntpc_lock_bench_task {
+    const     SNTPc_CFG   *CfgPtr;                              /* Cfg of the server, DEF_NULL for the dflt cfg.        */
+    volatile  CPU_INT32U   ReqNbr;                              /* Nbr of completed requests.                           */
+} APP_SNTPc_LOCK_BENCH_TASK;
+
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_LockBenchTask()
+*
+* Description : Send SNTP requests continuously & count the completed ones.
+*
+* Argument(s) : p_arg   Pointer to the APP_SNTPc_LOCK_BENCH_TASK of the task.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The tasks MUST be created by the application with KAL_TaskCreate(), each with its own
+*                   APP_SNTPc_LOCK_BENCH_TASK, at the same priority, lower than the priority of the task
+*                   calling App_SNTPc_LockBench().
+*
+*               (2) The failed requests are not counted.
+*********************************************************************************************************
+*/
+
+void  App_SNTPc_LockBenchTask (void  *p_arg)
+{
+    APP_SNTPc_LOCK_BENCH_TASK  *p_task;
+    SNTP_PKT                    pkt;
+    SNTPc_ERR                   sntp_err;
+    CPU_BOOLEAN                 ok;
+
+
+    p_task = (APP_SNTPc_LOCK_BENCH_TASK *)p_arg;
+
+    while (DEF_ON) {
+        ok = SNTPc_ReqRemoteTime(p_task->CfgPtr, &pkt, &sntp_err);
+        if (ok == DEF_OK) {                                     /* See Note #2.                                         */
+            p_task->ReqNbr++;
+        } else {
+            KAL_Dly(1u);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_SNTPc_LockBench()
+*
+* Description : Count the SNTP requests completed by the requesting tasks during a given time.
+*
+* Argument(s) : p_task_tbl      Table of the APP_SNTPc_LOCK_BENCH_TASK of the requesting tasks.
+*
+*               task_nbr        Number of requesting tasks.
+*
+*               dur_ms          Duration of the measurement, in milliseconds.
+*
+*               p_req_per_sec   Pointer to the variable that will receive the number of requests per second.
+*
+* Return(s)   : DEF_FAIL,   Null number of tasks or null duration.
+*               DEF_OK,     Operation is successful.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : (1) The counters are read at the start & at the end of the measurement, while the tasks run.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  App_SNTPc_LockBench (APP_SNTPc_LOCK_BENCH_TASK  *p_task_tbl,
+                                  CPU_INT32U                  task_nbr,
+                                  CPU_INT32U                  dur_ms,
+                                  CPU_INT32U                 *p_req_per_sec)
+{
+    NET_TS_MS   ts_start;
+    NET_TS_MS   elapsed_ms;
+    CPU_INT32U  req_nbr_start;
+    CPU_INT32U  req_nbr;
+    CPU_INT32U  ix;
+
+
+    if ((task_nbr == 0u) ||
+        (dur_ms   == 0u)) {
+        return (DEF_FAIL);
+    }
+                                                                /* See Note #1.                                         */
+    req_nbr_start = 0u;
+    for (ix = 0u; ix < task_nbr; ix++) {
+        req_nbr_start += p_task_tbl[ix].ReqNbr;
+    }
+    ts_start = NetUtil_TS_Get_ms();
+
+    KAL_Dly(dur_ms);
+
+    req_nbr = 0u;
+    for (ix = 0u; ix < task_nbr; ix++) {
+        req_nbr += p_task_tbl[ix].ReqNbr;
+    }
+    elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+    if (elapsed_ms == 0u) {
+        return (DEF_FAIL);
+    }
+
+   *p_req_per_sec = (CPU_INT32U)(((CPU_INT64U)(req_nbr - req_nbr_start) * 1000u) / elapsed_ms);
+
+    return (DEF_OK);
+}
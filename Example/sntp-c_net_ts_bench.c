@@ -0,0 +1,245 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                               EXAMPLE
+*
+*                                             SNTP CLIENT
+*
+* Filename : sntp-c_net_ts_bench.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This example shows how to compare the offsets & round trip delays measured with the
+*                network layer timestamps of SNTPc_NetTS_TxGet() & SNTPc_NetTS_RxGet() against the ones
+*                measured with the timestamps taken by the SNTP client itself, on the same server.
+*
+*            (2) SNTPc_CFG_NET_TS_EN MUST be enabled in 'sntp-c_cfg.h' & the network driver MUST report the
+*                captured times to 'sntp-c_net_ts.c'. The timestamps of the SNTP client are obtained by
+*                withholding the captured times with App_SNTPc_NetTS_OffSet().
+*
+*            (3) The requests MUST be sent to a NTP server of the local network run for the measurement : a
+*                public server would rate limit the requests & reply with Kiss-o'-Death packets.
+*
+*            (4) The network layer timestamps exclude the delays of the network stack & of the task
+*                scheduling : the round trip delays SHOULD be shorter & the offsets SHOULD spread less with
+*                the timestamps on.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <Source/sntp-c.h>
+#include  <sntp-c_cfg.h>
+#include  <KAL/kal.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct app_sntpc_net_ts_bench_result {
+    CPU_INT32U  ReqNbr;                                         /* Nbr of successful requests.                          */
+    CPU_INT64S  OffsetMin_us;
+    CPU_INT64S  OffsetMax_us;
+    CPU_INT64S  OffsetAvg_us;
+    CPU_INT64S  DlyMin_us;
+    CPU_INT64S  DlyMax_us;
+    CPU_INT64S  DlyAvg_us;
+} APP_SNTPc_NET_TS_BENCH_RESULT;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NET_TS_EN == DEF_ENABLED)
+                                                                /* See 'sntp-c_net_ts.c'.                               */
+void                 App_SNTPc_NetTS_OffSet   (      CPU_BOOLEAN                     is_off);
+
+static  CPU_BOOLEAN  App_SNTPc_NetTS_BenchReq (const SNTPc_CFG                      *p_cfg,
+                                                     CPU_BOOLEAN                     is_off,
+                                                     APP_SNTPc_NET_TS_BENCH_RESULT  *p_result,
+                                                     CPU_INT64S                     *p_offset_sum_us,
+                                                     CPU_INT64S                     *p_dly_sum_us);
+
+
+/*
+*********************************************************************************************************
+*                                       App_SNTPc_NetTS_Bench()
+*
+* Description : Measure the offsets & round trip delays of a server with the network layer timestamps on &
+*               off.
+*
+* Argument(s) : p_cfg           Pointer to the configuration of the server, DEF_NULL for the default one.
+*
+*               req_nbr         Number of requests sent with the timestamps on, & as many with them off.
+*
+*               interval_ms     Interval between the requests, in milliseconds.
+*
+*               p_result_on     Pointer to the variable that will receive the results with the network layer
+*                               timestamps.
+*
+*               p_result_off    Pointer to the variable that will receive the results with the timestamps of
+*                               the SNTP client.
+*
+* Return(s)   : DEF_FAIL,   Null number of requests, or no successful request with the timestamps on or off.
+*               DEF_OK,     Operation is successful.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : (1) The requests with the timestamps on & off alternate, so that both sets see the same
+*                   network load & the same drift of the local clock.
+*
+*               (2) The network layer timestamps are provided again before returning.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  App_SNTPc_NetTS_Bench (const SNTPc_CFG                      *p_cfg,
+                                          CPU_INT32U                      req_nbr,
+                                          CPU_INT32U                      interval_ms,
+                                          APP_SNTPc_NET_TS_BENCH_RESULT  *p_result_on,
+                                          APP_SNTPc_NET_TS_BENCH_RESULT  *p_result_off)
+{
+    CPU_INT64S  offset_sum_on_us;
+    CPU_INT64S  offset_sum_off_us;
+    CPU_INT64S  dly_sum_on_us;
+    CPU_INT64S  dly_sum_off_us;
+    CPU_INT32U  ix;
+
+
+    if (req_nbr == 0u) {
+        return (DEF_FAIL);
+    }
+
+    p_result_on->ReqNbr  = 0u;
+    p_result_off->ReqNbr = 0u;
+    offset_sum_on_us     = 0;
+    offset_sum_off_us    = 0;
+    dly_sum_on_us        = 0;
+    dly_sum_off_us       = 0;
+
+    for (ix = 0u; ix < req_nbr; ix++) {                         /* See Note #1.                                         */
+        (void)App_SNTPc_NetTS_BenchReq(p_cfg, DEF_NO,  p_result_on,  &offset_sum_on_us,  &dly_sum_on_us);
+        KAL_Dly(interval_ms);
+        (void)App_SNTPc_NetTS_BenchReq(p_cfg, DEF_YES, p_result_off, &offset_sum_off_us, &dly_sum_off_us);
+        KAL_Dly(interval_ms);
+    }
+
+    App_SNTPc_NetTS_OffSet(DEF_NO);                             /* See Note #2.                                         */
+
+    if ((p_result_on->ReqNbr  == 0u) ||
+        (p_result_off->ReqNbr == 0u)) {
+        return (DEF_FAIL);
+    }
+
+    p_result_on->OffsetAvg_us  = offset_sum_on_us  / (CPU_INT64S)p_result_on->ReqNbr;
+    p_result_on->DlyAvg_us     = dly_sum_on_us     / (CPU_INT64S)p_result_on->ReqNbr;
+    p_result_off->OffsetAvg_us = offset_sum_off_us / (CPU_INT64S)p_result_off->ReqNbr;
+    p_result_off->DlyAvg_us    = dly_sum_off_us    / (CPU_INT64S)p_result_off->ReqNbr;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_NetTS_BenchReq()
+*
+* Description : Send a request & add its offset & round trip delay to the results.
+*
+* Argument(s) : p_cfg               Pointer to the configuration of the server, DEF_NULL for the default one.
+*
+*               is_off              DEF_YES, to withhold the network layer timestamps.
+*
+*                                   DEF_NO,  to use them.
+*
+*               p_result            Pointer to the results to update.
+*
+*               p_offset_sum_us     Pointer to the sum of the offsets to update, in microseconds.
+*
+*               p_dly_sum_us        Pointer to the sum of the round trip delays to update, in microseconds.
+*
+* Return(s)   : DEF_OK,   if the request succeeded.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : App_SNTPc_NetTS_Bench().
+*
+* Note(s)     : (1) The failed requests are not counted.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  App_SNTPc_NetTS_BenchReq (const SNTPc_CFG                      *p_cfg,
+                                                     CPU_BOOLEAN                     is_off,
+                                                     APP_SNTPc_NET_TS_BENCH_RESULT  *p_result,
+                                                     CPU_INT64S                     *p_offset_sum_us,
+                                                     CPU_INT64S                     *p_dly_sum_us)
+{
+    SNTP_PKT      pkt;
+    SNTPc_SAMPLE  sample;
+    SNTPc_ERR     sntp_err;
+    CPU_INT64S    offset_us;
+    CPU_INT64S    dly_us;
+    CPU_BOOLEAN   ok;
+
+
+    App_SNTPc_NetTS_OffSet(is_off);
+
+    ok = SNTPc_ReqRemoteTime(p_cfg, &pkt, &sntp_err);
+    if (ok != DEF_OK) {                                         /* See Note #1.                                         */
+        return (DEF_FAIL);
+    }
+    SNTPc_PktDecode(&pkt, &sample, &sntp_err);
+    if (sntp_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    offset_us = sample.Offset_ns       / 1000;
+    dly_us    = sample.RoundTripDly_ns / 1000;
+
+    if (p_result->ReqNbr == 0u) {
+        p_result->OffsetMin_us = offset_us;
+        p_result->OffsetMax_us = offset_us;
+        p_result->DlyMin_us    = dly_us;
+        p_result->DlyMax_us    = dly_us;
+    } else {
+        p_result->OffsetMin_us = DEF_MIN(p_result->OffsetMin_us, offset_us);
+        p_result->OffsetMax_us = DEF_MAX(p_result->OffsetMax_us, offset_us);
+        p_result->DlyMin_us    = DEF_MIN(p_result->DlyMin_us,    dly_us);
+        p_result->DlyMax_us    = DEF_MAX(p_result->DlyMax_us,    dly_us);
+    }
+   *p_offset_sum_us += offset_us;
+   *p_dly_sum_us    += dly_us;
+    p_result->ReqNbr++;
+
+    return (DEF_OK);
+}
+#endif
@@ -0,0 +1,145 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                               EXAMPLE
+*
+*                                             SNTP CLIENT
+*
+* Filename : sntp-c_now.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This example shows how to measure the number of SNTPc_Now() reads per second while the
+*                disciplined clock is updated by another task.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <Source/sntp-c.h>
+#include  <sntp-c_cfg.h>
+#include  <Source/net_util.h>
+#include  <KAL/kal.h>
+
+
+/*
+*********************************************************************************************************
+*                                     App_SNTPc_NowUpdaterTask()
+*
+* Description : Update the disciplined clock continuously, to load the readers of SNTPc_Now().
+*
+* Argument(s) : p_arg   Argument passed to the task (unused).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The task MUST be created by the application with KAL_TaskCreate(), at a higher priority
+*                   than the task calling App_SNTPc_NowBench(), after the clock is set.
+*
+*               (2) The clock is updated with its own time, so that the updates never step the clock.
+*********************************************************************************************************
+*/
+
+void  App_SNTPc_NowUpdaterTask (void  *p_arg)
+{
+    SNTP_TS    ts;
+    SNTPc_ERR  sntp_err;
+
+
+    (void)&p_arg;
+
+    while (DEF_ON) {
+        ts = SNTPc_Now(&sntp_err);                              /* See Note #2.                                         */
+        if (sntp_err == SNTPc_ERR_NONE) {
+            (void)SNTPc_ClkUpdate(ts, 4u, &sntp_err);
+        }
+        KAL_Dly(1u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_SNTPc_NowBench()
+*
+* Description : Count the SNTPc_Now() reads performed during a given time.
+*
+* Argument(s) : dur_ms          Duration of the measurement, in milliseconds.
+*
+*               p_rd_per_sec    Pointer to the variable that will receive the number of reads per second.
+*
+* Return(s)   : DEF_FAIL,   Null duration, clock not set or time read backwards.
+*               DEF_OK,     Operation is successful.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : (1) The clock is not stepped by App_SNTPc_NowUpdaterTask(), so each read MUST return a time
+*                   later than or equal to the previous one.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  App_SNTPc_NowBench (CPU_INT32U   dur_ms,
+                                 CPU_INT32U  *p_rd_per_sec)
+{
+    SNTP_TS     ts;
+    SNTP_TS     ts_prev;
+    SNTPc_ERR   sntp_err;
+    NET_TS_MS   ts_start;
+    NET_TS_MS   elapsed_ms;
+    CPU_INT64U  rd_nbr;
+
+
+    if (dur_ms == 0u) {
+        return (DEF_FAIL);
+    }
+
+    ts_prev = SNTPc_Now(&sntp_err);
+    if (sntp_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    rd_nbr   = 0u;
+    ts_start = NetUtil_TS_Get_ms();
+    do {
+        ts = SNTPc_Now(&sntp_err);
+        if (sntp_err != SNTPc_ERR_NONE) {
+            return (DEF_FAIL);
+        }
+                                                                /* See Note #1.                                         */
+        if ((CPU_INT32S)(ts.Sec - ts_prev.Sec) < 0) {
+            return (DEF_FAIL);
+        }
+        if ((ts.Sec  == ts_prev.Sec ) &&
+            (ts.Frac <  ts_prev.Frac)) {
+            return (DEF_FAIL);
+        }
+        ts_prev = ts;
+        rd_nbr++;
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+    } while (elapsed_ms < dur_ms);
+
+   *p_rd_per_sec = (CPU_INT32U)((rd_nbr * 1000u) / elapsed_ms);
+
+    return (DEF_OK);
+}
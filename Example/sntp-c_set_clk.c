@@ -53,7 +53,9 @@
 *
 * Caller(s)   : none.
 *
-* Note(s)     : none.
+* Note(s)     : (1) NTP timestamps wrap around on 2036-02-07. The era of the timestamp is resolved by
+*                   SNTPc_TS_ToTime64() & the clock is set from the Unix time, which uC/CLK supports beyond
+*                   2036.
 *
 *********************************************************************************************************
 */
@@ -63,6 +65,7 @@ CPU_BOOLEAN App_SNTPc_SetClk (SNTPc_CFG *p_sntp_cfg)
     SNTP_TS         ntp_ts;
     SNTP_PKT        sntp_pkt;
     SNTPc_ERR       sntp_err;
+    CPU_INT64S      unix_sec;
     CPU_BOOLEAN     ret_val;
 
                                                                 /* ----------- REQUEST TS FROM SNTP SERVER ------------ */
@@ -76,9 +79,15 @@ CPU_BOOLEAN App_SNTPc_SetClk (SNTPc_CFG *p_sntp_cfg)
     ntp_ts = SNTPc_GetRemoteTime(&sntp_pkt, &sntp_err);         /* Get the local time from the received SNTP message... */
     if (sntp_err != SNTPc_ERR_NONE) {                           /* ...packet in the form of an NTP time stamp.          */
         return (DEF_FAIL);
+    }
+                                                                /* Resolve the NTP era (see Note #1).                   */
+    unix_sec = SNTPc_TS_ToTime64(ntp_ts) - SNTPc_UNIX_EPOCH_NTP_SEC;
+    if ((unix_sec < 0) ||
+        (unix_sec > DEF_INT_32U_MAX_VAL)) {
+        return (DEF_FAIL);
     }
                                                                 /* --------------------- SET CLK ---------------------- */
-    ret_val = Clk_SetTS_NTP(ntp_ts.Sec);                        /* Set the local time using uC/CLK.                     */
+    ret_val = Clk_SetTS_Unix((CLK_TS_SEC)unix_sec);             /* Set the local time using uC/CLK.                     */
     if (ret_val == DEF_FAIL) {
         return (DEF_FAIL);
     }
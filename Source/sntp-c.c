@@ -35,11 +35,29 @@
 #define    MICRIUM_SOURCE
 #define    SNTPc_MODULE
 #include  "sntp-c.h"
+#include  "sntp-c_sel.h"
+#include  "sntp-c_filter.h"
+#include  "sntp-c_drift.h"
+#include  "sntp-c_clk.h"
+#include  "sntp-c_fixed.h"
+#include  "sntp-c_nts.h"
+#include  "sntp-c_stat.h"
+#include  "sntp-c_trace.h"
 #include  <Source/net_sock.h>
 #include  <Source/net_ascii.h>
 #include  <Source/net_app.h>
 #include  <Source/net_util.h>
 #include  <KAL/kal.h>
+#include  <lib_math.h>
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+#ifdef   NET_IGMP_MODULE_EN
+#include  <IP/IPv4/net_igmp.h>
+#endif
+#ifdef   NET_MLDP_MODULE_EN
+#include  <IP/IPv6/net_mldp.h>
+#endif
+#endif
 
 
 /*
@@ -50,10 +68,388 @@
 *********************************************************************************************************
 */
 
-#define SNTP_TS_SEC_FRAC_SIZE       4294967296u                   /* Equivalent to 2^32.                                */
-
 #define SNTP_MS_NBR_PER_SEC         1000u                         /* Nb of ms in a second.                              */
 
+                                                                /* Resolution of SNTPc_ClkLocalGet().                   */
+#define SNTPc_LOCAL_TS_RESOLUTION_US    ((SNTPc_CLK_LOCAL_RES_NS + 999u) / 1000u)
+
+#define SNTPc_SOCK_RX_TIMEOUT_UNKNOWN    DEF_INT_32U_MAX_VAL      /* Rx timeout not yet cfg'd on the sock.              */
+
+#define SNTPc_MUX_LOCK_NAME             "SNTPc Mux Lock"
+#define SNTPc_MUX_SOCK_NBR                  2u                    /* One shared sock per addr family.                   */
+#define SNTPc_MUX_RX_SLICE_MS              10u                    /* Max time a task rx's on the shared socks at once.  */
+                                                                  /* Hash table bucket of a nonce.                      */
+#define SNTPc_MUX_REQ_HASH(p_nonce)     (((p_nonce)->Sec ^ (p_nonce)->Frac) % SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX)
+
+#define SNTPc_ADDR_CACHE_TTL_MS         (SNTPc_CFG_ADDR_CACHE_TTL_SEC     * SNTP_MS_NBR_PER_SEC)
+#define SNTPc_ADDR_CACHE_REFRESH_MS     (SNTPc_CFG_ADDR_CACHE_REFRESH_SEC * SNTP_MS_NBR_PER_SEC)
+
+#define SNTPc_TASK_NAME                 "SNTPc Task"
+#define SNTPc_REQ_Q_NAME                "SNTPc Req Q"
+#define SNTPc_TASK_PERIOD_MS            (SNTPc_ADDR_CACHE_REFRESH_MS / 2u)
+
+#define SNTPc_SYNC_POLL_MS(exp)         (DEF_BIT32(exp) * SNTP_MS_NBR_PER_SEC)
+#define SNTPc_SYNC_POLL_GATE                4                     /* Poll-adjust gate (see RFC #5905, Appendix A.5.5.6).  */
+#define SNTPc_SYNC_POLL_LIMIT              30                     /* Poll-adjust thresh.                                */
+
+#define SNTPc_BCAST_TASK_NAME           "SNTPc Bcast Task"
+#define SNTPc_BCAST_SEM_NAME            "SNTPc Bcast Sem"
+#define SNTPc_BCAST_RX_TIMEOUT_MS        1000u                    /* Max time to notice the bcast client was stopped.   */
+#define SNTPc_BCAST_RETRY_DLY_MS        10000u                    /* Dly before a failed listener is opened again.      */
+#define SNTPc_BCAST_CAL_PERIOD_MS       (SNTPc_CFG_BCAST_CAL_PERIOD_SEC * SNTP_MS_NBR_PER_SEC)
+#define SNTPc_BCAST_POLL_EXP_MIN            4u                    /* Poll exp limits of a broadcast server.             */
+#define SNTPc_BCAST_POLL_EXP_MAX           17u
+
+#define SNTPc_IPv4_MCAST_MASK           0xF0000000u               /* IPv4 multicast addrs are 224.0.0.0/4.              */
+#define SNTPc_IPv4_MCAST_PREFIX         0xE0000000u
+#define SNTPc_IPv6_MCAST_PREFIX           0xFFu                   /* IPv6 multicast addrs are ff00::/8.                 */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    SOCKET POOL ENTRY STATE DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef enum sntpc_sock_state {
+    SNTPc_SOCK_STATE_FREE,                                      /* Entry not assigned to any server.                    */
+    SNTPc_SOCK_STATE_OPEN,                                      /* Sock open & ready to be reused.                      */
+    SNTPc_SOCK_STATE_CLOSED                                     /* Sock closed after an err, must be re-opened.         */
+} SNTPc_SOCK_STATE;
+
+
+/*
+*********************************************************************************************************
+*                                       SOCKET POOL ENTRY DATA TYPE
+*
+* Note(s) : (1) An entry is identified by the server hostname, port number & address family.
+*
+*           (2) Temporary entries are used when the server hostname is too long to be kept in the pool or
+*               when all the entries are in use. Their socket is closed at the end of each request.
+*
+*           (3) An entry in use is owned by a single request. Its socket & Rx timeout are accessed by that
+*               request without the module lock. All the other fields are protected by the module lock.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_sock_entry {
+    SNTPc_SOCK_STATE       State;
+    CPU_BOOLEAN            IsPooled;                            /* See Note #2.                                         */
+    CPU_BOOLEAN            IsInUse;                             /* See Note #3.                                         */
+    CPU_BOOLEAN            IsFlushed;                           /* Pool flushed while the entry was in use.             */
+    CPU_CHAR               Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR           PortNbr;
+    NET_SOCK_ADDR_FAMILY   AddrFamily;
+    NET_SOCK_ID            SockID;
+    CPU_INT32U             RxTimeout_ms;                        /* Rx timeout currently cfg'd on the sock.              */
+} SNTPc_SOCK_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                    REQUEST TRANSMIT TIMESTAMP DATA TYPE
+*
+* Note(s) : (1) The transmit timestamp sent in the request is echoed by the server in the originate timestamp
+*               of its reply & identifies the request the reply answers.
+*
+*           (2) The local time at which the request was sent (T1) is the transmit timestamp, or the time at
+*               which the network layer transmitted the request, if available (see SNTPc_TxTS_Apply()).
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_tx_ts {
+    SNTP_TS        Pkt;                                         /* Transmit timestamp, in network order (see Note #1).  */
+    SNTP_FIXED_TS  Local;                                       /* See Note #2.                                         */
+} SNTPc_TX_TS;
+
+
+/*
+*********************************************************************************************************
+*                                   SHARED SOCKET REQUEST DATA TYPES
+*
+* Note(s) : (1) A request sent on a shared socket is identified by a random transmit timestamp (nonce), which
+*               the server echoes in the originate timestamp of its reply. The requests waiting for their
+*               reply are linked in a hash table keyed by the nonce, so that each reply is delivered to its
+*               request, whichever task receives it (see SNTPc_MuxRx()).
+*
+*           (2) The requests are allocated from a pool. A request is owned by the task that sent it until it
+*               is freed. Its state, its reply & the hash table are protected by the module lock.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+typedef enum sntpc_mux_req_state {
+    SNTPc_MUX_REQ_STATE_FREE,
+    SNTPc_MUX_REQ_STATE_PENDING,                                /* Req sent, waiting for its reply.                     */
+    SNTPc_MUX_REQ_STATE_RX,                                     /* Reply received, not yet returned to the owner.       */
+    SNTPc_MUX_REQ_STATE_DONE                                    /* Reply returned to the owner.                         */
+} SNTPc_MUX_REQ_STATE;
+
+typedef struct sntpc_mux_req  SNTPc_MUX_REQ;
+
+struct sntpc_mux_req {
+    SNTPc_MUX_REQ_STATE   State;
+    NET_SOCK_ADDR         ServerAddr;
+    SNTPc_TX_TS           TxTS;                                 /* Tx timestamp is the nonce (see Note #1).             */
+    SNTP_PKT              Pkt;                                  /* Reply.                                               */
+    SNTPc_ERR             Err;                                  /* SNTPc_ERR_NONE, or SNTPc_ERR_KOD for a KoD reply.    */
+    SNTPc_MUX_REQ        *NextPtr;                              /* Next req in the same hash table bucket.              */
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   ASYNCHRONOUS REQUEST DATA TYPES
+*
+* Note(s) : (1) The server configuration is copied into the request. When no configuration is passed, the
+*               default configuration in use when the request is processed is used.
+*********************************************************************************************************
+*/
+
+typedef enum sntpc_async_req_state {
+    SNTPc_ASYNC_REQ_STATE_FREE,
+    SNTPc_ASYNC_REQ_STATE_PENDING,                              /* Req queued to the SNTPc task.                        */
+    SNTPc_ASYNC_REQ_STATE_IN_PROGRESS,                          /* Req processed by the SNTPc task.                     */
+    SNTPc_ASYNC_REQ_STATE_CANCELED                              /* Req canceled, cb will not be called.                 */
+} SNTPc_ASYNC_REQ_STATE;
+
+typedef struct sntpc_async_req {
+    SNTPc_ASYNC_REQ_STATE   State;
+    SNTPc_REQ_ID            ID;
+    SNTPc_CFG               Cfg;                                /* See Note #1.                                         */
+    CPU_BOOLEAN             IsDfltCfg;
+    SNTPc_REQ_CMPL_CB       CmplCb;
+    void                   *CbArgPtr;
+} SNTPc_ASYNC_REQ;
+
+
+/*
+*********************************************************************************************************
+*                                  SERVER ADDRESS CACHE ENTRY DATA TYPE
+*
+* Note(s) : (1) An entry is identified by the server hostname, port number & requested address family.
+*
+*           (2) Entries for servers specified by an IP address string never expire.
+*
+*           (3) For servers configured without address family, the entry of the family that answered the
+*               last request is marked as preferred & is used without racing the other family.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_addr_entry {
+    CPU_BOOLEAN          IsValid;
+    CPU_CHAR             Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR         PortNbr;
+    NET_IP_ADDR_FAMILY   AddrFamily;
+    CPU_BOOLEAN          IsHostname;                            /* See Note #2.                                         */
+    NET_SOCK_ADDR        ServerAddr;
+    NET_TS_MS            ResolvedTS_ms;                         /* Time at which the server addr was resolved.          */
+    CPU_BOOLEAN          IsUsed;                                /* Entry used since the server addr was resolved.       */
+    CPU_BOOLEAN          IsPref;                                /* See Note #3.                                         */
+} SNTPc_ADDR_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                    SERVER BACKOFF ENTRY DATA TYPE
+*
+* Note(s) : (1) An entry is identified by the server hostname & port number. It is created by the first
+*               Kiss-o'-Death reply of the server & removed by its next valid reply.
+*
+*           (2) The server is in backoff until Dur_ms elapsed since StartTS_ms. The backoff interval is kept
+*               after the end of the backoff, so that the next Kiss-o'-Death reply doubles it.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_backoff_entry {
+    CPU_BOOLEAN    IsValid;
+    CPU_CHAR       Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR   PortNbr;
+    CPU_INT32U     Backoff_sec;                                 /* Backoff interval, without jitter (see Note #2).      */
+    NET_TS_MS      StartTS_ms;                                  /* Time at which the last KoD reply was received.       */
+    CPU_INT32U     Dur_ms;                                      /* Backoff duration, with jitter.                       */
+} SNTPc_BACKOFF_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                  SERVER CLOCK FILTER ENTRY DATA TYPE
+*
+* Note(s) : (1) An entry is identified by the server hostname & port number. It is created by the first
+*               valid reply of the server & holds the clock filter of its last samples.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_filter_entry {
+    CPU_BOOLEAN    IsValid;
+    CPU_CHAR       Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR   PortNbr;
+    NET_TS_MS      UpdateTS_ms;                                 /* Time at which the last sample was added.             */
+    SNTPc_FILTER   Filter;
+} SNTPc_FILTER_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                    SYNCHRONIZATION STATE DATA TYPE
+*
+* Note(s) : (1) The synchronization state is protected by the module lock.
+*
+*           (2) The start counter identifies the current run of the synchronization, so that the result of a
+*               poll started before SNTPc_SyncStop() or SNTPc_SyncStart() is discarded.
+*
+*           (3) Exponential average of the squared differences between consecutive offsets, in us^2.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+typedef struct sntpc_sync {
+    SNTPc_CFG            Cfg;
+    CPU_BOOLEAN          IsDfltCfg;
+    SNTPc_SYNC_CB        Cb;
+    void                *CbArgPtr;
+    CPU_INT32U           StartCtr;                              /* See Note #2.                                         */
+    NET_TS_MS            PollNextTS_ms;                         /* Time at which the next poll is due.                  */
+    CPU_BOOLEAN          IsBurst;                               /* Next poll is a burst.                                */
+    CPU_INT16S           PollCtr;                               /* Poll-adjust counter.                                 */
+    CPU_INT64S           JitterSq;                              /* See Note #3.                                         */
+    SNTPc_SYNC_STATUS    Status;
+} SNTPc_SYNC;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  BROADCAST CLIENT STATE DATA TYPE
+*
+* Note(s) : (1) The broadcast client state is protected by the module lock.
+*
+*           (2) The start counter identifies the current run of the broadcast client, so that the listener
+*               opened before SNTPc_BcastStop() or SNTPc_BcastStart() is closed & its broadcasts discarded.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+typedef struct sntpc_bcast {
+    NET_SOCK_ADDR_FAMILY  AddrFamily;                           /* Addr family of the listener.                         */
+    NET_IPv4_ADDR         GrpAddrIPv4;                          /* IPv4 grp addr, in host order.                        */
+    NET_IPv6_ADDR         GrpAddrIPv6;                          /* IPv6 grp addr.                                       */
+    CPU_BOOLEAN           IsMcast;                              /* Grp joined by the listener.                          */
+    NET_IF_NBR            IfNbr;
+    SNTPc_SYNC_CB         Cb;
+    void                 *CbArgPtr;
+    CPU_INT32U            StartCtr;                             /* See Note #2.                                         */
+    SNTP_FIXED            Dly;                                  /* Round trip dly to the server.                        */
+    NET_TS_MS             CalTS_ms;                             /* Time at which the dly was measured.                  */
+    CPU_BOOLEAN           IsRxPrev;                             /* A broadcast of the server was used.                  */
+    NET_TS_MS             RxPrevTS_ms;                          /* Time at which it was received.                       */
+    SNTPc_BCAST_STATUS    Status;
+} SNTPc_BCAST;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   MANYCAST SERVER ENTRY DATA TYPE
+*
+* Note(s) : (1) The manycast server entries are protected by the module lock.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+typedef struct sntpc_manycast_entry {
+    NET_SOCK_ADDR          ServerAddr;                          /* Addr the server replied from.                        */
+    SNTPc_MANYCAST_SERVER  Server;
+} SNTPc_MANYCAST_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                   MANYCAST SERVER CONFIG DATA TYPE
+*
+* Note(s) : (1) The config of a discovered server holds its own copy of the server address string, so that
+*               it can be used without the module lock (see 'SNTPc_ManycastCfgGet() Note #2').
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_manycast_cfg {
+    SNTPc_CFG              Cfg;
+    CPU_CHAR               Hostname[NET_ASCII_LEN_MAX_ADDR_IPv4];
+} SNTPc_MANYCAST_CFG;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          NTS ENTRY DATA TYPE
+*
+* Note(s) : (1) The NTS entries are protected by the module lock. Each entry holds the association of a NTS
+*               key establishment server, designated by the hostname & port of a server configuration (see
+*               'SNTPc_ReqRemoteTimeNTS() Note #1').
+*
+*           (2) When the table is full, the least recently used entry is replaced.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+typedef struct sntpc_nts_entry {
+    CPU_BOOLEAN            IsValid;
+    CPU_CHAR               Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR           PortNbr;
+    NET_TS_MS              UseTS_ms;                            /* Time of the last use (see Note #2).                  */
+    SNTPc_NTS_ASSOC        Assoc;
+} SNTPc_NTS_ENTRY;
+
+
+/*
+*********************************************************************************************************
+*                                         NTS REQUEST DATA TYPE
+*
+* Note(s) : (1) The state of the association used by a request is copied, so that the module lock is not
+*               held during the exchange. The cookie is removed from the association, since a cookie is sent
+*               only once (see RFC #8915, Section 5.7).
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_nts_req {
+    CPU_INT08U             KeyC2S[SNTPc_NTS_KEY_LEN];
+    CPU_INT08U             KeyS2C[SNTPc_NTS_KEY_LEN];
+    CPU_CHAR               ServerHostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR           ServerPortNbr;
+    SNTPc_NTS_COOKIE       Cookie;                              /* See Note #1.                                         */
+    CPU_INT08U             PlaceholderNbr;                      /* Nbr of additional cookies requested.                 */
+} SNTPc_NTS_REQ;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    SERVER STATISTICS ENTRY DATA TYPE
+*
+* Note(s) : (1) An entry is identified by the server hostname & port number. It is created by the first
+*               request to the server & is protected by the module lock.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+typedef struct sntpc_stat_entry {
+    CPU_BOOLEAN            IsValid;
+    CPU_CHAR               Hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR           PortNbr;
+    NET_TS_MS              UpdateTS_ms;                         /* Time at which the last req was counted.              */
+    SNTPc_STAT_REQ         Stat;
+} SNTPc_STAT_ENTRY;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -63,699 +459,8835 @@
 *********************************************************************************************************
 */
 
-static SNTPc_CFG          *SNTPc_DfltCfgPtr;
-
-static NET_IP_ADDR_FAMILY  SNTPc_DfltServerAddrFamily;
+static SNTPc_CFG          *SNTPc_DfltCfgPtr;
+
+static SNTP_PKT             SNTPc_TxPktTemplate;
+
+static KAL_LOCK_HANDLE     SNTPc_Lock;
+
+static SNTPc_SOCK_ENTRY     SNTPc_SockPool[SNTPc_CFG_SOCK_POOL_NBR_ENTRIES];
+
+static CPU_INT16U           SNTPc_SockPoolEvictIx;
+
+static SNTPc_SOCK_POOL_STAT SNTPc_SockPoolStat;
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+static KAL_LOCK_HANDLE      SNTPc_MuxRxLock;                    /* Held by the task that rx's on the shared socks.      */
+
+static NET_SOCK_ID          SNTPc_MuxSockTbl[SNTPc_MUX_SOCK_NBR];   /* Shared sock of each addr family.             */
+
+static CPU_INT08U           SNTPc_MuxSockRxIx;                  /* Next shared sock rx'd without sock sel.              */
+
+static SNTPc_MUX_REQ        SNTPc_MuxReqPool[SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX];
+
+static SNTPc_MUX_REQ       *SNTPc_MuxReqHashTbl[SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX];
+#endif
+
+static SNTPc_ADDR_ENTRY     SNTPc_AddrCache[SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES];
+
+static SNTPc_ADDR_CACHE_STAT  SNTPc_AddrCacheStat;
+
+static SNTPc_RX_STAT        SNTPc_RxStat;
+
+static SNTPc_BACKOFF_ENTRY  SNTPc_BackoffTbl[SNTPc_CFG_BACKOFF_NBR_ENTRIES];
+
+static SNTPc_FILTER_ENTRY   SNTPc_FilterTbl[SNTPc_CFG_FILTER_NBR_ENTRIES];
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static KAL_TASK_HANDLE      SNTPc_TaskHandle;
+
+static KAL_Q_HANDLE         SNTPc_ReqQ;
+
+static SNTPc_ASYNC_REQ      SNTPc_AsyncReqTbl[SNTPc_CFG_ASYNC_REQ_NBR_MAX];
+
+static SNTPc_REQ_ID         SNTPc_AsyncReqID_Next;
+
+static SNTPc_SYNC           SNTPc_Sync;
+#endif
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static KAL_TASK_HANDLE      SNTPc_BcastTaskHandle;
+
+static KAL_SEM_HANDLE       SNTPc_BcastSem;
+
+static SNTPc_BCAST          SNTPc_Bcast;
+#endif
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static SNTPc_MANYCAST_ENTRY SNTPc_ManycastTbl[SNTPc_CFG_MANYCAST_SERVER_NBR_MAX];
+
+static CPU_INT08U           SNTPc_ManycastNbr;
+#endif
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static SNTPc_NTS_ENTRY      SNTPc_NTS_Tbl[SNTPc_CFG_NTS_SERVER_NBR_MAX];
+#endif
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+static SNTPc_STAT_ENTRY     SNTPc_StatTbl[SNTPc_CFG_STAT_NBR_ENTRIES];
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if ((SNTPc_CFG_SOCK_SHARED_EN != DEF_ENABLED) || \
+     (SNTPc_CFG_BCAST_EN       == DEF_ENABLED))
+static  CPU_BOOLEAN  SNTPc_Rx           (      NET_SOCK_ID     sock,
+                                         const NET_SOCK_ADDR  *p_server_addr,
+                                               SNTP_PKT       *ppkt,
+                                               SNTPc_ERR      *p_err);
+#endif
+
+static  CPU_BOOLEAN  SNTPc_RxCheck      (const SNTP_PKT       *ppkt,
+                                               CPU_INT32U      pkt_len,
+                                         const NET_SOCK_ADDR  *p_remote_addr,
+                                         const NET_SOCK_ADDR  *p_server_addr,
+                                               CPU_INT08U      msg_mode,
+                                               SNTPc_ERR      *p_err);
+
+static  CPU_BOOLEAN  SNTPc_SockAddrIsEq (const NET_SOCK_ADDR  *p_addr1,
+                                         const NET_SOCK_ADDR  *p_addr2);
+
+static  void         SNTPc_RxStatInc    (      CPU_INT32U     *p_ctr);
+
+static  void         SNTPc_TxPktInit    (void);
+
+static  CPU_BOOLEAN  SNTPc_Tx           (NET_SOCK_ID     sock,
+                                         NET_SOCK_ADDR  *paddr,
+                                         SNTPc_TX_TS    *p_tx_ts,
+                                         CPU_BOOLEAN     is_nonce,
+                                         SNTPc_ERR      *p_err);
+
+static  CPU_BOOLEAN        SNTPc_ReqExchange  (const SNTPc_CFG           *p_cfg,
+                                                     NET_IP_ADDR_FAMILY   ip_family,
+                                                     SNTP_PKT            *ppkt,
+                                                     CPU_BOOLEAN         *p_is_hostname,
+                                                     SNTPc_ERR           *p_err);
+
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+static  CPU_BOOLEAN        SNTPc_ReqRace      (const SNTPc_CFG           *p_cfg,
+                                                     SNTP_PKT            *ppkt,
+                                                     NET_IP_ADDR_FAMILY  *p_ip_family,
+                                                     SNTPc_ERR           *p_err);
+#endif
+
+static  void               SNTPc_ServerAddrSel   (const SNTPc_CFG        *p_cfg,
+                                                        NET_IP_ADDR_FAMILY *p_ip_family,
+                                                        NET_SOCK_ADDR    *p_server_addr,
+                                                        CPU_BOOLEAN      *p_is_pref,
+                                                        SNTPc_ERR        *p_err);
+
+static  CPU_INT32U         SNTPc_ReqMultiExchange(const SNTPc_CFG        *p_cfg_tbl,
+                                                        CPU_INT08U        cfg_nbr,
+                                                        CPU_INT32U        timeout_ms,
+                                                        SNTP_PKT         *p_pkt_tbl);
+
+static  CPU_INT32U         SNTPc_PrecisionGet_us (      CPU_INT08S        precision);
+
+static  void               SNTPc_SampleSelGet    (const SNTPc_SAMPLE     *p_sample,
+                                                        SNTPc_SEL_SAMPLE *p_sel_sample);
+
+static  SNTP_TS            SNTPc_LocalTimeOffsetGet(    SNTP_FIXED        offset);
+
+static  void               SNTPc_RxTS_Set     (      SNTP_PKT            *ppkt,
+                                                        SNTP_FIXED_TS        ts_rx);
+
+static  CPU_BOOLEAN        SNTPc_TxTS_Apply   (      SNTP_PKT            *ppkt,
+                                                  const SNTPc_TX_TS         *p_tx_ts);
+
+static  void               SNTPc_SockPoolInit (void);
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_DISABLED)
+static  SNTPc_SOCK_ENTRY  *SNTPc_SockGet      (const SNTPc_CFG           *p_cfg,
+                                                     NET_SOCK_ADDR       *p_server_addr,
+                                                     SNTPc_SOCK_ENTRY    *p_entry_tmp,
+                                                     SNTPc_ERR           *p_err);
+
+static  void               SNTPc_SockRelease  (      SNTPc_SOCK_ENTRY    *p_entry,
+                                                     CPU_BOOLEAN          is_faulted);
+#endif
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+static  void               SNTPc_MuxInit      (void);
+
+static  NET_SOCK_ID        SNTPc_MuxSockGet   (      NET_SOCK_ADDR_FAMILY addr_family,
+                                                     SNTPc_ERR           *p_err);
+
+static  SNTPc_MUX_REQ     *SNTPc_MuxTx        (const NET_SOCK_ADDR       *p_server_addr,
+                                                     SNTPc_ERR           *p_err);
+
+static  CPU_INT08U         SNTPc_MuxRx        (      SNTPc_MUX_REQ      **p_req_tbl,
+                                                     CPU_INT08U           req_nbr,
+                                                     CPU_INT32U           timeout_ms,
+                                                     SNTP_PKT            *ppkt,
+                                                     SNTPc_ERR           *p_err);
+
+static  void               SNTPc_MuxSockRx    (      CPU_INT32U           wait_ms);
+
+static  void               SNTPc_MuxSockRd    (      NET_SOCK_ID          sock,
+                                                     CPU_BOOLEAN          is_block);
+
+static  SNTPc_MUX_REQ     *SNTPc_MuxReqSrch   (const SNTP_TS             *p_nonce);
+
+static  void               SNTPc_MuxReqUnlink (      SNTPc_MUX_REQ       *p_req);
+
+static  void               SNTPc_MuxReqFree   (      SNTPc_MUX_REQ       *p_req);
+
+static  CPU_BOOLEAN        SNTPc_MuxReqExchange(const SNTPc_CFG          *p_cfg,
+                                                const NET_SOCK_ADDR      *p_server_addr_tbl,
+                                                      CPU_INT08U          addr_nbr,
+                                                      SNTP_PKT           *ppkt,
+                                                      CPU_INT08U         *p_ix_rx,
+                                                      SNTPc_ERR          *p_err);
+#endif
+
+static  void               SNTPc_AddrCacheInit   (void);
+
+static  void               SNTPc_ServerAddrGet   (const SNTPc_CFG           *p_cfg,
+                                                        NET_IP_ADDR_FAMILY   ip_family,
+                                                        NET_SOCK_ADDR       *p_server_addr,
+                                                        CPU_BOOLEAN         *p_is_hostname,
+                                                        SNTPc_ERR           *p_err);
+
+static  SNTPc_ADDR_ENTRY  *SNTPc_AddrCacheSrch   (const SNTPc_CFG           *p_cfg,
+                                                        NET_IP_ADDR_FAMILY   ip_family,
+                                                        SNTPc_ADDR_ENTRY   **pp_entry_oldest);
+
+static  void               SNTPc_HostResolve     (      CPU_CHAR            *p_hostname,
+                                                        NET_PORT_NBR         port_nbr,
+                                                        NET_IP_ADDR_FAMILY   ip_family,
+                                                        NET_SOCK_ADDR       *p_server_addr,
+                                                        CPU_BOOLEAN         *p_is_hostname,
+                                                        SNTPc_ERR           *p_err);
+
+static  NET_IP_ADDR_FAMILY SNTPc_AddrFamilyPrefGet(const SNTPc_CFG          *p_cfg);
+
+static  void               SNTPc_AddrFamilyPrefSet(const SNTPc_CFG          *p_cfg,
+                                                         NET_IP_ADDR_FAMILY  ip_family);
+
+static  CPU_BOOLEAN        SNTPc_BackoffIsActive (const SNTPc_CFG           *p_cfg);
+
+static  void               SNTPc_BackoffStart    (const SNTPc_CFG           *p_cfg,
+                                                  const SNTP_PKT            *ppkt);
+
+static  void               SNTPc_BackoffClr      (const SNTPc_CFG           *p_cfg);
+
+static  SNTPc_BACKOFF_ENTRY  *SNTPc_BackoffSrch  (const SNTPc_CFG           *p_cfg,
+                                                        SNTPc_BACKOFF_ENTRY **pp_entry_replace);
+
+static  void               SNTPc_FilterSampleAdd (const SNTPc_CFG           *p_cfg,
+                                                  const SNTPc_SAMPLE        *p_sample);
+
+static  SNTPc_FILTER_ENTRY  *SNTPc_FilterSrch    (const SNTPc_CFG           *p_cfg,
+                                                        SNTPc_FILTER_ENTRY **pp_entry_replace);
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  void               SNTPc_AddrCacheRefresh(void);
+
+static  void               SNTPc_Task            (void                      *p_arg);
+
+static  void               SNTPc_AsyncReqProcess (SNTPc_ASYNC_REQ           *p_req);
+
+static  CPU_INT32U         SNTPc_SyncProcess     (void);
+
+static  void               SNTPc_SyncPollUpdate  (CPU_INT64S                 offset_us);
+#endif
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  void               SNTPc_BcastTask       (void                      *p_arg);
+
+static  CPU_BOOLEAN        SNTPc_BcastListen     (void);
+
+static  void               SNTPc_BcastRxProcess  (      NET_SOCK_ID          sock,
+                                                        SNTP_PKT            *ppkt,
+                                                  const NET_SOCK_ADDR       *p_remote_addr,
+                                                        CPU_INT32U           start_ctr);
+
+static  CPU_BOOLEAN        SNTPc_BcastCal        (      NET_SOCK_ID          sock,
+                                                        NET_SOCK_ADDR       *p_server_addr,
+                                                        SNTP_FIXED          *p_dly);
+
+static  CPU_BOOLEAN        SNTPc_BcastGrpJoin    (const SNTPc_BCAST         *p_bcast);
+
+static  void               SNTPc_BcastGrpLeave   (const SNTPc_BCAST         *p_bcast);
+#endif
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  CPU_INT08U         SNTPc_ManycastRound    (      NET_SOCK_ID             sock,
+                                                         NET_SOCK_ADDR          *p_grp_addr,
+                                                         NET_IP_TTL              ttl,
+                                                         SNTPc_MANYCAST_ENTRY   *p_tbl,
+                                                         CPU_INT08U              nbr);
+
+static  CPU_INT08U         SNTPc_ManycastCandAdd  (      SNTPc_MANYCAST_ENTRY   *p_tbl,
+                                                         CPU_INT08U              nbr,
+                                                   const NET_SOCK_ADDR          *p_addr,
+                                                   const SNTPc_SAMPLE           *p_sample);
+
+static  CPU_BOOLEAN        SNTPc_ManycastIsBetter (const SNTPc_MANYCAST_SERVER  *p_server1,
+                                                   const SNTPc_MANYCAST_SERVER  *p_server2);
+
+static  CPU_BOOLEAN        SNTPc_ManycastCfgGet   (      SNTPc_MANYCAST_CFG     *p_cfg);
+
+static  void               SNTPc_ManycastResultSet(const SNTPc_MANYCAST_CFG     *p_cfg,
+                                                         CPU_BOOLEAN             result);
+#endif
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  CPU_BOOLEAN        SNTPc_NTS_Exchange     (const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_CFG              *p_ntp_cfg,
+                                                   const SNTPc_NTS_REQ          *p_req,
+                                                         SNTP_PKT               *ppkt,
+                                                         NET_IP_ADDR_FAMILY     *p_ip_family,
+                                                         CPU_BOOLEAN            *p_is_pref,
+                                                         SNTPc_ERR              *p_err);
+
+static  void               SNTPc_NTS_KE           (const SNTPc_CFG              *p_cfg,
+                                                         SNTPc_ERR              *p_err);
+
+static  CPU_BOOLEAN        SNTPc_NTS_CookiePop    (const SNTPc_CFG              *p_cfg,
+                                                         SNTPc_NTS_REQ          *p_req,
+                                                         SNTPc_ERR              *p_err);
+
+static  void               SNTPc_NTS_CookiePush   (const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_NTS_REQ          *p_req,
+                                                   const CPU_INT08U             *p_buf_pt,
+                                                         CPU_INT16U              pt_len);
+
+static  void               SNTPc_NTS_CookieRestore(const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_NTS_REQ          *p_req);
+
+static  void               SNTPc_NTS_AssocDiscard (const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_NTS_REQ          *p_req);
+
+static  SNTPc_NTS_ENTRY   *SNTPc_NTS_AssocSrch    (const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_NTS_REQ          *p_req);
+
+static  SNTPc_NTS_ENTRY   *SNTPc_NTS_Srch         (const SNTPc_CFG              *p_cfg,
+                                                         SNTPc_NTS_ENTRY       **pp_entry_replace);
+#endif
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+static  void               SNTPc_StatReqRecord    (const SNTPc_CFG              *p_cfg,
+                                                   const SNTPc_SAMPLE           *p_sample,
+                                                         SNTPc_ERR               err);
+
+static  SNTPc_STAT_ENTRY  *SNTPc_StatSrch         (const SNTPc_CFG              *p_cfg,
+                                                         SNTPc_STAT_ENTRY      **pp_entry_replace);
+#endif
+
+static  void         SNTPc_AcquireLock  (SNTPc_ERR      *p_err);
+
+static  void         SNTPc_ReleaseLock  (void);
+
+
+/*
+*********************************************************************************************************
+*                                             SNTPc_Init()
+*
+* Description : Initialize the SNTPc Module.
+*
+* Argument(s) : p_cfg    Pointer to the default configuration use by the SNTP client.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Server address successfully set.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_MEM_ALLOC      Memory allocation failed.
+*                               SNTPc_ERR_FAULT_INIT     Initialization error.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occur while trying to acquire the module lock.
+*
+* Return(s)   : DEF_TRUE,  if the SNTP client initialization is successful.
+*
+*               DEF_FALSE, otherwise.
+*
+* Caller(s)   : AppTaskStart().
+*
+* Note(s)     : none.
+*
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_Init (const SNTPc_CFG   *p_cfg,
+                               SNTPc_ERR   *p_err)
+{
+    KAL_ERR         err_kal;
+    CPU_BOOLEAN     result;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_cfg == DEF_NULL) {
+       *p_err  = SNTPc_ERR_NULL_PTR;
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+                                                                /* Create the module's lock.                            */
+    SNTPc_Lock = KAL_LockCreate("SNTPc Lock",
+                                DEF_NULL,
+                               &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+
+    SNTPc_TxPktInit();                                          /* Build the req pkt template.                          */
+
+    Mem_Clr(&SNTPc_RxStat, sizeof(SNTPc_RxStat));               /* Clr the Rx stats.                                    */
+
+    Mem_Clr(&SNTPc_BackoffTbl, sizeof(SNTPc_BackoffTbl));       /* Clr the server backoff states.                       */
+
+    Mem_Clr(&SNTPc_FilterTbl, sizeof(SNTPc_FilterTbl));         /* Clr the server clock filters.                        */
+
+    SNTPc_SockPoolInit();                                       /* Init the socket pool.                                */
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+    SNTPc_MuxRxLock = KAL_LockCreate(SNTPc_MUX_LOCK_NAME,       /* Create the shared sock Rx lock.                      */
+                                     DEF_NULL,
+                                    &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+
+    SNTPc_MuxInit();                                            /* Init the shared socks.                               */
+#endif
+
+    SNTPc_AddrCacheInit();                                      /* Init the server addr cache.                          */
+
+    SNTPc_ClkInit();                                            /* Init the clock discipline.                           */
+
+                                                                /* Set the default server configuration.                */
+    result = SNTPc_SetDfltCfg (p_cfg, p_err);
+    if (result != DEF_OK) {
+        goto exit;
+    }
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+    Mem_Clr(SNTPc_AsyncReqTbl, sizeof(SNTPc_AsyncReqTbl));      /* Init the async req tbl.                              */
+    SNTPc_AsyncReqID_Next = SNTPc_REQ_ID_NONE + 1u;
+    Mem_Clr(&SNTPc_Sync, sizeof(SNTPc_Sync));                   /* Init the sync state.                                 */
+    SNTPc_DriftInit();                                          /* Init the freq drift estimation.                      */
+                                                                /* Create the async req Q, with room for a wakeup msg.  */
+    SNTPc_ReqQ = KAL_QCreate(SNTPc_REQ_Q_NAME,
+                             SNTPc_CFG_ASYNC_REQ_NBR_MAX + 1u,
+                             DEF_NULL,
+                            &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+                                                                /* Create the SNTPc task.                               */
+    SNTPc_TaskHandle = KAL_TaskAlloc(SNTPc_TASK_NAME,
+                                     DEF_NULL,
+                                     SNTPc_CFG_TASK_STK_SIZE_BYTES,
+                                     DEF_NULL,
+                                    &err_kal);
+    if (err_kal == KAL_ERR_NONE) {
+        KAL_TaskCreate(SNTPc_TaskHandle,
+                       SNTPc_Task,
+                       DEF_NULL,
+                       SNTPc_CFG_TASK_PRIO,
+                       DEF_NULL,
+                      &err_kal);
+    }
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+#endif
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+    Mem_Clr(SNTPc_ManycastTbl, sizeof(SNTPc_ManycastTbl));      /* Init the manycast servers.                           */
+    SNTPc_ManycastNbr = 0u;
+#endif
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+    Mem_Clr(SNTPc_NTS_Tbl, sizeof(SNTPc_NTS_Tbl));              /* Init the NTS associations.                           */
+#endif
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    Mem_Clr(SNTPc_StatTbl, sizeof(SNTPc_StatTbl));              /* Init the server stats.                               */
+    SNTPc_StatInit();                                           /* Init the global stats.                               */
+#endif
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+    Mem_Clr(&SNTPc_Bcast, sizeof(SNTPc_Bcast));                 /* Init the broadcast client state.                     */
+                                                                /* Create the broadcast client sem.                     */
+    SNTPc_BcastSem = KAL_SemCreate(SNTPc_BCAST_SEM_NAME,
+                                   DEF_NULL,
+                                  &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+                                                                /* Create the broadcast client task.                    */
+    SNTPc_BcastTaskHandle = KAL_TaskAlloc(SNTPc_BCAST_TASK_NAME,
+                                          DEF_NULL,
+                                          SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES,
+                                          DEF_NULL,
+                                         &err_kal);
+    if (err_kal == KAL_ERR_NONE) {
+        KAL_TaskCreate(SNTPc_BcastTaskHandle,
+                       SNTPc_BcastTask,
+                       DEF_NULL,
+                       SNTPc_CFG_BCAST_TASK_PRIO,
+                       DEF_NULL,
+                      &err_kal);
+    }
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = SNTPc_ERR_MEM_ALLOC;
+             result = DEF_FAIL;
+             goto exit;
+
+        default:
+            *p_err = SNTPc_ERR_FAULT_INIT;
+             result = DEF_FAIL;
+             goto exit;
+    }
+#endif
+
+exit:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_SetDfltCfg()
+*
+* Description : Set the default server configuration.
+*
+* Argument(s) : p_cfg   Pointer to the default configuration use by the SNTP client.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Server address successfully set.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occur while trying to acquire the module lock.
+*
+* Return(s)   : DEF_TRUE,  if the new default server configuration is successfully set.
+*
+*               DEF_FALSE, otherwise.
+*
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : none.
+*
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_SetDfltCfg (const SNTPc_CFG   *p_cfg,
+                                     SNTPc_ERR   *p_err)
+{
+    CPU_BOOLEAN     result;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_cfg == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (DEF_FAIL);
+    }
+#endif
+                                                                /* Get SNTPc Lock.                                      */
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        result = DEF_FAIL;
+        goto exit;
+    }
+                                                                /* Set default configuration                            */
+    SNTPc_DfltCfgPtr = (SNTPc_CFG *)p_cfg;
+                                                                /* Release SNTPc Lock.                                  */
+    SNTPc_ReleaseLock();
+
+    result = DEF_OK;
+
+exit:
+    return(result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ReqRemoteTime()
+*
+* Description : Send a request to an NTP server and receive an SNTP packet to compute.
+*
+* Argument(s) : p_cfg   Pointer to the server configuration to use by the SNTP client.
+*                           If DEF_NULL,    use default configuration set in the initialization.
+*                           Otherwise,      use the passed configuration.
+*
+*               ppkt    Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The SNTP Request has been successfully processed.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the request to fail.
+*                               SNTPc_ERR_TX             Error occurred during the request transmission.
+*                               SNTPc_ERR_RX             Error occurred during the packet reception.
+*                               SNTPc_ERR_NO_MORE_RSRC   All the shared socket requests are in use.
+*                               SNTPc_ERR_KOD            Kiss-o'-Death reply received, server put in backoff.
+*                               SNTPc_ERR_SERVER_BACKOFF Server in backoff, request not sent (see Note #5).
+*
+* Return(s)   : DEF_TRUE,  if the SNTP request has been successfully completed.
+*
+*               DEF_FALSE, otherwise.
+*
+* Caller(s)   : App_SNTPc_SetClk(),
+*               SNTPcCmd_Get(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : (1) The socket used to reach the server is kept open in the socket pool at the end of the
+*                   request. It is closed & re-opened by the next request only if an error occurred.
+*
+*               (2) The server address is taken from the server address cache. The server hostname is
+*                   resolved by the caller only if the address is not in the cache or if it expired.
+*
+*               (3) When the server configuration does not specify an address family & no family is
+*                   known to work for this server, the request is sent over IPv6 & then, after a short
+*                   delay, over IPv4. The first valid reply is used & its address family is remembered
+*                   for the following requests to this server (see 'SNTPc_ReqRace()').
+*
+*               (4) The module lock is held only while the request state is read & updated. It is never
+*                   held while the server hostname is resolved or while waiting for the reply, so that
+*                   concurrent requests from different tasks proceed in parallel.
+*
+*               (5) A server that sent a Kiss-o'-Death reply is put in backoff. Until the backoff expires,
+*                   requests to the server fail with SNTPc_ERR_SERVER_BACKOFF without any network access.
+*                   The backoff state of the server is cleared by its next valid reply (see
+*                   'SNTPc_BackoffStart() Note #1').
+*
+*               (6) Each valid reply is added to the clock filter of the server (see
+*                   'SNTPc_FilterStatusGet()').
+*
+*               (7) Once manycast servers were discovered, a request with the default configuration is sent
+*                   to the best discovered server (see 'SNTPc_ManycastDiscover() Note #3').
+*
+*               (8) The request is counted in the global statistics & in the statistics of the server (see
+*                   'SNTPc_StatServerGet()').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_ReqRemoteTime (const SNTPc_CFG     *p_cfg,
+                                        SNTP_PKT      *ppkt,
+                                        SNTPc_ERR     *p_err)
+{
+    const SNTPc_CFG               *p_server_cfg;
+          SNTPc_SAMPLE             sample;
+          SNTPc_ERR                err;
+          NET_IP_ADDR_FAMILY       ip_family;
+          CPU_BOOLEAN              is_hostname;
+          CPU_BOOLEAN              is_pref;
+          CPU_BOOLEAN              result;
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+          SNTPc_MANYCAST_CFG       cfg_manycast;
+          CPU_BOOLEAN              is_manycast;
+#endif
+
+
+    p_server_cfg = DEF_NULL;
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+    is_manycast  = DEF_NO;
+#endif
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (ppkt == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+                                                                /* ------------- ACQUIRE SNTP MODULE LOCK ------------- */
+    SNTPc_AcquireLock(p_err);                                   /* See Note #4.                                         */
+    if (*p_err != SNTPc_ERR_NONE) {
+        result = DEF_FAIL;
+        goto exit;
+    }
+                                                                /* --------------- SELECT SERVER CONFIG --------------- */
+    if (p_cfg == DEF_NULL) {
+        p_server_cfg = SNTPc_DfltCfgPtr;                        /* If DEF_NULL, Use the Default Server config.          */
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+        is_manycast  = SNTPc_ManycastCfgGet(&cfg_manycast);     /* See Note #7.                                         */
+        if (is_manycast == DEF_YES) {
+            p_server_cfg = &cfg_manycast.Cfg;
+        }
+#endif
+    } else {
+        p_server_cfg = p_cfg;                                   /* Otherwise, use the passed configuration.             */
+    }
+
+                                                                /* ----------------- SELECT IP FAMILY ----------------- */
+    ip_family = p_server_cfg->ServerAddrFamily;
+    is_pref   = DEF_NO;
+    if (ip_family == NET_IP_ADDR_FAMILY_NONE) {                 /* If the ip family is unknown, use the family that...  */
+        ip_family = SNTPc_AddrFamilyPrefGet(p_server_cfg);      /* ...worked the last time for this server, if any.     */
+        if (ip_family != NET_IP_ADDR_FAMILY_NONE) {
+            is_pref = DEF_YES;
+        }
+    }
+                                                                /* ------------- RELEASE SNTP MODULE LOCK ------------- */
+    SNTPc_ReleaseLock();
+                                                                /* ---------------- CHECK SERVER BACKOFF -------------- */
+    if (SNTPc_BackoffIsActive(p_server_cfg) == DEF_YES) {       /* See Note #5.                                         */
+       *p_err = SNTPc_ERR_SERVER_BACKOFF;
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+    if (ip_family != NET_IP_ADDR_FAMILY_NONE) {
+                                                                /* ------------- EXCHANGE WITH ONE FAMILY ------------- */
+        result = SNTPc_ReqExchange(p_server_cfg,
+                                   ip_family,
+                                   ppkt,
+                                  &is_hostname,
+                                   p_err);
+        if ((result  == DEF_FAIL) &&
+            (is_pref == DEF_YES )) {                            /* Family that worked failed, race both next time.      */
+            SNTPc_AddrFamilyPrefSet(p_server_cfg, NET_IP_ADDR_FAMILY_NONE);
+        }
+
+    } else {
+                                                                /* ------------ RACE IPv6 & IPv4 EXCHANGES ------------ */
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+        result = SNTPc_ReqRace(p_server_cfg,                    /* See Note #3.                                         */
+                               ppkt,
+                              &ip_family,
+                               p_err);
+#else
+        ip_family = NET_IP_ADDR_FAMILY_IPv6;                    /* Without sock sel, try IPv6 first, then IPv4.         */
+        result    = SNTPc_ReqExchange(p_server_cfg,
+                                      ip_family,
+                                      ppkt,
+                                     &is_hostname,
+                                      p_err);
+        if ((result      == DEF_FAIL     ) &&
+            (is_hostname == DEF_YES      ) &&
+            (*p_err      != SNTPc_ERR_KOD)) {
+            ip_family = NET_IP_ADDR_FAMILY_IPv4;
+            result    = SNTPc_ReqExchange(p_server_cfg,
+                                          ip_family,
+                                          ppkt,
+                                         &is_hostname,
+                                          p_err);
+        }
+#endif
+        if (result == DEF_OK) {                                 /* Remember the family that worked for this server.     */
+            SNTPc_AddrFamilyPrefSet(p_server_cfg, ip_family);
+        }
+    }
+
+    if (result == DEF_OK) {
+        SNTPc_BackoffClr(p_server_cfg);                         /* See Note #5.                                         */
+        SNTPc_PktDecode(ppkt, &sample, &err);                   /* See Note #6.                                         */
+        SNTPc_FilterSampleAdd(p_server_cfg, &sample);
+    }
+
+exit:
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+    if (is_manycast == DEF_YES) {
+        SNTPc_ManycastResultSet(&cfg_manycast, result);
+    }
+#endif
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    SNTPc_StatReqRecord(p_server_cfg,                           /* See Note #8.                                         */
+                       (result == DEF_OK) ? &sample : DEF_NULL,
+                       *p_err);
+#endif
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_REQ,
+                    *p_err,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(sample.RoundTripDly_ns / 1000) : 0u,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(sample.Offset_ns       / 1000) : 0u);
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_ReqRemoteTimeAsync()
+*
+* Description : Queue a request to an NTP server, without waiting for the reply.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration to use by the SNTP client.
+*                               If DEF_NULL,    use default configuration set in the initialization.
+*                               Otherwise,      use the passed configuration (see Note #1).
+*
+*               cmpl_cb     Function called by the SNTPc task when the request completes.
+*
+*               p_cb_arg    Argument passed to the completion callback.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The request has been successfully queued.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_NO_MORE_RSRC   Too many asynchronous requests already queued.
+*                               SNTPc_ERR_FAULT          The request could not be queued to the SNTPc task.
+*
+* Return(s)   : ID of the request, if NO error(s).
+*
+*               SNTPc_REQ_ID_NONE, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The configuration structure is copied, but the server hostname it points to MUST remain
+*                   valid until the request completes.
+*
+*               (2) The request is processed by the SNTPc task, which calls the completion callback with
+*                   the received packet or with the error that caused the request to fail.
+*
+*               (3) This function does not acquire the module lock & never waits for a request in progress.
+*
+*               (4) The ID is set in the same critical section as the PENDING state, so that a request slot
+*                   reused by a new request never matches the ID of the request it held before (see
+*                   SNTPc_ReqCancel()). An ID is consumed only if a slot is allocated.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+SNTPc_REQ_ID  SNTPc_ReqRemoteTimeAsync (const SNTPc_CFG          *p_cfg,
+                                              SNTPc_REQ_CMPL_CB   cmpl_cb,
+                                              void               *p_cb_arg,
+                                              SNTPc_ERR          *p_err)
+{
+    SNTPc_ASYNC_REQ  *p_req;
+    SNTPc_REQ_ID      req_id;
+    KAL_ERR           err_kal;
+    CPU_INT16U        ix;
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(SNTPc_REQ_ID_NONE);
+    }
+
+    if (cmpl_cb == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (SNTPc_REQ_ID_NONE);
+    }
+#endif
+                                                                /* ------------------- ALLOC REQ ---------------------- */
+    p_req  = DEF_NULL;
+    req_id = SNTPc_REQ_ID_NONE;
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    for (ix = 0u; ix < SNTPc_CFG_ASYNC_REQ_NBR_MAX; ix++) {
+        if (SNTPc_AsyncReqTbl[ix].State == SNTPc_ASYNC_REQ_STATE_FREE) {
+            req_id = SNTPc_AsyncReqID_Next;
+            SNTPc_AsyncReqID_Next++;
+            if (SNTPc_AsyncReqID_Next == SNTPc_REQ_ID_NONE) {
+                SNTPc_AsyncReqID_Next++;
+            }
+            p_req        = &SNTPc_AsyncReqTbl[ix];
+            p_req->ID    =  req_id;                             /* See Note #4.                                         */
+            p_req->State =  SNTPc_ASYNC_REQ_STATE_PENDING;
+            break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_req == DEF_NULL) {
+       *p_err = SNTPc_ERR_NO_MORE_RSRC;
+        return (SNTPc_REQ_ID_NONE);
+    }
+
+    p_req->CmplCb   = cmpl_cb;
+    p_req->CbArgPtr = p_cb_arg;
+    if (p_cfg == DEF_NULL) {
+        p_req->IsDfltCfg = DEF_YES;
+    } else {
+        p_req->IsDfltCfg = DEF_NO;
+        p_req->Cfg       = *p_cfg;                              /* See Note #1.                                         */
+    }
+                                                                /* ---------------- POST REQ TO TASK ------------------ */
+    KAL_QPost(SNTPc_ReqQ,
+              p_req,
+              KAL_OPT_POST_NONE,
+             &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+        CPU_CRITICAL_ENTER();
+        p_req->State = SNTPc_ASYNC_REQ_STATE_FREE;
+        CPU_CRITICAL_EXIT();
+       *p_err = SNTPc_ERR_FAULT;
+        return (SNTPc_REQ_ID_NONE);
+    }
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (req_id);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_ReqCancel()
+*
+* Description : Cancel an asynchronous request.
+*
+* Argument(s) : req_id   ID of the request to cancel, as returned by SNTPc_ReqRemoteTimeAsync().
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The request has been successfully canceled.
+*                               SNTPc_ERR_REQ_NOT_FOUND  The request does not exist or already completed.
+*
+* Return(s)   : DEF_OK,   if the request has been canceled.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The completion callback of a canceled request is never called. If the request is already
+*                   in progress, the exchange with the server completes but its result is discarded.
+*
+*               (2) The ID & the state of a request are compared in one critical section, as they are set
+*                   (see 'SNTPc_ReqRemoteTimeAsync()  Note #4'). The ID of a completed request thus never
+*                   cancels a new request queued in the same slot.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+CPU_BOOLEAN  SNTPc_ReqCancel (SNTPc_REQ_ID   req_id,
+                              SNTPc_ERR     *p_err)
+{
+    SNTPc_ASYNC_REQ  *p_req;
+    CPU_BOOLEAN       result;
+    CPU_INT16U        ix;
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+    result = DEF_FAIL;
+   *p_err  = SNTPc_ERR_REQ_NOT_FOUND;
+
+    if (req_id == SNTPc_REQ_ID_NONE) {
+        return (result);
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    for (ix = 0u; ix < SNTPc_CFG_ASYNC_REQ_NBR_MAX; ix++) {
+        p_req = &SNTPc_AsyncReqTbl[ix];
+        if ((p_req->ID == req_id) &&
+           ((p_req->State == SNTPc_ASYNC_REQ_STATE_PENDING    ) ||
+            (p_req->State == SNTPc_ASYNC_REQ_STATE_IN_PROGRESS))) {
+            p_req->State = SNTPc_ASYNC_REQ_STATE_CANCELED;      /* See Note #1.                                         */
+            result       = DEF_OK;
+           *p_err        = SNTPc_ERR_NONE;
+            break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (result);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_SyncStart()
+*
+* Description : Start the background synchronization with an NTP server.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration to use by the SNTP client.
+*                               If DEF_NULL,    use default configuration set in the initialization.
+*                               Otherwise,      use the passed configuration (see Note #1).
+*
+*               sync_cb     Function called by the SNTPc task after each successful poll of the server.
+*
+*               p_cb_arg    Argument passed to the synchronization callback.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Synchronization successfully started.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_CLK_IN_USE     Broadcast client running (see Note #4).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The configuration structure is copied, but the server hostname it points to MUST remain
+*                   valid until the synchronization is stopped.
+*
+*               (2) The SNTPc task polls the server with a burst of requests right away, then with a single
+*                   request every poll interval (see 'SNTPc_SyncPollUpdate()'). Each successful poll
+*                   updates the disciplined clock (see SNTPc_ClkUpdate()), then calls the callback.
+*
+*               (3) If the synchronization is already running, it is restarted with the new configuration.
+*                   The frequency drift estimation restarts from the first poll (see SNTPc_DriftTimeGet()).
+*
+*               (4) The synchronization & the broadcast client both discipline the clock, so they cannot run
+*                   at the same time (see 'SNTPc_BcastStart() Note #4').
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+void  SNTPc_SyncStart (const SNTPc_CFG       *p_cfg,
+                             SNTPc_SYNC_CB    sync_cb,
+                             void            *p_cb_arg,
+                             SNTPc_ERR       *p_err)
+{
+    KAL_ERR  err_kal;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (sync_cb == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+    if (SNTPc_Bcast.Status.IsRunning == DEF_YES) {              /* See Note #4.                                         */
+        SNTPc_ReleaseLock();
+       *p_err = SNTPc_ERR_CLK_IN_USE;
+        return;
+    }
+#endif
+
+    Mem_Clr(&SNTPc_Sync, sizeof(SNTPc_Sync));
+    if (p_cfg == DEF_NULL) {
+        SNTPc_Sync.IsDfltCfg = DEF_YES;
+    } else {
+        SNTPc_Sync.IsDfltCfg = DEF_NO;
+        SNTPc_Sync.Cfg       = *p_cfg;                          /* See Note #1.                                         */
+    }
+    SNTPc_Sync.Cb                = sync_cb;
+    SNTPc_Sync.CbArgPtr          = p_cb_arg;
+    SNTPc_Sync.IsBurst           = DEF_YES;                     /* See Note #2.                                         */
+    SNTPc_Sync.PollNextTS_ms     = NetUtil_TS_Get_ms();
+    SNTPc_Sync.Status.IsRunning  = DEF_YES;
+    SNTPc_Sync.Status.PollExp    = SNTPc_CFG_SYNC_POLL_EXP_MIN;
+    SNTPc_Sync.Status.Jitter_us  = SNTPc_LOCAL_TS_RESOLUTION_US;
+    SNTPc_Sync.StartCtr++;
+
+    SNTPc_DriftInit();                                          /* See Note #3.                                         */
+
+    SNTPc_ReleaseLock();
+
+    KAL_QPost(SNTPc_ReqQ,                                       /* Wake up the task to poll right away.                 */
+              DEF_NULL,
+              KAL_OPT_POST_NONE,
+             &err_kal);
+    (void)&err_kal;
+
+   *p_err = SNTPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_SyncStop()
+*
+* Description : Stop the background synchronization.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Synchronization successfully stopped.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A poll in progress completes, but its result is discarded & the callback is not called.
+*
+*               (2) The SNTPc task is woken up, so that it stops waiting for the next poll.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+void  SNTPc_SyncStop (SNTPc_ERR  *p_err)
+{
+    KAL_ERR  err_kal;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    SNTPc_Sync.Status.IsRunning = DEF_NO;                       /* See Note #1.                                         */
+    SNTPc_Sync.StartCtr++;
+
+    SNTPc_ReleaseLock();
+
+    KAL_QPost(SNTPc_ReqQ,                                       /* Wake up the task (see Note #2).                      */
+              DEF_NULL,
+              KAL_OPT_POST_NONE,
+             &err_kal);
+    (void)&err_kal;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SyncStatusGet()
+*
+* Description : Get the status of the background synchronization.
+*
+* Argument(s) : p_status    Pointer to a variable that will receive the synchronization status.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Status successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+void  SNTPc_SyncStatusGet (SNTPc_SYNC_STATUS  *p_status,
+                           SNTPc_ERR          *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_status == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+   *p_status = SNTPc_Sync.Status;
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_BcastStart()
+*
+* Description : Start the broadcast client, which disciplines the clock with the broadcasts of an NTP server.
+*
+* Argument(s) : p_grp_addr  Pointer to the address the server broadcasts to, as a string.
+*                               If DEF_NULL,    listen to the IPv4 broadcasts.
+*                               Otherwise,      listen to the IPv4 or IPv6 address (see Note #1).
+*
+*               if_nbr      Interface on which the multicast group is joined.
+*
+*               sync_cb     Function called by the broadcast client task after each broadcast used to update
+*                           the clock (see 'SNTPc SYNCHRONIZATION DATA TYPES  Note #1').
+*
+*               p_cb_arg    Argument passed to the synchronization callback.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Broadcast client successfully started.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_SERVER_CFG     Invalid or unsupported address.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_CLK_IN_USE     Synchronization running (see Note #4).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) An IPv4 multicast address is joined with IGMP & an IPv6 multicast address with MLD, which
+*                   MUST be enabled in the network stack. Any other IPv4 address listens to the broadcasts,
+*                   whatever their destination. IPv6 has no broadcast, so an IPv6 address MUST be multicast.
+*
+*               (2) RFC #4330, Section 5 'SNTP Client Operations' states that a broadcast client should
+*                   measure the network delay with a few client/server exchanges before it uses the
+*                   broadcasts of a server. The broadcast client task sends SNTPc_CFG_BCAST_CAL_REQ_NBR
+*                   requests to the first server heard, then to any other server heard, keeps the shortest
+*                   round trip delay & measures it again every SNTPc_CFG_BCAST_CAL_PERIOD_SEC seconds.
+*
+*               (3) Each broadcast is then taken as a reply whose request was sent half the measured round
+*                   trip delay before it was received, so the delay is accounted for in the offset.
+*
+*               (4) The broadcast client & the synchronization both discipline the clock, so they cannot run
+*                   at the same time : the broadcast client is not started while the synchronization runs, &
+*                   SNTPc_SyncStart() fails while the broadcast client runs. The clock is also updated under
+*                   the module lock by both, after checking that they were not stopped in the meantime, so
+*                   that a poll or a broadcast processed across a stop & a start of the other client never
+*                   updates the clock concurrently (see 'sntp-c_clk.c  SNTPc_ClkUpdate()  Note #5').
+*
+*               (5) If the broadcast client is already running, it is restarted with the new address.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+void  SNTPc_BcastStart (const CPU_CHAR       *p_grp_addr,
+                              NET_IF_NBR      if_nbr,
+                              SNTPc_SYNC_CB   sync_cb,
+                              void           *p_cb_arg,
+                              SNTPc_ERR      *p_err)
+{
+    NET_IPv6_ADDR       addr;
+    NET_IPv4_ADDR       addr_ipv4;
+    NET_IP_ADDR_FAMILY  ip_family;
+    CPU_BOOLEAN         is_mcast;
+    CPU_INT32U          start_ctr;
+    NET_ERR             err_net;
+    KAL_ERR             err_kal;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (sync_cb == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+                                                                /* ---------------- VALIDATE GRP ADDR ----------------- */
+    Mem_Clr(&addr, sizeof(addr));
+    addr_ipv4 = NET_IPv4_ADDR_NONE;
+    is_mcast  = DEF_NO;
+    if (p_grp_addr == DEF_NULL) {
+        ip_family = NET_IP_ADDR_FAMILY_IPv4;
+    } else {
+        ip_family = NetASCII_Str_to_IP((CPU_CHAR *)p_grp_addr,
+                                                   &addr,
+                                                    sizeof(addr),
+                                                   &err_net);
+        if (err_net != NET_ASCII_ERR_NONE) {
+           *p_err = SNTPc_ERR_SERVER_CFG;
+            return;
+        }
+    }
+
+    switch (ip_family) {                                        /* See Note #1.                                         */
+        case NET_IP_ADDR_FAMILY_IPv4:
+             if (p_grp_addr != DEF_NULL) {
+                 Mem_Copy(&addr_ipv4, &addr, sizeof(addr_ipv4));
+             }
+             if ((addr_ipv4 & SNTPc_IPv4_MCAST_MASK) == SNTPc_IPv4_MCAST_PREFIX) {
+#ifndef  NET_IGMP_MODULE_EN
+                *p_err = SNTPc_ERR_SERVER_CFG;
+                 return;
+#else
+                 is_mcast = DEF_YES;
+#endif
+             }
+             break;
+
+        case NET_IP_ADDR_FAMILY_IPv6:
+             if (addr.Addr[0] != SNTPc_IPv6_MCAST_PREFIX) {
+                *p_err = SNTPc_ERR_SERVER_CFG;
+                 return;
+             }
+#ifndef  NET_MLDP_MODULE_EN
+            *p_err = SNTPc_ERR_SERVER_CFG;
+             return;
+#else
+             is_mcast = DEF_YES;
+             break;
+#endif
+
+        default:
+            *p_err = SNTPc_ERR_SERVER_CFG;
+             return;
+    }
+                                                                /* ---------------- SET BCAST CLIENT ------------------ */
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+    if (SNTPc_Sync.Status.IsRunning == DEF_YES) {               /* See Note #4.                                         */
+        SNTPc_ReleaseLock();
+       *p_err = SNTPc_ERR_CLK_IN_USE;
+        return;
+    }
+#endif
+
+    start_ctr = SNTPc_Bcast.StartCtr;
+    Mem_Clr(&SNTPc_Bcast, sizeof(SNTPc_Bcast));
+    SNTPc_Bcast.AddrFamily       = (ip_family == NET_IP_ADDR_FAMILY_IPv4) ? NET_SOCK_ADDR_FAMILY_IP_V4
+                                                                          : NET_SOCK_ADDR_FAMILY_IP_V6;
+    SNTPc_Bcast.GrpAddrIPv4      = addr_ipv4;
+    SNTPc_Bcast.GrpAddrIPv6      = addr;
+    SNTPc_Bcast.IsMcast          = is_mcast;
+    SNTPc_Bcast.IfNbr            = if_nbr;
+    SNTPc_Bcast.Cb               = sync_cb;
+    SNTPc_Bcast.CbArgPtr         = p_cb_arg;
+    SNTPc_Bcast.Status.IsRunning = DEF_YES;
+    SNTPc_Bcast.StartCtr         = start_ctr + 1u;              /* See Note #5.                                         */
+
+    SNTPc_ReleaseLock();
+
+    KAL_SemPost(SNTPc_BcastSem,                                 /* Wake up the task to open the listener.               */
+                KAL_OPT_POST_NONE,
+               &err_kal);
+    (void)&err_kal;
+
+   *p_err = SNTPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_BcastStop()
+*
+* Description : Stop the broadcast client.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Broadcast client successfully stopped.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The listener is closed by the broadcast client task within SNTPc_BCAST_RX_TIMEOUT_MS. A
+*                   broadcast being processed is discarded & the callback is not called.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+void  SNTPc_BcastStop (SNTPc_ERR  *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    SNTPc_Bcast.Status.IsRunning = DEF_NO;                      /* See Note #1.                                         */
+    SNTPc_Bcast.StartCtr++;
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_BcastStatusGet()
+*
+* Description : Get the status of the broadcast client.
+*
+* Argument(s) : p_status    Pointer to a variable that will receive the broadcast client status.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Status successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+void  SNTPc_BcastStatusGet (SNTPc_BCAST_STATUS  *p_status,
+                            SNTPc_ERR           *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_status == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+   *p_status = SNTPc_Bcast.Status;
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_ManycastDiscover()
+*
+* Description : Discover the nearest NTP servers with manycast requests & use the best ones as the default
+*               servers.
+*
+* Argument(s) : p_grp_addr  Pointer to the IPv4 multicast address to send the requests to, as a string.
+*                               If DEF_NULL,    use SNTPc_CFG_MANYCAST_GRP_ADDR.
+*                               Otherwise,      use the passed address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           At least one server discovered.
+*                               SNTPc_ERR_SERVER_CFG     Invalid address or socket error.
+*                               SNTPc_ERR_MANYCAST_NONE  No server answered (see Note #4).
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : Number of servers discovered.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) RFC #5905, Section 3.1 'Dynamic Server Discovery' describes the manycast mode : a request is
+*                   sent to a multicast address with a TTL of 1, then with a larger TTL, until enough servers
+*                   answered. Each server replies from its unicast address. The replies to each request are
+*                   collected during SNTPc_CFG_MANYCAST_RX_WINDOW_MS & the TTL is doubled up to
+*                   SNTPc_CFG_MANYCAST_TTL_MAX.
+*
+*               (2) The servers are ranked by root distance, which adds half the round trip delay to the
+*                   server & the distance of the server to its primary reference (see RFC #5905, Appendix
+*                   A.5.5.2). Servers at the same distance are ranked by stratum. The best
+*                   SNTPc_CFG_MANYCAST_SERVER_NBR_MAX servers are kept.
+*
+*               (3) Once servers are discovered, the requests & the bursts with the default configuration
+*                   (see SNTPc_ReqRemoteTime() & SNTPc_ReqRemoteTimeBurst()) are sent to the best server, by
+*                   IP address. A server is skipped once a request to it failed. When all the servers
+*                   failed, the default configuration is used again until the next discovery.
+*
+*               (4) If no server answered, the servers of the previous discovery are kept.
+*
+*               (5) This function blocks for up to SNTPc_CFG_MANYCAST_RX_WINDOW_MS per TTL tried.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+CPU_INT08U  SNTPc_ManycastDiscover (const CPU_CHAR   *p_grp_addr,
+                                          SNTPc_ERR  *p_err)
+{
+    SNTPc_MANYCAST_ENTRY   tbl[SNTPc_CFG_MANYCAST_SERVER_NBR_MAX];
+    NET_SOCK_ADDR          grp_addr;
+    NET_SOCK_ADDR_IPv4    *p_addr_ipv4;
+    NET_IPv4_ADDR          addr;
+    NET_IP_ADDR_FAMILY     ip_family;
+    NET_SOCK_ID            sock;
+    CPU_INT16U             ttl;
+    CPU_INT08U             nbr;
+    CPU_INT08U             ix;
+    NET_ERR                err_net;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(0u);
+    }
+#endif
+                                                                /* ---------------- VALIDATE GRP ADDR ----------------- */
+    if (p_grp_addr == DEF_NULL) {
+        p_grp_addr = SNTPc_CFG_MANYCAST_GRP_ADDR;
+    }
+
+    addr      = NET_IPv4_ADDR_NONE;
+    ip_family = NetASCII_Str_to_IP((CPU_CHAR *)p_grp_addr,
+                                               &addr,
+                                                sizeof(addr),
+                                               &err_net);
+    if ((err_net                        != NET_ASCII_ERR_NONE     ) ||
+        (ip_family                      != NET_IP_ADDR_FAMILY_IPv4) ||
+        ((addr & SNTPc_IPv4_MCAST_MASK) != SNTPc_IPv4_MCAST_PREFIX)) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (0u);
+    }
+
+    Mem_Clr(&grp_addr, sizeof(grp_addr));
+    p_addr_ipv4             = (NET_SOCK_ADDR_IPv4 *)&grp_addr;
+    p_addr_ipv4->AddrFamily =  NET_SOCK_ADDR_FAMILY_IP_V4;
+    p_addr_ipv4->Port       =  NET_UTIL_HOST_TO_NET_16(SNTPc_DFLT_IPPORT);
+    p_addr_ipv4->Addr       =  NET_UTIL_HOST_TO_NET_32(addr);
+                                                                /* ------------------- OPEN SOCKET -------------------- */
+    sock = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                        NET_SOCK_TYPE_DATAGRAM,
+                        NET_SOCK_PROTOCOL_UDP,
+                       &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (0u);
+    }
+
+    (void)NetSock_CfgBlock(sock, NET_SOCK_BLOCK_SEL_BLOCK, &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+        (void)NetSock_Close(sock, &err_net);
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (0u);
+    }
+                                                                /* ------------- EXPANDING TTL DISCOVERY -------------- */
+    nbr = 0u;
+    ttl = 1u;
+    while (DEF_ON) {                                            /* See Note #1.                                         */
+        nbr = SNTPc_ManycastRound( sock,
+                                  &grp_addr,
+                                  (NET_IP_TTL)ttl,
+                                   tbl,
+                                   nbr);
+        if ((nbr >= SNTPc_CFG_MANYCAST_SERVER_NBR_MAX) ||
+            (ttl >= SNTPc_CFG_MANYCAST_TTL_MAX       )) {
+            break;
+        }
+        ttl = DEF_MIN(ttl * 2u, SNTPc_CFG_MANYCAST_TTL_MAX);
+    }
+
+    (void)NetSock_Close(sock, &err_net);
+
+    if (nbr == 0u) {
+       *p_err = SNTPc_ERR_MANYCAST_NONE;                        /* See Note #4.                                         */
+        return (0u);
+    }
+                                                                /* ---------------- KEEP BEST SERVERS ----------------- */
+    for (ix = 0u; ix < nbr; ix++) {
+        p_addr_ipv4 = (NET_SOCK_ADDR_IPv4 *)&tbl[ix].ServerAddr;
+        (void)NetASCII_IPv4_to_Str(NET_UTIL_NET_TO_HOST_32(p_addr_ipv4->Addr),
+                                   tbl[ix].Server.Addr,
+                                   DEF_NO,
+                                  &err_net);
+    }
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (0u);
+    }
+
+    Mem_Copy(SNTPc_ManycastTbl, tbl, sizeof(SNTPc_MANYCAST_ENTRY) * nbr);
+    SNTPc_ManycastNbr = nbr;
+
+    SNTPc_ReleaseLock();
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_ManycastServerGet()
+*
+* Description : Get the servers found by the last manycast discovery, best first.
+*
+* Argument(s) : p_tbl       Pointer to a table that will receive the servers.
+*
+*               tbl_size    Number of entries in the table.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Servers successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : Number of servers returned.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The address string of a server can be used as the hostname of a server configuration, for
+*                   instance to query the best servers with SNTPc_ReqRemoteTimeMulti().
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+CPU_INT08U  SNTPc_ManycastServerGet (SNTPc_MANYCAST_SERVER  *p_tbl,
+                                     CPU_INT08U              tbl_size,
+                                     SNTPc_ERR              *p_err)
+{
+    CPU_INT08U  nbr;
+    CPU_INT08U  ix;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(0u);
+    }
+
+    if (p_tbl == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (0u);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (0u);
+    }
+
+    nbr = DEF_MIN(tbl_size, SNTPc_ManycastNbr);
+    for (ix = 0u; ix < nbr; ix++) {
+        p_tbl[ix] = SNTPc_ManycastTbl[ix].Server;
+    }
+
+    SNTPc_ReleaseLock();
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ManycastFlush()
+*
+* Description : Forget the servers found by the manycast discovery.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Servers successfully forgotten.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The requests with the default configuration use the default server again.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+void  SNTPc_ManycastFlush (SNTPc_ERR  *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    SNTPc_ManycastNbr = 0u;                                     /* See Note #1.                                         */
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_ReqRemoteTimeNTS()
+*
+* Description : Send a request authenticated with Network Time Security (NTS) to an NTP server & receive its
+*               reply.
+*
+* Argument(s) : p_cfg   Pointer to the configuration of the NTS key establishment server (see Note #1).
+*
+*               ppkt    Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           An authenticated reply has been received.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the request to fail.
+*                               SNTPc_ERR_TX             Error occurred during the request transmission.
+*                               SNTPc_ERR_RX             No authenticated reply received before the Rx timeout.
+*                               SNTPc_ERR_KOD            Kiss-o'-Death reply received, server put in backoff.
+*                               SNTPc_ERR_SERVER_BACKOFF Server in backoff, request not sent.
+*                               SNTPc_ERR_NTS_KE         NTS key establishment failed.
+*                               SNTPc_ERR_NTS_NAK        NTS cookie rejected by the server (see Note #4).
+*
+* Return(s)   : DEF_TRUE,  if the SNTP request has been successfully completed.
+*
+*               DEF_FALSE, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The hostname & the port of the configuration designate the NTS key establishment server
+*                   (see SNTPc_NTS_KE_DFLT_IPPORT). The NTP server & port are negotiated by the key
+*                   establishment. If none is negotiated, the key establishment server is queried on the NTP
+*                   port. The address family & the Rx timeout of the configuration apply to the NTP exchange.
+*
+*               (2) The keys & the cookies of each key establishment server are kept. Each request sends one
+*                   cookie & asks for as many new cookies as needed to refill SNTPc_CFG_NTS_COOKIE_NBR_MAX
+*                   cookies. A new key establishment is performed, without the module lock, when no cookie is
+*                   left.
+*
+*               (3) Only an authenticated reply is accepted. A reply that fails the authentication is dropped
+*                   & the reception is resumed. A Kiss-o'-Death reply puts the server in backoff only if it is
+*                   authenticated (see RFC #8915, Section 5.7).
+*
+*               (4) A "NTSN" Kiss-o'-Death reply that echoes the unique identifier of the request discards the
+*                   keys & the cookies of the server, so that the next request performs a new key
+*                   establishment.
+*
+*               (5) The request is sent on its own socket, since its length differs from the other requests.
+*                   Neither the socket pool nor the shared sockets are used.
+*
+*               (6) Each valid reply is added to the clock filter of the NTP server (see
+*                   'SNTPc_FilterStatusGet()').
+*
+*               (7) The request is counted in the statistics of the key establishment server (see
+*                   'SNTPc_StatServerGet()').
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeNTS (const SNTPc_CFG  *p_cfg,
+                                           SNTP_PKT   *ppkt,
+                                           SNTPc_ERR  *p_err)
+{
+    SNTPc_NTS_REQ       req;
+    SNTPc_CFG           ntp_cfg;
+    SNTPc_SAMPLE        sample;
+    NET_IP_ADDR_FAMILY  ip_family;
+    CPU_SIZE_T          hostname_len;
+    CPU_BOOLEAN         is_pref;
+    CPU_BOOLEAN         result;
+    SNTPc_ERR           err;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+
+    if ((p_cfg == DEF_NULL) ||
+        (ppkt  == DEF_NULL)) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+
+    hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+    if (hostname_len > SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        result = DEF_FAIL;
+        goto exit;
+    }
+                                                                /* -------------------- GET COOKIE -------------------- */
+    result = SNTPc_NTS_CookiePop(p_cfg, &req, p_err);           /* See Note #2.                                         */
+    if (*p_err != SNTPc_ERR_NONE) {
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+    if (result == DEF_NO) {
+        SNTPc_NTS_KE(p_cfg, p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            result = DEF_FAIL;
+            goto exit;
+        }
+
+        result = SNTPc_NTS_CookiePop(p_cfg, &req, p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            result = DEF_FAIL;
+            goto exit;
+        }
+        if (result == DEF_NO) {                                 /* Cookies used by concurrent reqs.                     */
+           *p_err = SNTPc_ERR_NTS_KE;
+            result = DEF_FAIL;
+            goto exit;
+        }
+    }
+                                                                /* ----------------- NTP SERVER CONFIG ---------------- */
+    ntp_cfg.ServerHostnamePtr = req.ServerHostname;             /* See Note #1.                                         */
+    ntp_cfg.ServerPortNbr     = req.ServerPortNbr;
+    ntp_cfg.ServerAddrFamily  = p_cfg->ServerAddrFamily;
+    ntp_cfg.ReqRxTimeout_ms   = p_cfg->ReqRxTimeout_ms;
+
+    if (SNTPc_BackoffIsActive(&ntp_cfg) == DEF_YES) {
+        SNTPc_NTS_CookieRestore(p_cfg, &req);                   /* The cookie was not sent, keep it.                    */
+       *p_err = SNTPc_ERR_SERVER_BACKOFF;
+        result = DEF_FAIL;
+        goto exit;
+    }
+                                                                /* --------------------- EXCHANGE --------------------- */
+    result = SNTPc_NTS_Exchange( p_cfg,
+                                &ntp_cfg,
+                                &req,
+                                 ppkt,
+                                &ip_family,
+                                &is_pref,
+                                 p_err);
+    if (result != DEF_OK) {
+        goto exit;
+    }
+
+    SNTPc_BackoffClr(&ntp_cfg);
+    if (is_pref == DEF_YES) {                                   /* Remember the family that worked for this server.     */
+        SNTPc_AddrFamilyPrefSet(&ntp_cfg, ip_family);
+    }
+    SNTPc_PktDecode(ppkt, &sample, &err);                       /* See Note #6.                                         */
+    SNTPc_FilterSampleAdd(&ntp_cfg, &sample);
+
+    result = DEF_OK;
+
+exit:
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    SNTPc_StatReqRecord(p_cfg,                                  /* See Note #7.                                         */
+                       (result == DEF_OK) ? &sample : DEF_NULL,
+                       *p_err);
+#endif
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_REQ,
+                    *p_err,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(sample.RoundTripDly_ns / 1000) : 0u,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(sample.Offset_ns       / 1000) : 0u);
+    return (result);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_NTS_Flush()
+*
+* Description : Discard the NTS keys & cookies of all the key establishment servers.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Keys & cookies successfully discarded.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The next request to each server performs a new key establishment, e.g. once the trusted
+*                   certificates of the product changed.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+void  SNTPc_NTS_Flush (SNTPc_ERR  *p_err)
+{
+    CPU_INT16U  ix;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    for (ix = 0u; ix < SNTPc_CFG_NTS_SERVER_NBR_MAX; ix++) {    /* See Note #1.                                         */
+        SNTPc_NTS_Tbl[ix].IsValid = DEF_NO;
+    }
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc_GetRemoteTime()
+*
+* Description : Get remote time (NTP timestamp) from a received NTP packet.
+*
+* Argument(s) : ppkt     Pointer to received SNTP message packet.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The time has been successfully computed from the SNTP packet.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : NTP timestamp, if NO error(s).
+*
+*               Null timestamp, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The packet is decoded by SNTPc_PktDecode() & the offset of the server clock is added to
+*                   the current local time. Applications that only need the offset SHOULD decode the packet
+*                   once & call SNTPc_GetOffset_ns() instead.
+*********************************************************************************************************
+*/
+
+SNTP_TS  SNTPc_GetRemoteTime (SNTP_PKT  *ppkt,
+                              SNTPc_ERR *p_err)
+{
+    SNTPc_SAMPLE  sample;
+    SNTP_TS       remote_time;
+
+
+    remote_time.Sec  = 0u;
+    remote_time.Frac = 0u;
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(remote_time);
+    }
+
+    if (ppkt == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        goto exit;
+    }
+#endif
+                                                                /* Apply offset to local time (see Note #1).            */
+    SNTPc_PktDecode(ppkt, &sample, p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        goto exit;
+    }
+    remote_time = SNTPc_LocalTimeOffsetGet(SNTPc_NsToFixed(sample.Offset_ns));
+
+exit:
+    return (remote_time);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_GetRoundTripDly_us()
+*
+* Description : Get SNTP packet round trip delay from a received SNTP message packet.
+*
+* Argument(s) : ppkt     Pointer to received SNTP message packet.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The round trip delay has been successfully computed from the SNTP packet.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : SNTP packet round trip delay in us, if NO error(s).
+*
+*               0,                                   otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) If the round trip delay is faster than the precision of the system clock, then the
+*                   round trip delay is approximated to 0.
+*
+*               (2) The packet is decoded by SNTPc_PktDecode(). Only the integer part of the round trip delay
+*                   in microseconds is returned.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  SNTPc_GetRoundTripDly_us (SNTP_PKT   *ppkt,
+                                      SNTPc_ERR  *p_err)
+{
+    SNTPc_SAMPLE  sample;
+    CPU_INT64S    round_trip_dly_us;
+    CPU_INT32U    round_trip_dly_32;
+
+
+    round_trip_dly_32 = 0u;
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (ppkt == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        goto exit;
+    }
+#endif
+
+                                                                /* ------------- CALCULATE ROUND TRIP DLY ------------- */
+    SNTPc_PktDecode(ppkt, &sample, p_err);                      /* See Note #2.                                         */
+    if (*p_err != SNTPc_ERR_NONE) {
+        goto exit;
+    }
+    round_trip_dly_us = sample.RoundTripDly_ns / 1000;          /* See Note #1.                                         */
+    round_trip_dly_us = DEF_MIN(round_trip_dly_us, (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+
+    round_trip_dly_32 = (CPU_INT32U)round_trip_dly_us;
+
+exit:
+    return (round_trip_dly_32);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_PktDecode()
+*
+* Description : Decode a sample from a received SNTP packet.
+*
+* Argument(s) : ppkt        Pointer to received SNTP message packet.
+*
+*               p_sample    Pointer to a variable that will receive the decoded sample.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The sample has been successfully decoded.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               SNTPc_GetRemoteTime(),
+*               SNTPc_GetRoundTripDly_us(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeMulti(),
+*               SNTPc_SyncProcess(),
+*               SNTPc_BcastRxProcess(),
+*               SNTPc_BcastCal(),
+*               SNTPc_ManycastRound(),
+*               SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The packet MUST have been received by SNTPc_ReqRemoteTime() or by an asynchronous
+*                   request, which keep the local reception timestamp in the reference timestamp field of
+*                   the packet.
+*
+*               (2) The offset & round trip delay are computed on the 64-bit NTP timestamps (see RFC #5905,
+*                   Section 8) :
+*
+*                       offset = ((T2 - T1) + (T3 - T4)) / 2
+*                       delay  =  (T4 - T1) - (T3 - T2)
+*
+*                   where T1 is the originate, T2 the receive, T3 the transmit & T4 the local reception
+*                   timestamp. If the round trip delay is shorter than the resolution of the clocks, it is
+*                   set to 0.
+*
+*               (3) Root delay & root dispersion are 16.16 fixed-point seconds, limited to
+*                   DEF_INT_32U_MAX_VAL microseconds.
+*********************************************************************************************************
+*/
+
+void  SNTPc_PktDecode (SNTP_PKT      *ppkt,
+                       SNTPc_SAMPLE  *p_sample,
+                       SNTPc_ERR     *p_err)
+{
+    SNTP_FIXED  offset;
+    SNTP_FIXED  dly;
+    CPU_INT64U  root_dly_us;
+    CPU_INT64U  root_disp_us;
+    CPU_INT32U  cw;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((ppkt     == DEF_NULL) ||
+        (p_sample == DEF_NULL)) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+                                                                /* ----------------- DECODE TIMESTAMPS ---------------- */
+    p_sample->TS_Originate    = SNTPc_TS_ToFixed(&ppkt->TS_Originate);
+    p_sample->TS_Rx           = SNTPc_TS_ToFixed(&ppkt->TS_Rx);
+    p_sample->TS_Tx           = SNTPc_TS_ToFixed(&ppkt->TS_Tx);
+                                                                /* See Note #1.                                         */
+    p_sample->TS_Terminate    = SNTPc_TS_ToFixed(&ppkt->TS_Ref);
+                                                                /* ----------- CALC OFFSET & ROUND TRIP DLY ----------- */
+    offset                    = SNTPc_FixedOffsetGet(p_sample->TS_Originate,
+                                                     p_sample->TS_Rx,
+                                                     p_sample->TS_Tx,
+                                                     p_sample->TS_Terminate);
+    dly                       = SNTPc_FixedDlyGet(p_sample->TS_Originate,
+                                                  p_sample->TS_Rx,
+                                                  p_sample->TS_Tx,
+                                                  p_sample->TS_Terminate);
+    dly                       = DEF_MAX(dly, 0);                /* See Note #2.                                         */
+
+    p_sample->Offset_ns       = SNTPc_FixedToNs(offset);
+    p_sample->RoundTripDly_ns = SNTPc_FixedToNs(dly);
+                                                                /* ------------------ DECODE HEADER ------------------- */
+    root_dly_us               = ((CPU_INT64U)NET_UTIL_NET_TO_HOST_32(ppkt->RootDly)        * DEF_TIME_NBR_uS_PER_SEC) >> 16u;
+    root_disp_us              = ((CPU_INT64U)NET_UTIL_NET_TO_HOST_32(ppkt->RootDispersion) * DEF_TIME_NBR_uS_PER_SEC) >> 16u;
+    p_sample->RootDly_us      = (CPU_INT32U)DEF_MIN(root_dly_us,  DEF_INT_32U_MAX_VAL);
+    p_sample->RootDisp_us     = (CPU_INT32U)DEF_MIN(root_disp_us, DEF_INT_32U_MAX_VAL);
+    p_sample->RefID           = NET_UTIL_NET_TO_HOST_32(ppkt->RefID);
+
+    cw                        = NET_UTIL_NET_TO_HOST_32(ppkt->CW);
+    p_sample->LI              = (CPU_INT08U)(cw >> (SNTPc_MSG_FLAG_SHIFT + SNTPc_MSG_FLAG_LI_SHIFT));
+    p_sample->Stratum         = (CPU_INT08U)(cw >>  SNTPc_MSG_STRATUM_SHIFT);
+    p_sample->Precision       = (CPU_INT08S)(cw &   DEF_INT_08U_MAX_VAL);
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_GetOffset_ns()
+*
+* Description : Get the offset of the server clock from the local clock from a decoded sample.
+*
+* Argument(s) : p_sample    Pointer to a sample decoded by SNTPc_PktDecode().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The offset has been successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : Offset, in nanoseconds. A positive offset means that the server clock is ahead.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Unlike SNTPc_GetRemoteTime(), the local time is not read again. The offset can be applied
+*                   to the time base that produced the timestamps of the request.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_GetOffset_ns (const SNTPc_SAMPLE  *p_sample,
+                                      SNTPc_ERR     *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(0);
+    }
+
+    if (p_sample == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (0);
+    }
+#endif
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (p_sample->Offset_ns);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_GetRoundTripDly_ns()
+*
+* Description : Get the round trip delay from a decoded sample.
+*
+* Argument(s) : p_sample    Pointer to a sample decoded by SNTPc_PktDecode().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The round trip delay has been successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : Round trip delay, in nanoseconds.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_GetRoundTripDly_ns (const SNTPc_SAMPLE  *p_sample,
+                                            SNTPc_ERR     *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(0);
+    }
+
+    if (p_sample == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (0);
+    }
+#endif
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (p_sample->RoundTripDly_ns);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc_ReqRemoteTimeMulti()
+*
+* Description : Send requests to a set of NTP servers & combine the replies of the servers that agree.
+*
+* Argument(s) : p_cfg_tbl   Pointer to a table of server configurations.
+*
+*               cfg_nbr     Number of server configurations in the table.
+*
+*               timeout_ms  Time to wait for the replies of all the servers, in milliseconds.
+*
+*               p_result    Pointer to a variable that will receive the combined result.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           The combined offset has been successfully computed.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_SERVER_CFG     Invalid number of server configurations.
+*                               SNTPc_ERR_RX             No server replied before the timeout.
+*                               SNTPc_ERR_NO_MAJORITY    No majority of the servers that replied agree on the time.
+*
+* Return(s)   : DEF_OK,   if a combined offset has been computed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The requests are sent to all the servers at once & the replies are received until all
+*                   the servers replied or the timeout expired (see 'SNTPc_ReqMultiExchange()').
+*
+*               (2) The replies are processed by the selection, clustering & combining algorithms of
+*                   RFC #5905, Section 11.2. Servers whose time does not agree with the majority of the
+*                   servers are discarded, so that a single falseticker cannot corrupt the result.
+*
+*               (3) On SNTPc_ERR_NO_MAJORITY, the servers that replied are still returned in the result.
+*
+*               (4) Each reply is added to the clock filter of its server (see 'SNTPc_FilterStatusGet()').
+*
+*               (5) Each server is counted as one request in the statistics. Without socket selection, the
+*                   servers are queried by SNTPc_ReqRemoteTime(), which counts them. Otherwise, a server
+*                   without a valid reply is counted as a reception failure.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeMulti (const SNTPc_CFG           *p_cfg_tbl,
+                                             CPU_INT08U           cfg_nbr,
+                                             CPU_INT32U           timeout_ms,
+                                             SNTPc_MULTI_RESULT  *p_result,
+                                             SNTPc_ERR           *p_err)
+{
+    SNTP_PKT          pkt_tbl[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+    SNTPc_SEL_SAMPLE  sample_tbl[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+    CPU_INT08U        cfg_ix_tbl[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+    SNTPc_SAMPLE      sample;
+    CPU_INT32U        rx_mask;
+    CPU_INT08U        sample_nbr;
+    CPU_INT08U        ix;
+    SNTPc_ERR         err;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+
+    if ((p_cfg_tbl == DEF_NULL) ||
+        (p_result  == DEF_NULL)) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (DEF_FAIL);
+    }
+#endif
+
+    if ((cfg_nbr == 0u                            ) ||
+        (cfg_nbr >  SNTPc_CFG_MULTI_SERVER_NBR_MAX)) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_FAIL);
+    }
+
+    Mem_Clr(p_result, sizeof(SNTPc_MULTI_RESULT));
+                                                                /* ------------- EXCHANGE WITH ALL SERVERS ------------ */
+    rx_mask          = SNTPc_ReqMultiExchange(p_cfg_tbl,        /* See Note #1.                                         */
+                                              cfg_nbr,
+                                              timeout_ms,
+                                              pkt_tbl);
+    p_result->RxMask = rx_mask;
+#if ((SNTPc_CFG_STAT_EN   == DEF_ENABLED) && \
+     (NET_SOCK_CFG_SEL_EN == DEF_ENABLED))
+    for (ix = 0u; ix < cfg_nbr; ix++) {                         /* See Note #5.                                         */
+        if (DEF_BIT_IS_SET(rx_mask, DEF_BIT32(ix)) == DEF_NO) {
+            SNTPc_StatReqRecord(&p_cfg_tbl[ix], DEF_NULL, SNTPc_ERR_RX);
+        }
+    }
+#endif
+    if (rx_mask == 0u) {
+       *p_err = SNTPc_ERR_RX;
+        return (DEF_FAIL);
+    }
+                                                                /* ---------------- BUILD SAMPLE TABLE ---------------- */
+    sample_nbr = 0u;
+    for (ix = 0u; ix < cfg_nbr; ix++) {
+        if (DEF_BIT_IS_SET(rx_mask, DEF_BIT32(ix)) == DEF_YES) {
+            SNTPc_PktDecode(&pkt_tbl[ix], &sample, &err);
+                                                                /* See Note #4.                                         */
+            SNTPc_FilterSampleAdd(&p_cfg_tbl[ix], &sample);
+#if ((SNTPc_CFG_STAT_EN   == DEF_ENABLED) && \
+     (NET_SOCK_CFG_SEL_EN == DEF_ENABLED))
+            SNTPc_StatReqRecord(&p_cfg_tbl[ix], &sample, SNTPc_ERR_NONE);
+#endif
+            SNTPc_SampleSelGet(&sample, &sample_tbl[sample_nbr]);
+            cfg_ix_tbl[sample_nbr] = ix;
+            sample_nbr++;
+        }
+    }
+                                                                /* ------------ SELECT, CLUSTER & COMBINE ------------- */
+    if (SNTPc_SelIntersect(sample_tbl, sample_nbr) == 0u) {     /* See Note #2.                                         */
+       *p_err = SNTPc_ERR_NO_MAJORITY;
+        return (DEF_FAIL);
+    }
+
+    p_result->SurvivorNbr = SNTPc_SelCluster(sample_tbl,
+                                             sample_nbr,
+                                             SNTPc_CFG_SEL_SURVIVOR_NBR_MIN);
+    p_result->Offset_us   = SNTPc_SelCombine(sample_tbl,
+                                             sample_nbr,
+                                            &p_result->Jitter_us);
+
+    for (ix = 0u; ix < sample_nbr; ix++) {
+        if (sample_tbl[ix].IsTruechimer == DEF_YES) {
+            DEF_BIT_SET(p_result->TruechimerMask, DEF_BIT32(cfg_ix_tbl[ix]));
+        }
+        if (sample_tbl[ix].IsSurvivor == DEF_YES) {
+            DEF_BIT_SET(p_result->SurvivorMask, DEF_BIT32(cfg_ix_tbl[ix]));
+        }
+    }
+
+    p_result->RemoteTime = SNTPc_LocalTimeOffsetGet(SNTPc_UsToFixed(p_result->Offset_us));
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc_ReqRemoteTimeBurst()
+*
+* Description : Send a burst of requests to an NTP server & keep the reply with the lowest round trip delay.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration to use by the SNTP client.
+*                                   If DEF_NULL,    use default configuration set in the initialization.
+*                                   Otherwise,      use the passed configuration.
+*
+*               req_nbr         Number of requests in the burst.
+*
+*               interval_ms     Interval between two requests of the burst, in milliseconds.
+*
+*               p_result        Pointer to a variable that will receive the result of the burst.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           At least one reply has been received.
+*                                   SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Error in the Server configuration or invalid number of requests.
+*                                   SNTPc_ERR_TX             No request could be transmitted.
+*                                   SNTPc_ERR_RX             No reply received before the Rx timeout.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death reply received (see Note #5).
+*                                   SNTPc_ERR_SERVER_BACKOFF Server in backoff, no request sent (see Note #5).
+*
+* Return(s)   : DEF_OK,   if at least one reply has been received.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application,
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : (1) All the requests are sent on the same socket, one every interval_ms. The replies are
+*                   received while waiting for the next request to be sent, & until the configured Rx
+*                   timeout expires after the last request.
+*
+*               (2) A reply is matched to its request by its originate timestamp, which is the transmit
+*                   timestamp of the request. Replies that do not match a request of the burst, or that
+*                   match an already answered request, are discarded & counted in the reception
+*                   statistics, as are the invalid packets (see 'SNTPc_Rx() Note #2'). The requests of a
+*                   burst MUST then be sent at least 1 ms apart.
+*
+*               (3) The reply with the lowest round trip delay, as decoded by SNTPc_PktDecode(),
+*                   suffered the least queuing delay & gives the most accurate offset. The spread of the
+*                   round trip delays & offsets of all the replies is also returned.
+*
+*               (4) The socket is closed if a request was not answered, so that a late reply is never
+*                   received by a following request.
+*
+*               (5) The burst fails with SNTPc_ERR_SERVER_BACKOFF, without any network access, while the server
+*                   is in backoff. A Kiss-o'-Death reply stops the burst, puts the server in backoff & fails
+*                   the burst with SNTPc_ERR_KOD, even if replies were already received (see
+*                   'SNTPc_BackoffStart() Note #1').
+*
+*               (6) Each valid reply of the burst is added to the clock filter of the server (see
+*                   'SNTPc_FilterStatusGet()').
+*
+*               (7) In shared socket mode, the requests are sent on the shared socket of the address family
+*                   & each reply is matched to its request by the nonce it echoes (see 'SNTPc_MuxTx()
+*                   Note #2'), so the requests of a burst may be sent less than 1 ms apart. The unanswered
+*                   requests are freed, so that their late reply is dropped.
+*
+*               (8) Once manycast servers were discovered, a burst with the default configuration is sent
+*                   to the best discovered server (see 'SNTPc_ManycastDiscover() Note #3').
+*
+*               (9) The burst is counted as one request in the statistics, with the sample of the reply kept
+*                   (see 'SNTPc_StatServerGet()').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeBurst (const SNTPc_CFG           *p_cfg,
+                                             CPU_INT08U           req_nbr,
+                                             CPU_INT32U           interval_ms,
+                                             SNTPc_BURST_RESULT  *p_result,
+                                             SNTPc_ERR           *p_err)
+{
+    const SNTPc_CFG           *p_server_cfg;
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+          SNTPc_MUX_REQ       *p_req_tbl[SNTPc_CFG_BURST_REQ_NBR_MAX];
+#else
+          SNTPc_SOCK_ENTRY    *p_entry;
+          SNTPc_SOCK_ENTRY     entry_tmp;
+          SNTPc_TX_TS          tx_ts_tbl[SNTPc_CFG_BURST_REQ_NBR_MAX];
+          CPU_BOOLEAN          is_rx_tbl[SNTPc_CFG_BURST_REQ_NBR_MAX];
+          NET_ERR              err_net;
+#endif
+          NET_SOCK_ADDR        server_addr;
+          NET_IP_ADDR_FAMILY   ip_family;
+          SNTP_PKT             pkt;
+          SNTPc_SAMPLE         sample;
+          CPU_BOOLEAN          is_pref;
+          CPU_BOOLEAN          is_kod;
+          NET_TS_MS            ts_start;
+          NET_TS_MS            ts_last_tx;
+          NET_TS_MS            elapsed_ms;
+          NET_TS_MS            wait_end_ms;
+          NET_TS_MS            wait_ms;
+          NET_TS_MS            wait_max_ms;
+          SNTPc_ERR            err;
+          CPU_INT64S           offset_us;
+          CPU_INT64S           offset_min_us;
+          CPU_INT64S           offset_max_us;
+          CPU_INT32U           dly_us;
+          CPU_INT08U           tx_ok_nbr;
+          CPU_INT08U           ix;
+          CPU_BOOLEAN          result;
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+          SNTPc_MANYCAST_CFG   cfg_manycast;
+          CPU_BOOLEAN          is_manycast;
+#endif
+
+
+    p_server_cfg = DEF_NULL;
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+
+    if (p_result == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+
+    if ((req_nbr == 0u                         ) ||
+        (req_nbr >  SNTPc_CFG_BURST_REQ_NBR_MAX)) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+    Mem_Clr(p_result, sizeof(SNTPc_BURST_RESULT));
+                                                                /* --------------- SELECT SERVER CONFIG --------------- */
+    if (p_cfg == DEF_NULL) {
+        SNTPc_AcquireLock(p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            result = DEF_FAIL;
+            goto exit;
+        }
+        p_server_cfg = SNTPc_DfltCfgPtr;                        /* If DEF_NULL, Use the Default Server config.          */
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+        is_manycast  = SNTPc_ManycastCfgGet(&cfg_manycast);     /* See Note #8.                                         */
+#endif
+        SNTPc_ReleaseLock();
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+        if (is_manycast == DEF_YES) {
+            result = SNTPc_ReqRemoteTimeBurst(&cfg_manycast.Cfg,
+                                               req_nbr,
+                                               interval_ms,
+                                               p_result,
+                                               p_err);
+            SNTPc_ManycastResultSet(&cfg_manycast, result);
+            return (result);
+        }
+#endif
+    } else {
+        p_server_cfg = p_cfg;                                   /* Otherwise, use the passed configuration.             */
+    }
+
+    if (SNTPc_BackoffIsActive(p_server_cfg) == DEF_YES) {       /* See Note #5.                                         */
+       *p_err = SNTPc_ERR_SERVER_BACKOFF;
+        result = DEF_FAIL;
+        goto exit;
+    }
+                                                                /* ------------ GET SERVER ADDR & SOCKET -------------- */
+    SNTPc_ServerAddrSel( p_server_cfg,
+                        &ip_family,
+                        &server_addr,
+                        &is_pref,
+                         p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_DISABLED)
+    p_entry = SNTPc_SockGet(p_server_cfg,
+                           &server_addr,
+                           &entry_tmp,
+                            p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+                                                                /* -------------- TX REQS & RX REPLIES ---------------- */
+    offset_min_us = 0;
+    offset_max_us = 0;
+    tx_ok_nbr     = 0u;
+    is_kod        = DEF_NO;
+    ts_start      = NetUtil_TS_Get_ms();
+    ts_last_tx    = ts_start;
+
+    while ((p_result->RxNbr < req_nbr) &&                       /* See Note #1.                                         */
+           (is_kod          == DEF_NO )) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if ((p_result->TxNbr < req_nbr                                     ) &&
+            (elapsed_ms     >= (NET_TS_MS)(p_result->TxNbr * interval_ms))) {
+            ix = p_result->TxNbr;
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+            p_req_tbl[ix] = SNTPc_MuxTx(&server_addr, &err);    /* See Note #7.                                         */
+            result        = (p_req_tbl[ix] != DEF_NULL) ? DEF_OK : DEF_FAIL;
+#else
+            result = SNTPc_Tx( p_entry->SockID,
+                              &server_addr,
+                              &tx_ts_tbl[ix],
+                               DEF_NO,
+                              &err);
+            is_rx_tbl[ix] = (result == DEF_OK) ? DEF_NO : DEF_YES;
+#endif
+            if (result == DEF_OK) {
+                tx_ok_nbr++;
+            }
+            ts_last_tx    = NetUtil_TS_Get_ms();
+            p_result->TxNbr++;
+            continue;
+        }
+
+        if (p_result->TxNbr < req_nbr) {                        /* Wait until next req is due.                          */
+            wait_end_ms = ts_start   + (NET_TS_MS)(p_result->TxNbr * interval_ms);
+            wait_max_ms = interval_ms;
+        } else {                                                /* Wait until Rx timeout after last req.                */
+            wait_end_ms = ts_last_tx + p_server_cfg->ReqRxTimeout_ms;
+            wait_max_ms = p_server_cfg->ReqRxTimeout_ms;
+        }
+        wait_ms = wait_end_ms - NetUtil_TS_Get_ms();
+        if ((wait_ms == 0u         ) ||
+            (wait_ms >  wait_max_ms)) {                         /* Wait end already reached.                            */
+            if (p_result->TxNbr < req_nbr) {
+                continue;
+            }
+            break;
+        }
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+        ix = SNTPc_MuxRx(p_req_tbl, p_result->TxNbr, wait_ms, &pkt, &err);
+        if ((err != SNTPc_ERR_NONE) &&
+            (err != SNTPc_ERR_KOD )) {
+            continue;                                           /* No reply, tx next req or check Rx timeout.           */
+        }
+        (void)SNTPc_TxTS_Apply(&pkt, &p_req_tbl[ix]->TxTS);     /* Reply matched by its nonce, restore the org TS.      */
+        result = (err == SNTPc_ERR_NONE) ? DEF_OK : DEF_FAIL;
+#else
+        NetSock_CfgTimeoutRxQ_Set(p_entry->SockID,
+                                  wait_ms,
+                                 &err_net);
+        p_entry->RxTimeout_ms = SNTPc_SOCK_RX_TIMEOUT_UNKNOWN;  /* Restored by the next req on this sock.              */
+        if (err_net != NET_SOCK_ERR_NONE) {
+            break;
+        }
+
+        result = SNTPc_Rx(p_entry->SockID, &server_addr, &pkt, &err);
+        if ((result == DEF_FAIL     ) &&
+            (err    != SNTPc_ERR_KOD)) {
+            continue;                                           /* No valid reply, tx next req or check Rx timeout.     */
+        }
+                                                                /* Match reply to its req (see Note #2).                */
+        for (ix = 0u; ix < p_result->TxNbr; ix++) {
+            if ((is_rx_tbl[ix]                          == DEF_NO ) &&
+                (SNTPc_TxTS_Apply(&pkt, &tx_ts_tbl[ix]) == DEF_YES)) {
+                break;
+            }
+        }
+        if (ix >= p_result->TxNbr) {
+            SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+            continue;
+        }
+        is_rx_tbl[ix] = DEF_YES;
+#endif
+
+        if (result == DEF_FAIL) {                               /* Stop the burst on a KoD reply (see Note #5).         */
+            SNTPc_BackoffStart(p_server_cfg, &pkt);
+            is_kod = DEF_YES;
+            continue;
+        }
+                                                                /* Keep the reply with the lowest dly (see Note #3).    */
+        SNTPc_PktDecode(&pkt, &sample, &err);
+        SNTPc_FilterSampleAdd(p_server_cfg, &sample);           /* See Note #6.                                         */
+        dly_us    = (CPU_INT32U)DEF_MIN(sample.RoundTripDly_ns / 1000, (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+        offset_us = sample.Offset_ns / 1000;
+        if ((p_result->RxNbr == 0u                         ) ||
+            (dly_us          <  p_result->RoundTripDlyMin_us)) {
+            p_result->Pkt                = pkt;
+            p_result->Sample             = sample;
+            p_result->RoundTripDlyMin_us = dly_us;
+        }
+        if ((p_result->RxNbr == 0u                         ) ||
+            (dly_us          >  p_result->RoundTripDlyMax_us)) {
+            p_result->RoundTripDlyMax_us = dly_us;
+        }
+        if ((p_result->RxNbr == 0u           ) ||
+            (offset_us       <  offset_min_us)) {
+            offset_min_us = offset_us;
+        }
+        if ((p_result->RxNbr == 0u           ) ||
+            (offset_us       >  offset_max_us)) {
+            offset_max_us = offset_us;
+        }
+        p_result->RxNbr++;
+    }
+
+    p_result->OffsetSpread_us = (CPU_INT32U)DEF_MIN(offset_max_us - offset_min_us, (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+                                                                /* -------------------- FREE REQS --------------------- */
+    for (ix = 0u; ix < p_result->TxNbr; ix++) {
+        if (p_req_tbl[ix] != DEF_NULL) {                        /* See Note #7.                                         */
+            SNTPc_MuxReqFree(p_req_tbl[ix]);
+        }
+    }
+#else
+                                                                /* ------------------ RELEASE SOCKET ------------------ */
+    SNTPc_SockRelease(p_entry,                                  /* See Note #4.                                         */
+                     (p_result->RxNbr < p_result->TxNbr) ? DEF_YES : DEF_NO);
+#endif
+
+    if (is_kod == DEF_YES) {
+       *p_err = SNTPc_ERR_KOD;
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+    if (p_result->RxNbr == 0u) {
+       *p_err = (tx_ok_nbr == 0u) ? SNTPc_ERR_TX : SNTPc_ERR_RX;
+        result = DEF_FAIL;
+        goto exit;
+    }
+
+    SNTPc_BackoffClr(p_server_cfg);
+
+    if (is_pref == DEF_YES) {                                   /* Remember the family that worked for this server.     */
+        SNTPc_AddrFamilyPrefSet(p_server_cfg, ip_family);
+    }
+
+   *p_err  = SNTPc_ERR_NONE;
+    result = DEF_OK;
+
+exit:
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    SNTPc_StatReqRecord(p_server_cfg,                           /* See Note #9.                                         */
+                       (result == DEF_OK) ? &p_result->Sample : DEF_NULL,
+                       *p_err);
+#endif
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_REQ,
+                    *p_err,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(p_result->Sample.RoundTripDly_ns / 1000) : 0u,
+                    (result == DEF_OK) ? SNTPc_TRACE_ARG_32S(p_result->Sample.Offset_ns       / 1000) : 0u);
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SockPoolFlush()
+*
+* Description : Close all the sockets kept in the socket pool.
+*
+* Argument(s) : p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Socket pool successfully flushed.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) This function should be called when the network interface configuration changes, so
+*                   that following requests open new sockets & resolve the server addresses again.
+*
+*               (2) The sockets in use by a request in progress are closed when the request releases them.
+*********************************************************************************************************
+*/
+
+void  SNTPc_SockPoolFlush (SNTPc_ERR  *p_err)
+{
+    SNTPc_SOCK_ENTRY  *p_entry;
+    NET_ERR            err;
+    CPU_INT16U         ix;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    for (ix = 0u; ix < SNTPc_CFG_SOCK_POOL_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_SockPool[ix];
+        if (p_entry->IsInUse == DEF_YES) {                      /* See Note #2.                                         */
+            p_entry->IsFlushed = DEF_YES;
+            continue;
+        }
+        if (p_entry->State == SNTPc_SOCK_STATE_OPEN) {
+            (void)NetSock_Close(p_entry->SockID, &err);
+            p_entry->SockID = NET_SOCK_BAD_SOCK;
+        }
+        p_entry->State = SNTPc_SOCK_STATE_FREE;
+    }
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_SockPoolStatGet()
+*
+* Description : Get the socket pool statistics.
+*
+* Argument(s) : p_stat   Pointer to variable that will receive the socket pool statistics.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Statistics successfully copied.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_SockPoolStatGet (SNTPc_SOCK_POOL_STAT  *p_stat,
+                             SNTPc_ERR             *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_stat == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+   *p_stat = SNTPc_SockPoolStat;
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_AddrCacheFlush()
+*
+* Description : Remove all the entries of the server address cache.
+*
+* Argument(s) : p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Server address cache successfully flushed.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Following requests resolve the server hostnames synchronously.
+*********************************************************************************************************
+*/
+
+void  SNTPc_AddrCacheFlush (SNTPc_ERR  *p_err)
+{
+    CPU_INT16U  ix;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        SNTPc_AddrCache[ix].IsValid = DEF_NO;
+    }
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_AddrCacheStatGet()
+*
+* Description : Get the server address cache statistics.
+*
+* Argument(s) : p_stat   Pointer to variable that will receive the server address cache statistics.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Statistics successfully copied.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_AddrCacheStatGet (SNTPc_ADDR_CACHE_STAT  *p_stat,
+                              SNTPc_ERR              *p_err)
+{
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_stat == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+   *p_stat = SNTPc_AddrCacheStat;
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_RxStatGet()
+*
+* Description : Get the reception statistics.
+*
+* Argument(s) : p_stat   Pointer to variable that will receive the reception statistics.
+*
+*               p_err    Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Statistics successfully copied.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The counters are updated without the module lock (see 'SNTPc_RxStatInc() Note #1') & are
+*                   copied within a critical section.
+*********************************************************************************************************
+*/
+
+void  SNTPc_RxStatGet (SNTPc_RX_STAT  *p_stat,
+                       SNTPc_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_stat == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+   *p_stat = SNTPc_RxStat;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_FilterStatusGet()
+*
+* Description : Get the status of the clock filter of a server.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration.
+*                               If DEF_NULL,    use default configuration set in the initialization.
+*                               Otherwise,      use the passed configuration.
+*
+*               p_status    Pointer to variable that will receive the clock filter status.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Clock filter status successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_FILTER_EMPTY   No usable sample in the clock filter of the server.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The clock filter of a server is fed with the valid replies of the server to
+*                   SNTPc_ReqRemoteTime(), SNTPc_ReqRemoteTimeBurst() & SNTPc_ReqRemoteTimeMulti(),
+*                   including the requests of the SNTPc task. It selects the sample with the lowest round
+*                   trip delay among the last eight, so that a reply delayed by the network does not
+*                   produce an offset spike (see 'sntp-c_filter.c').
+*
+*               (2) The offset of the selected sample was measured when the sample was received. The local
+*                   clock may have drifted since then, which is accounted for in the dispersion.
+*
+*               (3) The jitter is at least the resolution of the local timestamps.
+*
+*               (4) Once manycast servers were discovered, the default configuration designates the best
+*                   discovered server (see 'SNTPc_ManycastDiscover() Note #3').
+*********************************************************************************************************
+*/
+
+void  SNTPc_FilterStatusGet (const SNTPc_CFG            *p_cfg,
+                                   SNTPc_FILTER_STATUS  *p_status,
+                                   SNTPc_ERR            *p_err)
+{
+    const SNTPc_CFG           *p_server_cfg;
+          SNTPc_FILTER_ENTRY  *p_entry;
+          SNTPc_FILTER_ENTRY  *p_entry_replace;
+          CPU_BOOLEAN          result;
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+          SNTPc_MANYCAST_CFG   cfg_manycast;
+#endif
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_status == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    Mem_Clr(p_status, sizeof(SNTPc_FILTER_STATUS));
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    if (p_cfg == DEF_NULL) {
+        p_server_cfg = SNTPc_DfltCfgPtr;                        /* If DEF_NULL, Use the Default Server config.          */
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+        if (SNTPc_ManycastCfgGet(&cfg_manycast) == DEF_YES) {   /* See Note #4.                                         */
+            p_server_cfg = &cfg_manycast.Cfg;
+        }
+#endif
+    } else {
+        p_server_cfg = p_cfg;                                   /* Otherwise, use the passed configuration.             */
+    }
+
+    result  = DEF_FAIL;
+    p_entry = SNTPc_FilterSrch(p_server_cfg, &p_entry_replace);
+    if (p_entry != DEF_NULL) {
+        result = SNTPc_FilterEval(&p_entry->Filter,
+                                   SNTPc_ClkLocalGet(),
+                                   p_status);
+    }
+
+    SNTPc_ReleaseLock();
+
+    if (result == DEF_FAIL) {
+       *p_err = SNTPc_ERR_FILTER_EMPTY;
+        return;
+    }
+                                                                /* See Note #3.                                         */
+    p_status->Jitter_us = DEF_MAX(p_status->Jitter_us, SNTPc_LOCAL_TS_RESOLUTION_US);
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_StatServerGet()
+*
+* Description : Get the request statistics of a server.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration.
+*                               If DEF_NULL,    use default configuration set in the initialization.
+*                               Otherwise,      use the passed configuration.
+*
+*               p_stat      Pointer to variable that will receive the request statistics of the server.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE             Statistics successfully returned.
+*                               SNTPc_ERR_NULL_PTR         Invalid pointer.
+*                               SNTPc_ERR_ACQUIRE_LOCK     Error occurred while trying to acquire the module lock.
+*                               SNTPc_ERR_STAT_NOT_FOUND   No statistics kept for the server.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The statistics of the last SNTPc_CFG_STAT_NBR_ENTRIES servers requested are kept. The
+*                   statistics of all the servers are returned by SNTPc_StatGet().
+*
+*               (2) The requests to a NTS server are counted against its key establishment server.
+*
+*               (3) See 'SNTPc_FilterStatusGet() Note #4'.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+void  SNTPc_StatServerGet (const SNTPc_CFG       *p_cfg,
+                                 SNTPc_STAT_REQ  *p_stat,
+                                 SNTPc_ERR       *p_err)
+{
+    const SNTPc_CFG           *p_server_cfg;
+          SNTPc_STAT_ENTRY    *p_entry;
+          SNTPc_STAT_ENTRY    *p_entry_replace;
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+          SNTPc_MANYCAST_CFG   cfg_manycast;
+#endif
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_stat == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    Mem_Clr(p_stat, sizeof(SNTPc_STAT_REQ));
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    if (p_cfg == DEF_NULL) {
+        p_server_cfg = SNTPc_DfltCfgPtr;                        /* If DEF_NULL, Use the Default Server config.          */
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+        if (SNTPc_ManycastCfgGet(&cfg_manycast) == DEF_YES) {   /* See Note #3.                                         */
+            p_server_cfg = &cfg_manycast.Cfg;
+        }
+#endif
+    } else {
+        p_server_cfg = p_cfg;                                   /* Otherwise, use the passed configuration.             */
+    }
+
+    p_entry = SNTPc_StatSrch(p_server_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {
+        SNTPc_ReleaseLock();
+       *p_err = SNTPc_ERR_STAT_NOT_FOUND;
+        return;
+    }
+
+   *p_stat = p_entry->Stat;
+
+    SNTPc_ReleaseLock();
+
+   *p_err = SNTPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_StatClr()
+*
+* Description : Clear the request & lock wait statistics.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Statistics successfully cleared.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+void  SNTPc_StatClr (SNTPc_ERR  *p_err)
+{
+    CPU_INT16U  ix;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    for (ix = 0u; ix < SNTPc_CFG_STAT_NBR_ENTRIES; ix++) {
+        SNTPc_StatTbl[ix].IsValid = DEF_NO;
+    }
+
+    SNTPc_StatInit();
+
+    SNTPc_ReleaseLock();
+
+   *p_err = SNTPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                              SNTPc_Rx()
+*
+* Description : Receive a NTP packet from server & validate it.
+*
+* Argument(s) : sock            Socket to receive NTP     message packet from.
+*
+*               p_server_addr   Pointer to the socket address of the queried server.
+*
+*               ppkt            Pointer to allocated SNTP message packet.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           A valid packet has been received.
+*                                   SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                                   SNTPc_ERR_RX             Error during the SNTP packet reception.
+*                                   SNTPc_ERR_RX_INVALID     Invalid packet received & dropped (see Note #2).
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death packet received (see Note #4).
+*
+* Return(s)   : DEF_TRUE,  if packet successfully received.
+*
+*               DEF_FALSE, otherwise.
+*
+* Caller(s)   : SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_BcastCal().
+*
+* Note(s)     : (1) The local reception timestamp (T4) is read as soon as the packet is returned by the network
+*                   stack, before any other processing, & is kept in the packet (see SNTPc_RxTS_Set()).
+*
+*               (2) RFC #4330, Section 5 'SNTP Client Operations' states that the client should discard a
+*                   reply that is not from the server it queried, whose Mode is not 4 (server), whose
+*                   Transmit Timestamp is zero or whose Stratum is 0 (kiss-o'-death, see Note #4) or above 15
+*                   (unsynchronized). A dropped packet is counted in the reception statistics & the caller
+*                   keeps waiting for a valid reply within its Rx timeout.
+*
+*               (3) The originate timestamp is checked by the caller, which knows the pending requests (see
+*                   SNTPc_TxTS_Apply()).
+*
+*               (4) A packet with a stratum of 0 & a "RATE", "DENY" or "RSTR" kiss code is returned to the
+*                   caller, which puts the server in backoff once the originate timestamp of the packet is
+*                   checked (see 'SNTPc_BackoffStart() Note #1'). Other kiss codes are dropped.
+*********************************************************************************************************
+*/
+
+#if ((SNTPc_CFG_SOCK_SHARED_EN != DEF_ENABLED) || \
+     (SNTPc_CFG_BCAST_EN       == DEF_ENABLED))
+static  CPU_BOOLEAN  SNTPc_Rx (      NET_SOCK_ID     sock,
+                               const NET_SOCK_ADDR  *p_server_addr,
+                                     SNTP_PKT       *ppkt,
+                                     SNTPc_ERR      *p_err)
+{
+    NET_SOCK_ADDR       remote_addr;
+    NET_SOCK_ADDR_LEN   remote_addr_size;
+    NET_SOCK_RTN_CODE   res;
+    NET_ERR             err;
+    SNTP_FIXED_TS       ts_rx;
+    CPU_BOOLEAN         result;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if ((ppkt          == DEF_NULL) ||
+        (p_server_addr == DEF_NULL)) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return (DEF_FAIL);
+    }
+#endif
+
+
+    remote_addr_size = sizeof(remote_addr);
+
+                                                                /* ---------------------- RX PKT ---------------------- */
+    res = NetSock_RxDataFrom(                      sock,
+                             (void              *) ppkt,
+                             (CPU_INT16U         ) sizeof(SNTP_PKT),
+                             (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+                                                  &remote_addr,
+                                                  &remote_addr_size,
+                             (void              *) DEF_NULL,
+                                                   0u,
+                                                   DEF_NULL,
+                                                  &err);
+    ts_rx = SNTPc_ClkLocalGet();                                /* See Note #1.                                         */
+
+    if (res <= 0) {
+       *p_err = SNTPc_ERR_RX;
+        return (DEF_FAIL);
+    }
+
+    SNTPc_RxStatInc(&SNTPc_RxStat.RxCtr);
+                                                                /* ------------------ VALIDATE PKT -------------------- */
+    result = SNTPc_RxCheck( ppkt,                               /* See Note #2.                                         */
+                           (CPU_INT32U)res,
+                           &remote_addr,
+                            p_server_addr,
+                            SNTPc_MSG_MODE_SERVER,
+                            p_err);
+    if (result != DEF_OK) {
+        return (DEF_FAIL);
+    }
+
+    SNTPc_RxTS_Set(ppkt, ts_rx);
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_RxCheck()
+*
+* Description : Validate a received NTP packet.
+*
+* Argument(s) : ppkt            Pointer to the received SNTP message packet.
+*
+*               pkt_len         Length of the received packet, in octets.
+*
+*               p_remote_addr   Pointer to the socket address the packet was received from.
+*
+*               p_server_addr   Pointer to the socket address of the queried server.
+*                                   If DEF_NULL, accept a packet from any sender (see Note #2).
+*
+*               msg_mode        Expected mode of the packet :
+*
+*                                   SNTPc_MSG_MODE_SERVER       Reply to a request.
+*                                   SNTPc_MSG_MODE_BROADCAST    Broadcast (see Note #2).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           The packet is valid.
+*                                   SNTPc_ERR_RX_INVALID     Invalid packet, counted in the Rx stats.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death packet.
+*
+* Return(s)   : DEF_OK,   if the packet is valid.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_MuxSockRd(),
+*               SNTPc_Rx(),
+*               SNTPc_BcastListen(),
+*               SNTPc_ManycastRound(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) See 'SNTPc_Rx() Note #2' & 'SNTPc_Rx() Note #4'.
+*
+*               (2) The sender of a broadcast is not known in advance, so a broadcast is checked without the
+*                   address of a server (see 'SNTPc_BcastStart() Note #2'). Neither is the sender of a
+*                   reply to a manycast request (see 'SNTPc_ManycastRound() Note #2').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_RxCheck (const SNTP_PKT       *ppkt,
+                                          CPU_INT32U      pkt_len,
+                                    const NET_SOCK_ADDR  *p_remote_addr,
+                                    const NET_SOCK_ADDR  *p_server_addr,
+                                          CPU_INT08U      msg_mode,
+                                          SNTPc_ERR      *p_err)
+{
+    CPU_INT32U   cw;
+    CPU_INT08U   mode;
+    CPU_INT08U   vn;
+    CPU_INT08U   stratum;
+    CPU_INT32U   kiss_code;
+    CPU_BOOLEAN  is_kod;
+    CPU_INT32U  *p_drop_ctr;
+
+
+    cw      = NET_UTIL_NET_TO_HOST_32(ppkt->CW);                /* See Note #1.                                         */
+    mode    = (CPU_INT08U)((cw >>  SNTPc_MSG_FLAG_SHIFT)                            & 0x07u);
+    vn      = (CPU_INT08U)((cw >> (SNTPc_MSG_FLAG_SHIFT + SNTPc_MSG_FLAG_VN_SHIFT)) & 0x07u);
+    stratum = (CPU_INT08U)((cw >>  SNTPc_MSG_STRATUM_SHIFT)                         & 0xFFu);
+
+    kiss_code = NET_UTIL_NET_TO_HOST_32(ppkt->RefID);
+    is_kod    = DEF_NO;
+    if ((stratum   == 0u                 ) &&
+       ((kiss_code == SNTPc_KOD_CODE_RATE) ||
+        (kiss_code == SNTPc_KOD_CODE_DENY) ||
+        (kiss_code == SNTPc_KOD_CODE_RSTR))) {
+        is_kod = DEF_YES;
+    }
+
+    if (pkt_len < sizeof(SNTP_PKT)) {
+        p_drop_ctr = &SNTPc_RxStat.DropLenCtr;
+
+    } else if ((p_server_addr                                     != DEF_NULL) &&
+               (SNTPc_SockAddrIsEq(p_remote_addr, p_server_addr) == DEF_NO  )) {
+        p_drop_ctr = &SNTPc_RxStat.DropAddrCtr;
+
+    } else if (mode != msg_mode) {
+        p_drop_ctr = &SNTPc_RxStat.DropModeCtr;
+
+    } else if ((vn < SNTPc_MSG_VER_3) ||
+               (vn > SNTPc_MSG_VER_4)) {
+        p_drop_ctr = &SNTPc_RxStat.DropVerCtr;
+
+    } else if (is_kod == DEF_YES) {
+        p_drop_ctr = DEF_NULL;
+
+    } else if ((stratum == 0u                   ) ||
+               (stratum >  SNTPc_MSG_STRATUM_MAX)) {
+        p_drop_ctr = &SNTPc_RxStat.DropStratumCtr;
+
+    } else if ((ppkt->TS_Tx.Sec  == 0u) &&
+               (ppkt->TS_Tx.Frac == 0u)) {
+        p_drop_ctr = &SNTPc_RxStat.DropTxTS_Ctr;
+
+    } else {
+        p_drop_ctr = DEF_NULL;
+    }
+
+    if (p_drop_ctr != DEF_NULL) {
+        SNTPc_RxStatInc(p_drop_ctr);
+        SNTPc_TRACE_DBG(SNTPc_TRACE_EVT_RX, SNTPc_ERR_RX_INVALID, cw, pkt_len);
+       *p_err = SNTPc_ERR_RX_INVALID;
+        return (DEF_FAIL);
+    }
+
+    if (is_kod == DEF_YES) {
+        SNTPc_RxStatInc(&SNTPc_RxStat.KoD_Ctr);
+        SNTPc_TRACE_DBG(SNTPc_TRACE_EVT_RX, SNTPc_ERR_KOD, cw, pkt_len);
+        SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_KOD, 0u, kiss_code, 0u);
+       *p_err = SNTPc_ERR_KOD;
+        return (DEF_FAIL);
+    }
+
+    SNTPc_TRACE_DBG(SNTPc_TRACE_EVT_RX, SNTPc_ERR_NONE, cw, pkt_len);
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SockAddrIsEq()
+*
+* Description : Compare two socket addresses.
+*
+* Argument(s) : p_addr1     Pointer to the first  socket address.
+*
+*               p_addr2     Pointer to the second socket address.
+*
+* Return(s)   : DEF_YES, if the address family, the IP address & the port number are the same.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_RxCheck(),
+*               SNTPc_BcastRxProcess(),
+*               SNTPc_ManycastCandAdd(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_SockAddrIsEq (const NET_SOCK_ADDR  *p_addr1,
+                                         const NET_SOCK_ADDR  *p_addr2)
+{
+    const NET_SOCK_ADDR_IPv4  *p_addr1_v4;
+    const NET_SOCK_ADDR_IPv4  *p_addr2_v4;
+    const NET_SOCK_ADDR_IPv6  *p_addr1_v6;
+    const NET_SOCK_ADDR_IPv6  *p_addr2_v6;
+
+
+    if (p_addr1->AddrFamily != p_addr2->AddrFamily) {
+        return (DEF_NO);
+    }
+
+    switch (p_addr1->AddrFamily) {
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             p_addr1_v4 = (const NET_SOCK_ADDR_IPv4 *)p_addr1;
+             p_addr2_v4 = (const NET_SOCK_ADDR_IPv4 *)p_addr2;
+             if ((p_addr1_v4->Port != p_addr2_v4->Port) ||
+                 (p_addr1_v4->Addr != p_addr2_v4->Addr)) {
+                 return (DEF_NO);
+             }
+             return (DEF_YES);
+
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             p_addr1_v6 = (const NET_SOCK_ADDR_IPv6 *)p_addr1;
+             p_addr2_v6 = (const NET_SOCK_ADDR_IPv6 *)p_addr2;
+             if (p_addr1_v6->Port != p_addr2_v6->Port) {
+                 return (DEF_NO);
+             }
+             return (Mem_Cmp(&p_addr1_v6->Addr, &p_addr2_v6->Addr, sizeof(NET_IPv6_ADDR)));
+
+        default:
+             return (DEF_NO);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_RxStatInc()
+*
+* Description : Increment a reception statistics counter.
+*
+* Argument(s) : p_ctr   Pointer to the counter, in SNTPc_RxStat.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Rx(),
+*               SNTPc_RxCheck(),
+*               SNTPc_MuxSockRd(),
+*               SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_BcastListen(),
+*               SNTPc_BcastCal(),
+*               SNTPc_ManycastRound(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) The counters are updated without the module lock, which is not held during network I/O
+*                   (see 'SNTPc_ReqExchange() Note #1').
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_RxStatInc (CPU_INT32U  *p_ctr)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+  (*p_ctr)++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_TxPktInit()
+*
+* Description : Build the request packet template.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : (1) RFC # 2030, Section 5 'SNTP Client Operations' states that "[For client operations],
+*                   all of the NTP header fields [...] can be set to 0, except the first octet and
+*                   (optional) Transmit Timestamp fields.  In the first octet, the LI field is set to 0
+*                   (no warning) and the Mode field is set to 3 (client).  The VN field must agree with
+*                   the version number of the NTP/SNTP server".
+*
+*               (2) The request packet is built once, so that only its transmit timestamp is set between the
+*                   reading of the local time & the transmission of each request (see SNTPc_Tx()).
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_TxPktInit (void)
+{
+    CPU_INT32U  cw;
+    CPU_INT08U  li;
+    CPU_INT08U  vn;
+    CPU_INT08U  mode;
+
+
+    Mem_Clr(&SNTPc_TxPktTemplate, sizeof(SNTPc_TxPktTemplate)); /* Clr SNTP msg pkt.                                    */
+
+                                                                /* See Note #1.                                         */
+    li       = SNTPc_MSG_LI_NO_WARNING;                         /* Set flags.                                           */
+    li     <<= SNTPc_MSG_FLAG_LI_SHIFT;
+
+    vn       = SNTPc_MSG_VER_4;
+    vn     <<= SNTPc_MSG_FLAG_VN_SHIFT;
+
+    mode     = SNTPc_MSG_MODE_CLIENT;
+
+    cw       = li | vn | mode;
+    cw     <<= SNTPc_MSG_FLAG_SHIFT;
+
+    SNTPc_TxPktTemplate.CW = NET_UTIL_HOST_TO_NET_32(cw);
+}
+
+
+/*
+*********************************************************************************************************
+*                                              SNTPc_Tx()
+*
+* Description : Send NTP packet to server.
+*
+* Argument(s) : sock        Socket to sent NTP message packet to.
+*
+*               paddr       Pointer to SNTP server sockaddr_in.
+*
+*               p_tx_ts     Pointer to variable that will receive the transmit timestamp of the request.
+*
+*               is_nonce    DEF_YES, if the transmit timestamp is the nonce set in p_tx_ts (see Note #3).
+*
+*                           DEF_NO,  if the transmit timestamp is the local time.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function.
+*
+* Return(s)   : DEF_TRUE,  if packet successfully sent.
+*
+*               DEF_FALSE, otherwise.
+*
+* Caller(s)   : SNTPc_MuxTx(),
+*               SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_BcastCal(),
+*               SNTPc_ManycastRound().
+*
+* Note(s)     : (1) The request is copied from the template built by SNTPc_TxPktInit().
+*
+*               (2) The local time is read as late as possible, right before the packet is handed to the
+*                   network stack, so that the processing of the request does not add to the offset.
+*
+*               (3) Requests sent on a shared socket carry a random nonce instead of the local time (see
+*                   'SHARED SOCKET REQUEST DATA TYPES  Note #1'). The local time is still returned in p_tx_ts.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_Tx (NET_SOCK_ID     sock,
+                               NET_SOCK_ADDR  *paddr,
+                               SNTPc_TX_TS    *p_tx_ts,
+                               CPU_BOOLEAN     is_nonce,
+                               SNTPc_ERR      *p_err)
+{
+    SNTP_PKT           pkt;
+    NET_SOCK_RTN_CODE  res;
+    NET_ERR            err;
+    SNTP_FIXED_TS      timestamp;
+    CPU_BOOLEAN        result;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if ((paddr   == DEF_NULL) ||
+        (p_tx_ts == DEF_NULL)) {
+       *p_err  = SNTPc_ERR_NULL_PTR;
+        result = DEF_FAIL;
+        goto exit;
+    }
+#endif
+
+    pkt            = SNTPc_TxPktTemplate;                       /* See Note #1.                                         */
+                                                                /* Set tx timestamp (see Note #2).                      */
+    timestamp      = SNTPc_ClkLocalGet();
+    if (is_nonce == DEF_YES) {
+        pkt.TS_Tx  = p_tx_ts->Pkt;                              /* See Note #3.                                         */
+    } else {
+        pkt.TS_Tx.Sec  = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(timestamp >> 32u));
+        pkt.TS_Tx.Frac = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(timestamp &  DEF_INT_32U_MAX_VAL));
+    }
+
+                                                                /* ---------------------- TX PKT ---------------------- */
+    res = NetSock_TxDataTo(sock,
+                          &pkt,
+                           sizeof(SNTP_PKT),
+                           NET_SOCK_FLAG_SOCK_NONE,
+                           paddr,
+                           sizeof(NET_SOCK_ADDR),
+                          &err);
+
+    p_tx_ts->Pkt   = pkt.TS_Tx;                                 /* Returned to match the reply's originate timestamp.   */
+    p_tx_ts->Local = timestamp;
+
+    if (res <= 0) {
+       *p_err  = SNTPc_ERR_TX;
+        result = DEF_FAIL;
+    } else {
+       *p_err  = SNTPc_ERR_NONE;
+        result = DEF_OK;
+    }
+
+    SNTPc_TRACE_DBG(SNTPc_TRACE_EVT_TX, *p_err, sock, 0u);
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+exit:
+#endif
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ReqExchange()
+*
+* Description : Perform a request/reply exchange with a server using one address family.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration.
+*
+*               ip_family       IP family of the server address to use.
+*
+*               ppkt            Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
+*
+*               p_is_hostname   Pointer to variable that will receive :
+*
+*                                   DEF_YES, if the server is specified by a hostname.
+*                                   DEF_NO,  if the server is specified by an IP address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           The SNTP Request has been successfully processed.
+*                                   SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the request to fail.
+*                                   SNTPc_ERR_TX             Error occurred during the request transmission.
+*                                   SNTPc_ERR_RX             Error occurred during the packet reception.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death reply received (see Note #3).
+*
+* Return(s)   : DEF_OK,   if the exchange has been successfully completed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime().
+*
+* Note(s)     : (1) The module lock MUST NOT be held by the caller. It is acquired only while the socket
+*                   pool & the server address cache are accessed, never during network I/O.
+*
+*               (2) An invalid packet or a late reply to a previous request is dropped & the reception is
+*                   resumed with the Rx timeout reduced to the time left (see 'SNTPc_Rx() Note #2').
+*
+*               (3) A Kiss-o'-Death reply puts the server in backoff & fails the exchange with
+*                   SNTPc_ERR_KOD (see 'SNTPc_BackoffStart() Note #1').
+*
+*               (4) In shared socket mode, the request is sent on the shared socket of the address family
+*                   instead of a socket of the pool (see SNTPc_MuxReqExchange()).
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_ReqExchange (const SNTPc_CFG           *p_cfg,
+                                             NET_IP_ADDR_FAMILY   ip_family,
+                                             SNTP_PKT            *ppkt,
+                                             CPU_BOOLEAN         *p_is_hostname,
+                                             SNTPc_ERR           *p_err)
+{
+    NET_SOCK_ADDR      server_addr;
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+    CPU_INT08U         ix_rx;
+#else
+    SNTPc_SOCK_ENTRY  *p_entry;
+    SNTPc_SOCK_ENTRY   entry_tmp;
+    SNTPc_TX_TS        tx_ts;
+    NET_TS_MS          ts_start;
+    NET_TS_MS          elapsed_ms;
+    NET_ERR            err;
+    CPU_BOOLEAN        result;
+#endif
+
+
+   *p_is_hostname = DEF_NO;
+                                                                /* -------------- GET SERVER SOCKET ADDR -------------- */
+    SNTPc_ServerAddrGet(p_cfg,                                  /* Get server addr from cache or resolve host name.     */
+                        ip_family,
+                       &server_addr,
+                        p_is_hostname,
+                        p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+                                                                /* ---------- EXCHANGE ON THE SHARED SOCKET ----------- */
+    return (SNTPc_MuxReqExchange(p_cfg,                         /* See Note #4.                                         */
+                                &server_addr,
+                                 1u,
+                                 ppkt,
+                                &ix_rx,
+                                 p_err));
+#else
+                                                                /* ------------- GET SOCKET FROM THE POOL ------------- */
+    p_entry = SNTPc_SockGet(p_cfg,                              /* Open a new sock only if none is open for the server. */
+                           &server_addr,
+                           &entry_tmp,
+                            p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+                                                                /* ------------------ SET RX TIMEOUT ------------------ */
+    if (p_entry->RxTimeout_ms != p_cfg->ReqRxTimeout_ms) {
+        NetSock_CfgTimeoutRxQ_Set( p_entry->SockID,             /* Set the Rx timeout timer.                            */
+                                   p_cfg->ReqRxTimeout_ms,
+                                  &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            SNTPc_SockRelease(p_entry, DEF_YES);
+           *p_err = SNTPc_ERR_SERVER_CFG;
+            return (DEF_FAIL);
+        }
+        p_entry->RxTimeout_ms = p_cfg->ReqRxTimeout_ms;
+    }
+                                                                /* ---------------------- TX REQ ---------------------- */
+    result = SNTPc_Tx(p_entry->SockID,                          /* Send the SNTP request to the NTP server.             */
+                     &server_addr,
+                     &tx_ts,
+                      DEF_NO,
+                      p_err);
+    if (result != DEF_OK) {
+        SNTPc_SockRelease(p_entry, DEF_YES);
+        return (DEF_FAIL);
+    }
+                                                                /* ---------------------- RX REP ---------------------- */
+    ts_start = NetUtil_TS_Get_ms();
+    while (DEF_ON) {
+        result = SNTPc_Rx( p_entry->SockID,                     /* Pend and Receive the SNTP packet.                    */
+                          &server_addr,
+                           ppkt,
+                           p_err);
+        if (result == DEF_OK) {
+            if (SNTPc_TxTS_Apply(ppkt, &tx_ts) == DEF_YES) {    /* Set the local tx timestamp of the reply.             */
+                break;
+            }
+            SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);    /* Late reply to a previous req.                        */
+        } else if (*p_err == SNTPc_ERR_KOD) {
+            if (SNTPc_TxTS_Apply(ppkt, &tx_ts) == DEF_YES) {
+                SNTPc_BackoffStart(p_cfg, ppkt);                /* See Note #3.                                         */
+                SNTPc_SockRelease(p_entry, DEF_NO);
+                return (DEF_FAIL);
+            }
+            SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+        } else if (*p_err != SNTPc_ERR_RX_INVALID) {
+            SNTPc_SockRelease(p_entry, DEF_YES);                /* Close sock so that a late reply is never reused.     */
+            return (DEF_FAIL);
+        }
+                                                                /* Pkt dropped, keep waiting (see Note #2).             */
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= p_cfg->ReqRxTimeout_ms) {
+            SNTPc_SockRelease(p_entry, DEF_YES);
+           *p_err = SNTPc_ERR_RX;
+            return (DEF_FAIL);
+        }
+
+        p_entry->RxTimeout_ms = p_cfg->ReqRxTimeout_ms - elapsed_ms;
+        NetSock_CfgTimeoutRxQ_Set( p_entry->SockID,
+                                   p_entry->RxTimeout_ms,
+                                  &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            SNTPc_SockRelease(p_entry, DEF_YES);
+           *p_err = SNTPc_ERR_RX;
+            return (DEF_FAIL);
+        }
+    }
+
+    SNTPc_SockRelease(p_entry, DEF_NO);                         /* Keep the sock open for the next request.             */
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (DEF_OK);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_ReqRace()
+*
+* Description : Race request/reply exchanges with a server over IPv6 & IPv4.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration.
+*
+*               ppkt            Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
+*
+*               p_ip_family     Pointer to variable that will receive the IP family of the first reply.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           The SNTP Request has been successfully processed.
+*                                   SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the request to fail.
+*                                   SNTPc_ERR_TX             Error occurred during the request transmission.
+*                                   SNTPc_ERR_RX             No reply received before the Rx timeout.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death reply received (see Note #5).
+*
+* Return(s)   : DEF_OK,   if a reply has been received over one of the address families.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime().
+*
+* Note(s)     : (1) The module lock MUST NOT be held by the caller (see 'SNTPc_ReqExchange() Note #1').
+*
+*               (2) The IPv6 request is sent first. The IPv4 request is sent once the IPv6 request failed
+*                   or SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS elapsed without reply. Both sockets are then
+*                   waited on until the first reply or the expiration of the configured Rx timeout.
+*
+*               (3) The socket of the family that lost the race is closed, so that its late reply is never
+*                   received by a following request.
+*
+*               (4) An invalid packet or a late reply to a previous request is dropped & the sockets are waited
+*                   on for the time left (see 'SNTPc_Rx() Note #2').
+*
+*               (5) A Kiss-o'-Death reply on either family puts the server in backoff & ends the race with
+*                   SNTPc_ERR_KOD (see 'SNTPc_BackoffStart() Note #1').
+*
+*               (6) In shared socket mode, both requests are sent on the shared sockets & the race is run by
+*                   SNTPc_MuxReqExchange(). No socket is closed, since the late reply of the family that lost
+*                   the race does not match any pending request.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_ReqRace (const SNTPc_CFG           *p_cfg,
+                                          SNTP_PKT            *ppkt,
+                                          NET_IP_ADDR_FAMILY  *p_ip_family,
+                                          SNTPc_ERR           *p_err)
+{
+    const NET_IP_ADDR_FAMILY   ip_family[2] = { NET_IP_ADDR_FAMILY_IPv6, NET_IP_ADDR_FAMILY_IPv4 };
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+          NET_IP_ADDR_FAMILY   addr_family[2];
+          NET_SOCK_ADDR        server_addr[2];
+          CPU_BOOLEAN          is_hostname;
+          CPU_INT08U           addr_nbr;
+          CPU_INT08U           ix;
+          CPU_INT08U           ix_rx;
+          CPU_BOOLEAN          result;
+
+
+    addr_nbr = 0u;                                              /* ---------------- GET SERVER ADDRS ----------------- */
+    for (ix = 0u; ix < 2u; ix++) {
+        SNTPc_ServerAddrGet(p_cfg,
+                            ip_family[ix],
+                           &server_addr[addr_nbr],
+                           &is_hostname,
+                            p_err);
+        if (*p_err == SNTPc_ERR_NONE) {
+            addr_family[addr_nbr] = ip_family[ix];
+            addr_nbr++;
+        }
+    }
+
+    if (addr_nbr == 0u) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_FAIL);
+    }
+                                                                /* -------------------- RACE REQS --------------------- */
+    result = SNTPc_MuxReqExchange(p_cfg,                        /* See Note #6.                                         */
+                                  server_addr,
+                                  addr_nbr,
+                                  ppkt,
+                                 &ix_rx,
+                                  p_err);
+    if (result == DEF_OK) {
+       *p_ip_family = addr_family[ix_rx];
+    }
+
+    return (result);
+#else
+          SNTPc_SOCK_ENTRY    *p_entry[2];
+          SNTPc_SOCK_ENTRY     entry_tmp[2];
+          NET_SOCK_ADDR        server_addr[2];
+          SNTPc_TX_TS          tx_ts[2];
+          CPU_BOOLEAN          is_tx[2];
+          CPU_BOOLEAN          is_hostname;
+          NET_SOCK_DESC        sock_desc_rd;
+          NET_SOCK_TIMEOUT     sel_timeout;
+          NET_SOCK_QTY         sock_nbr_max;
+          NET_SOCK_RTN_CODE    sel_res;
+          NET_ERR              err;
+          NET_TS_MS            ts_start;
+          NET_TS_MS            elapsed_ms;
+          NET_TS_MS            wait_ms;
+          CPU_INT08U           ix;
+          CPU_INT08U           ix_won;
+          CPU_BOOLEAN          is_kod;
+          CPU_BOOLEAN          result;
+
+
+   *p_err  = SNTPc_ERR_SERVER_CFG;
+    ix_won = DEF_INT_08U_MAX_VAL;
+    is_kod = DEF_NO;
+                                                                /* ------------ GET SERVER ADDRS & SOCKETS ------------ */
+    for (ix = 0u; ix < 2u; ix++) {
+        is_tx[ix]   = DEF_NO;
+        p_entry[ix] = DEF_NULL;
+
+        SNTPc_ServerAddrGet(p_cfg,
+                            ip_family[ix],
+                           &server_addr[ix],
+                           &is_hostname,
+                            p_err);
+        if (*p_err == SNTPc_ERR_NONE) {
+            p_entry[ix] = SNTPc_SockGet(p_cfg,
+                                       &server_addr[ix],
+                                       &entry_tmp[ix],
+                                        p_err);
+        }
+    }
+
+    if ((p_entry[0] == DEF_NULL) &&
+        (p_entry[1] == DEF_NULL)) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_FAIL);
+    }
+                                                                /* -------------------- RACE REQS --------------------- */
+    ts_start = NetUtil_TS_Get_ms();
+   *p_err    = SNTPc_ERR_RX;
+
+    while ((ix_won == DEF_INT_08U_MAX_VAL) &&
+           (is_kod == DEF_NO              )) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= p_cfg->ReqRxTimeout_ms) {
+            break;
+        }
+        wait_ms = p_cfg->ReqRxTimeout_ms - elapsed_ms;
+                                                                /* Tx IPv6 req, then IPv4 req after dly (see Note #2).  */
+        for (ix = 0u; ix < 2u; ix++) {
+            if ((p_entry[ix] == DEF_NULL) ||
+                (is_tx[ix]   == DEF_YES )) {
+                continue;
+            }
+            if ((ix         == 1u                                ) &&
+                (p_entry[0] != DEF_NULL                          ) &&
+                (is_tx[0]   == DEF_YES                           ) &&
+                (elapsed_ms <  SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS)) {
+                wait_ms = DEF_MIN(wait_ms, SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS - elapsed_ms);
+                continue;
+            }
+            (void)SNTPc_Tx(p_entry[ix]->SockID, &server_addr[ix], &tx_ts[ix], DEF_NO, p_err);
+            if (*p_err == SNTPc_ERR_NONE) {
+                is_tx[ix] = DEF_YES;
+            } else {
+                SNTPc_SockRelease(p_entry[ix], DEF_YES);
+                p_entry[ix] = DEF_NULL;
+            }
+        }
+
+        if ((p_entry[0] == DEF_NULL) &&
+            (p_entry[1] == DEF_NULL)) {
+            break;                                              /* Both reqs failed.                                    */
+        }
+                                                                /* Wait for a reply on the socks that sent a req.       */
+        NET_SOCK_DESC_INIT(&sock_desc_rd);
+        sock_nbr_max = 0;
+        for (ix = 0u; ix < 2u; ix++) {
+            if ((p_entry[ix] != DEF_NULL) &&
+                (is_tx[ix]   == DEF_YES )) {
+                NET_SOCK_DESC_SET(p_entry[ix]->SockID, &sock_desc_rd);
+                sock_nbr_max = DEF_MAX(sock_nbr_max, p_entry[ix]->SockID + 1);
+            }
+        }
+        if (sock_nbr_max == 0) {
+            continue;                                           /* IPv6 req failed, tx IPv4 req right away.             */
+        }
+
+        sel_timeout.timeout_sec = (CPU_INT32S)( wait_ms / SNTP_MS_NBR_PER_SEC);
+        sel_timeout.timeout_us  = (CPU_INT32S)((wait_ms % SNTP_MS_NBR_PER_SEC) * 1000u);
+
+        sel_res = NetSock_Sel(sock_nbr_max,
+                             &sock_desc_rd,
+                              DEF_NULL,
+                              DEF_NULL,
+                             &sel_timeout,
+                             &err);
+        if (sel_res < 0) {
+            break;
+        }
+        if (sel_res == 0) {
+            continue;                                           /* Timeout, tx IPv4 req or check overall timeout.       */
+        }
+                                                                /* Rx reply from the first ready sock.                  */
+        for (ix = 0u; ix < 2u; ix++) {
+            if ((p_entry[ix] == DEF_NULL) ||
+                (is_tx[ix]   == DEF_NO  ) ||
+                (NET_SOCK_DESC_IS_SET(p_entry[ix]->SockID, &sock_desc_rd) == 0)) {
+                continue;
+            }
+            result = SNTPc_Rx(p_entry[ix]->SockID, &server_addr[ix], ppkt, p_err);
+            if (result == DEF_OK) {
+                if (SNTPc_TxTS_Apply(ppkt, &tx_ts[ix]) == DEF_YES) {
+                    ix_won = ix;
+                    break;
+                }
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+               *p_err = SNTPc_ERR_RX;
+                continue;                                       /* Late reply dropped, keep waiting (see Note #4).      */
+            }
+            if (*p_err == SNTPc_ERR_RX_INVALID) {
+               *p_err = SNTPc_ERR_RX;
+                continue;                                       /* Invalid pkt dropped, keep waiting (see Note #4).     */
+            }
+            if (*p_err == SNTPc_ERR_KOD) {
+                if (SNTPc_TxTS_Apply(ppkt, &tx_ts[ix]) == DEF_YES) {
+                    SNTPc_BackoffStart(p_cfg, ppkt);            /* See Note #5.                                         */
+                    is_kod = DEF_YES;
+                    break;
+                }
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+               *p_err = SNTPc_ERR_RX;
+                continue;
+            }
+            SNTPc_SockRelease(p_entry[ix], DEF_YES);
+            p_entry[ix] = DEF_NULL;
+        }
+    }
+
+    if (ix_won != DEF_INT_08U_MAX_VAL) {
+       *p_ip_family = ip_family[ix_won];
+       *p_err       = SNTPc_ERR_NONE;
+    }
+                                                                /* ----------------- RELEASE SOCKETS ------------------ */
+    for (ix = 0u; ix < 2u; ix++) {
+        if (p_entry[ix] != DEF_NULL) {                          /* See Note #3.                                         */
+            SNTPc_SockRelease(p_entry[ix], ((is_tx[ix] == DEF_YES) && (ix != ix_won)) ? DEF_YES : DEF_NO);
+        }
+    }
+
+    return ((ix_won != DEF_INT_08U_MAX_VAL) ? DEF_OK : DEF_FAIL);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ServerAddrSel()
+*
+* Description : Select the address family used to reach a server & get the server address.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration.
+*
+*               p_ip_family     Pointer to variable that will receive the selected address family.
+*
+*               p_server_addr   Pointer to variable that will receive the server socket address.
+*
+*               p_is_pref       Pointer to variable that will receive :
+*
+*                                   DEF_YES, if the family was selected by the SNTP client (see Note #1).
+*                                   DEF_NO,  if the family is specified by the server configuration.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Server address successfully returned.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Server hostname could not be resolved.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) When the server configuration does not specify an address family, the preferred family
+*                   of the server is used. If no family is known to work for this server, IPv6 is used if the
+*                   server has an IPv6 address, IPv4 otherwise. The caller should remember the selected
+*                   family once a reply is received (see 'SNTPc_AddrFamilyPrefSet()').
+*
+*               (2) The module lock MUST NOT be held by the caller.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_ServerAddrSel (const SNTPc_CFG           *p_cfg,
+                                         NET_IP_ADDR_FAMILY  *p_ip_family,
+                                         NET_SOCK_ADDR       *p_server_addr,
+                                         CPU_BOOLEAN         *p_is_pref,
+                                         SNTPc_ERR           *p_err)
+{
+    NET_IP_ADDR_FAMILY  ip_family;
+    CPU_BOOLEAN         is_hostname;
+
+
+    ip_family  = p_cfg->ServerAddrFamily;
+   *p_is_pref  = DEF_NO;
+
+    if (ip_family == NET_IP_ADDR_FAMILY_NONE) {                 /* See Note #1.                                         */
+        SNTPc_AcquireLock(p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            return;
+        }
+        ip_family = SNTPc_AddrFamilyPrefGet(p_cfg);
+        SNTPc_ReleaseLock();
+       *p_is_pref = DEF_YES;
+    }
+
+    if (ip_family == NET_IP_ADDR_FAMILY_NONE) {
+        ip_family = NET_IP_ADDR_FAMILY_IPv6;
+        SNTPc_ServerAddrGet(p_cfg, ip_family, p_server_addr, &is_hostname, p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            ip_family = NET_IP_ADDR_FAMILY_IPv4;
+            SNTPc_ServerAddrGet(p_cfg, ip_family, p_server_addr, &is_hostname, p_err);
+        }
+    } else {
+        SNTPc_ServerAddrGet(p_cfg, ip_family, p_server_addr, &is_hostname, p_err);
+    }
+
+   *p_ip_family = ip_family;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_ReqMultiExchange()
+*
+* Description : Perform request/reply exchanges with a set of servers within a single timeout.
+*
+* Argument(s) : p_cfg_tbl   Pointer to a table of server configurations.
+*
+*               cfg_nbr     Number of server configurations in the table.
+*
+*               timeout_ms  Time to wait for the replies of all the servers, in milliseconds.
+*
+*               p_pkt_tbl   Pointer to a table of SNTP_PKT variables that will contain the received packets,
+*                           at the index of their server configuration.
+*
+* Return(s)   : Mask of the servers that replied (bit n set if server n replied).
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : (1) The module lock MUST NOT be held by the caller (see 'SNTPc_ReqExchange() Note #1').
+*
+*               (2) See 'SNTPc_ServerAddrSel() Note #1'.
+*
+*               (3) All the requests are sent before waiting for the replies, so that the exchange takes a
+*                   single round trip to the slowest server instead of the sum of the round trips. When
+*                   the socket select feature is disabled, the servers are queried one after the other
+*                   until the timeout expires.
+*
+*               (4) The sockets of the servers that did not reply are closed, so that their late reply is
+*                   never received by a following request.
+*
+*               (5) An invalid packet or a late reply to a previous request is dropped & the socket is waited
+*                   on until a valid reply is received or the timeout expires (see 'SNTPc_Rx() Note #2').
+*
+*               (6) Servers in backoff after a Kiss-o'-Death reply are not queried. A server that replies with
+*                   a Kiss-o'-Death packet is put in backoff (see 'SNTPc_BackoffStart() Note #1').
+*
+*               (7) In shared socket mode, all the requests are sent on the shared sockets & each reply is
+*                   matched to its request by the nonce it echoes (see 'SNTPc_MuxTx() Note #2'). The requests
+*                   of the servers that did not reply are freed, so that their late reply is dropped.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  SNTPc_ReqMultiExchange (const SNTPc_CFG           *p_cfg_tbl,
+                                                  CPU_INT08U           cfg_nbr,
+                                                  CPU_INT32U           timeout_ms,
+                                                  SNTP_PKT            *p_pkt_tbl)
+{
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+    const SNTPc_CFG           *p_cfg;
+          SNTPc_MUX_REQ       *p_req_tbl[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          NET_SOCK_ADDR        server_addr;
+          NET_IP_ADDR_FAMILY   ip_family[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          CPU_BOOLEAN          is_pref[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          SNTP_PKT             pkt;
+          NET_TS_MS            ts_start;
+          NET_TS_MS            elapsed_ms;
+          SNTPc_ERR            err;
+          CPU_INT32U           rx_mask;
+          CPU_INT08U           pending_nbr;
+          CPU_INT08U           ix;
+
+
+    rx_mask     = 0u;
+    pending_nbr = 0u;
+    ts_start    = NetUtil_TS_Get_ms();
+                                                                /* ------------------ TX ALL REQS --------------------- */
+    for (ix = 0u; ix < cfg_nbr; ix++) {                         /* See Notes #3 & #7.                                   */
+        p_cfg         = &p_cfg_tbl[ix];
+        p_req_tbl[ix] =  DEF_NULL;
+
+        if (SNTPc_BackoffIsActive(p_cfg) == DEF_YES) {          /* See Note #6.                                         */
+            continue;
+        }
+
+        SNTPc_ServerAddrSel( p_cfg,                             /* See Note #2.                                         */
+                            &ip_family[ix],
+                            &server_addr,
+                            &is_pref[ix],
+                            &err);
+        if (err != SNTPc_ERR_NONE) {
+            continue;
+        }
+
+        p_req_tbl[ix] = SNTPc_MuxTx(&server_addr, &err);
+        if (p_req_tbl[ix] != DEF_NULL) {
+            pending_nbr++;
+        }
+    }
+                                                                /* ------------------ RX ALL REPLIES ------------------ */
+    while (pending_nbr > 0u) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= timeout_ms) {
+            break;
+        }
+
+        ix = SNTPc_MuxRx(p_req_tbl, cfg_nbr, timeout_ms - elapsed_ms, &pkt, &err);
+        if (err == SNTPc_ERR_KOD) {
+            SNTPc_BackoffStart(&p_cfg_tbl[ix], &pkt);
+        } else if (err == SNTPc_ERR_NONE) {
+            (void)SNTPc_TxTS_Apply(&pkt, &p_req_tbl[ix]->TxTS); /* Reply matched by its nonce, restore the org TS.      */
+            p_pkt_tbl[ix] = pkt;
+            DEF_BIT_SET(rx_mask, DEF_BIT32(ix));
+            SNTPc_BackoffClr(&p_cfg_tbl[ix]);
+            if (is_pref[ix] == DEF_YES) {                       /* Remember the family that worked for this server.     */
+                SNTPc_AddrFamilyPrefSet(&p_cfg_tbl[ix], ip_family[ix]);
+            }
+        } else {
+            break;                                              /* Timeout or lock err.                                 */
+        }
+        SNTPc_MuxReqFree(p_req_tbl[ix]);
+        p_req_tbl[ix] = DEF_NULL;
+        pending_nbr--;
+    }
+                                                                /* ------------------- FREE REQS ---------------------- */
+    for (ix = 0u; ix < cfg_nbr; ix++) {
+        if (p_req_tbl[ix] != DEF_NULL) {                        /* See Note #7.                                         */
+            SNTPc_MuxReqFree(p_req_tbl[ix]);
+        }
+    }
+
+    return (rx_mask);
+
+#elif (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+    const SNTPc_CFG           *p_cfg;
+          SNTPc_SOCK_ENTRY    *p_entry[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          SNTPc_SOCK_ENTRY     entry_tmp[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          NET_SOCK_ADDR        server_addr[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          SNTPc_TX_TS          tx_ts[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          NET_IP_ADDR_FAMILY   ip_family[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          CPU_BOOLEAN          is_pref[SNTPc_CFG_MULTI_SERVER_NBR_MAX];
+          NET_SOCK_DESC        sock_desc_rd;
+          NET_SOCK_TIMEOUT     sel_timeout;
+          NET_SOCK_QTY         sock_nbr_max;
+          NET_SOCK_RTN_CODE    sel_res;
+          NET_TS_MS            ts_start;
+          NET_TS_MS            elapsed_ms;
+          NET_TS_MS            wait_ms;
+          NET_ERR              err_net;
+          SNTPc_ERR            err;
+          CPU_INT32U           rx_mask;
+          CPU_INT08U           pending_nbr;
+          CPU_INT08U           ix;
+          CPU_BOOLEAN          result;
+
+
+    rx_mask     = 0u;
+    pending_nbr = 0u;
+    ts_start    = NetUtil_TS_Get_ms();
+                                                                /* ------------------ TX ALL REQS --------------------- */
+    for (ix = 0u; ix < cfg_nbr; ix++) {                         /* See Note #3.                                         */
+        p_cfg       = &p_cfg_tbl[ix];
+        p_entry[ix] =  DEF_NULL;
+
+        if (SNTPc_BackoffIsActive(p_cfg) == DEF_YES) {          /* See Note #6.                                         */
+            continue;
+        }
+
+        SNTPc_ServerAddrSel( p_cfg,                             /* See Note #2.                                         */
+                            &ip_family[ix],
+                            &server_addr[ix],
+                            &is_pref[ix],
+                            &err);
+        if (err != SNTPc_ERR_NONE) {
+            continue;
+        }
+
+        p_entry[ix] = SNTPc_SockGet(p_cfg, &server_addr[ix], &entry_tmp[ix], &err);
+        if (err != SNTPc_ERR_NONE) {
+            p_entry[ix] = DEF_NULL;
+            continue;
+        }
+
+        result = SNTPc_Tx(p_entry[ix]->SockID, &server_addr[ix], &tx_ts[ix], DEF_NO, &err);
+        if (result != DEF_OK) {
+            SNTPc_SockRelease(p_entry[ix], DEF_YES);
+            p_entry[ix] = DEF_NULL;
+            continue;
+        }
+        pending_nbr++;
+    }
+                                                                /* ------------------ RX ALL REPLIES ------------------ */
+    while (pending_nbr > 0u) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= timeout_ms) {
+            break;
+        }
+        wait_ms = timeout_ms - elapsed_ms;
+
+        NET_SOCK_DESC_INIT(&sock_desc_rd);
+        sock_nbr_max = 0;
+        for (ix = 0u; ix < cfg_nbr; ix++) {
+            if (p_entry[ix] != DEF_NULL) {
+                NET_SOCK_DESC_SET(p_entry[ix]->SockID, &sock_desc_rd);
+                sock_nbr_max = DEF_MAX(sock_nbr_max, p_entry[ix]->SockID + 1);
+            }
+        }
+
+        sel_timeout.timeout_sec = (CPU_INT32S)( wait_ms / SNTP_MS_NBR_PER_SEC);
+        sel_timeout.timeout_us  = (CPU_INT32S)((wait_ms % SNTP_MS_NBR_PER_SEC) * 1000u);
+
+        sel_res = NetSock_Sel(sock_nbr_max,
+                             &sock_desc_rd,
+                              DEF_NULL,
+                              DEF_NULL,
+                             &sel_timeout,
+                             &err_net);
+        if (sel_res <= 0) {
+            break;                                              /* Timeout or sel err.                                  */
+        }
+
+        for (ix = 0u; ix < cfg_nbr; ix++) {
+            if ((p_entry[ix] == DEF_NULL) ||
+                (NET_SOCK_DESC_IS_SET(p_entry[ix]->SockID, &sock_desc_rd) == 0)) {
+                continue;
+            }
+            result = SNTPc_Rx(p_entry[ix]->SockID, &server_addr[ix], &p_pkt_tbl[ix], &err);
+            if ((result                                       == DEF_OK) &&
+                (SNTPc_TxTS_Apply(&p_pkt_tbl[ix], &tx_ts[ix]) == DEF_NO)) {
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+                continue;                                       /* Late reply dropped, keep waiting (see Note #5).      */
+            }
+            if ((result == DEF_FAIL            ) &&
+                (err    == SNTPc_ERR_RX_INVALID)) {
+                continue;                                       /* Invalid pkt dropped, keep waiting (see Note #5).     */
+            }
+            if ((result == DEF_FAIL     ) &&
+                (err    == SNTPc_ERR_KOD)) {
+                if (SNTPc_TxTS_Apply(&p_pkt_tbl[ix], &tx_ts[ix]) == DEF_NO) {
+                    SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+                    continue;
+                }
+                SNTPc_BackoffStart(&p_cfg_tbl[ix], &p_pkt_tbl[ix]);
+                SNTPc_SockRelease(p_entry[ix], DEF_NO);         /* Server answered, no reply pending on its sock.       */
+            } else if (result == DEF_OK) {
+                DEF_BIT_SET(rx_mask, DEF_BIT32(ix));
+                SNTPc_SockRelease(p_entry[ix], DEF_NO);
+                SNTPc_BackoffClr(&p_cfg_tbl[ix]);
+                if (is_pref[ix] == DEF_YES) {                   /* Remember the family that worked for this server.     */
+                    SNTPc_AddrFamilyPrefSet(&p_cfg_tbl[ix], ip_family[ix]);
+                }
+            } else {
+                SNTPc_SockRelease(p_entry[ix], DEF_YES);
+            }
+            p_entry[ix] = DEF_NULL;
+            pending_nbr--;
+        }
+    }
+                                                                /* ----------------- RELEASE SOCKETS ------------------ */
+    for (ix = 0u; ix < cfg_nbr; ix++) {
+        if (p_entry[ix] != DEF_NULL) {                          /* See Note #4.                                         */
+            SNTPc_SockRelease(p_entry[ix], DEF_YES);
+        }
+    }
+
+    return (rx_mask);
+
+#else
+    NET_TS_MS    ts_start;
+    SNTPc_ERR    err;
+    CPU_INT32U   rx_mask;
+    CPU_INT08U   ix;
+    CPU_BOOLEAN  result;
+
+
+    rx_mask  = 0u;
+    ts_start = NetUtil_TS_Get_ms();
+
+    for (ix = 0u; ix < cfg_nbr; ix++) {                         /* See Note #3.                                         */
+        if ((NetUtil_TS_Get_ms() - ts_start) >= timeout_ms) {
+            break;
+        }
+        result = SNTPc_ReqRemoteTime(&p_cfg_tbl[ix], &p_pkt_tbl[ix], &err);
+        if (result == DEF_OK) {
+            DEF_BIT_SET(rx_mask, DEF_BIT32(ix));
+        }
+    }
+
+    return (rx_mask);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_PrecisionGet_us()
+*
+* Description : Convert the precision advertised by a server to microseconds.
+*
+* Argument(s) : precision   Precision of the server clock, as a power of two of seconds.
+*
+* Return(s)   : Precision, in microseconds.
+*
+* Caller(s)   : SNTPc_FilterSampleAdd(),
+*               SNTPc_SampleSelGet().
+*
+* Note(s)     : (1) The precision is at least 1 us & at most 1 s.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  SNTPc_PrecisionGet_us (CPU_INT08S  precision)
+{
+    CPU_INT32U  precision_us;
+
+                                                                /* See Note #1.                                         */
+    if (precision <= -20) {
+        precision_us = 1u;
+    } else if (precision < 0) {
+        precision_us = DEF_TIME_NBR_uS_PER_SEC >> (CPU_INT08U)(-precision);
+    } else {
+        precision_us = DEF_TIME_NBR_uS_PER_SEC;
+    }
+
+    return (precision_us);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SampleSelGet()
+*
+* Description : Compute the server selection sample of a decoded sample.
+*
+* Argument(s) : p_sample        Pointer to the sample decoded from the received SNTP packet.
+*
+*               p_sel_sample    Pointer to the variable that will receive the selection sample.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : (1) The root distance is computed as in RFC #5905, Section 11.2 :
+*
+*                       root_dist = max(MINDISP, root_delay + delay) / 2 + root_disp + jitter
+*
+*               (2) With a single sample per server, the jitter is estimated from the resolution of the
+*                   local timestamps & the precision advertised by the server.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_SampleSelGet (const SNTPc_SAMPLE      *p_sample,
+                                        SNTPc_SEL_SAMPLE  *p_sel_sample)
+{
+    CPU_INT64U  dist_us;
+
+
+    p_sel_sample->Offset_us = p_sample->Offset_ns / 1000;
+                                                                /* See Note #2.                                         */
+    p_sel_sample->Jitter_us = SNTPc_LOCAL_TS_RESOLUTION_US + SNTPc_PrecisionGet_us(p_sample->Precision);
+                                                                /* See Note #1.                                         */
+    dist_us = (CPU_INT64U)p_sample->RootDly_us + (CPU_INT64U)(p_sample->RoundTripDly_ns / 1000);
+    dist_us = DEF_MAX(dist_us, SNTPc_SEL_MIN_DISP_US) / 2u;
+    dist_us = dist_us + p_sample->RootDisp_us + p_sel_sample->Jitter_us;
+
+    p_sel_sample->RootDist_us  = (CPU_INT32U)DEF_MIN(dist_us, DEF_INT_32U_MAX_VAL);
+    p_sel_sample->IsTruechimer = DEF_NO;
+    p_sel_sample->IsSurvivor   = DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_LocalTimeOffsetGet()
+*
+* Description : Get the local time corrected by an offset.
+*
+* Argument(s) : offset      Offset to apply to the local time, in signed 32.32 fixed point.
+*
+* Return(s)   : Corrected NTP timestamp.
+*
+* Caller(s)   : SNTPc_GetRemoteTime(),
+*               SNTPc_ReqRemoteTimeMulti(),
+*               SNTPc_SyncProcess(),
+*               SNTPc_BcastRxProcess().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  SNTP_TS  SNTPc_LocalTimeOffsetGet (SNTP_FIXED  offset)
+{
+    SNTP_FIXED_TS  time;
+
+
+    time  = SNTPc_ClkLocalGet();
+    time += (SNTP_FIXED_TS)offset;
+
+    return (SNTPc_FixedToTS(time));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_RxTS_Set()
+*
+* Description : Set the local reception timestamp of a received SNTP packet.
+*
+* Argument(s) : ppkt    Pointer to the received SNTP packet.
+*
+*               ts_rx   Local time read when the packet was returned by the network stack.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxSockRd(),
+*               SNTPc_Rx(),
+*               SNTPc_BcastListen(),
+*               SNTPc_ManycastRound(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) The reception timestamp is kept in the reference timestamp field of the packet, which
+*                   is not used by the SNTP client.
+*
+*               (2) If SNTPc_CFG_NET_TS_EN is enabled, the time at which the network layer received the
+*                   packet is used instead, if available (see SNTPc_NetTS_RxGet()).
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_RxTS_Set (SNTP_PKT       *ppkt,
+                              SNTP_FIXED_TS   ts_rx)
+{
+#if (SNTPc_CFG_NET_TS_EN == DEF_ENABLED)
+    (void)SNTPc_NetTS_RxGet(ppkt, &ts_rx);                      /* See Note #2.                                         */
+#endif
+                                                                /* See Note #1.                                         */
+    ppkt->TS_Ref.Sec  = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_rx >> 32u));
+    ppkt->TS_Ref.Frac = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_rx &  DEF_INT_32U_MAX_VAL));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_TxTS_Apply()
+*
+* Description : Match a received SNTP packet to a request & set its local transmit timestamp.
+*
+* Argument(s) : ppkt        Pointer to the received SNTP packet.
+*
+*               p_tx_ts     Pointer to the transmit timestamp of the request, as returned by SNTPc_Tx().
+*
+* Return(s)   : DEF_YES, if the packet answers the request.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_MuxReqExchange(),
+*               SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_BcastCal(),
+*               SNTPc_ManycastRound(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) The originate timestamp of the packet (T1) is replaced by the local time at which the
+*                   request was sent. If SNTPc_CFG_NET_TS_EN is enabled, the time at which the network layer
+*                   transmitted the request is used, if available (see SNTPc_NetTS_TxGet()). It is read
+*                   only once the reply is received, since the network layer may timestamp the request
+*                   after SNTPc_Tx() returned.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_TxTS_Apply (      SNTP_PKT     *ppkt,
+                                       const SNTPc_TX_TS  *p_tx_ts)
+{
+    SNTP_FIXED_TS  ts_tx;
+
+
+    if ((ppkt->TS_Originate.Sec  != p_tx_ts->Pkt.Sec ) ||
+        (ppkt->TS_Originate.Frac != p_tx_ts->Pkt.Frac)) {
+        return (DEF_NO);
+    }
+                                                                /* See Note #1.                                         */
+    ts_tx = p_tx_ts->Local;
+#if (SNTPc_CFG_NET_TS_EN == DEF_ENABLED)
+    (void)SNTPc_NetTS_TxGet(&p_tx_ts->Pkt, &ts_tx);
+#endif
+    ppkt->TS_Originate.Sec  = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_tx >> 32u));
+    ppkt->TS_Originate.Frac = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_tx &  DEF_INT_32U_MAX_VAL));
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_SockPoolInit()
+*
+* Description : Initialize the socket pool.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_SockPoolInit (void)
+{
+    SNTPc_SOCK_ENTRY  *p_entry;
+    CPU_INT16U         ix;
+
+
+    for (ix = 0u; ix < SNTPc_CFG_SOCK_POOL_NBR_ENTRIES; ix++) {
+        p_entry            = &SNTPc_SockPool[ix];
+        p_entry->State     =  SNTPc_SOCK_STATE_FREE;
+        p_entry->IsPooled  =  DEF_YES;
+        p_entry->IsInUse   =  DEF_NO;
+        p_entry->IsFlushed =  DEF_NO;
+        p_entry->SockID    =  NET_SOCK_BAD_SOCK;
+    }
+
+    SNTPc_SockPoolEvictIx = 0u;
+
+    Mem_Clr(&SNTPc_SockPoolStat, sizeof(SNTPc_SockPoolStat));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_SockGet()
+*
+* Description : Get an open socket to reach a server, from the socket pool if possible.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration.
+*
+*               p_server_addr   Pointer to the server socket address.
+*
+*               p_entry_tmp     Pointer to a temporary entry to use if the server cannot be kept in the pool.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Socket successfully returned.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the socket open to fail.
+*
+* Return(s)   : Pointer to the socket entry, if NO error(s).
+*
+*               DEF_NULL,                    otherwise.
+*
+* Caller(s)   : SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst().
+*
+* Note(s)     : (1) The returned entry is owned by the caller until it is released with SNTPc_SockRelease().
+*                   Concurrent requests to the same server use different entries.
+*
+*               (2) When no entry is free, the entries closed after an error are replaced first. Otherwise,
+*                   open entries that are not in use are evicted in round-robin order. If all entries are in
+*                   use, the temporary entry is used.
+*
+*               (3) The module lock is released while the socket is opened & configured.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_DISABLED)
+static  SNTPc_SOCK_ENTRY  *SNTPc_SockGet (const SNTPc_CFG           *p_cfg,
+                                                NET_SOCK_ADDR       *p_server_addr,
+                                                SNTPc_SOCK_ENTRY    *p_entry_tmp,
+                                                SNTPc_ERR           *p_err)
+{
+    SNTPc_SOCK_ENTRY          *p_entry;
+    SNTPc_SOCK_ENTRY          *p_entry_cur;
+    SNTPc_SOCK_ENTRY          *p_entry_free;
+    SNTPc_SOCK_ENTRY          *p_entry_closed;
+    NET_SOCK_PROTOCOL_FAMILY   protocol_family;
+    NET_SOCK_ID                sock_evict;
+    CPU_SIZE_T                 hostname_len;
+    CPU_BOOLEAN                is_reopen;
+    NET_ERR                    err;
+    CPU_INT16U                 ix;
+
+
+    p_entry        = DEF_NULL;
+    p_entry_free   = DEF_NULL;
+    p_entry_closed = DEF_NULL;
+    sock_evict     = NET_SOCK_BAD_SOCK;
+    is_reopen      = DEF_NO;
+
+    switch (p_server_addr->AddrFamily) {
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V4;
+             break;
+
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V6;
+             break;
+
+        default:
+            *p_err = SNTPc_ERR_SERVER_CFG;
+             return (DEF_NULL);
+    }
+
+    hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    if (hostname_len <= SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {
+                                                                /* ------------- SEARCH SERVER IN THE POOL ------------ */
+        for (ix = 0u; ix < SNTPc_CFG_SOCK_POOL_NBR_ENTRIES; ix++) {
+            p_entry_cur = &SNTPc_SockPool[ix];
+            if (p_entry_cur->IsInUse == DEF_YES) {              /* Entry owned by another req (see Note #1).            */
+                continue;
+            }
+
+            if (p_entry_cur->State == SNTPc_SOCK_STATE_FREE) {
+                if (p_entry_free == DEF_NULL) {
+                    p_entry_free = p_entry_cur;
+                }
+                continue;
+            }
+
+            if ((p_entry_cur->PortNbr    == p_cfg->ServerPortNbr     ) &&
+                (p_entry_cur->AddrFamily == p_server_addr->AddrFamily) &&
+                (Str_Cmp(p_entry_cur->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+                if (p_entry_cur->State == SNTPc_SOCK_STATE_OPEN) {
+                    p_entry = p_entry_cur;                      /* Open sock found for this server.                     */
+                    break;
+                }
+                if (p_entry == DEF_NULL) {
+                    p_entry = p_entry_cur;                      /* Keep searching for an open sock.                     */
+                }
+                continue;
+            }
+
+            if ((p_entry_cur->State == SNTPc_SOCK_STATE_CLOSED) &&
+                (p_entry_closed     == DEF_NULL               )) {
+                p_entry_closed = p_entry_cur;
+            }
+        }
+
+        if (p_entry != DEF_NULL) {
+            p_entry->IsInUse = DEF_YES;
+            if (p_entry->State == SNTPc_SOCK_STATE_OPEN) {      /* Reuse the sock already open for this server.         */
+                SNTPc_SockPoolStat.SockReuseCtr++;
+                SNTPc_ReleaseLock();
+               *p_err = SNTPc_ERR_NONE;
+                return (p_entry);
+            }
+            is_reopen = DEF_YES;                                /* Sock was closed after an err, re-open it.            */
+
+        } else {                                                /* Assign a new entry to the server (see Note #2).      */
+            if (p_entry_free != DEF_NULL) {
+                p_entry = p_entry_free;
+            } else if (p_entry_closed != DEF_NULL) {
+                p_entry = p_entry_closed;
+            } else {
+                for (ix = 0u; ix < SNTPc_CFG_SOCK_POOL_NBR_ENTRIES; ix++) {
+                    p_entry_cur = &SNTPc_SockPool[SNTPc_SockPoolEvictIx];
+                    SNTPc_SockPoolEvictIx++;
+                    if (SNTPc_SockPoolEvictIx >= SNTPc_CFG_SOCK_POOL_NBR_ENTRIES) {
+                        SNTPc_SockPoolEvictIx = 0u;
+                    }
+                    if (p_entry_cur->IsInUse == DEF_NO) {
+                        p_entry             = p_entry_cur;
+                        sock_evict          = p_entry->SockID;
+                        p_entry->SockID     = NET_SOCK_BAD_SOCK;
+                        SNTPc_SockPoolStat.SockEvictCtr++;
+                        break;
+                    }
+                }
+            }
+
+            if (p_entry != DEF_NULL) {
+                (void)Str_Copy_N(p_entry->Hostname,
+                                 p_cfg->ServerHostnamePtr,
+                                 SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+                p_entry->PortNbr    = p_cfg->ServerPortNbr;
+                p_entry->AddrFamily = p_server_addr->AddrFamily;
+                p_entry->State      = SNTPc_SOCK_STATE_CLOSED;
+                p_entry->IsInUse    = DEF_YES;
+            }
+        }
+    }
+
+    SNTPc_ReleaseLock();
+
+    if (sock_evict != NET_SOCK_BAD_SOCK) {
+        (void)NetSock_Close(sock_evict, &err);
+    }
+
+    if (p_entry == DEF_NULL) {
+        p_entry            = p_entry_tmp;                       /* Server cannot be kept in the pool.                   */
+        p_entry->IsPooled  = DEF_NO;
+        p_entry->IsInUse   = DEF_YES;
+        p_entry->IsFlushed = DEF_NO;
+    }
+                                                                /* -------------------- OPEN SOCKET ------------------- */
+    p_entry->SockID = NetSock_Open(protocol_family,             /* See Note #3.                                         */
+                                   NET_SOCK_TYPE_DATAGRAM,
+                                   NET_SOCK_PROTOCOL_UDP,
+                                  &err);
+    if (err != NET_SOCK_ERR_NONE) {
+        p_entry->SockID = NET_SOCK_BAD_SOCK;
+        SNTPc_SockRelease(p_entry, DEF_YES);
+       *p_err           = SNTPc_ERR_SERVER_CFG;
+        return (DEF_NULL);
+    }
+                                                                /* ----------- SET SOCKET IN BLOCKING MODE ------------ */
+    (void)NetSock_CfgBlock(p_entry->SockID, NET_SOCK_BLOCK_SEL_BLOCK, &err);
+    if (err != NET_SOCK_ERR_NONE) {
+        SNTPc_SockRelease(p_entry, DEF_YES);
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_NULL);
+    }
+
+    p_entry->RxTimeout_ms = SNTPc_SOCK_RX_TIMEOUT_UNKNOWN;
+
+    if (p_entry->IsPooled == DEF_YES) {
+        SNTPc_AcquireLock(p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            SNTPc_SockRelease(p_entry, DEF_YES);
+            return (DEF_NULL);
+        }
+        p_entry->State = SNTPc_SOCK_STATE_OPEN;
+        if (is_reopen == DEF_YES) {
+            SNTPc_SockPoolStat.SockReopenCtr++;
+        } else {
+            SNTPc_SockPoolStat.SockOpenCtr++;
+        }
+        SNTPc_ReleaseLock();
+    } else {
+        p_entry->State = SNTPc_SOCK_STATE_OPEN;
+    }
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (p_entry);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_SockRelease()
+*
+* Description : Release a socket obtained with SNTPc_SockGet().
+*
+* Argument(s) : p_entry     Pointer to the socket entry to release.
+*
+*               is_faulted  DEF_YES, if an error occurred on the socket. The socket is closed.
+*
+*                           DEF_NO,  otherwise. The socket is kept open in the pool.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_SockGet(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst().
+*
+* Note(s)     : (1) The socket of a temporary entry is always closed.
+*
+*               (2) The socket of an entry flushed while in use is closed & the entry is freed.
+*
+*               (3) If the module lock cannot be acquired, the socket is closed but the entry remains in use
+*                   & is never reused.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_SockRelease (SNTPc_SOCK_ENTRY  *p_entry,
+                                 CPU_BOOLEAN        is_faulted)
+{
+    NET_SOCK_ID  sock_close;
+    SNTPc_ERR    err;
+    NET_ERR      err_net;
+
+
+    sock_close = NET_SOCK_BAD_SOCK;
+
+    if (p_entry->IsPooled == DEF_NO) {                          /* See Note #1.                                         */
+        sock_close       = p_entry->SockID;
+        p_entry->SockID  = NET_SOCK_BAD_SOCK;
+        p_entry->State   = SNTPc_SOCK_STATE_CLOSED;
+        p_entry->IsInUse = DEF_NO;
+
+    } else {
+        SNTPc_AcquireLock(&err);
+        if (err != SNTPc_ERR_NONE) {                            /* See Note #3.                                         */
+            sock_close      = p_entry->SockID;
+            p_entry->SockID = NET_SOCK_BAD_SOCK;
+        } else {
+            if ((is_faulted         == DEF_YES) ||
+                (p_entry->IsFlushed == DEF_YES)) {
+                sock_close      = p_entry->SockID;
+                p_entry->SockID = NET_SOCK_BAD_SOCK;
+                p_entry->State  = (p_entry->IsFlushed == DEF_YES) ? SNTPc_SOCK_STATE_FREE    /* See Note #2.          */
+                                                                  : SNTPc_SOCK_STATE_CLOSED;
+            }
+            p_entry->IsFlushed = DEF_NO;
+            p_entry->IsInUse   = DEF_NO;
+            SNTPc_ReleaseLock();
+        }
+    }
+
+    if (sock_close != NET_SOCK_BAD_SOCK) {
+        (void)NetSock_Close(sock_close, &err_net);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_MuxInit()
+*
+* Description : Initialize the shared sockets & the shared socket request pool.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : (1) The shared sockets are opened by the first request sent on each address family (see
+*                   SNTPc_MuxSockGet()).
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+static  void  SNTPc_MuxInit (void)
+{
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < SNTPc_MUX_SOCK_NBR; ix++) {              /* See Note #1.                                         */
+        SNTPc_MuxSockTbl[ix] = NET_SOCK_BAD_SOCK;
+    }
+    SNTPc_MuxSockRxIx = 0u;
+
+    for (ix = 0u; ix < SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX; ix++) {
+        SNTPc_MuxReqPool[ix].State   = SNTPc_MUX_REQ_STATE_FREE;
+        SNTPc_MuxReqPool[ix].NextPtr = DEF_NULL;
+        SNTPc_MuxReqHashTbl[ix]      = DEF_NULL;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_MuxSockGet()
+*
+* Description : Get the shared socket of an address family, & open it if needed.
+*
+* Argument(s) : addr_family     Address family of the server socket address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Socket successfully returned.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Invalid address family or socket open failed.
+*
+* Return(s)   : Socket ID of the shared socket, if NO error(s).
+*
+*               NET_SOCK_BAD_SOCK,              otherwise.
+*
+* Caller(s)   : SNTPc_MuxTx().
+*
+* Note(s)     : (1) The module lock is released while the socket is opened & configured. If another task
+*                   opened the shared socket meanwhile, the socket just opened is closed.
+*
+*               (2) The shared sockets are never connected, so that they receive the replies of all the
+*                   servers, & are kept open until the network stack is shut down.
+*********************************************************************************************************
+*/
+
+static  NET_SOCK_ID  SNTPc_MuxSockGet (NET_SOCK_ADDR_FAMILY   addr_family,
+                                       SNTPc_ERR             *p_err)
+{
+    NET_SOCK_PROTOCOL_FAMILY   protocol_family;
+    NET_SOCK_ID                sock;
+    NET_SOCK_ID                sock_close;
+    NET_ERR                    err;
+    CPU_INT08U                 ix;
+
+
+    switch (addr_family) {
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V4;
+             ix              = 0u;
+             break;
+
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V6;
+             ix              = 1u;
+             break;
+
+        default:
+            *p_err = SNTPc_ERR_SERVER_CFG;
+             return (NET_SOCK_BAD_SOCK);
+    }
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (NET_SOCK_BAD_SOCK);
+    }
+    sock = SNTPc_MuxSockTbl[ix];
+    SNTPc_ReleaseLock();
+
+    if (sock != NET_SOCK_BAD_SOCK) {
+       *p_err = SNTPc_ERR_NONE;
+        return (sock);
+    }
+                                                                /* -------------------- OPEN SOCKET ------------------- */
+    sock = NetSock_Open(protocol_family,                        /* See Note #1.                                         */
+                        NET_SOCK_TYPE_DATAGRAM,
+                        NET_SOCK_PROTOCOL_UDP,
+                       &err);
+    if (err != NET_SOCK_ERR_NONE) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (NET_SOCK_BAD_SOCK);
+    }
+                                                                /* ----------- SET SOCKET IN BLOCKING MODE ------------ */
+    (void)NetSock_CfgBlock(sock, NET_SOCK_BLOCK_SEL_BLOCK, &err);
+    if (err != NET_SOCK_ERR_NONE) {
+        (void)NetSock_Close(sock, &err);
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (NET_SOCK_BAD_SOCK);
+    }
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        (void)NetSock_Close(sock, &err);
+        return (NET_SOCK_BAD_SOCK);
+    }
+    if (SNTPc_MuxSockTbl[ix] == NET_SOCK_BAD_SOCK) {            /* See Note #2.                                         */
+        SNTPc_MuxSockTbl[ix] = sock;
+        sock_close           = NET_SOCK_BAD_SOCK;
+        SNTPc_SockPoolStat.SockOpenCtr++;
+    } else {
+        sock_close           = sock;                            /* Opened by another task, close ours (see Note #1).    */
+        sock                 = SNTPc_MuxSockTbl[ix];
+    }
+    SNTPc_ReleaseLock();
+
+    if (sock_close != NET_SOCK_BAD_SOCK) {
+        (void)NetSock_Close(sock_close, &err);
+    }
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (sock);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_MuxTx()
+*
+* Description : Send a request to a server on the shared socket of its address family.
+*
+* Argument(s) : p_server_addr   Pointer to the server socket address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Request successfully sent.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the socket open to fail.
+*                                   SNTPc_ERR_NO_MORE_RSRC   All the shared socket requests are in use.
+*                                   SNTPc_ERR_TX             Error during the request transmission.
+*
+* Return(s)   : Pointer to the request, if NO error(s).
+*
+*               DEF_NULL,               otherwise.
+*
+* Caller(s)   : SNTPc_MuxReqExchange(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst().
+*
+* Note(s)     : (1) The request is owned by the caller until it is freed with SNTPc_MuxReqFree().
+*
+*               (2) The nonce is drawn from Math_Rand(), mixed with the local time, & is unique among the
+*                   pending requests. It is neither zero, which servers may treat as an unsynchronized
+*                   client, nor predictable from the local time, so that an off-path attacker cannot forge
+*                   a reply. The application should seed the generator with Math_RandSetSeed() from a
+*                   hardware entropy source.
+*
+*               (3) The request is linked in the hash table before it is sent, so that its reply is matched
+*                   even if it is received by another task before SNTPc_Tx() returns.
+*********************************************************************************************************
+*/
+
+static  SNTPc_MUX_REQ  *SNTPc_MuxTx (const NET_SOCK_ADDR  *p_server_addr,
+                                           SNTPc_ERR      *p_err)
+{
+    SNTPc_MUX_REQ  *p_req;
+    NET_SOCK_ID     sock;
+    SNTP_TS         nonce;
+    SNTP_FIXED_TS   ts_local;
+    CPU_INT32U      hash;
+    CPU_INT16U      ix;
+    CPU_BOOLEAN     result;
+
+
+    sock = SNTPc_MuxSockGet(p_server_addr->AddrFamily, p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_NULL);
+    }
+                                                                /* -------------------- ALLOC REQ --------------------- */
+    p_req = DEF_NULL;
+    for (ix = 0u; ix < SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX; ix++) {
+        if (SNTPc_MuxReqPool[ix].State == SNTPc_MUX_REQ_STATE_FREE) {
+            p_req = &SNTPc_MuxReqPool[ix];
+            break;
+        }
+    }
+    if (p_req == DEF_NULL) {
+        SNTPc_ReleaseLock();
+       *p_err = SNTPc_ERR_NO_MORE_RSRC;
+        return (DEF_NULL);
+    }
+                                                                /* -------------------- DRAW NONCE -------------------- */
+    ts_local = SNTPc_ClkLocalGet();
+    do {                                                        /* See Note #2.                                         */
+        nonce.Sec  = ((CPU_INT32U)Math_Rand() << 16u) ^ (CPU_INT32U)Math_Rand() ^ (CPU_INT32U)(ts_local >> 32u);
+        nonce.Frac = ((CPU_INT32U)Math_Rand() << 16u) ^ (CPU_INT32U)Math_Rand() ^ (CPU_INT32U)ts_local;
+    } while (((nonce.Sec  == 0u) &&
+              (nonce.Frac == 0u)) ||
+             (SNTPc_MuxReqSrch(&nonce) != DEF_NULL));
+                                                                /* --------------------- LINK REQ --------------------- */
+    p_req->State        = SNTPc_MUX_REQ_STATE_PENDING;
+    p_req->ServerAddr   = *p_server_addr;
+    p_req->TxTS.Pkt     = nonce;
+    p_req->TxTS.Local   = ts_local;
+    hash                = SNTPc_MUX_REQ_HASH(&nonce);
+    p_req->NextPtr      = SNTPc_MuxReqHashTbl[hash];            /* See Note #3.                                         */
+    SNTPc_MuxReqHashTbl[hash] = p_req;
+    SNTPc_ReleaseLock();
+                                                                /* ---------------------- TX REQ ---------------------- */
+    result = SNTPc_Tx( sock,
+                      &p_req->ServerAddr,
+                      &p_req->TxTS,
+                       DEF_YES,
+                       p_err);
+    if (result != DEF_OK) {
+        SNTPc_MuxReqFree(p_req);
+        return (DEF_NULL);
+    }
+
+    return (p_req);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_MuxRx()
+*
+* Description : Wait for the reply to one of a set of requests sent on the shared sockets.
+*
+* Argument(s) : p_req_tbl       Pointer to a table of requests. DEF_NULL entries are skipped.
+*
+*               req_nbr         Number of requests in the table.
+*
+*               timeout_ms      Time to wait for a reply, in milliseconds.
+*
+*               ppkt            Pointer to a variable that will receive the reply.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           A valid reply has been received.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_RX             No reply received before the timeout.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death reply received.
+*
+* Return(s)   : Index of the answered request in the table, if a reply has been received.
+*
+*               DEF_INT_08U_MAX_VAL,                          otherwise.
+*
+* Caller(s)   : SNTPc_MuxReqExchange(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst().
+*
+* Note(s)     : (1) A single task at a time receives on the shared sockets, while holding the shared socket Rx
+*                   lock, & delivers each reply to its request, whichever task owns it. The other tasks
+*                   wait on the lock & check their requests each time the lock is released, which happens
+*                   at least every SNTPc_MUX_RX_SLICE_MS.
+*
+*               (2) The originate timestamp of the returned reply is the nonce of the request. The caller
+*                   restores the local transmit time with SNTPc_TxTS_Apply().
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  SNTPc_MuxRx (SNTPc_MUX_REQ  **p_req_tbl,
+                                 CPU_INT08U       req_nbr,
+                                 CPU_INT32U       timeout_ms,
+                                 SNTP_PKT        *ppkt,
+                                 SNTPc_ERR       *p_err)
+{
+    SNTPc_MUX_REQ  *p_req;
+    NET_TS_MS       ts_start;
+    NET_TS_MS       elapsed_ms;
+    CPU_INT32U      wait_ms;
+    KAL_ERR         err_kal;
+    CPU_INT08U      ix;
+
+
+    ts_start = NetUtil_TS_Get_ms();
+
+    while (DEF_ON) {
+                                                                /* ---------------- CHECK FOR A REPLY ----------------- */
+        SNTPc_AcquireLock(p_err);
+        if (*p_err != SNTPc_ERR_NONE) {
+            break;
+        }
+        for (ix = 0u; ix < req_nbr; ix++) {
+            p_req = p_req_tbl[ix];
+            if ((p_req        != DEF_NULL                ) &&
+                (p_req->State == SNTPc_MUX_REQ_STATE_RX)) {
+                p_req->State = SNTPc_MUX_REQ_STATE_DONE;
+               *ppkt         = p_req->Pkt;                      /* See Note #2.                                         */
+               *p_err        = p_req->Err;
+                break;
+            }
+        }
+        SNTPc_ReleaseLock();
+
+        if (ix < req_nbr) {
+            break;
+        }
+
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= timeout_ms) {
+           *p_err = SNTPc_ERR_RX;
+            break;
+        }
+        wait_ms = timeout_ms - elapsed_ms;
+                                                                /* --------------- WAIT FOR THE RX LOCK --------------- */
+        KAL_LockAcquire(SNTPc_MuxRxLock,                        /* See Note #1.                                         */
+                        KAL_OPT_PEND_NONE,
+                        wait_ms,
+                       &err_kal);
+        if (err_kal == KAL_ERR_TIMEOUT) {
+            continue;
+        }
+        if (err_kal != KAL_ERR_NONE) {
+           *p_err = SNTPc_ERR_ACQUIRE_LOCK;
+            break;
+        }
+                                                                /* ---------------- RX ON SHARED SOCKS ---------------- */
+        SNTPc_AcquireLock(p_err);
+        if (*p_err == SNTPc_ERR_NONE) {
+            for (ix = 0u; ix < req_nbr; ix++) {                 /* Reply may have been rx'd while waiting for the lock. */
+                p_req = p_req_tbl[ix];
+                if ((p_req        != DEF_NULL                ) &&
+                    (p_req->State == SNTPc_MUX_REQ_STATE_RX)) {
+                    break;
+                }
+            }
+            SNTPc_ReleaseLock();
+            if (ix >= req_nbr) {
+                SNTPc_MuxSockRx(DEF_MIN(wait_ms, SNTPc_MUX_RX_SLICE_MS));
+            }
+        }
+        KAL_LockRelease(SNTPc_MuxRxLock, &err_kal);
+
+        if (*p_err != SNTPc_ERR_NONE) {
+            break;
+        }
+    }
+
+    if ((*p_err != SNTPc_ERR_NONE) &&
+        (*p_err != SNTPc_ERR_KOD )) {
+        return (DEF_INT_08U_MAX_VAL);
+    }
+
+    return (ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_MuxSockRx()
+*
+* Description : Receive the replies pending on the shared sockets.
+*
+* Argument(s) : wait_ms     Maximum time to wait for a reply, in milliseconds.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxRx().
+*
+* Note(s)     : (1) The shared socket Rx lock MUST be held by the caller.
+*
+*               (2) When the socket select feature is disabled, the shared sockets are waited on one after the
+*                   other, each for a single slice.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_MuxSockRx (CPU_INT32U  wait_ms)
+{
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+    NET_SOCK_DESC       sock_desc_rd;
+    NET_SOCK_TIMEOUT    sel_timeout;
+    NET_SOCK_QTY        sock_nbr_max;
+    NET_SOCK_RTN_CODE   sel_res;
+#endif
+    NET_SOCK_ID         sock_tbl[SNTPc_MUX_SOCK_NBR];
+    NET_ERR             err_net;
+    SNTPc_ERR           err;
+    CPU_INT08U          ix;
+
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+    for (ix = 0u; ix < SNTPc_MUX_SOCK_NBR; ix++) {
+        sock_tbl[ix] = SNTPc_MuxSockTbl[ix];
+    }
+    SNTPc_ReleaseLock();
+
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+    NET_SOCK_DESC_INIT(&sock_desc_rd);
+    sock_nbr_max = 0;
+    for (ix = 0u; ix < SNTPc_MUX_SOCK_NBR; ix++) {
+        if (sock_tbl[ix] != NET_SOCK_BAD_SOCK) {
+            NET_SOCK_DESC_SET(sock_tbl[ix], &sock_desc_rd);
+            sock_nbr_max = DEF_MAX(sock_nbr_max, sock_tbl[ix] + 1);
+        }
+    }
+
+    if (sock_nbr_max == 0) {                                    /* No shared sock open yet.                             */
+        KAL_Dly(wait_ms);
+        return;
+    }
+
+    sel_timeout.timeout_sec = (CPU_INT32S)( wait_ms / SNTP_MS_NBR_PER_SEC);
+    sel_timeout.timeout_us  = (CPU_INT32S)((wait_ms % SNTP_MS_NBR_PER_SEC) * 1000u);
+
+    sel_res = NetSock_Sel(sock_nbr_max,
+                         &sock_desc_rd,
+                          DEF_NULL,
+                          DEF_NULL,
+                         &sel_timeout,
+                         &err_net);
+    if (sel_res <= 0) {
+        return;                                                 /* Timeout or sel err.                                  */
+    }
+
+    for (ix = 0u; ix < SNTPc_MUX_SOCK_NBR; ix++) {
+        if ((sock_tbl[ix] != NET_SOCK_BAD_SOCK) &&
+            (NET_SOCK_DESC_IS_SET(sock_tbl[ix], &sock_desc_rd) != 0)) {
+            SNTPc_MuxSockRd(sock_tbl[ix], DEF_NO);
+        }
+    }
+
+#else
+    for (ix = 0u; ix < SNTPc_MUX_SOCK_NBR; ix++) {              /* Select the next open shared sock (see Note #2).      */
+        SNTPc_MuxSockRxIx = (SNTPc_MuxSockRxIx + 1u) % SNTPc_MUX_SOCK_NBR;
+        if (sock_tbl[SNTPc_MuxSockRxIx] != NET_SOCK_BAD_SOCK) {
+            break;
+        }
+    }
+
+    if (ix >= SNTPc_MUX_SOCK_NBR) {                             /* No shared sock open yet.                             */
+        KAL_Dly(wait_ms);
+        return;
+    }
+
+    NetSock_CfgTimeoutRxQ_Set(sock_tbl[SNTPc_MuxSockRxIx],
+                              wait_ms,
+                             &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+    SNTPc_MuxSockRd(sock_tbl[SNTPc_MuxSockRxIx], DEF_YES);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_MuxSockRd()
+*
+* Description : Read the datagrams queued on a shared socket & deliver each reply to its request.
+*
+* Argument(s) : sock        Shared socket to read.
+*
+*               is_block    DEF_YES, if the first read waits until the Rx timeout of the socket.
+*
+*                           DEF_NO,  otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxSockRx().
+*
+* Note(s)     : (1) See 'SNTPc_Rx() Note #1'.
+*
+*               (2) Once a datagram is received, the datagrams already queued on the socket are read without
+*                   blocking, up to the number of requests that can be pending. A burst of replies is then
+*                   delivered on a single wake-up of the receiving task.
+*
+*               (3) A reply is matched to its request by its originate timestamp, which is the nonce of the
+*                   request (see 'SNTPc_MuxTx() Note #2'), then validated against the address of the queried
+*                   server (see 'SNTPc_Rx() Note #2'). A reply that matches no pending request is dropped &
+*                   counted in the reception statistics.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_MuxSockRd (NET_SOCK_ID  sock,
+                               CPU_BOOLEAN  is_block)
+{
+    SNTPc_MUX_REQ       *p_req;
+    NET_SOCK_ADDR        remote_addr;
+    NET_SOCK_ADDR_LEN    remote_addr_size;
+    NET_SOCK_API_FLAGS   flags;
+    NET_SOCK_RTN_CODE    res;
+    NET_ERR              err_net;
+    SNTP_PKT             pkt;
+    SNTP_FIXED_TS        ts_rx;
+    SNTPc_ERR            err;
+    CPU_INT16U           rx_nbr;
+    CPU_BOOLEAN          result;
+
+
+    flags = (is_block == DEF_YES) ? NET_SOCK_FLAG_NONE : NET_SOCK_FLAG_SOCK_NO_BLOCK;
+
+    for (rx_nbr = 0u; rx_nbr < SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX; rx_nbr++) {
+        remote_addr_size = sizeof(remote_addr);
+                                                                /* ---------------------- RX PKT ---------------------- */
+        res = NetSock_RxDataFrom(                      sock,
+                                 (void              *)&pkt,
+                                 (CPU_INT16U         ) sizeof(SNTP_PKT),
+                                                       flags,
+                                                      &remote_addr,
+                                                      &remote_addr_size,
+                                 (void              *) DEF_NULL,
+                                                       0u,
+                                                       DEF_NULL,
+                                                      &err_net);
+        ts_rx = SNTPc_ClkLocalGet();                            /* See Note #1.                                         */
+        if (res <= 0) {
+            break;                                              /* Rx Q empty, timeout or rx err.                       */
+        }
+        flags = NET_SOCK_FLAG_SOCK_NO_BLOCK;                    /* See Note #2.                                         */
+
+        SNTPc_RxStatInc(&SNTPc_RxStat.RxCtr);
+        if ((CPU_INT32U)res < sizeof(SNTP_PKT)) {
+            SNTPc_RxStatInc(&SNTPc_RxStat.DropLenCtr);
+            continue;
+        }
+                                                                /* ------------- DELIVER PKT TO ITS REQ --------------- */
+        SNTPc_AcquireLock(&err);
+        if (err != SNTPc_ERR_NONE) {
+            break;
+        }
+        p_req = SNTPc_MuxReqSrch(&pkt.TS_Originate);            /* See Note #3.                                         */
+        if (p_req == DEF_NULL) {
+            SNTPc_ReleaseLock();
+            SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+            continue;
+        }
+
+        result = SNTPc_RxCheck(&pkt,
+                               (CPU_INT32U)res,
+                               &remote_addr,
+                               &p_req->ServerAddr,
+                                SNTPc_MSG_MODE_SERVER,
+                               &err);
+        if ((result == DEF_OK       ) ||
+            (err    == SNTPc_ERR_KOD)) {
+            if (result == DEF_OK) {
+                SNTPc_RxTS_Set(&pkt, ts_rx);
+            }
+            p_req->Pkt   = pkt;
+            p_req->Err   = err;
+            p_req->State = SNTPc_MUX_REQ_STATE_RX;
+            SNTPc_MuxReqUnlink(p_req);
+        }
+        SNTPc_ReleaseLock();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_MuxReqSrch()
+*
+* Description : Search the pending request of a nonce.
+*
+* Argument(s) : p_nonce     Pointer to the nonce, in network order.
+*
+* Return(s)   : Pointer to the pending request, if found.
+*
+*               DEF_NULL,                       otherwise.
+*
+* Caller(s)   : SNTPc_MuxTx(),
+*               SNTPc_MuxSockRd().
+*
+* Note(s)     : (1) The module lock MUST be held by the caller.
+*********************************************************************************************************
+*/
+
+static  SNTPc_MUX_REQ  *SNTPc_MuxReqSrch (const SNTP_TS  *p_nonce)
+{
+    SNTPc_MUX_REQ  *p_req;
+
+
+    p_req = SNTPc_MuxReqHashTbl[SNTPc_MUX_REQ_HASH(p_nonce)];
+    while (p_req != DEF_NULL) {
+        if ((p_req->TxTS.Pkt.Sec  == p_nonce->Sec ) &&
+            (p_req->TxTS.Pkt.Frac == p_nonce->Frac)) {
+            break;
+        }
+        p_req = p_req->NextPtr;
+    }
+
+    return (p_req);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_MuxReqUnlink()
+*
+* Description : Remove a request from the hash table of the pending requests.
+*
+* Argument(s) : p_req       Pointer to the request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxSockRd(),
+*               SNTPc_MuxReqFree().
+*
+* Note(s)     : (1) The module lock MUST be held by the caller.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_MuxReqUnlink (SNTPc_MUX_REQ  *p_req)
+{
+    SNTPc_MUX_REQ  *p_req_prev;
+    SNTPc_MUX_REQ  *p_req_cur;
+    CPU_INT32U      hash;
+
+
+    hash       = SNTPc_MUX_REQ_HASH(&p_req->TxTS.Pkt);
+    p_req_prev = DEF_NULL;
+    p_req_cur  = SNTPc_MuxReqHashTbl[hash];
+    while ((p_req_cur != DEF_NULL) &&
+           (p_req_cur != p_req   )) {
+        p_req_prev = p_req_cur;
+        p_req_cur  = p_req_cur->NextPtr;
+    }
+
+    if (p_req_cur == DEF_NULL) {                                /* Req not linked.                                      */
+        return;
+    }
+
+    if (p_req_prev == DEF_NULL) {
+        SNTPc_MuxReqHashTbl[hash] = p_req->NextPtr;
+    } else {
+        p_req_prev->NextPtr       = p_req->NextPtr;
+    }
+    p_req->NextPtr = DEF_NULL;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_MuxReqFree()
+*
+* Description : Free a request obtained with SNTPc_MuxTx().
+*
+* Argument(s) : p_req       Pointer to the request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxTx(),
+*               SNTPc_MuxReqExchange(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst().
+*
+* Note(s)     : (1) A request still waiting for its reply is removed from the hash table, so that its late
+*                   reply is dropped (see 'SNTPc_MuxSockRd() Note #3').
+*
+*               (2) If the module lock cannot be acquired, the request remains allocated & is never reused.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_MuxReqFree (SNTPc_MUX_REQ  *p_req)
+{
+    SNTPc_ERR  err;
+
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {                                /* See Note #2.                                         */
+        return;
+    }
+    if (p_req->State == SNTPc_MUX_REQ_STATE_PENDING) {          /* See Note #1.                                         */
+        SNTPc_MuxReqUnlink(p_req);
+    }
+    p_req->State = SNTPc_MUX_REQ_STATE_FREE;
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_MuxReqExchange()
+*
+* Description : Perform a request/reply exchange with a server on the shared sockets, racing its addresses.
+*
+* Argument(s) : p_cfg               Pointer to the server configuration.
+*
+*               p_server_addr_tbl   Pointer to a table of socket addresses of the server, by order of
+*                                   preference.
+*
+*               addr_nbr            Number of addresses in the table (1 or 2).
+*
+*               ppkt                Pointer to a variable that will receive the reply.
+*
+*               p_ix_rx             Pointer to a variable that will receive the index of the address that
+*                                   replied.
+*
+*               p_err               Pointer to variable that will receive the return error code from this function :
+*
+*                                       SNTPc_ERR_NONE           A valid reply has been received.
+*                                       SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                       SNTPc_ERR_SERVER_CFG     Error in the Server configuration.
+*                                       SNTPc_ERR_NO_MORE_RSRC   All the shared socket requests are in use.
+*                                       SNTPc_ERR_TX             Error during the request transmission.
+*                                       SNTPc_ERR_RX             No reply received before the Rx timeout.
+*                                       SNTPc_ERR_KOD            Kiss-o'-Death reply received.
+*
+* Return(s)   : DEF_OK,   if a valid reply has been received.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_ReqExchange(),
+*               SNTPc_ReqRace().
+*
+* Note(s)     : (1) The module lock MUST NOT be held by the caller (see 'SNTPc_ReqExchange() Note #1').
+*
+*               (2) The request to the second address is sent SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS after the first
+*                   one, or right away if the first request could not be sent (see 'SNTPc_ReqRace() Note #2').
+*                   The first valid reply wins & the other request is freed.
+*
+*               (3) A Kiss-o'-Death reply puts the server in backoff & fails the exchange with SNTPc_ERR_KOD
+*                   (see 'SNTPc_BackoffStart() Note #1').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_MuxReqExchange (const SNTPc_CFG      *p_cfg,
+                                           const NET_SOCK_ADDR  *p_server_addr_tbl,
+                                                 CPU_INT08U      addr_nbr,
+                                                 SNTP_PKT       *ppkt,
+                                                 CPU_INT08U     *p_ix_rx,
+                                                 SNTPc_ERR      *p_err)
+{
+    SNTPc_MUX_REQ  *p_req_tbl[2];
+    CPU_BOOLEAN     is_tx[2];
+    NET_TS_MS       ts_start;
+    NET_TS_MS       elapsed_ms;
+    CPU_INT32U      wait_ms;
+    SNTPc_ERR       err_tx;
+    CPU_INT08U      tx_nbr;
+    CPU_INT08U      ix;
+    CPU_INT08U      ix_rx;
+    CPU_BOOLEAN     result;
+
+
+    addr_nbr = DEF_MIN(addr_nbr, 2u);
+    for (ix = 0u; ix < 2u; ix++) {
+        p_req_tbl[ix] = DEF_NULL;
+        is_tx[ix]     = DEF_NO;
+    }
+    tx_nbr   = 0u;
+    err_tx   = SNTPc_ERR_TX;
+    result   = DEF_FAIL;
+    ts_start = NetUtil_TS_Get_ms();
+
+    while (DEF_ON) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+        if (elapsed_ms >= p_cfg->ReqRxTimeout_ms) {
+           *p_err = ((p_req_tbl[0] != DEF_NULL) || (p_req_tbl[1] != DEF_NULL)) ? SNTPc_ERR_RX : err_tx;
+            break;
+        }
+        wait_ms = p_cfg->ReqRxTimeout_ms - elapsed_ms;
+                                                                /* ---------------------- TX REQS --------------------- */
+        for (ix = 0u; ix < addr_nbr; ix++) {
+            if (is_tx[ix] == DEF_YES) {
+                continue;
+            }
+            if ((ix           >  0u                              ) &&
+                (p_req_tbl[0] != DEF_NULL                        ) &&
+                (elapsed_ms   <  SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS)) {
+                wait_ms = DEF_MIN(wait_ms, SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS - elapsed_ms);
+                continue;                                       /* See Note #2.                                         */
+            }
+            p_req_tbl[ix] = SNTPc_MuxTx(&p_server_addr_tbl[ix], &err_tx);
+            is_tx[ix]     = DEF_YES;
+            tx_nbr++;
+        }
+
+        if ((tx_nbr       == addr_nbr) &&
+            (p_req_tbl[0] == DEF_NULL) &&
+            (p_req_tbl[1] == DEF_NULL)) {
+           *p_err = err_tx;                                     /* No req could be sent.                                */
+            break;
+        }
+                                                                /* ---------------------- RX REPLY -------------------- */
+        ix_rx = SNTPc_MuxRx(p_req_tbl, addr_nbr, wait_ms, ppkt, p_err);
+        if (*p_err == SNTPc_ERR_NONE) {
+            (void)SNTPc_TxTS_Apply(ppkt, &p_req_tbl[ix_rx]->TxTS);
+           *p_ix_rx = ix_rx;
+            result  = DEF_OK;
+            break;
+        }
+        if (*p_err == SNTPc_ERR_KOD) {                          /* See Note #3.                                         */
+            SNTPc_BackoffStart(p_cfg, ppkt);
+            break;
+        }
+        if (*p_err != SNTPc_ERR_RX) {
+            break;
+        }
+    }
+                                                                /* --------------------- FREE REQS -------------------- */
+    for (ix = 0u; ix < addr_nbr; ix++) {
+        if (p_req_tbl[ix] != DEF_NULL) {
+            SNTPc_MuxReqFree(p_req_tbl[ix]);
+        }
+    }
+
+    return (result);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_AddrCacheInit()
+*
+* Description : Initialize the server address cache.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_AddrCacheInit (void)
+{
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        SNTPc_AddrCache[ix].IsValid = DEF_NO;
+    }
+
+    Mem_Clr(&SNTPc_AddrCacheStat, sizeof(SNTPc_AddrCacheStat));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ServerAddrGet()
+*
+* Description : Get the socket address of a server, from the server address cache if possible.
+*
+* Argument(s) : p_cfg           Pointer to the server configuration.
+*
+*               ip_family       IP family of the server address to use.
+*
+*               p_server_addr   Pointer to variable that will receive the server socket address.
+*
+*               p_is_hostname   Pointer to variable that will receive :
+*
+*                                   DEF_YES, if the server is specified by a hostname.
+*                                   DEF_NO,  if the server is specified by an IP address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Server address successfully returned.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Server hostname could not be resolved.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ServerAddrSel().
+*
+* Note(s)     : (1) The module lock is released while the hostname is resolved. The cache is searched again
+*                   once the lock is acquired again, since it may have changed in the meantime.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_ServerAddrGet (const SNTPc_CFG           *p_cfg,
+                                         NET_IP_ADDR_FAMILY   ip_family,
+                                         NET_SOCK_ADDR       *p_server_addr,
+                                         CPU_BOOLEAN         *p_is_hostname,
+                                         SNTPc_ERR           *p_err)
+{
+    SNTPc_ADDR_ENTRY  *p_entry;
+    SNTPc_ADDR_ENTRY  *p_entry_oldest;
+    NET_TS_MS          age_ms;
+    CPU_SIZE_T         hostname_len;
+    SNTPc_ERR          err_resolve;
+
+
+    hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+                                                                /* ------------ SEARCH SERVER IN THE CACHE ------------ */
+    if (hostname_len <= SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {
+        p_entry = SNTPc_AddrCacheSrch(p_cfg, ip_family, &p_entry_oldest);
+        if (p_entry != DEF_NULL) {
+            age_ms = NetUtil_TS_Get_ms() - p_entry->ResolvedTS_ms;
+            if ((p_entry->IsHostname == DEF_NO                 ) ||
+                (age_ms              <  SNTPc_ADDR_CACHE_TTL_MS)) {
+               *p_server_addr   = p_entry->ServerAddr;          /* Entry found & not expired.                           */
+               *p_is_hostname   = p_entry->IsHostname;
+                p_entry->IsUsed = DEF_YES;
+                SNTPc_AddrCacheStat.HitCtr++;
+                SNTPc_ReleaseLock();
+               *p_err           = SNTPc_ERR_NONE;
+                return;
+            }
+        }
+    }
+
+    SNTPc_AddrCacheStat.MissCtr++;
+
+    SNTPc_ReleaseLock();
+                                                                /* ------------- RESOLVE SERVER HOST NAME ------------- */
+    SNTPc_HostResolve(p_cfg->ServerHostnamePtr,                 /* See Note #1.                                         */
+                      p_cfg->ServerPortNbr,
+                      ip_family,
+                      p_server_addr,
+                      p_is_hostname,
+                     &err_resolve);
+
+    if (hostname_len > SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {     /* Hostname too long to be kept in the cache.           */
+       *p_err = err_resolve;
+        return;
+    }
+                                                                /* -------------- UPDATE SERVER IN CACHE -------------- */
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    p_entry = SNTPc_AddrCacheSrch(p_cfg, ip_family, &p_entry_oldest);
+
+    if (err_resolve != SNTPc_ERR_NONE) {
+        if (p_entry != DEF_NULL) {
+            p_entry->IsValid = DEF_NO;
+        }
+        SNTPc_ReleaseLock();
+       *p_err = err_resolve;
+        return;
+    }
+
+    if (p_entry == DEF_NULL) {
+        p_entry = p_entry_oldest;
+        (void)Str_Copy_N(p_entry->Hostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        p_entry->PortNbr    = p_cfg->ServerPortNbr;
+        p_entry->AddrFamily = ip_family;
+        p_entry->IsPref     = DEF_NO;
+    }
+
+    p_entry->IsHostname    = *p_is_hostname;
+    p_entry->ServerAddr    = *p_server_addr;
+    p_entry->ResolvedTS_ms =  NetUtil_TS_Get_ms();
+    p_entry->IsUsed        =  DEF_YES;
+    p_entry->IsValid       =  DEF_YES;
+
+    SNTPc_ReleaseLock();
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_AddrCacheSrch()
+*
+* Description : Search a server in the server address cache.
+*
+* Argument(s) : p_cfg               Pointer to the server configuration.
+*
+*               ip_family           IP family of the server address.
+*
+*               pp_entry_oldest     Pointer to variable that will receive the entry to replace if the server
+*                                   is added to the cache (see Note #2).
+*
+* Return(s)   : Pointer to the cache entry of the server, if found.
+*
+*               DEF_NULL,                                 otherwise.
+*
+* Caller(s)   : SNTPc_ServerAddrGet().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) When no entry is free, the entry resolved the longest time ago is replaced.
+*********************************************************************************************************
+*/
+
+static  SNTPc_ADDR_ENTRY  *SNTPc_AddrCacheSrch (const SNTPc_CFG           *p_cfg,
+                                                      NET_IP_ADDR_FAMILY   ip_family,
+                                                      SNTPc_ADDR_ENTRY   **pp_entry_oldest)
+{
+    SNTPc_ADDR_ENTRY  *p_entry;
+    NET_TS_MS          ts_cur;
+    NET_TS_MS          age_ms;
+    NET_TS_MS          age_oldest_ms;
+    CPU_INT16U         ix;
+
+
+   *pp_entry_oldest = DEF_NULL;
+    age_oldest_ms   = 0u;
+    ts_cur          = NetUtil_TS_Get_ms();
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_AddrCache[ix];
+        if (p_entry->IsValid == DEF_NO) {
+            if ((*pp_entry_oldest == DEF_NULL           ) ||
+                (age_oldest_ms    != DEF_INT_32U_MAX_VAL)) {
+               *pp_entry_oldest = p_entry;                      /* Free entries are replaced first.                     */
+                age_oldest_ms   = DEF_INT_32U_MAX_VAL;
+            }
+            continue;
+        }
+
+        if ((p_entry->PortNbr    == p_cfg->ServerPortNbr) &&
+            (p_entry->AddrFamily == ip_family           ) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry);
+        }
+
+        age_ms = ts_cur - p_entry->ResolvedTS_ms;
+        if ((*pp_entry_oldest == DEF_NULL    ) ||
+            (age_ms           >  age_oldest_ms)) {
+           *pp_entry_oldest = p_entry;                          /* See Note #2.                                         */
+            age_oldest_ms   = age_ms;
+        }
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_AddrFamilyPrefGet()
+*
+* Description : Get the address family that answered the last request to a server.
+*
+* Argument(s) : p_cfg    Pointer to the server configuration.
+*
+* Return(s)   : Preferred address family of the server, if any.
+*
+*               NET_IP_ADDR_FAMILY_NONE,                 otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ServerAddrSel().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The preferred family is lost when its server address cache entry is replaced or
+*                   expires. The families are then raced again.
+*********************************************************************************************************
+*/
+
+static  NET_IP_ADDR_FAMILY  SNTPc_AddrFamilyPrefGet (const SNTPc_CFG  *p_cfg)
+{
+    SNTPc_ADDR_ENTRY  *p_entry;
+    CPU_INT16U         ix;
+
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_AddrCache[ix];
+        if ((p_entry->IsValid == DEF_YES             ) &&
+            (p_entry->IsPref  == DEF_YES             ) &&
+            (p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry->AddrFamily);
+        }
+    }
+
+    return (NET_IP_ADDR_FAMILY_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_AddrFamilyPrefSet()
+*
+* Description : Set the address family to use for the following requests to a server.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration.
+*
+*               ip_family   Address family to prefer,
+*                           NET_IP_ADDR_FAMILY_NONE to race both families on the next request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The module lock is acquired by this function. If it cannot be acquired, the preferred
+*                   family is left unchanged.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_AddrFamilyPrefSet (const SNTPc_CFG          *p_cfg,
+                                             NET_IP_ADDR_FAMILY  ip_family)
+{
+    SNTPc_ADDR_ENTRY  *p_entry;
+    SNTPc_ERR          err;
+    CPU_INT16U         ix;
+
+
+    SNTPc_AcquireLock(&err);                                    /* See Note #1.                                         */
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_AddrCache[ix];
+        if ((p_entry->IsValid == DEF_YES             ) &&
+            (p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            p_entry->IsPref = (p_entry->AddrFamily == ip_family) ? DEF_YES : DEF_NO;
+        }
+    }
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_BackoffIsActive()
+*
+* Description : Check whether a server is in backoff after a Kiss-o'-Death reply.
+*
+* Argument(s) : p_cfg    Pointer to the server configuration.
+*
+* Return(s)   : DEF_YES, if the server is in backoff.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The module lock is acquired by this function. If it cannot be acquired, the server is
+*                   considered not in backoff.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  SNTPc_BackoffIsActive (const SNTPc_CFG  *p_cfg)
+{
+    SNTPc_BACKOFF_ENTRY  *p_entry;
+    SNTPc_BACKOFF_ENTRY  *p_entry_replace;
+    NET_TS_MS             elapsed_ms;
+    CPU_BOOLEAN           is_active;
+    SNTPc_ERR             err;
+
+
+    SNTPc_AcquireLock(&err);                                    /* See Note #1.                                         */
+    if (err != SNTPc_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+    is_active = DEF_NO;
+    p_entry   = SNTPc_BackoffSrch(p_cfg, &p_entry_replace);
+    if (p_entry != DEF_NULL) {
+        elapsed_ms = NetUtil_TS_Get_ms() - p_entry->StartTS_ms;
+        if (elapsed_ms < p_entry->Dur_ms) {
+            is_active = DEF_YES;
+        }
+    }
+
+    SNTPc_ReleaseLock();
+
+    return (is_active);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_BackoffStart()
+*
+* Description : Put a server in backoff after a Kiss-o'-Death reply.
+*
+* Argument(s) : p_cfg    Pointer to the server configuration.
+*
+*               ppkt     Pointer to the Kiss-o'-Death reply.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_MuxReqExchange(),
+*               SNTPc_ReqExchange(),
+*               SNTPc_ReqRace(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) RFC #5905, Section 7.4 states that "for kiss code DENY or RSTR, the client MUST
+*                   demobilize any associations to that server and stop sending packets to that server",
+*                   & that for kiss code RATE "the client MUST immediately reduce its polling interval to
+*                   that server and continue to reduce it each time it receives a RATE kiss code". DENY &
+*                   RSTR set the largest backoff interval, since the server may be reconfigured. RATE
+*                   doubles the interval, which is at least the poll interval of the reply.
+*
+*               (2) A random time of up to SNTPc_CFG_BACKOFF_JITTER_PCT percent of the interval is added, so
+*                   that the clients rate limited at the same time do not retry at the same time.
+*
+*               (3) The module lock is acquired by this function. If it cannot be acquired or if the hostname
+*                   is too long to be kept, the server is not put in backoff.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_BackoffStart (const SNTPc_CFG  *p_cfg,
+                                  const SNTP_PKT   *ppkt)
+{
+    SNTPc_BACKOFF_ENTRY  *p_entry;
+    SNTPc_BACKOFF_ENTRY  *p_entry_replace;
+    CPU_INT32U            kiss_code;
+    CPU_INT32U            cw;
+    CPU_INT08S            poll;
+    CPU_INT32U            backoff_sec;
+    CPU_INT32U            jitter_ms;
+    CPU_SIZE_T            hostname_len;
+    SNTPc_ERR             err;
+
+
+    hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+    if (hostname_len > SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {     /* See Note #3.                                         */
+        return;
+    }
+
+    kiss_code = NET_UTIL_NET_TO_HOST_32(ppkt->RefID);
+    cw        = NET_UTIL_NET_TO_HOST_32(ppkt->CW);
+    poll      = (CPU_INT08S)(cw >> SNTPc_MSG_POLL_SHIFT);
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    p_entry = SNTPc_BackoffSrch(p_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {
+        p_entry = p_entry_replace;
+        (void)Str_Copy_N(p_entry->Hostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        p_entry->PortNbr     = p_cfg->ServerPortNbr;
+        p_entry->Backoff_sec = 0u;
+        p_entry->IsValid     = DEF_YES;
+    }
+                                                                /* ------------- COMPUTE BACKOFF INTERVAL ------------- */
+    if (kiss_code == SNTPc_KOD_CODE_RATE) {                     /* See Note #1.                                         */
+        if (p_entry->Backoff_sec == 0u) {
+            backoff_sec = SNTPc_CFG_BACKOFF_MIN_SEC;
+        } else {
+            backoff_sec = DEF_MIN(p_entry->Backoff_sec * 2u, SNTPc_CFG_BACKOFF_MAX_SEC);
+        }
+        if ((poll > 0 ) &&
+            (poll < 31)) {                                      /* Honor the poll interval of the server.               */
+            backoff_sec = DEF_MAX(backoff_sec, DEF_MIN(DEF_BIT32(poll), SNTPc_CFG_BACKOFF_MAX_SEC));
+        }
+    } else {
+        backoff_sec = SNTPc_CFG_BACKOFF_MAX_SEC;
+    }
+                                                                /* See Note #2.                                         */
+    jitter_ms = (CPU_INT32U)Math_Rand() % ((backoff_sec * 10u * SNTPc_CFG_BACKOFF_JITTER_PCT) + 1u);
+
+    p_entry->Backoff_sec = backoff_sec;
+    p_entry->StartTS_ms  = NetUtil_TS_Get_ms();
+    p_entry->Dur_ms      = (backoff_sec * SNTP_MS_NBR_PER_SEC) + jitter_ms;
+
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_BACKOFF, 0u, kiss_code, p_entry->Dur_ms);
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_BackoffClr()
+*
+* Description : Remove the backoff state of a server after a valid reply.
+*
+* Argument(s) : p_cfg    Pointer to the server configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqMultiExchange(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The module lock is acquired by this function. If it cannot be acquired, the backoff
+*                   state is left unchanged.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_BackoffClr (const SNTPc_CFG  *p_cfg)
+{
+    SNTPc_BACKOFF_ENTRY  *p_entry;
+    SNTPc_BACKOFF_ENTRY  *p_entry_replace;
+    SNTPc_ERR             err;
+
+
+    SNTPc_AcquireLock(&err);                                    /* See Note #1.                                         */
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    p_entry = SNTPc_BackoffSrch(p_cfg, &p_entry_replace);
+    if (p_entry != DEF_NULL) {
+        p_entry->IsValid = DEF_NO;
+    }
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_BackoffSrch()
+*
+* Description : Search the backoff state of a server.
+*
+* Argument(s) : p_cfg               Pointer to the server configuration.
+*
+*               pp_entry_replace    Pointer to variable that will receive the entry to replace if the server
+*                                   is not found (see Note #2).
+*
+* Return(s)   : Pointer to the backoff entry of the server, if found.
+*
+*               DEF_NULL,                                   otherwise.
+*
+* Caller(s)   : SNTPc_BackoffClr(),
+*               SNTPc_BackoffIsActive(),
+*               SNTPc_BackoffStart().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The entry to replace is a free entry, if any. Otherwise, it is the entry whose backoff
+*                   ends first.
+*********************************************************************************************************
+*/
+
+static  SNTPc_BACKOFF_ENTRY  *SNTPc_BackoffSrch (const SNTPc_CFG             *p_cfg,
+                                                       SNTPc_BACKOFF_ENTRY  **pp_entry_replace)
+{
+    SNTPc_BACKOFF_ENTRY  *p_entry;
+    NET_TS_MS             ts_cur_ms;
+    NET_TS_MS             elapsed_ms;
+    CPU_INT32U            rem_ms;
+    CPU_INT32U            rem_min_ms;
+    CPU_BOOLEAN           is_free;
+    CPU_INT16U            ix;
+
+
+   *pp_entry_replace = &SNTPc_BackoffTbl[0];
+    rem_min_ms       = DEF_INT_32U_MAX_VAL;
+    is_free          = DEF_NO;
+    ts_cur_ms        = NetUtil_TS_Get_ms();
+
+    for (ix = 0u; ix < SNTPc_CFG_BACKOFF_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_BackoffTbl[ix];
+        if (p_entry->IsValid == DEF_NO) {
+            if (is_free == DEF_NO) {                            /* See Note #2.                                         */
+               *pp_entry_replace = p_entry;
+                is_free          = DEF_YES;
+            }
+            continue;
+        }
+
+        if ((p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry);
+        }
+
+        elapsed_ms = ts_cur_ms - p_entry->StartTS_ms;
+        rem_ms     = (elapsed_ms < p_entry->Dur_ms) ? (p_entry->Dur_ms - elapsed_ms) : 0u;
+        if ((is_free == DEF_NO    ) &&
+            (rem_ms  <  rem_min_ms)) {
+           *pp_entry_replace = p_entry;
+            rem_min_ms       = rem_ms;
+        }
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_FilterSampleAdd()
+*
+* Description : Add a sample to the clock filter of a server.
+*
+* Argument(s) : p_cfg       Pointer to the server configuration.
+*
+*               p_sample    Pointer to the sample decoded from a valid reply of the server.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeMulti(),
+*               SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The dispersion of the sample is the sum of the precision of the server, of the resolution
+*                   of the local timestamps & of the frequency tolerance over the round trip delay (see
+*                   RFC #5905, Section 8).
+*
+*               (2) The module lock is acquired by this function. If it cannot be acquired or if the hostname
+*                   is too long to be kept, the sample is not added.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_FilterSampleAdd (const SNTPc_CFG     *p_cfg,
+                                     const SNTPc_SAMPLE  *p_sample)
+{
+    SNTPc_FILTER_ENTRY  *p_entry;
+    SNTPc_FILTER_ENTRY  *p_entry_replace;
+    CPU_INT64U           dly_us;
+    CPU_INT64U           disp_us;
+    CPU_SIZE_T           hostname_len;
+    SNTPc_ERR            err;
+
+
+    hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+    if (hostname_len > SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {     /* See Note #2.                                         */
+        return;
+    }
+                                                                /* See Note #1.                                         */
+    dly_us  = (CPU_INT64U)(p_sample->RoundTripDly_ns / 1000);
+    disp_us = (CPU_INT64U)SNTPc_PrecisionGet_us(p_sample->Precision) +
+              SNTPc_LOCAL_TS_RESOLUTION_US                           +
+              ((dly_us * SNTPc_FILTER_PHI_PPM) / DEF_TIME_NBR_uS_PER_SEC);
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    p_entry = SNTPc_FilterSrch(p_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {
+        p_entry = p_entry_replace;
+        (void)Str_Copy_N(p_entry->Hostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        p_entry->PortNbr = p_cfg->ServerPortNbr;
+        p_entry->IsValid = DEF_YES;
+        SNTPc_FilterInit(&p_entry->Filter);
+    }
+
+    SNTPc_FilterAdd(&p_entry->Filter,
+                     p_sample->Offset_ns / 1000,
+                    (CPU_INT32U)DEF_MIN(dly_us,  DEF_INT_32U_MAX_VAL),
+                    (CPU_INT32U)DEF_MIN(disp_us, DEF_INT_32U_MAX_VAL),
+                     p_sample->TS_Terminate);
+    p_entry->UpdateTS_ms = NetUtil_TS_Get_ms();
+
+    SNTPc_ReleaseLock();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_FilterSrch()
+*
+* Description : Search the clock filter of a server.
+*
+* Argument(s) : p_cfg               Pointer to the server configuration.
+*
+*               pp_entry_replace    Pointer to variable that will receive the entry to replace if the server
+*                                   is not found (see Note #2).
+*
+* Return(s)   : Pointer to the clock filter entry of the server, if found.
+*
+*               DEF_NULL,                                      otherwise.
+*
+* Caller(s)   : SNTPc_FilterSampleAdd(),
+*               SNTPc_FilterStatusGet().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The entry to replace is a free entry, if any. Otherwise, it is the entry updated least
+*                   recently.
+*********************************************************************************************************
+*/
+
+static  SNTPc_FILTER_ENTRY  *SNTPc_FilterSrch (const SNTPc_CFG            *p_cfg,
+                                                     SNTPc_FILTER_ENTRY  **pp_entry_replace)
+{
+    SNTPc_FILTER_ENTRY  *p_entry;
+    NET_TS_MS            ts_cur_ms;
+    NET_TS_MS            elapsed_ms;
+    NET_TS_MS            elapsed_max_ms;
+    CPU_BOOLEAN          is_free;
+    CPU_INT16U           ix;
+
+
+   *pp_entry_replace = &SNTPc_FilterTbl[0];
+    elapsed_max_ms   = 0u;
+    is_free          = DEF_NO;
+    ts_cur_ms        = NetUtil_TS_Get_ms();
+
+    for (ix = 0u; ix < SNTPc_CFG_FILTER_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_FilterTbl[ix];
+        if (p_entry->IsValid == DEF_NO) {
+            if (is_free == DEF_NO) {                            /* See Note #2.                                         */
+               *pp_entry_replace = p_entry;
+                is_free          = DEF_YES;
+            }
+            continue;
+        }
+
+        if ((p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry);
+        }
+
+        elapsed_ms = ts_cur_ms - p_entry->UpdateTS_ms;
+        if ((is_free    == DEF_NO        ) &&
+            (elapsed_ms >= elapsed_max_ms)) {
+           *pp_entry_replace = p_entry;
+            elapsed_max_ms   = elapsed_ms;
+        }
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_HostResolve()
+*
+* Description : Resolve a server hostname or IP address string into a socket address.
+*
+* Argument(s) : p_hostname      Pointer to the server hostname or IP address string.
+*
+*               port_nbr        Server port number.
+*
+*               ip_family       IP family of the server address to resolve.
+*
+*               p_server_addr   Pointer to variable that will receive the server socket address.
+*
+*               p_is_hostname   Pointer to variable that will receive :
+*
+*                                   DEF_YES, if the server is specified by a hostname.
+*                                   DEF_NO,  if the server is specified by an IP address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Server address successfully resolved.
+*                                   SNTPc_ERR_SERVER_CFG     Server hostname could not be resolved.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_AddrCacheRefresh(),
+*               SNTPc_ServerAddrGet().
+*
+* Note(s)     : (1) NetApp_ClientDatagramOpenByHostname() resolves both hostnames & IP address strings. The
+*                   socket it opens is not needed & is closed right away.
+*
+*               (2) This function may block on the DNS resolution & MUST be called without the module lock
+*                   from any task other than the requesting task.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_HostResolve (CPU_CHAR            *p_hostname,
+                                 NET_PORT_NBR         port_nbr,
+                                 NET_IP_ADDR_FAMILY   ip_family,
+                                 NET_SOCK_ADDR       *p_server_addr,
+                                 CPU_BOOLEAN         *p_is_hostname,
+                                 SNTPc_ERR           *p_err)
+{
+    NET_SOCK_ID  sock;
+    NET_ERR      err;
+
+
+    sock = NET_SOCK_BAD_SOCK;
+    (void)NetApp_ClientDatagramOpenByHostname(&sock,            /* See Note #1.                                         */
+                                               p_hostname,
+                                               port_nbr,
+                                               ip_family,
+                                               p_server_addr,
+                                               p_is_hostname,
+                                              &err);
+    if (err != NET_APP_ERR_NONE) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return;
+    }
+
+    (void)NetSock_Close(sock, &err);
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_AddrCacheRefresh()
+*
+* Description : Resolve again the server hostnames of the cache entries that are about to expire.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Task().
+*
+* Note(s)     : (1) The module lock is released while the hostname is resolved. The entry is updated only if
+*                   it still refers to the same server once the lock is acquired again.
+*
+*               (2) If the refresh fails, the previous address is kept until the entry expires.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  void  SNTPc_AddrCacheRefresh (void)
+{
+    SNTPc_ADDR_ENTRY    *p_entry;
+    CPU_CHAR             hostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR         port_nbr;
+    NET_IP_ADDR_FAMILY   ip_family;
+    NET_SOCK_ADDR        server_addr;
+    NET_TS_MS            age_ms;
+    CPU_BOOLEAN          is_hostname;
+    SNTPc_ERR            err;
+    SNTPc_ERR            err_resolve;
+    CPU_INT16U           ix;
+
+
+    for (ix = 0u; ix < SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_AddrCache[ix];
+
+        SNTPc_AcquireLock(&err);
+        if (err != SNTPc_ERR_NONE) {
+            return;
+        }
+
+        if ((p_entry->IsValid    == DEF_NO) ||
+            (p_entry->IsHostname == DEF_NO)) {
+            SNTPc_ReleaseLock();
+            continue;
+        }
+
+        age_ms = NetUtil_TS_Get_ms() - p_entry->ResolvedTS_ms;
+        if (age_ms < (SNTPc_ADDR_CACHE_TTL_MS - SNTPc_ADDR_CACHE_REFRESH_MS)) {
+            SNTPc_ReleaseLock();                                /* Entry not about to expire.                           */
+            continue;
+        }
+
+        if (p_entry->IsUsed == DEF_NO) {                        /* Let unused entries expire.                           */
+            if (age_ms >= SNTPc_ADDR_CACHE_TTL_MS) {
+                p_entry->IsValid = DEF_NO;
+                SNTPc_AddrCacheStat.ExpireCtr++;
+            }
+            SNTPc_ReleaseLock();
+            continue;
+        }
+
+        (void)Str_Copy_N(hostname,
+                         p_entry->Hostname,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        port_nbr  = p_entry->PortNbr;
+        ip_family = p_entry->AddrFamily;
+
+        SNTPc_ReleaseLock();
+                                                                /* ------------- RESOLVE SERVER HOST NAME ------------- */
+        SNTPc_HostResolve(hostname,                             /* See Note #1.                                         */
+                          port_nbr,
+                          ip_family,
+                         &server_addr,
+                         &is_hostname,
+                         &err_resolve);
+
+        SNTPc_AcquireLock(&err);
+        if (err != SNTPc_ERR_NONE) {
+            return;
+        }
+
+        if ((p_entry->IsValid    == DEF_YES  ) &&
+            (p_entry->PortNbr    == port_nbr ) &&
+            (p_entry->AddrFamily == ip_family) &&
+            (Str_Cmp(p_entry->Hostname, hostname) == 0)) {
+            if (err_resolve == SNTPc_ERR_NONE) {
+                p_entry->ServerAddr    = server_addr;
+                p_entry->ResolvedTS_ms = NetUtil_TS_Get_ms();
+                p_entry->IsUsed        = DEF_NO;
+                SNTPc_AddrCacheStat.RefreshCtr++;
+            } else {
+                SNTPc_AddrCacheStat.RefreshFailCtr++;           /* See Note #2.                                         */
+            }
+        }
+
+        SNTPc_ReleaseLock();
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_Task()
+*
+* Description : SNTPc task, performs the background operations of the SNTP client.
+*
+* Argument(s) : p_arg    Argument passed to the task (unused).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The task refreshes the server address cache twice during the refresh period of the
+*                   cache, so that the entries about to expire are always refreshed before their TTL
+*                   elapses. The disciplined clock is rebased at the same period (see SNTPc_ClkRebase()).
+*
+*               (2) Between refreshes, the task waits for asynchronous requests. Requests are processed
+*                   one at a time, in the order they were queued.
+*
+*               (3) The task polls the synchronization server when its poll interval elapses. Starting or
+*                   stopping the synchronization posts a null message to wake up the task.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  void  SNTPc_Task (void  *p_arg)
+{
+    SNTPc_ASYNC_REQ  *p_req;
+    NET_TS_MS         ts_refresh;
+    NET_TS_MS         elapsed_ms;
+    CPU_INT32U        timeout_ms;
+    KAL_ERR           err_kal;
+
+
+    (void)&p_arg;
+
+    ts_refresh = NetUtil_TS_Get_ms();
+
+    while (DEF_ON) {
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_refresh;
+        if (elapsed_ms >= SNTPc_TASK_PERIOD_MS) {               /* See Note #1.                                         */
+            SNTPc_AddrCacheRefresh();
+            SNTPc_ClkRebase();
+            ts_refresh = NetUtil_TS_Get_ms();
+            elapsed_ms = 0u;
+        }
+        timeout_ms = SNTPc_SyncProcess();                       /* See Note #3.                                         */
+        timeout_ms = DEF_MIN(timeout_ms, SNTPc_TASK_PERIOD_MS - elapsed_ms);
+                                                                /* See Note #2.                                         */
+        p_req = (SNTPc_ASYNC_REQ *)KAL_QPend(SNTPc_ReqQ,
+                                             KAL_OPT_PEND_NONE,
+                                             timeout_ms,
+                                            &err_kal);
+        if ((err_kal == KAL_ERR_NONE) &&
+            (p_req   != DEF_NULL    )) {                        /* Null msgs only wake up the task (see Note #3).       */
+            SNTPc_AsyncReqProcess(p_req);
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_AsyncReqProcess()
+*
+* Description : Process an asynchronous request & call its completion callback.
+*
+* Argument(s) : p_req    Pointer to the asynchronous request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Task().
+*
+* Note(s)     : (1) The request is freed before its callback is called, so that the callback can queue a new
+*                   request.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  void  SNTPc_AsyncReqProcess (SNTPc_ASYNC_REQ  *p_req)
+{
+    SNTP_PKT            pkt;
+    SNTPc_CFG          *p_cfg;
+    SNTPc_REQ_CMPL_CB   cmpl_cb;
+    void               *p_cb_arg;
+    SNTPc_REQ_ID        req_id;
+    SNTPc_ERR           err;
+    CPU_BOOLEAN         result;
+    CPU_BOOLEAN         is_canceled;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (p_req->State == SNTPc_ASYNC_REQ_STATE_CANCELED) {
+        p_req->State = SNTPc_ASYNC_REQ_STATE_FREE;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    p_req->State = SNTPc_ASYNC_REQ_STATE_IN_PROGRESS;
+    CPU_CRITICAL_EXIT();
+
+    p_cfg = (p_req->IsDfltCfg == DEF_YES) ? DEF_NULL : &p_req->Cfg;
+
+    result = SNTPc_ReqRemoteTime(p_cfg, &pkt, &err);
+                                                                /* Free req before calling the cb (see Note #1).        */
+    CPU_CRITICAL_ENTER();
+    is_canceled  = (p_req->State == SNTPc_ASYNC_REQ_STATE_CANCELED) ? DEF_YES : DEF_NO;
+    cmpl_cb      =  p_req->CmplCb;
+    p_cb_arg     =  p_req->CbArgPtr;
+    req_id       =  p_req->ID;
+    p_req->State =  SNTPc_ASYNC_REQ_STATE_FREE;
+    CPU_CRITICAL_EXIT();
+
+    if (is_canceled == DEF_NO) {
+        cmpl_cb(req_id,
+               (result == DEF_OK) ? &pkt : DEF_NULL,
+                err,
+                p_cb_arg);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_SyncProcess()
+*
+* Description : Poll the synchronization server if the poll interval elapsed.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Time until the next poll, in milliseconds,
+*
+*               DEF_INT_32U_MAX_VAL, if the synchronization is not running or was stopped or restarted
+*                                    during the poll.
+*
+* Caller(s)   : SNTPc_Task().
+*
+* Note(s)     : (1) The module lock is released during the poll. The result is discarded if the
+*                   synchronization was stopped or restarted in the meantime.
+*
+*               (2) After a failed poll, the server is polled again with a burst after the minimum poll
+*                   interval.
+*
+*               (3) The disciplined clock is updated with the remote time of each successful poll, under the
+*                   module lock & only if the synchronization is still running (see 'SNTPc_BcastStart()
+*                   Note #4'). The offset it measures drives the poll interval (see SNTPc_SyncPollUpdate()).
+*
+*               (4) The era pivot is moved to the remote time of each successful poll, so that timestamps
+*                   remain converted to the right era over the lifetime of the device (see
+*                   SNTPc_EraPivotSet()).
+*
+*               (5) The offset of each successful poll from the local time base, at the midpoint of the
+*                   exchange, is added to the frequency drift estimation (see SNTPc_DriftAdd()).
+*
+*               (6) The time returned MUST NOT be 0, which KAL_QPend() takes as an infinite timeout. When the
+*                   synchronization was stopped or restarted during the poll, SNTPc_SyncStop() or
+*                   SNTPc_SyncStart() posted a null message that wakes up the task right away.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  CPU_INT32U  SNTPc_SyncProcess (void)
+{
+    SNTPc_CFG            cfg;
+    SNTPc_CFG           *p_cfg;
+    SNTPc_BURST_RESULT   burst;
+    SNTP_PKT             pkt;
+    SNTPc_SAMPLE         sample;
+    SNTP_TS              remote_time;
+    SNTPc_SYNC_CB        sync_cb;
+    void                *p_cb_arg;
+    NET_TS_MS            ts_cur;
+    NET_TS_MS            dly_ms;
+    CPU_INT64S           offset_us;
+    CPU_INT32U           start_ctr;
+    CPU_INT08U           poll_exp;
+    CPU_BOOLEAN          is_burst;
+    CPU_BOOLEAN          result;
+    SNTPc_ERR            err;
+
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return (SNTPc_SYNC_POLL_MS(SNTPc_CFG_SYNC_POLL_EXP_MIN));
+    }
+
+    if (SNTPc_Sync.Status.IsRunning == DEF_NO) {
+        SNTPc_ReleaseLock();
+        return (DEF_INT_32U_MAX_VAL);
+    }
+
+    ts_cur = NetUtil_TS_Get_ms();
+    dly_ms = SNTPc_Sync.PollNextTS_ms - ts_cur;
+    if ((dly_ms != 0u                                                   ) &&
+        (dly_ms <= SNTPc_SYNC_POLL_MS(SNTPc_CFG_SYNC_POLL_EXP_MAX))) {
+        SNTPc_ReleaseLock();                                    /* Poll not due yet.                                    */
+        return (dly_ms);
+    }
+
+    cfg       = SNTPc_Sync.Cfg;
+    p_cfg     = (SNTPc_Sync.IsDfltCfg == DEF_YES) ? DEF_NULL : &cfg;
+    is_burst  = SNTPc_Sync.IsBurst;
+    poll_exp  = SNTPc_Sync.Status.PollExp;
+    start_ctr = SNTPc_Sync.StartCtr;
+
+    SNTPc_ReleaseLock();
+                                                                /* ------------------ POLL THE SERVER ----------------- */
+    if (is_burst == DEF_YES) {                                  /* See Note #1.                                         */
+        result = SNTPc_ReqRemoteTimeBurst(p_cfg,
+                                          SNTPc_CFG_SYNC_BURST_REQ_NBR,
+                                          SNTPc_CFG_SYNC_BURST_INTERVAL_MS,
+                                         &burst,
+                                         &err);
+        sample = burst.Sample;
+    } else {
+        result = SNTPc_ReqRemoteTime(p_cfg, &pkt, &err);
+        if (result == DEF_OK) {
+            SNTPc_PktDecode(&pkt, &sample, &err);
+        }
+    }
+
+    offset_us        = 0;
+    remote_time.Sec  = 0u;
+    remote_time.Frac = 0u;
+                                                                /* ---------------- UPDATE SYNC STATE ----------------- */
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return (SNTPc_SYNC_POLL_MS(SNTPc_CFG_SYNC_POLL_EXP_MIN));
+    }
+
+    if ((SNTPc_Sync.Status.IsRunning == DEF_NO   ) ||
+        (SNTPc_Sync.StartCtr         != start_ctr)) {
+        SNTPc_ReleaseLock();                                    /* Sync stopped or restarted during the poll.           */
+        return (DEF_INT_32U_MAX_VAL);                           /* See Note #6.                                         */
+    }
+
+    if (result == DEF_OK) {                                     /* Discipline the clock (see Note #3).                  */
+        remote_time = SNTPc_LocalTimeOffsetGet(SNTPc_NsToFixed(sample.Offset_ns));
+        offset_us   = SNTPc_ClkUpdate(remote_time, poll_exp, &err);
+                                                                /* Keep the era pivot current (see Note #4).            */
+        SNTPc_EraPivotSet(SNTPc_TS_ToTime64(remote_time));
+
+        SNTPc_SyncPollUpdate(offset_us);
+                                                                /* See Note #5.                                         */
+        SNTPc_DriftAdd(sample.TS_Originate + ((sample.TS_Terminate - sample.TS_Originate) / 2u),
+                       sample.Offset_ns / 1000,
+                      (CPU_INT32U)DEF_MIN(sample.RoundTripDly_ns / 1000, (CPU_INT64S)DEF_INT_32U_MAX_VAL));
+        SNTPc_Sync.IsBurst          = DEF_NO;
+        SNTPc_Sync.Status.IsSync    = DEF_YES;
+        SNTPc_Sync.Status.Offset_us = offset_us;
+        SNTPc_Sync.Status.SyncCtr++;
+        sync_cb                     = SNTPc_Sync.Cb;
+        p_cb_arg                    = SNTPc_Sync.CbArgPtr;
+    } else {
+        SNTPc_Sync.IsBurst          = DEF_YES;                  /* See Note #2.                                         */
+        SNTPc_Sync.Status.PollExp   = SNTPc_CFG_SYNC_POLL_EXP_MIN;
+        SNTPc_Sync.PollCtr          = 0;
+        SNTPc_Sync.Status.FailCtr++;
+        sync_cb                     = DEF_NULL;
+        p_cb_arg                    = DEF_NULL;
+    }
+
+    dly_ms                   = SNTPc_SYNC_POLL_MS(SNTPc_Sync.Status.PollExp);
+    SNTPc_Sync.PollNextTS_ms = ts_cur + dly_ms;
+
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_SYNC, result, SNTPc_Sync.Status.PollExp, SNTPc_TRACE_ARG_32S(offset_us));
+
+    SNTPc_ReleaseLock();
+
+    if (sync_cb != DEF_NULL) {
+        sync_cb(remote_time, offset_us, p_cb_arg);
+    }
+
+    return (dly_ms);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_SyncPollUpdate()
+*
+* Description : Update the jitter estimate & the poll interval with the offset of a new poll.
+*
+* Argument(s) : offset_us   Offset of the disciplined clock measured by the poll, in microseconds.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_SyncProcess().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The jitter is the exponential average of the squared differences between consecutive
+*                   offsets, with an averaging factor of 1/4 (see RFC #5905, Section 10).
+*
+*               (3) The poll interval is adapted as in RFC #5905, Appendix A.5.5.6. While the offset stays
+*                   within SNTPc_SYNC_POLL_GATE times the jitter, the clock is considered stable & a counter
+*                   is increased by the poll exponent. Otherwise, it is decreased by twice the poll exponent.
+*                   When the counter exceeds +/- SNTPc_SYNC_POLL_LIMIT, the poll exponent is increased or
+*                   decreased within the configured limits & the counter is reset.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+static  void  SNTPc_SyncPollUpdate (CPU_INT64S  offset_us)
+{
+    CPU_INT64S  diff_us;
+    CPU_INT64S  diff_sq;
+    CPU_INT64S  offset_abs_us;
+    CPU_INT32U  jitter_us;
+
+
+    if (SNTPc_Sync.Status.SyncCtr > 0u) {                       /* See Note #2.                                         */
+        diff_us  = offset_us - SNTPc_Sync.Status.Offset_us;
+        diff_us  = DEF_MIN(diff_us,  (CPU_INT64S)DEF_INT_32S_MAX_VAL);
+        diff_us  = DEF_MAX(diff_us, -(CPU_INT64S)DEF_INT_32S_MAX_VAL);
+        diff_sq  = diff_us * diff_us;
+        SNTPc_Sync.JitterSq += (diff_sq - SNTPc_Sync.JitterSq) / 4;
+    }
+    jitter_us                   = SNTPc_SelSqrt((CPU_INT64U)SNTPc_Sync.JitterSq);
+    jitter_us                   = DEF_MAX(jitter_us, SNTPc_LOCAL_TS_RESOLUTION_US);
+    SNTPc_Sync.Status.Jitter_us = jitter_us;
+                                                                /* See Note #3.                                         */
+    offset_abs_us = (offset_us < 0) ? -offset_us : offset_us;
+    if (offset_abs_us < ((CPU_INT64S)jitter_us * SNTPc_SYNC_POLL_GATE)) {
+        SNTPc_Sync.PollCtr += SNTPc_Sync.Status.PollExp;
+        if (SNTPc_Sync.PollCtr > SNTPc_SYNC_POLL_LIMIT) {
+            SNTPc_Sync.PollCtr = SNTPc_SYNC_POLL_LIMIT;
+            if (SNTPc_Sync.Status.PollExp < SNTPc_CFG_SYNC_POLL_EXP_MAX) {
+                SNTPc_Sync.PollCtr = 0;
+                SNTPc_Sync.Status.PollExp++;
+            }
+        }
+    } else {
+        SNTPc_Sync.PollCtr -= 2 * SNTPc_Sync.Status.PollExp;
+        if (SNTPc_Sync.PollCtr < -SNTPc_SYNC_POLL_LIMIT) {
+            SNTPc_Sync.PollCtr = -SNTPc_SYNC_POLL_LIMIT;
+            if (SNTPc_Sync.Status.PollExp > SNTPc_CFG_SYNC_POLL_EXP_MIN) {
+                SNTPc_Sync.PollCtr = 0;
+                SNTPc_Sync.Status.PollExp--;
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_BcastTask()
+*
+* Description : Broadcast client task, listens for the broadcasts of the NTP servers.
+*
+* Argument(s) : p_arg    Argument passed to the task (unused).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The task waits until the broadcast client is started, then listens until it is stopped or
+*                   restarted. If the listener cannot be opened, it is opened again after
+*                   SNTPc_BCAST_RETRY_DLY_MS.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  void  SNTPc_BcastTask (void  *p_arg)
+{
+    CPU_BOOLEAN  is_retry;
+    KAL_ERR      err_kal;
+
+
+    (void)&p_arg;
+
+    while (DEF_ON) {
+        is_retry = SNTPc_BcastListen();
+                                                                /* See Note #1.                                         */
+        KAL_SemPend(SNTPc_BcastSem,
+                    KAL_OPT_PEND_NONE,
+                   (is_retry == DEF_YES) ? SNTPc_BCAST_RETRY_DLY_MS : KAL_TIMEOUT_INFINITE,
+                   &err_kal);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_BcastListen()
+*
+* Description : Open the broadcast listener & process the broadcasts received until the broadcast client is
+*               stopped or restarted.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_YES, if the listener failed & SHOULD be opened again later.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_BcastTask().
+*
+* Note(s)     : (1) The listener is bound to the wildcard address on the NTP port, so that it receives the
+*                   broadcasts & the packets sent to the joined multicast group. The client/server exchanges
+*                   that measure the network delay use the same socket (see SNTPc_BcastCal()).
+*
+*               (2) The Rx timeout bounds the time it takes to notice that the broadcast client was stopped
+*                   or restarted.
+*
+*               (3) The local reception timestamp is read as soon as the packet is returned by the network
+*                   stack (see 'SNTPc_Rx() Note #1'). The sender of a broadcast is not known in advance, so
+*                   the packet is only checked to be a valid broadcast (see SNTPc_RxCheck()).
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_BcastListen (void)
+{
+    SNTPc_BCAST                bcast;
+    SNTP_PKT                   pkt;
+    NET_SOCK_ADDR              bind_addr;
+    NET_SOCK_ADDR              remote_addr;
+    NET_SOCK_ADDR_LEN          remote_addr_size;
+    NET_SOCK_ADDR_IPv4        *p_addr_ipv4;
+    NET_SOCK_ADDR_IPv6        *p_addr_ipv6;
+    NET_SOCK_PROTOCOL_FAMILY   protocol_family;
+    NET_SOCK_ID                sock;
+    NET_SOCK_RTN_CODE          res;
+    SNTP_FIXED_TS              ts_rx;
+    CPU_BOOLEAN                is_run;
+    CPU_BOOLEAN                is_drop;
+    CPU_BOOLEAN                result;
+    NET_ERR                    err_net;
+    SNTPc_ERR                  err;
+
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return (DEF_YES);
+    }
+    bcast = SNTPc_Bcast;
+    SNTPc_ReleaseLock();
+
+    if (bcast.Status.IsRunning == DEF_NO) {
+        return (DEF_NO);
+    }
+                                                                /* ------------------ OPEN LISTENER ------------------- */
+    Mem_Clr(&bind_addr, sizeof(bind_addr));                     /* Wildcard addr (see Note #1).                         */
+    bind_addr.AddrFamily = bcast.AddrFamily;
+    if (bcast.AddrFamily == NET_SOCK_ADDR_FAMILY_IP_V4) {
+        p_addr_ipv4       = (NET_SOCK_ADDR_IPv4 *)&bind_addr;
+        p_addr_ipv4->Port =  NET_UTIL_HOST_TO_NET_16(SNTPc_DFLT_IPPORT);
+        protocol_family   =  NET_SOCK_PROTOCOL_FAMILY_IP_V4;
+    } else {
+        p_addr_ipv6       = (NET_SOCK_ADDR_IPv6 *)&bind_addr;
+        p_addr_ipv6->Port =  NET_UTIL_HOST_TO_NET_16(SNTPc_DFLT_IPPORT);
+        protocol_family   =  NET_SOCK_PROTOCOL_FAMILY_IP_V6;
+    }
+
+    sock = NetSock_Open(protocol_family,
+                        NET_SOCK_TYPE_DATAGRAM,
+                        NET_SOCK_PROTOCOL_UDP,
+                       &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+        return (DEF_YES);
+    }
+
+    (void)NetSock_CfgBlock(sock, NET_SOCK_BLOCK_SEL_BLOCK, &err_net);
+    if (err_net == NET_SOCK_ERR_NONE) {
+        (void)NetSock_Bind(sock,
+                          &bind_addr,
+                           sizeof(bind_addr),
+                          &err_net);
+    }
+    if (err_net == NET_SOCK_ERR_NONE) {
+        NetSock_CfgTimeoutRxQ_Set(sock,                         /* See Note #2.                                         */
+                                  SNTPc_BCAST_RX_TIMEOUT_MS,
+                                 &err_net);
+    }
+    result = DEF_FAIL;
+    if (err_net == NET_SOCK_ERR_NONE) {
+        result = SNTPc_BcastGrpJoin(&bcast);
+    }
+    if (result != DEF_OK) {
+        (void)NetSock_Close(sock, &err_net);
+        return (DEF_YES);
+    }
+                                                                /* ------------------ RX BROADCASTS ------------------- */
+    is_run = DEF_YES;
+    while (is_run == DEF_YES) {
+        remote_addr_size = sizeof(remote_addr);
+        res = NetSock_RxDataFrom(                      sock,
+                                 (void              *)&pkt,
+                                 (CPU_INT16U         ) sizeof(SNTP_PKT),
+                                 (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+                                                      &remote_addr,
+                                                      &remote_addr_size,
+                                 (void              *) DEF_NULL,
+                                                       0u,
+                                                       DEF_NULL,
+                                                      &err_net);
+        ts_rx = SNTPc_ClkLocalGet();                            /* See Note #3.                                         */
+
+        is_drop = DEF_NO;
+        if (res > 0) {
+            SNTPc_RxStatInc(&SNTPc_RxStat.RxCtr);
+            result = SNTPc_RxCheck(&pkt,                        /* See Note #3.                                         */
+                                   (CPU_INT32U)res,
+                                   &remote_addr,
+                                    DEF_NULL,
+                                    SNTPc_MSG_MODE_BROADCAST,
+                                   &err);
+            if (result == DEF_OK) {
+                SNTPc_RxTS_Set(&pkt, ts_rx);
+                SNTPc_BcastRxProcess(sock, &pkt, &remote_addr, bcast.StartCtr);
+            } else {
+                is_drop = DEF_YES;
+            }
+        } else if (err_net != NET_SOCK_ERR_RX_Q_EMPTY) {        /* Listener failed, open it again later.                */
+            break;
+        }
+
+        SNTPc_AcquireLock(&err);
+        if (err == SNTPc_ERR_NONE) {
+            if (SNTPc_Bcast.StartCtr != bcast.StartCtr) {
+                is_run = DEF_NO;                                /* Bcast client stopped or restarted.                   */
+            } else if (is_drop == DEF_YES) {
+                SNTPc_Bcast.Status.DropCtr++;
+            }
+            SNTPc_ReleaseLock();
+        }
+    }
+                                                                /* ------------------ CLOSE LISTENER ------------------ */
+    SNTPc_BcastGrpLeave(&bcast);
+    (void)NetSock_Close(sock, &err_net);
+
+    return ((is_run == DEF_YES) ? DEF_YES : DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_BcastRxProcess()
+*
+* Description : Discipline the clock with a received broadcast.
+*
+* Argument(s) : sock            Listener socket.
+*
+*               ppkt            Pointer to the received broadcast.
+*
+*               p_remote_addr   Pointer to the socket address of the server that sent the broadcast.
+*
+*               start_ctr       Start counter of the broadcast client when the listener was opened.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_BcastListen().
+*
+* Note(s)     : (1) The network delay is measured before the first broadcast of a server is used, whenever the
+*                   broadcast server changes & every SNTPc_CFG_BCAST_CAL_PERIOD_SEC seconds (see
+*                   'SNTPc_BcastStart() Note #2'). The broadcast is dropped if the measurement fails.
+*
+*               (2) The broadcast is decoded as the reply to a request sent the measured round trip delay
+*                   before it was received (T1 = T4 - delay) & received by the server when the broadcast was
+*                   sent (T2 = T3). The offset computed by SNTPc_PktDecode() is then :
+*
+*                       offset = (T3 - T4) + (delay / 2)
+*
+*               (3) The interval between the broadcasts of the server is used as the poll interval of the
+*                   clock discipline (see SNTPc_ClkUpdate()).
+*
+*               (4) The era pivot is kept current (see 'SNTPc_SyncProcess() Note #4').
+*
+*               (5) The clock is updated under the module lock & only if the broadcast client was not stopped
+*                   or restarted since the broadcast was received (see 'SNTPc_BcastStart() Note #4').
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  void  SNTPc_BcastRxProcess (      NET_SOCK_ID     sock,
+                                          SNTP_PKT       *ppkt,
+                                    const NET_SOCK_ADDR  *p_remote_addr,
+                                          CPU_INT32U      start_ctr)
+{
+    NET_SOCK_ADDR   server_addr;
+    SNTPc_SAMPLE    sample;
+    SNTP_TS         remote_time;
+    SNTP_FIXED      dly;
+    SNTP_FIXED_TS   ts_originate;
+    SNTPc_SYNC_CB   sync_cb;
+    void           *p_cb_arg;
+    NET_TS_MS       ts_cur;
+    NET_TS_MS       interval_ms;
+    CPU_INT64S      offset_us;
+    CPU_INT08U      poll_exp;
+    CPU_BOOLEAN     is_cal;
+    CPU_BOOLEAN     is_rx_prev;
+    CPU_BOOLEAN     result;
+    SNTPc_ERR       err;
+
+
+    ts_cur = NetUtil_TS_Get_ms();
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    if (SNTPc_Bcast.StartCtr != start_ctr) {
+        SNTPc_ReleaseLock();
+        return;
+    }
+                                                                /* See Note #1.                                         */
+    is_cal = SNTPc_Bcast.Status.IsCal;
+    if ((is_cal                                                              == DEF_YES) &&
+        (SNTPc_SockAddrIsEq(p_remote_addr, &SNTPc_Bcast.Status.ServerAddr) == DEF_NO )) {
+        is_cal = DEF_NO;
+    }
+#if (SNTPc_CFG_BCAST_CAL_PERIOD_SEC > 0u)
+    if ((is_cal                               == DEF_YES) &&
+        ((ts_cur - SNTPc_Bcast.CalTS_ms) >= SNTPc_BCAST_CAL_PERIOD_MS)) {
+        is_cal = DEF_NO;
+    }
+#endif
+    dly         = SNTPc_Bcast.Dly;
+    is_rx_prev  = SNTPc_Bcast.IsRxPrev;
+    interval_ms = ts_cur - SNTPc_Bcast.RxPrevTS_ms;
+
+    SNTPc_ReleaseLock();
+                                                                /* --------------- MEASURE NETWORK DLY ---------------- */
+    if (is_cal == DEF_NO) {
+        server_addr = *p_remote_addr;
+        result      =  SNTPc_BcastCal(sock, &server_addr, &dly);
+
+        SNTPc_AcquireLock(&err);
+        if (err != SNTPc_ERR_NONE) {
+            return;
+        }
+
+        if (SNTPc_Bcast.StartCtr != start_ctr) {
+            SNTPc_ReleaseLock();
+            return;
+        }
+
+        SNTPc_Bcast.Status.ServerAddr = *p_remote_addr;
+        SNTPc_Bcast.Status.IsCal      =  result;
+        SNTPc_Bcast.CalTS_ms          =  ts_cur;
+        SNTPc_Bcast.IsRxPrev          =  DEF_NO;
+        if (result == DEF_OK) {
+            SNTPc_Bcast.Dly                    = dly;
+            SNTPc_Bcast.Status.RoundTripDly_us = (CPU_INT32U)DEF_MIN(SNTPc_FixedToUs(dly),
+                                                                     (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+            SNTPc_Bcast.Status.CalCtr++;
+        } else {
+            SNTPc_Bcast.Status.CalFailCtr++;
+        }
+
+        SNTPc_ReleaseLock();
+
+        if (result != DEF_OK) {
+            return;
+        }
+        is_rx_prev = DEF_NO;
+    }
+                                                                /* ------------------ DECODE OFFSET ------------------- */
+    ppkt->TS_Rx             = ppkt->TS_Tx;                      /* See Note #2.                                         */
+    ts_originate            = SNTPc_TS_ToFixed(&ppkt->TS_Ref) - (SNTP_FIXED_TS)dly;
+    ppkt->TS_Originate.Sec  = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_originate >> 32u));
+    ppkt->TS_Originate.Frac = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts_originate &  DEF_INT_32U_MAX_VAL));
+
+    SNTPc_PktDecode(ppkt, &sample, &err);
+
+    poll_exp = SNTPc_BCAST_POLL_EXP_MIN;                        /* See Note #3.                                         */
+    if (is_rx_prev == DEF_YES) {
+        while ((poll_exp                          <  SNTPc_BCAST_POLL_EXP_MAX) &&
+               (SNTPc_SYNC_POLL_MS(poll_exp + 1u) <= interval_ms             )) {
+            poll_exp++;
+        }
+    }
+                                                                /* ----------------- DISCIPLINE CLOCK ----------------- */
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    if (SNTPc_Bcast.StartCtr != start_ctr) {                    /* See Note #5.                                         */
+        SNTPc_ReleaseLock();
+        return;
+    }
+
+    remote_time = SNTPc_LocalTimeOffsetGet(SNTPc_NsToFixed(sample.Offset_ns));
+    offset_us   = SNTPc_ClkUpdate(remote_time, poll_exp, &err);
+                                                                /* See Note #4.                                         */
+    SNTPc_EraPivotSet(SNTPc_TS_ToTime64(remote_time));
+                                                                /* ------------------- UPDATE STATUS ------------------ */
+    SNTPc_Bcast.IsRxPrev         = DEF_YES;
+    SNTPc_Bcast.RxPrevTS_ms      = ts_cur;
+    SNTPc_Bcast.Status.Offset_us = offset_us;
+    SNTPc_Bcast.Status.RxCtr++;
+    sync_cb                      = SNTPc_Bcast.Cb;
+    p_cb_arg                     = SNTPc_Bcast.CbArgPtr;
+
+    SNTPc_ReleaseLock();
+
+    if (sync_cb != DEF_NULL) {
+        sync_cb(remote_time, offset_us, p_cb_arg);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_BcastCal()
+*
+* Description : Measure the round trip delay to a broadcast server.
+*
+* Argument(s) : sock            Listener socket.
+*
+*               p_server_addr   Pointer to the socket address of the broadcast server.
+*
+*               p_dly           Pointer to a variable that will receive the shortest round trip delay, in
+*                               signed 32.32 fixed point.
+*
+* Return(s)   : DEF_OK,   if at least one reply was received.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_BcastRxProcess().
+*
+* Note(s)     : (1) SNTPc_CFG_BCAST_CAL_REQ_NBR requests are sent one after the other. The shortest round trip
+*                   delay is kept, since it is the least affected by queuing in the network.
+*
+*               (2) Broadcasts received while a reply is awaited are dropped (see 'SNTPc_Rx() Note #2').
+*
+*               (3) A Kiss-o'-Death reply fails the measurement, so that the broadcasts of the server are not
+*                   used.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_BcastCal (NET_SOCK_ID     sock,
+                                     NET_SOCK_ADDR  *p_server_addr,
+                                     SNTP_FIXED     *p_dly)
+{
+    SNTP_PKT      pkt;
+    SNTPc_SAMPLE  sample;
+    SNTPc_TX_TS   tx_ts;
+    NET_TS_MS     ts_start;
+    CPU_INT64S    dly_min_ns;
+    CPU_INT08U    ix;
+    CPU_BOOLEAN   is_rx;
+    CPU_BOOLEAN   result;
+    SNTPc_ERR     err;
+
+
+    dly_min_ns = -1;
+    for (ix = 0u; ix < SNTPc_CFG_BCAST_CAL_REQ_NBR; ix++) {     /* See Note #1.                                         */
+        result = SNTPc_Tx(sock,
+                          p_server_addr,
+                         &tx_ts,
+                          DEF_NO,
+                         &err);
+        if (result != DEF_OK) {
+            continue;
+        }
+
+        is_rx    = DEF_NO;
+        ts_start = NetUtil_TS_Get_ms();
+        do {
+            result = SNTPc_Rx( sock,
+                               p_server_addr,
+                              &pkt,
+                              &err);
+            if (result == DEF_OK) {
+                is_rx = SNTPc_TxTS_Apply(&pkt, &tx_ts);
+                if (is_rx == DEF_NO) {
+                    SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+                }
+            } else if (err == SNTPc_ERR_KOD) {
+                if (SNTPc_TxTS_Apply(&pkt, &tx_ts) == DEF_YES) {
+                    return (DEF_FAIL);                          /* See Note #3.                                         */
+                }
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+            } else if (err != SNTPc_ERR_RX_INVALID) {           /* See Note #2.                                         */
+                break;
+            }
+        } while ((is_rx                              == DEF_NO                   ) &&
+                 ((NetUtil_TS_Get_ms() - ts_start) <  SNTPc_BCAST_RX_TIMEOUT_MS));
+
+        if (is_rx == DEF_YES) {
+            SNTPc_PktDecode(&pkt, &sample, &err);
+            if ((dly_min_ns             <  0         ) ||
+                (sample.RoundTripDly_ns <  dly_min_ns)) {
+                dly_min_ns = sample.RoundTripDly_ns;
+            }
+        }
+    }
+
+    if (dly_min_ns < 0) {
+        return (DEF_FAIL);
+    }
+
+   *p_dly = SNTPc_NsToFixed(dly_min_ns);
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_BcastGrpJoin()
+*
+* Description : Join the multicast group of the broadcast client.
+*
+* Argument(s) : p_bcast     Pointer to a copy of the broadcast client state.
+*
+* Return(s)   : DEF_OK,   if the group was joined or if the client listens to broadcasts.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_BcastListen().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_BcastGrpJoin (const SNTPc_BCAST  *p_bcast)
+{
+    CPU_BOOLEAN  result;
+    NET_ERR      err_net;
+
+
+    if (p_bcast->IsMcast == DEF_NO) {
+        return (DEF_OK);
+    }
+
+    result = DEF_FAIL;
+    switch (p_bcast->AddrFamily) {
+#ifdef  NET_IGMP_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             (void)NetIGMP_HostGrpJoin(p_bcast->IfNbr,
+                                       p_bcast->GrpAddrIPv4,
+                                      &err_net);
+             result = (err_net == NET_IGMP_ERR_NONE) ? DEF_OK : DEF_FAIL;
+             break;
+#endif
+
+#ifdef  NET_MLDP_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             (void)NetMLDP_HostGrpJoin( p_bcast->IfNbr,
+                                       (NET_IPv6_ADDR *)&p_bcast->GrpAddrIPv6,
+                                       &err_net);
+             result = (err_net == NET_MLDP_ERR_NONE) ? DEF_OK : DEF_FAIL;
+             break;
+#endif
+
+        default:
+             break;
+    }
+
+    (void)&err_net;
+
+    return (result);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_BcastGrpLeave()
+*
+* Description : Leave the multicast group of the broadcast client.
+*
+* Argument(s) : p_bcast     Pointer to a copy of the broadcast client state.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_BcastListen().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+static  void  SNTPc_BcastGrpLeave (const SNTPc_BCAST  *p_bcast)
+{
+    NET_ERR  err_net;
+
+
+    if (p_bcast->IsMcast == DEF_NO) {
+        return;
+    }
+
+    switch (p_bcast->AddrFamily) {
+#ifdef  NET_IGMP_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             (void)NetIGMP_HostGrpLeave(p_bcast->IfNbr,
+                                        p_bcast->GrpAddrIPv4,
+                                       &err_net);
+             break;
+#endif
+
+#ifdef  NET_MLDP_MODULE_EN
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             (void)NetMLDP_HostGrpLeave( p_bcast->IfNbr,
+                                        (NET_IPv6_ADDR *)&p_bcast->GrpAddrIPv6,
+                                        &err_net);
+             break;
+#endif
+
+        default:
+             break;
+    }
+
+    (void)&err_net;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ManycastRound()
+*
+* Description : Send a manycast request with a given TTL & collect the servers that reply.
+*
+* Argument(s) : sock        Socket to send the request on.
+*
+*               p_grp_addr  Pointer to the socket address of the multicast group.
+*
+*               ttl         TTL of the request.
+*
+*               p_tbl       Pointer to the table of the servers found, best first.
+*
+*               nbr         Number of servers in the table.
+*
+* Return(s)   : Number of servers in the table after the replies are collected.
+*
+* Caller(s)   : SNTPc_ManycastDiscover().
+*
+* Note(s)     : (1) The replies are collected until SNTPc_CFG_MANYCAST_RX_WINDOW_MS elapsed since the request
+*                   was sent.
+*
+*               (2) The replies come from the unicast address of each server, so they are checked without a
+*                   server address & matched to the request by their originate timestamp. A server that
+*                   replied with a Kiss-o'-Death packet is not kept.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  CPU_INT08U  SNTPc_ManycastRound (NET_SOCK_ID            sock,
+                                         NET_SOCK_ADDR         *p_grp_addr,
+                                         NET_IP_TTL             ttl,
+                                         SNTPc_MANYCAST_ENTRY  *p_tbl,
+                                         CPU_INT08U             nbr)
+{
+    SNTP_PKT           pkt;
+    SNTPc_SAMPLE       sample;
+    SNTPc_TX_TS        tx_ts;
+    NET_SOCK_ADDR      remote_addr;
+    NET_SOCK_ADDR_LEN  remote_addr_size;
+    NET_SOCK_RTN_CODE  res;
+    SNTP_FIXED_TS      ts_rx;
+    NET_TS_MS          ts_start;
+    NET_TS_MS          elapsed_ms;
+    CPU_BOOLEAN        result;
+    NET_ERR            err_net;
+    SNTPc_ERR          err;
+
+
+    (void)NetSock_CfgTxIP_TTL_Multicast(sock, ttl, &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+        return (nbr);
+    }
+                                                                /* ---------------------- TX REQ ---------------------- */
+    result = SNTPc_Tx( sock,
+                       p_grp_addr,
+                      &tx_ts,
+                       DEF_NO,
+                      &err);
+    if (result != DEF_OK) {
+        return (nbr);
+    }
+                                                                /* -------------------- RX REPLIES -------------------- */
+    ts_start   = NetUtil_TS_Get_ms();
+    elapsed_ms = 0u;
+                                                                /* See Note #1.                                         */
+    while (elapsed_ms < SNTPc_CFG_MANYCAST_RX_WINDOW_MS) {
+        NetSock_CfgTimeoutRxQ_Set(sock,
+                                  SNTPc_CFG_MANYCAST_RX_WINDOW_MS - elapsed_ms,
+                                 &err_net);
+        if (err_net != NET_SOCK_ERR_NONE) {
+            break;
+        }
+
+        remote_addr_size = sizeof(remote_addr);
+        res = NetSock_RxDataFrom(                      sock,
+                                 (void              *)&pkt,
+                                 (CPU_INT16U         ) sizeof(SNTP_PKT),
+                                 (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+                                                      &remote_addr,
+                                                      &remote_addr_size,
+                                 (void              *) DEF_NULL,
+                                                       0u,
+                                                       DEF_NULL,
+                                                      &err_net);
+        ts_rx = SNTPc_ClkLocalGet();                            /* See 'SNTPc_Rx() Note #1'.                            */
+        if (res <= 0) {
+            break;
+        }
+
+        SNTPc_RxStatInc(&SNTPc_RxStat.RxCtr);
+        result = SNTPc_RxCheck(&pkt,                            /* See Note #2.                                         */
+                               (CPU_INT32U)res,
+                               &remote_addr,
+                                DEF_NULL,
+                                SNTPc_MSG_MODE_SERVER,
+                               &err);
+        if (result == DEF_OK) {
+            SNTPc_RxTS_Set(&pkt, ts_rx);
+            if (SNTPc_TxTS_Apply(&pkt, &tx_ts) == DEF_YES) {
+                SNTPc_PktDecode(&pkt, &sample, &err);
+                nbr = SNTPc_ManycastCandAdd(p_tbl, nbr, &remote_addr, &sample);
+            } else {
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+            }
+        }
+
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+    }
+
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_ManycastCandAdd()
+*
+* Description : Add a server that replied to a manycast request to the table of the servers found.
+*
+* Argument(s) : p_tbl       Pointer to the table of the servers found, best first.
+*
+*               nbr         Number of servers in the table.
+*
+*               p_addr      Pointer to the socket address of the server.
+*
+*               p_sample    Pointer to the sample decoded from the reply.
+*
+* Return(s)   : Number of servers in the table.
+*
+* Caller(s)   : SNTPc_ManycastRound().
+*
+* Note(s)     : (1) A server that replies to several requests is kept once, with its best reply.
+*
+*               (2) When the table is full, the worst server is replaced if the new server is better.
+*
+*               (3) The root distance is half the total round trip delay to the primary reference, plus the
+*                   root dispersion of the server (see 'SNTPc_ManycastDiscover() Note #2').
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  CPU_INT08U  SNTPc_ManycastCandAdd (      SNTPc_MANYCAST_ENTRY  *p_tbl,
+                                                 CPU_INT08U             nbr,
+                                           const NET_SOCK_ADDR         *p_addr,
+                                           const SNTPc_SAMPLE          *p_sample)
+{
+    SNTPc_MANYCAST_ENTRY  entry;
+    CPU_INT64U            dly_us;
+    CPU_INT64U            root_dist_us;
+    CPU_INT08U            ix;
+
+
+    dly_us       = (CPU_INT64U)(p_sample->RoundTripDly_ns / 1000);
+    root_dist_us = ((dly_us + p_sample->RootDly_us) / 2u) + p_sample->RootDisp_us;
+
+    Mem_Clr(&entry, sizeof(entry));
+    entry.ServerAddr             = *p_addr;
+    entry.Server.PortNbr         =  NET_UTIL_NET_TO_HOST_16(((const NET_SOCK_ADDR_IPv4 *)p_addr)->Port);
+    entry.Server.Stratum         =  p_sample->Stratum;
+    entry.Server.RoundTripDly_us = (CPU_INT32U)DEF_MIN(dly_us,       DEF_INT_32U_MAX_VAL);
+    entry.Server.RootDist_us     = (CPU_INT32U)DEF_MIN(root_dist_us, DEF_INT_32U_MAX_VAL);
+
+    for (ix = 0u; ix < nbr; ix++) {                             /* See Note #1.                                         */
+        if (SNTPc_SockAddrIsEq(&p_tbl[ix].ServerAddr, p_addr) == DEF_YES) {
+            break;
+        }
+    }
+
+    if (ix < nbr) {
+        if (SNTPc_ManycastIsBetter(&entry.Server, &p_tbl[ix].Server) == DEF_NO) {
+            return (nbr);
+        }
+        for (; (ix + 1u) < nbr; ix++) {                         /* Remove the previous reply of the server.             */
+            p_tbl[ix] = p_tbl[ix + 1u];
+        }
+        nbr--;
+
+    } else if (nbr >= SNTPc_CFG_MANYCAST_SERVER_NBR_MAX) {      /* See Note #2.                                         */
+        if (SNTPc_ManycastIsBetter(&entry.Server, &p_tbl[nbr - 1u].Server) == DEF_NO) {
+            return (nbr);
+        }
+        nbr--;
+    }
+                                                                /* Insert the server, best first.                       */
+    ix = nbr;
+    while ((ix                                                         > 0u    ) &&
+           (SNTPc_ManycastIsBetter(&entry.Server, &p_tbl[ix - 1u].Server) == DEF_YES)) {
+        p_tbl[ix] = p_tbl[ix - 1u];
+        ix--;
+    }
+    p_tbl[ix] = entry;
+
+    return (nbr + 1u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_ManycastIsBetter()
+*
+* Description : Compare two servers found by the manycast discovery.
+*
+* Argument(s) : p_server1   Pointer to the first  server.
+*
+*               p_server2   Pointer to the second server.
+*
+* Return(s)   : DEF_YES, if the first server is better than the second one.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_ManycastCandAdd().
+*
+* Note(s)     : (1) See 'SNTPc_ManycastDiscover() Note #2'.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_ManycastIsBetter (const SNTPc_MANYCAST_SERVER  *p_server1,
+                                             const SNTPc_MANYCAST_SERVER  *p_server2)
+{
+    if (p_server1->RootDist_us != p_server2->RootDist_us) {
+        return ((p_server1->RootDist_us < p_server2->RootDist_us) ? DEF_YES : DEF_NO);
+    }
 
-static KAL_LOCK_HANDLE     SNTPc_Lock;
+    return ((p_server1->Stratum < p_server2->Stratum) ? DEF_YES : DEF_NO);
+}
+#endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                      LOCAL FUNCTION PROTOTYPES
-*********************************************************************************************************
+*                                        SNTPc_ManycastCfgGet()
+*
+* Description : Get the configuration of the best discovered server that did not fail.
+*
+* Argument(s) : p_cfg       Pointer to a variable that will receive the server configuration.
+*
+* Return(s)   : DEF_YES, if a discovered server is available.
+*
+*               DEF_NO,  otherwise, the default configuration is used.
+*
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_FilterStatusGet().
+*
+* Note(s)     : (1) The module lock MUST be held by the caller.
+*
+*               (2) The server is addressed by its IP address string, kept in the variable, so that the
+*                   configuration remains valid if a new discovery replaces the servers.
 *********************************************************************************************************
 */
 
-static  CPU_BOOLEAN  SNTPc_Rx           (NET_SOCK_ID     sock,
-                                         SNTP_PKT       *ppkt,
-                                         SNTPc_ERR      *p_err);
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_ManycastCfgGet (SNTPc_MANYCAST_CFG  *p_cfg)
+{
+    SNTPc_MANYCAST_SERVER  *p_server;
+    CPU_INT08U              ix;
 
-static  CPU_BOOLEAN  SNTPc_Tx           (NET_SOCK_ID     sock,
-                                         NET_SOCK_ADDR  *paddr,
-                                         SNTPc_ERR      *p_err);
 
-static  void         SNTPc_AcquireLock  (SNTPc_ERR      *p_err);
+    for (ix = 0u; ix < SNTPc_ManycastNbr; ix++) {
+        p_server = &SNTPc_ManycastTbl[ix].Server;
+        if (p_server->IsFailed == DEF_NO) {
+            (void)Str_Copy_N(p_cfg->Hostname,                   /* See Note #2.                                         */
+                             p_server->Addr,
+                             sizeof(p_cfg->Hostname));
+            p_cfg->Cfg.ServerHostnamePtr = p_cfg->Hostname;
+            p_cfg->Cfg.ServerPortNbr     = p_server->PortNbr;
+            p_cfg->Cfg.ServerAddrFamily  = NET_IP_ADDR_FAMILY_IPv4;
+            p_cfg->Cfg.ReqRxTimeout_ms   = SNTPc_DfltCfgPtr->ReqRxTimeout_ms;
+            return (DEF_YES);
+        }
+    }
 
-static  void         SNTPc_ReleaseLock  (void);
+    return (DEF_NO);
+}
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                             SNTPc_Init()
-*
-* Description : Initialize the SNTPc Module.
-*
-* Argument(s) : p_cfg    Pointer to the default configuration use by the SNTP client.
+*                                      SNTPc_ManycastResultSet()
 *
-*               p_err    Pointer to variable that will receive the return error code from this function :
+* Description : Record the result of a request to a discovered server.
 *
-*                               SNTPc_ERR_NONE           Server address successfully set.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
-*                               SNTPc_ERR_MEM_ALLOC      Memory allocation failed.
-*                               SNTPc_ERR_FAULT_INIT     Initialization error.
-*                               SNTPc_ERR_ACQUIRE_LOCK   Error occur while trying to acquire the module lock.
+* Argument(s) : p_cfg       Pointer to the configuration of the server, as returned by SNTPc_ManycastCfgGet().
 *
-* Return(s)   : DEF_TRUE,  if the SNTP client initialization is successful.
+*               result      DEF_OK,   if the request succeeded.
 *
-*               DEF_FALSE, otherwise.
+*                           DEF_FAIL, otherwise.
 *
-* Caller(s)   : AppTaskStart().
+* Return(s)   : none.
 *
-* Note(s)     : none.
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqRemoteTimeBurst().
 *
+* Note(s)     : (1) The server is skipped by the next requests once it failed (see 'SNTPc_ManycastDiscover()
+*                   Note #3'). The result is discarded if a new discovery replaced the server.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  SNTPc_Init (const SNTPc_CFG   *p_cfg,
-                               SNTPc_ERR   *p_err)
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+static  void  SNTPc_ManycastResultSet (const SNTPc_MANYCAST_CFG  *p_cfg,
+                                             CPU_BOOLEAN          result)
 {
-    KAL_ERR         err_kal;
-    CPU_BOOLEAN     result;
+    CPU_INT08U  ix;
+    SNTPc_ERR   err;
 
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
-    }
-
-    if (p_cfg == DEF_NULL) {
-       *p_err  = SNTPc_ERR_NULL_PTR;
-        result = DEF_FAIL;
-        goto exit;
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
     }
-#endif
-                                                                /* Create the module's lock.                            */
-    SNTPc_Lock = KAL_LockCreate("SNTPc Lock",
-                                DEF_NULL,
-                               &err_kal);
-    switch (err_kal) {
-        case KAL_ERR_NONE:
-             break;
-
-        case KAL_ERR_MEM_ALLOC:
-            *p_err = SNTPc_ERR_MEM_ALLOC;
-             result = DEF_FAIL;
-             goto exit;
 
-        default:
-            *p_err = SNTPc_ERR_FAULT_INIT;
-             result = DEF_FAIL;
-             goto exit;
+    for (ix = 0u; ix < SNTPc_ManycastNbr; ix++) {               /* See Note #1.                                         */
+        if (Str_Cmp(SNTPc_ManycastTbl[ix].Server.Addr, p_cfg->Hostname) == 0) {
+            SNTPc_ManycastTbl[ix].Server.IsFailed = (result == DEF_OK) ? DEF_NO : DEF_YES;
+            break;
+        }
     }
-                                                                /* Set the default server configuration.                */
-    result = SNTPc_SetDfltCfg (p_cfg, p_err);
 
-exit:
-    return (result);
+    SNTPc_ReleaseLock();
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                          SNTPc_SetDfltCfg()
+*                                        SNTPc_NTS_Exchange()
 *
-* Description : Set the default server configuration.
+* Description : Perform an authenticated request/reply exchange with the NTP server of a NTS association.
 *
-* Argument(s) : p_cfg   Pointer to the default configuration use by the SNTP client.
+* Argument(s) : p_cfg           Pointer to the configuration of the NTS key establishment server.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+*               p_ntp_cfg       Pointer to the configuration of the NTP server.
 *
-*                               SNTPc_ERR_NONE           Server address successfully set.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
-*                               SNTPc_ERR_ACQUIRE_LOCK   Error occur while trying to acquire the module lock.
+*               p_req           Pointer to the state of the association used by the request.
 *
-* Return(s)   : DEF_TRUE,  if the new default server configuration is successfully set.
+*               ppkt            Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
 *
-*               DEF_FALSE, otherwise.
+*               p_ip_family     Pointer to variable that will receive the IP family used.
 *
+*               p_is_pref       Pointer to variable that will receive :
 *
-* Caller(s)   : SNTPc_Init().
+*                                   DEF_YES, if the family was selected by the SNTP client.
+*                                   DEF_NO,  if the family is specified by the server configuration.
 *
-* Note(s)     : none.
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           An authenticated reply has been received.
+*                                   SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
+*                                   SNTPc_ERR_SERVER_CFG     Server hostname could not be resolved or socket error.
+*                                   SNTPc_ERR_TX             Error occurred during the request transmission.
+*                                   SNTPc_ERR_RX             No authenticated reply received before the Rx timeout.
+*                                   SNTPc_ERR_KOD            Kiss-o'-Death reply received, server put in backoff.
+*                                   SNTPc_ERR_NTS_NAK        NTS cookie rejected by the server.
+*
+* Return(s)   : DEF_OK,   if the exchange has been successfully completed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeNTS().
 *
+* Note(s)     : (1) The unique identifier & the transmit timestamp of the request are random, so that the
+*                   requests cannot be linked to each other nor to the local time (see RFC #8915, Section 5.7).
+*
+*               (2) The NTP header of each received packet is copied to the caller's packet, since it may not
+*                   be aligned in the reception buffer. Once the request is sent, the transmission buffer
+*                   receives the decrypted extension fields of the reply.
+*
+*               (3) A "NTSN" Kiss-o'-Death reply is not authenticated. It is accepted only from the server,
+*                   with the unique identifier of the request (see 'SNTPc_ReqRemoteTimeNTS() Note #4').
+*
+*               (4) See 'SNTPc_ReqRemoteTimeNTS() Note #3'. A reply that answers the request but fails the
+*                   authentication is counted in the Rx stats (see 'SNTPc_RX_STAT Note #2').
+*
+*               (5) The module lock MUST NOT be held by the caller.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  SNTPc_SetDfltCfg (const SNTPc_CFG   *p_cfg,
-                                     SNTPc_ERR   *p_err)
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_NTS_Exchange (const SNTPc_CFG           *p_cfg,
+                                         const SNTPc_CFG           *p_ntp_cfg,
+                                         const SNTPc_NTS_REQ       *p_req,
+                                               SNTP_PKT            *ppkt,
+                                               NET_IP_ADDR_FAMILY  *p_ip_family,
+                                               CPU_BOOLEAN         *p_is_pref,
+                                               SNTPc_ERR           *p_err)
 {
-    CPU_BOOLEAN     result;
+    CPU_INT08U                buf_tx[SNTPc_NTS_PKT_LEN_MAX];
+    CPU_INT08U                buf_rx[SNTPc_NTS_PKT_LEN_MAX];
+    CPU_INT08U                uid[SNTPc_NTS_UID_LEN];
+    SNTP_PKT                  hdr;
+    SNTPc_TX_TS               tx_ts;
+    NET_SOCK_ADDR             server_addr;
+    NET_SOCK_ADDR             remote_addr;
+    NET_SOCK_ADDR_LEN         remote_addr_size;
+    NET_SOCK_PROTOCOL_FAMILY  protocol_family;
+    NET_SOCK_ID               sock;
+    NET_SOCK_RTN_CODE         res;
+    SNTP_FIXED_TS             ts_rx;
+    NET_TS_MS                 ts_start;
+    NET_TS_MS                 elapsed_ms;
+    CPU_INT32U                cw;
+    CPU_INT16U                len;
+    CPU_INT16U                pt_len;
+    CPU_BOOLEAN               is_auth;
+    CPU_BOOLEAN               result;
+    NET_ERR                   err_net;
 
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+                                                                /* -------------- GET SERVER SOCKET ADDR -------------- */
+    SNTPc_ServerAddrSel( p_ntp_cfg,
+                         p_ip_family,
+                        &server_addr,
+                         p_is_pref,
+                         p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_FAIL);
     }
 
-    if (p_cfg == DEF_NULL) {
-       *p_err = SNTPc_ERR_NULL_PTR;
+    switch (server_addr.AddrFamily) {
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V4;
+             break;
+
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             protocol_family = NET_SOCK_PROTOCOL_FAMILY_IP_V6;
+             break;
+
+        default:
+            *p_err = SNTPc_ERR_SERVER_CFG;
+             return (DEF_FAIL);
+    }
+                                                                /* --------------------- BUILD REQ -------------------- */
+    if ((SNTPc_NTS_RandGet( uid,                      SNTPc_NTS_UID_LEN) != DEF_OK) ||
+        (SNTPc_NTS_RandGet((CPU_INT08U *)&tx_ts.Pkt, sizeof(tx_ts.Pkt)) != DEF_OK)) {
+       *p_err = SNTPc_ERR_TX;                                   /* See Note #1.                                         */
         return (DEF_FAIL);
     }
-#endif
-                                                                /* Get SNTPc Lock.                                      */
-    SNTPc_AcquireLock(p_err);
-    if (*p_err != SNTPc_ERR_NONE) {
-        result = DEF_FAIL;
-        goto exit;
+
+    hdr       = SNTPc_TxPktTemplate;
+    hdr.TS_Tx = tx_ts.Pkt;
+    len       = SNTPc_NTS_ReqBuild( buf_tx,
+                                   &hdr,
+                                    uid,
+                                   &p_req->Cookie,
+                                    p_req->PlaceholderNbr,
+                                    p_req->KeyC2S);
+    if (len == 0u) {
+       *p_err = SNTPc_ERR_TX;
+        return (DEF_FAIL);
+    }
+                                                                /* -------------------- OPEN SOCKET ------------------- */
+    sock = NetSock_Open( protocol_family,
+                         NET_SOCK_TYPE_DATAGRAM,
+                         NET_SOCK_PROTOCOL_UDP,
+                        &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_FAIL);
     }
-                                                                /* Set default configuration                            */
-    SNTPc_DfltCfgPtr = (SNTPc_CFG *)p_cfg;
 
-    SNTPc_DfltServerAddrFamily = p_cfg->ServerAddrFamily;
-                                                                /* Release SNTPc Lock.                                  */
-    SNTPc_ReleaseLock();
+    (void)NetSock_CfgBlock(sock, NET_SOCK_BLOCK_SEL_BLOCK, &err_net);
+    if (err_net != NET_SOCK_ERR_NONE) {
+        (void)NetSock_Close(sock, &err_net);
+       *p_err = SNTPc_ERR_SERVER_CFG;
+        return (DEF_FAIL);
+    }
+                                                                /* ---------------------- TX REQ ---------------------- */
+    tx_ts.Local = SNTPc_ClkLocalGet();                          /* See 'SNTPc_Tx() Note #2'.                            */
+    res         = NetSock_TxDataTo( sock,
+                                    buf_tx,
+                                    len,
+                                    NET_SOCK_FLAG_SOCK_NONE,
+                                   &server_addr,
+                                    sizeof(NET_SOCK_ADDR),
+                                   &err_net);
+    if (res <= 0) {
+        (void)NetSock_Close(sock, &err_net);
+       *p_err = SNTPc_ERR_TX;
+        return (DEF_FAIL);
+    }
+                                                                /* ---------------------- RX REP ---------------------- */
+    ts_start   = NetUtil_TS_Get_ms();
+    elapsed_ms = 0u;
+    is_auth    = DEF_FAIL;
+    pt_len     = 0u;
+    ts_rx      = 0u;
 
-    result = DEF_OK;
+    while (elapsed_ms < p_ntp_cfg->ReqRxTimeout_ms) {
+        NetSock_CfgTimeoutRxQ_Set(sock,
+                                  p_ntp_cfg->ReqRxTimeout_ms - elapsed_ms,
+                                 &err_net);
+        if (err_net != NET_SOCK_ERR_NONE) {
+            break;
+        }
 
-exit:
-    return(result);
+        remote_addr_size = sizeof(remote_addr);
+        res = NetSock_RxDataFrom(                      sock,
+                                 (void              *) buf_rx,
+                                 (CPU_INT16U         ) sizeof(buf_rx),
+                                 (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+                                                      &remote_addr,
+                                                      &remote_addr_size,
+                                 (void              *) DEF_NULL,
+                                                       0u,
+                                                       DEF_NULL,
+                                                      &err_net);
+        ts_rx = SNTPc_ClkLocalGet();                            /* See 'SNTPc_Rx() Note #1'.                            */
+        if (res <= 0) {
+            break;
+        }
+
+        SNTPc_RxStatInc(&SNTPc_RxStat.RxCtr);
+        Mem_Copy(ppkt, buf_rx, sizeof(SNTP_PKT));               /* See Note #2.                                         */
+        cw = NET_UTIL_NET_TO_HOST_32(ppkt->CW);
+                                                                /* See Note #3.                                         */
+        if (((CPU_INT32U)res                                     >= sizeof(SNTP_PKT)  ) &&
+            (((cw >> SNTPc_MSG_STRATUM_SHIFT) & 0xFFu)           == 0u                ) &&
+            (NET_UTIL_NET_TO_HOST_32(ppkt->RefID)                == SNTPc_KOD_CODE_NTSN) &&
+            (SNTPc_SockAddrIsEq(&remote_addr, &server_addr)      == DEF_YES           ) &&
+            (SNTPc_NTS_UID_IsEq(buf_rx, (CPU_INT16U)res, uid)    == DEF_YES           )) {
+            SNTPc_RxStatInc(&SNTPc_RxStat.KoD_Ctr);
+            SNTPc_NTS_AssocDiscard(p_cfg, p_req);
+            (void)NetSock_Close(sock, &err_net);
+           *p_err = SNTPc_ERR_NTS_NAK;
+            return (DEF_FAIL);
+        }
+
+        result = SNTPc_RxCheck( ppkt,
+                               (CPU_INT32U)res,
+                               &remote_addr,
+                               &server_addr,
+                                SNTPc_MSG_MODE_SERVER,
+                                p_err);
+        if ((result == DEF_OK       ) ||
+            (*p_err == SNTPc_ERR_KOD)) {
+            if (SNTPc_TxTS_Apply(ppkt, &tx_ts) == DEF_NO) {
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropOriginateCtr);
+            } else {
+                is_auth = SNTPc_NTS_RespParse( buf_rx,
+                                              (CPU_INT16U)res,
+                                               uid,
+                                               p_req->KeyS2C,
+                                               buf_tx,
+                                              &pt_len);
+                if (is_auth == DEF_OK) {
+                    break;
+                }
+                SNTPc_RxStatInc(&SNTPc_RxStat.DropAuthCtr);     /* See Note #4.                                         */
+            }
+        }
+
+        elapsed_ms = NetUtil_TS_Get_ms() - ts_start;
+    }
+
+    (void)NetSock_Close(sock, &err_net);
+
+    if (is_auth != DEF_OK) {
+       *p_err = SNTPc_ERR_RX;
+        return (DEF_FAIL);
+    }
+
+    if (*p_err == SNTPc_ERR_KOD) {
+        SNTPc_BackoffStart(p_ntp_cfg, ppkt);                    /* See 'SNTPc_BackoffStart() Note #1'.                  */
+        return (DEF_FAIL);
+    }
+
+    SNTPc_RxTS_Set(ppkt, ts_rx);
+    SNTPc_NTS_CookiePush(p_cfg, p_req, buf_tx, pt_len);
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (DEF_OK);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                         SNTPc_ReqRemoteTime()
-*
-* Description : Send a request to an NTP server and receive an SNTP packet to compute.
+*                                           SNTPc_NTS_KE()
 *
-* Argument(s) : p_cfg   Pointer to the server configuration to use by the SNTP client.
-*                           If DEF_NULL,    use default configuration set in the initialization.
-*                           Otherwise,      use the passed configuration.
+* Description : Perform a NTS key establishment & keep the resulting association.
 *
-*               ppkt    Pointer to a SNTP_PKT variable that will contain the received SNTP packet.
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               SNTPc_ERR_NONE           The SNTP Request has been successfully processed.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*                               SNTPc_ERR_NONE           Association successfully established.
 *                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
-*                               SNTPc_ERR_SERVER_CFG     Error in the Server configuration that cause the request to fail.
-*                               SNTPc_ERR_TX             Error occurred during the request transmission.
-*                               SNTPc_ERR_RX             Error occurred during the packet reception.
+*                               SNTPc_ERR_NTS_KE         NTS key establishment failed.
 *
-* Return(s)   : DEF_TRUE,  if the SNTP request has been successfully completed.
+* Return(s)   : none.
 *
-*               DEF_FALSE, otherwise.
+* Caller(s)   : SNTPc_ReqRemoteTimeNTS().
 *
-* Caller(s)   : App_SNTPc_SetClk(),
-*               SNTPcCmd_Get().
+* Note(s)     : (1) The module lock MUST NOT be held by the caller. It is acquired only once the key
+*                   establishment completed.
 *
-* Note(s)     : none.
+*               (2) See 'SNTPc_ReqRemoteTimeNTS() Note #1'.
 *
+*               (3) The association replaces the previous association of the server, if any. Otherwise, it
+*                   replaces a free entry or the least recently used one.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  SNTPc_ReqRemoteTime (const SNTPc_CFG     *p_cfg,
-                                        SNTP_PKT      *ppkt,
-                                        SNTPc_ERR     *p_err)
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  void  SNTPc_NTS_KE (const SNTPc_CFG  *p_cfg,
+                                  SNTPc_ERR  *p_err)
 {
-    const SNTPc_CFG               *p_server_cfg;
-          NET_SOCK_ID              sock;
-          NET_ERR                  err;
-          NET_IP_ADDR_FAMILY       ip_family;
-          NET_SOCK_ADDR            sock_addr;
-          NET_TS_MS                timestamp;
-          CPU_INT32U               second;
-          CPU_INT32U               frac;
-          CPU_FP64                 frac_float;
-          CPU_BOOLEAN              is_hostname;
-          CPU_BOOLEAN              is_completed;
-          CPU_BOOLEAN              is_retry_allowed;
-          CPU_BOOLEAN              result;
+    CPU_INT08U        buf_req[SNTPc_NTS_KE_REQ_LEN];
+    CPU_INT08U        buf_resp[SNTPc_NTS_KE_RESP_LEN_MAX];
+    SNTPc_NTS_ASSOC   assoc;
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_NTS_ENTRY  *p_entry_replace;
+    CPU_INT16U        req_len;
+    CPU_INT16U        resp_len;
+    CPU_BOOLEAN       result;
 
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+    req_len  = SNTPc_NTS_KE_ReqBuild(buf_req);
+    resp_len = 0u;
+                                                                /* See Note #1.                                         */
+    result   = SNTPc_NTS_KE_Exchange( p_cfg->ServerHostnamePtr,
+                                      p_cfg->ServerPortNbr,
+                                      buf_req,
+                                      req_len,
+                                      buf_resp,
+                                      sizeof(buf_resp),
+                                     &resp_len,
+                                      assoc.KeyC2S,
+                                      assoc.KeyS2C);
+    if ((result   == DEF_OK          ) &&
+        (resp_len <= sizeof(buf_resp))) {
+        result = SNTPc_NTS_KE_RespParse(buf_resp, resp_len, &assoc);
+    } else {
+        result = DEF_FAIL;
+    }
+    if (result != DEF_OK) {
+        SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_NTS_KE, SNTPc_ERR_NTS_KE, 0u, 0u);
+       *p_err = SNTPc_ERR_NTS_KE;
+        return;
     }
 
-    if (ppkt == DEF_NULL) {
-       *p_err = SNTPc_ERR_NULL_PTR;
-        result = DEF_FAIL;
-        goto exit;
+    SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_NTS_KE, SNTPc_ERR_NONE, assoc.CookieNbr, 0u);
+
+    if (assoc.ServerHostname[0] == ASCII_CHAR_NULL) {           /* See Note #2.                                         */
+        (void)Str_Copy_N(assoc.ServerHostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
     }
-#endif
-                                                                /* ------------- ACQUIRE SNTP MODULE LOCK ------------- */
+                                                                /* ----------------- KEEP ASSOCIATION ----------------- */
     SNTPc_AcquireLock(p_err);
     if (*p_err != SNTPc_ERR_NONE) {
-        result = DEF_FAIL;
-        goto exit;
-    }
-                                                                /* --------------- SELECT SERVER CONFIG --------------- */
-    if (p_cfg == DEF_NULL) {
-        p_server_cfg = SNTPc_DfltCfgPtr;                        /* If DEF_NULL, Use the Default Server config.          */
-        ip_family    = SNTPc_DfltServerAddrFamily;
-    } else {
-        p_server_cfg = p_cfg;                                   /* Otherwise, use the passed configuration.             */
-        ip_family    = p_server_cfg->ServerAddrFamily;
+        return;
     }
 
-                                                                /* ----------------- SELECT IP FAMILY ----------------- */
-    if (ip_family == NET_IP_ADDR_FAMILY_NONE) {
-        ip_family = NET_IP_ADDR_FAMILY_IPv6;                    /* If the ip family is unknown, Try first with IPV6.    */
-    }
-
-    is_completed = DEF_NO;
-
-    while (is_completed == DEF_NO) {
-                                                                /* ------------- RESOLVE SERVER HOST NAME ------------- */
-        (void)NetApp_ClientDatagramOpenByHostname(&sock,
-                                                   p_server_cfg->ServerHostnamePtr,
-                                                   p_server_cfg->ServerPortNbr,
-                                                   ip_family,
-                                                  &sock_addr,
-                                                  &is_hostname,
-                                                  &err);
-                                                                /* Check if a retry in IPv4 is allowed in case of error. */
-        if ((is_hostname                    == DEF_YES                 ) &&
-            (p_server_cfg->ServerAddrFamily == NET_IP_ADDR_FAMILY_NONE ) &&
-            (ip_family                      == NET_IP_ADDR_FAMILY_IPv6 )) {
-            is_retry_allowed = DEF_YES;
-        } else {
-            is_retry_allowed = DEF_NO;
-        }
-        if (err != NET_APP_ERR_NONE) {
-            if (is_retry_allowed == DEF_YES) {
-                ip_family = NET_IP_ADDR_FAMILY_IPv4;
-                continue;
-            }
-           *p_err = SNTPc_ERR_SERVER_CFG;
-            result = DEF_FAIL;
-            goto exit_release;
-        }
-
-                                                                /* ----------- SET SOCKET IN BLOCKING MODE ------------ */
-        NetSock_CfgBlock(sock, NET_SOCK_BLOCK_SEL_BLOCK, &err);
-        if (err != NET_SOCK_ERR_NONE) {
-           *p_err  = SNTPc_ERR_SERVER_CFG;
-            result = DEF_FAIL;
-            goto exit;
-        }
-                                                                /* ---------------------- TX REQ ---------------------- */
-        result = SNTPc_Tx(sock, &sock_addr, p_err);             /* Send the SNTP request to the NTP server.             */
-        if (*p_err != SNTPc_ERR_NONE) {
-            NetSock_Close(sock, &err);
-            if (is_retry_allowed == DEF_YES) {
-                ip_family = NET_IP_ADDR_FAMILY_IPv4;
-                continue;
-            }
-            goto exit_release;
-        }
-
-                                                                /* ---------------------- RX REP ---------------------- */
-        NetSock_CfgTimeoutRxQ_Set( sock,                        /* Set the Rx timeout timer.                            */
-                                   p_server_cfg->ReqRxTimeout_ms,
-                                  &err);
-        if (err != NET_SOCK_ERR_NONE) {
-            if (is_retry_allowed == DEF_YES) {
-                NetSock_Close(sock, &err);
-                ip_family = NET_IP_ADDR_FAMILY_IPv4;
-                continue;
-            }
-           *p_err = SNTPc_ERR_SERVER_CFG;
-            goto exit_release;
-        }
-
-        result = SNTPc_Rx(sock, ppkt, p_err);                   /* Pend and Receive the SNTP packet.                    */
-        if (*p_err != SNTPc_ERR_NONE) {
-            NetSock_Close(sock, &err);
-            if (is_retry_allowed == DEF_YES) {
-                ip_family = NET_IP_ADDR_FAMILY_IPv4;
-                continue;
-            }
-            goto exit_release;
-        }
-                                                                /* ----------------- COMPUTE REF TIME ----------------- */
-
-        timestamp         = NetUtil_TS_Get_ms();
-        second            = (CPU_INT32U)(timestamp / SNTP_MS_NBR_PER_SEC );
-        frac_float        = ((CPU_FP64) (timestamp % SNTP_MS_NBR_PER_SEC)) / SNTP_MS_NBR_PER_SEC;
-        frac              = (CPU_INT32U)(frac_float * SNTP_TS_SEC_FRAC_SIZE);
-        ppkt->TS_Ref.Sec  = NET_UTIL_HOST_TO_NET_32(second);
-        ppkt->TS_Ref.Frac = NET_UTIL_HOST_TO_NET_32(frac);
-
-        NetSock_Close(sock, &err);
-                                                                /* In case it's successful and the ip family was not... */
-                                                                /* ...specified and it was the default config, save ... */
-                                                                /* ...the ip family that worked in the default config.  */
-        if (p_cfg == DEF_NULL) {
-            if (SNTPc_DfltServerAddrFamily == NET_IP_ADDR_FAMILY_NONE ) {
-                SNTPc_DfltServerAddrFamily = ip_family;
-            }
-        }
-        is_completed = DEF_YES;
+    p_entry = SNTPc_NTS_Srch(p_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {                                  /* See Note #3.                                         */
+        p_entry = p_entry_replace;
+        (void)Str_Copy_N(p_entry->Hostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        p_entry->PortNbr = p_cfg->ServerPortNbr;
+        p_entry->IsValid = DEF_YES;
     }
-                                                                /* ------------- RELEASE SNTP MODULE LOCK ------------- */
-exit_release:
-    SNTPc_ReleaseLock();
+    p_entry->Assoc    = assoc;
+    p_entry->UseTS_ms = NetUtil_TS_Get_ms();
 
-exit:
-    return (result);
+    SNTPc_ReleaseLock();
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                     SNTPc_GetRemoteTime()
+*                                        SNTPc_NTS_CookiePop()
 *
-* Description : Get remote time (NTP timestamp) from a received NTP packet.
+* Description : Take a cookie from the association of a NTS key establishment server.
 *
-* Argument(s) : ppkt     Pointer to received SNTP message packet.
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
 *
-*               p_err    Pointer to variable that will receive the return error code from this function :
+*               p_req       Pointer to variable that will receive the state of the association & the cookie.
 *
-*                               SNTPc_ERR_NONE           The time has been successfully computed from the SNTP packet.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : NTP timestamp.
+*                               SNTPc_ERR_NONE           No error.
+*                               SNTPc_ERR_ACQUIRE_LOCK   Error occurred while trying to acquire the module lock.
 *
-* Caller(s)   : Application.
+* Return(s)   : DEF_YES, if a cookie was taken.
 *
-* Note(s)     : none.
+*               DEF_NO,  if the server has no association or no cookie left.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) The last cookie is taken. The request asks for one new cookie per cookie missing from the
+*                   association, in addition to the cookie that replaces the one sent (see
+*                   'SNTPc_ReqRemoteTimeNTS() Note #2').
 *********************************************************************************************************
 */
 
-SNTP_TS  SNTPc_GetRemoteTime (SNTP_PKT  *ppkt,
-                              SNTPc_ERR *p_err)
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  SNTPc_NTS_CookiePop (const SNTPc_CFG      *p_cfg,
+                                                SNTPc_NTS_REQ  *p_req,
+                                                SNTPc_ERR      *p_err)
 {
-    CPU_FP64  ts_originate;
-    CPU_FP64  ts_rx;
-    CPU_FP64  ts_tx;
-    CPU_FP64  ts_terminate;
-    CPU_FP64  local_time_offset;
-    CPU_FP64  local_time_float;
-    SNTP_TS   local_time;
-
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_NTS_ENTRY  *p_entry_replace;
+    SNTPc_NTS_ASSOC  *p_assoc;
 
-    local_time.Sec = 0u;
-    local_time.Frac= 0u;
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+    SNTPc_AcquireLock(p_err);
+    if (*p_err != SNTPc_ERR_NONE) {
+        return (DEF_NO);
     }
 
-    if (ppkt == DEF_NULL) {
-       *p_err = SNTPc_ERR_NULL_PTR;
-        goto exit;
+    p_entry = SNTPc_NTS_Srch(p_cfg, &p_entry_replace);
+    if ((p_entry                  == DEF_NULL) ||
+        (p_entry->Assoc.CookieNbr == 0u      )) {
+        SNTPc_ReleaseLock();
+        return (DEF_NO);
     }
-#endif
-
-                                                                /* ------------- GET TIME VALUES FROM PKT ------------- */
-    ts_originate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Sec)  +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Frac) /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
 
-    ts_rx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Sec)         +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Frac)        /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
+    p_assoc = &p_entry->Assoc;
+    p_assoc->CookieNbr--;                                       /* See Note #1.                                         */
 
-    ts_tx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Sec)         +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Frac)        /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
+    Mem_Copy(p_req->KeyC2S, p_assoc->KeyC2S, SNTPc_NTS_KEY_LEN);
+    Mem_Copy(p_req->KeyS2C, p_assoc->KeyS2C, SNTPc_NTS_KEY_LEN);
+    (void)Str_Copy_N(p_req->ServerHostname,
+                     p_assoc->ServerHostname,
+                     SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+    p_req->ServerPortNbr  = p_assoc->ServerPortNbr;
+    p_req->Cookie         = p_assoc->CookieTbl[p_assoc->CookieNbr];
+    p_req->PlaceholderNbr = SNTPc_CFG_NTS_COOKIE_NBR_MAX - p_assoc->CookieNbr - 1u;
+    p_entry->UseTS_ms     = NetUtil_TS_Get_ms();
 
-    ts_terminate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Sec)        +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Frac)       /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
-
-                                                                /* ------------------ CALCULATE TIME ------------------ */
-    local_time_offset = ((ts_rx - ts_originate) +               /* Calculate local time offset from the server.         */
-                         (ts_tx - ts_terminate)) / 2;
-
-                                                                /* Apply offset to local time.                          */
-    local_time_float  = (((CPU_FP64)NetUtil_TS_Get_ms()) / SNTP_MS_NBR_PER_SEC) + local_time_offset;
-    local_time.Sec    = (CPU_INT32U)local_time_float;
-    local_time.Frac   = (CPU_INT32U)((local_time_float - local_time.Sec) * SNTP_TS_SEC_FRAC_SIZE);
+    SNTPc_ReleaseLock();
 
-    *p_err = SNTPc_ERR_NONE;
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-exit:
-#endif
-    return (local_time);
+    return (DEF_YES);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                      SNTPc_GetRoundTripDly_us()
+*                                       SNTPc_NTS_CookiePush()
 *
-* Description : Get SNTP packet round trip delay from a received SNTP message packet.
+* Description : Add the cookies of an authenticated reply to the association of a NTS key establishment
+*               server.
 *
-* Argument(s) : ppkt     Pointer to received SNTP message packet.
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
 *
-*               p_err    Pointer to variable that will receive the return error code from this function :
+*               p_req       Pointer to the state of the association used by the request.
 *
-*                               SNTPc_ERR_NONE           The round trip delay has been successfully computed from the SNTP packet.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*               p_buf_pt    Pointer to the decrypted extension fields of the reply.
 *
-* Return(s)   : SNTP packet round trip delay in us.
+*               pt_len      Length of the decrypted extension fields, in octets.
 *
-* Caller(s)   : Application.
+* Return(s)   : none.
 *
-* Note(s)     : (1) If the round trip delay is faster than the precision of the system clock, then the
-*                   round trip delay is approximated to 0.
+* Caller(s)   : SNTPc_NTS_Exchange().
 *
-*               (2) Only the integer part of the round trip delay is returned.
+* Note(s)     : (1) The module lock is acquired by this function. The cookies are discarded if the lock cannot
+*                   be acquired or if the association was replaced during the exchange (see
+*                   SNTPc_NTS_AssocSrch()).
 *********************************************************************************************************
 */
 
-CPU_INT32U  SNTPc_GetRoundTripDly_us (SNTP_PKT   *ppkt,
-                                      SNTPc_ERR  *p_err)
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  void  SNTPc_NTS_CookiePush (const SNTPc_CFG      *p_cfg,
+                                    const SNTPc_NTS_REQ  *p_req,
+                                    const CPU_INT08U     *p_buf_pt,
+                                          CPU_INT16U      pt_len)
 {
-    CPU_FP64    ts_originate;
-    CPU_FP64    ts_rx;
-    CPU_FP64    ts_tx;
-    CPU_FP64    ts_terminate;
-    CPU_FP64    round_trip_dly;
-    CPU_INT32U  round_trip_dly_32;
-
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_NTS_ASSOC  *p_assoc;
+    SNTPc_ERR         err;
 
-    round_trip_dly_32 = 0u;
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+    SNTPc_AcquireLock(&err);                                    /* See Note #1.                                         */
+    if (err != SNTPc_ERR_NONE) {
+        return;
     }
 
-    if (ppkt == DEF_NULL) {
-       *p_err = SNTPc_ERR_NULL_PTR;
-        goto exit;
+    p_entry = SNTPc_NTS_AssocSrch(p_cfg, p_req);
+    if (p_entry != DEF_NULL) {
+        p_assoc            = &p_entry->Assoc;
+        p_assoc->CookieNbr =  SNTPc_NTS_CookieParse(p_buf_pt,
+                                                    pt_len,
+                                                    p_assoc->CookieTbl,
+                                                    p_assoc->CookieNbr,
+                                                    SNTPc_CFG_NTS_COOKIE_NBR_MAX);
     }
-#endif
 
-                                                                /* ------------- GET TIME VALUES FROM PKT ------------- */
-    ts_originate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Sec)   +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Originate.Frac) /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
+    SNTPc_ReleaseLock();
+}
+#endif
 
-    ts_rx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Sec)          +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Rx.Frac)        /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
 
-    ts_tx        = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Sec)          +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Tx.Frac)        /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
+/*
+*********************************************************************************************************
+*                                      SNTPc_NTS_CookieRestore()
+*
+* Description : Give back the cookie of a request that was not sent.
+*
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
+*
+*               p_req       Pointer to the state of the association used by the request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeNTS().
+*
+* Note(s)     : (1) A cookie that was never sent does not link the requests & can still be used. See
+*                   'SNTPc_NTS_CookiePush() Note #1'.
+*********************************************************************************************************
+*/
 
-    ts_terminate = (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Sec)         +
-                   (CPU_FP64)NET_UTIL_NET_TO_HOST_32(ppkt->TS_Ref.Frac)       /
-                   (CPU_FP64)SNTP_TS_SEC_FRAC_SIZE;
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  void  SNTPc_NTS_CookieRestore (const SNTPc_CFG      *p_cfg,
+                                       const SNTPc_NTS_REQ  *p_req)
+{
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_NTS_ASSOC  *p_assoc;
+    SNTPc_ERR         err;
 
-                                                                /* ------------- CALCULATE ROUND TRIP DLY ------------- */
-    round_trip_dly    = ((ts_terminate - ts_originate) -
-                         (ts_tx - ts_rx)) * 1000000;
 
-    round_trip_dly_32 = (CPU_INT32U)round_trip_dly;             /* See Note #2.                                         */
+    SNTPc_AcquireLock(&err);                                    /* See Note #1.                                         */
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
 
-    *p_err = SNTPc_ERR_NONE;
+    p_entry = SNTPc_NTS_AssocSrch(p_cfg, p_req);
+    if (p_entry != DEF_NULL) {
+        p_assoc = &p_entry->Assoc;
+        if (p_assoc->CookieNbr < SNTPc_CFG_NTS_COOKIE_NBR_MAX) {
+            p_assoc->CookieTbl[p_assoc->CookieNbr] = p_req->Cookie;
+            p_assoc->CookieNbr++;
+        }
+    }
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-exit:
-#endif
-    return (round_trip_dly_32);
+    SNTPc_ReleaseLock();
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
+*                                       SNTPc_NTS_AssocDiscard()
+*
+* Description : Discard the association used by a request.
+*
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
+*
+*               p_req       Pointer to the state of the association used by the request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) See 'SNTPc_ReqRemoteTimeNTS() Note #4'. An association established during the exchange is
+*                   kept.
 *********************************************************************************************************
 */
 
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  void  SNTPc_NTS_AssocDiscard (const SNTPc_CFG      *p_cfg,
+                                      const SNTPc_NTS_REQ  *p_req)
+{
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_ERR         err;
+
+
+    SNTPc_AcquireLock(&err);
+    if (err != SNTPc_ERR_NONE) {
+        return;
+    }
+
+    p_entry = SNTPc_NTS_AssocSrch(p_cfg, p_req);                /* See Note #1.                                         */
+    if (p_entry != DEF_NULL) {
+        p_entry->IsValid = DEF_NO;
+    }
+
+    SNTPc_ReleaseLock();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
-*                                              SNTPc_Rx()
+*                                        SNTPc_NTS_AssocSrch()
 *
-* Description : Receive a NTP packet from server.
+* Description : Search the entry that still holds the association used by a request.
 *
-* Argument(s) : sock        Socket to receive NTP     message packet from.
+* Argument(s) : p_cfg       Pointer to the configuration of the NTS key establishment server.
 *
-*               ppkt        Pointer to allocated SNTP message packet.
+*               p_req       Pointer to the state of the association used by the request.
 *
-*               p_err    Pointer to variable that will receive the return error code from this function :
-*
-*                               SNTPc_ERR_NONE           The round trip delay has been successfully computed from the SNTP packet.
-*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
-*                               SNTPc_ERR_RX             Error during the SNTP packet reception.
+* Return(s)   : Pointer to the entry of the server, if it holds the same keys as the request.
 *
-* Return(s)   : DEF_TRUE,  if packet successfully received.
+*               DEF_NULL,                          otherwise.
 *
-*               DEF_FALSE, otherwise.
+* Caller(s)   : SNTPc_NTS_CookiePush(),
+*               SNTPc_NTS_CookieRestore(),
+*               SNTPc_NTS_AssocDiscard().
 *
-* Caller(s)   : SNTPc_ReqRemoteTime().
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
 *
-* Note(s)     : none.
+*               (2) The association may have been replaced by a key establishment of a concurrent request.
+*                   The cookies of the previous keys cannot be used with the new ones.
 *********************************************************************************************************
 */
 
-static  CPU_BOOLEAN  SNTPc_Rx (NET_SOCK_ID   sock,
-                               SNTP_PKT     *ppkt,
-                               SNTPc_ERR    *p_err)
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  SNTPc_NTS_ENTRY  *SNTPc_NTS_AssocSrch (const SNTPc_CFG      *p_cfg,
+                                               const SNTPc_NTS_REQ  *p_req)
 {
-    NET_SOCK_ADDR       remote_addr;
-    NET_SOCK_ADDR_LEN   remote_addr_size;
-    NET_SOCK_RTN_CODE   res;
-    NET_ERR             err;
-    CPU_BOOLEAN         result;
+    SNTPc_NTS_ENTRY  *p_entry;
+    SNTPc_NTS_ENTRY  *p_entry_replace;
 
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+    p_entry = SNTPc_NTS_Srch(p_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {
+        return (DEF_NULL);
     }
-
-    if (ppkt == DEF_NULL) {
-       *p_err  = SNTPc_ERR_NULL_PTR;
-        result = DEF_FAIL;
-        goto exit;
+                                                                /* See Note #2.                                         */
+    if (Mem_Cmp(p_entry->Assoc.KeyC2S, p_req->KeyC2S, SNTPc_NTS_KEY_LEN) == DEF_NO) {
+        return (DEF_NULL);
     }
+
+    return (p_entry);
+}
 #endif
 
 
-    remote_addr_size = sizeof(remote_addr);
+/*
+*********************************************************************************************************
+*                                          SNTPc_NTS_Srch()
+*
+* Description : Search the NTS entry of a key establishment server.
+*
+* Argument(s) : p_cfg               Pointer to the configuration of the NTS key establishment server.
+*
+*               pp_entry_replace    Pointer to variable that will receive the entry to replace if the server
+*                                   is not found (see Note #2).
+*
+* Return(s)   : Pointer to the NTS entry of the server, if found.
+*
+*               DEF_NULL,                               otherwise.
+*
+* Caller(s)   : SNTPc_NTS_KE(),
+*               SNTPc_NTS_CookiePop(),
+*               SNTPc_NTS_AssocSrch().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The entry to replace is a free entry, if any. Otherwise, it is the least recently used
+*                   entry (see 'NTS ENTRY DATA TYPE  Note #2').
+*********************************************************************************************************
+*/
 
-                                                                /* ---------------------- RX PKT ---------------------- */
-    res = NetSock_RxDataFrom(                      sock,
-                             (void              *) ppkt,
-                             (CPU_INT16U         ) sizeof(SNTP_PKT),
-                             (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
-                                                  &remote_addr,
-                                                  &remote_addr_size,
-                             (void              *) DEF_NULL,
-                                                   0u,
-                                                   DEF_NULL,
-                                                  &err);
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+static  SNTPc_NTS_ENTRY  *SNTPc_NTS_Srch (const SNTPc_CFG         *p_cfg,
+                                                SNTPc_NTS_ENTRY  **pp_entry_replace)
+{
+    SNTPc_NTS_ENTRY  *p_entry;
+    NET_TS_MS         ts_cur_ms;
+    NET_TS_MS         unused_ms;
+    NET_TS_MS         unused_max_ms;
+    CPU_BOOLEAN       is_free;
+    CPU_INT16U        ix;
 
-    if (res <= 0) {
-       *p_err = SNTPc_ERR_RX;
-        result = DEF_FAIL;
-    } else {
-        result = DEF_OK;
+
+   *pp_entry_replace = &SNTPc_NTS_Tbl[0];
+    unused_max_ms    = 0u;
+    is_free          = DEF_NO;
+    ts_cur_ms        = NetUtil_TS_Get_ms();
+
+    for (ix = 0u; ix < SNTPc_CFG_NTS_SERVER_NBR_MAX; ix++) {
+        p_entry = &SNTPc_NTS_Tbl[ix];
+        if (p_entry->IsValid == DEF_NO) {
+            if (is_free == DEF_NO) {                            /* See Note #2.                                         */
+               *pp_entry_replace = p_entry;
+                is_free          = DEF_YES;
+            }
+            continue;
+        }
+
+        if ((p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry);
+        }
+
+        unused_ms = ts_cur_ms - p_entry->UseTS_ms;
+        if ((is_free   == DEF_NO       ) &&
+            (unused_ms >= unused_max_ms)) {
+           *pp_entry_replace = p_entry;
+            unused_max_ms    = unused_ms;
+        }
     }
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-exit:
-#endif
-    return (result);
+    return (DEF_NULL);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                              SNTPc_Tx()
+*                                        SNTPc_StatReqRecord()
 *
-* Description : Send NTP packet to server.
+* Description : Count a completed request in the statistics.
 *
-* Argument(s) : sock    Socket to sent NTP message packet to.
+* Argument(s) : p_cfg       Pointer to the server configuration, DEF_NULL if the server is not known.
 *
-*               paddr   Pointer to SNTP server sockaddr_in.
+*               p_sample    Pointer to the sample decoded from the reply, if the request succeeded.
 *
+*               err         Error code of the request.
 *
-* Return(s)   : DEF_TRUE,  if packet successfully sent.
+* Return(s)   : none.
 *
-*               DEF_FALSE, otherwise.
+* Caller(s)   : SNTPc_ReqRemoteTime(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ReqRemoteTimeMulti(),
+*               SNTPc_ReqRemoteTimeNTS().
 *
-* Caller(s)   : SNTPc_ReqRemoteTime().
+* Note(s)     : (1) The module lock is acquired by this function to search the statistics of the server. If
+*                   it cannot be acquired, if the server is not known or if its hostname is too long to be
+*                   kept, the request is only counted in the global statistics.
 *
-* Note(s)     : (1) RFC # 2030, Section 5 'SNTP Client Operations' states that "[For client operations],
-*                   all of the NTP header fields [...] can be set to 0, except the first octet and
-*                   (optional) Transmit Timestamp fields.  In the first octet, the LI field is set to 0
-*                   (no warning) and the Mode field is set to 3 (client).  The VN field must agree with
-*                   the version number of the NTP/SNTP server".
+*               (2) The statistics of a new server replace the entry of the server updated least recently,
+*                   if the table is full.
 *********************************************************************************************************
 */
 
-static  CPU_BOOLEAN  SNTPc_Tx (NET_SOCK_ID     sock,
-                               NET_SOCK_ADDR  *paddr,
-                               SNTPc_ERR      *p_err)
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+static  void  SNTPc_StatReqRecord (const SNTPc_CFG     *p_cfg,
+                                   const SNTPc_SAMPLE  *p_sample,
+                                         SNTPc_ERR      err)
 {
-    CPU_INT32U         cw;
-    SNTP_PKT           pkt;
-    CPU_INT08U         li;
-    CPU_INT08U         vn;
-    CPU_INT08U         mode;
-    NET_SOCK_RTN_CODE  res;
-    NET_ERR            err;
-    NET_TS_MS          timestamp;
-    CPU_INT32U         second;
-    CPU_INT32U         frac;
-    CPU_FP64           frac_float;
-    CPU_BOOLEAN        result;
+    SNTPc_STAT_ENTRY  *p_entry;
+    SNTPc_STAT_ENTRY  *p_entry_replace;
+    CPU_SIZE_T         hostname_len;
+    SNTPc_ERR          err_lock;
 
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION(DEF_NULL);
+    hostname_len = SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u;
+    if ((p_cfg                    != DEF_NULL) &&
+        (p_cfg->ServerHostnamePtr != DEF_NULL)) {
+        hostname_len = Str_Len_N(p_cfg->ServerHostnamePtr, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+    }
+    if (hostname_len > SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX) {     /* See Note #1.                                         */
+        SNTPc_StatReqAdd(DEF_NULL, err, p_sample);
+        return;
     }
 
-    if (paddr == DEF_NULL) {
-       *p_err  = SNTPc_ERR_NULL_PTR;
-        result = DEF_FAIL;
-        goto exit;
+    SNTPc_AcquireLock(&err_lock);
+    if (err_lock != SNTPc_ERR_NONE) {
+        SNTPc_StatReqAdd(DEF_NULL, err, p_sample);
+        return;
     }
-#endif
 
-    Mem_Clr(&pkt, sizeof(pkt));                                 /* Clr SNTP msg pkt.                                    */
+    p_entry = SNTPc_StatSrch(p_cfg, &p_entry_replace);
+    if (p_entry == DEF_NULL) {                                  /* See Note #2.                                         */
+        p_entry = p_entry_replace;
+        (void)Str_Copy_N(p_entry->Hostname,
+                         p_cfg->ServerHostnamePtr,
+                         SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u);
+        p_entry->PortNbr = p_cfg->ServerPortNbr;
+        p_entry->IsValid = DEF_YES;
+        Mem_Clr(&p_entry->Stat, sizeof(SNTPc_STAT_REQ));
+    }
+    p_entry->UpdateTS_ms = NetUtil_TS_Get_ms();
 
+    SNTPc_StatReqAdd(&p_entry->Stat, err, p_sample);
 
-                                                                /* --------------------- INIT MSG --------------------- */
-                                                                /* See Note #1.                                         */
-    li       = SNTPc_MSG_LI_NO_WARNING;                         /* Set flags.                                           */
-    li     <<= SNTPc_MSG_FLAG_LI_SHIFT;
+    SNTPc_ReleaseLock();
+}
+#endif
 
-    vn       = SNTPc_MSG_VER_4;
-    vn     <<= SNTPc_MSG_FLAG_VN_SHIFT;
 
-    mode     = SNTPc_MSG_MODE_CLIENT;
+/*
+*********************************************************************************************************
+*                                          SNTPc_StatSrch()
+*
+* Description : Search the statistics of a server.
+*
+* Argument(s) : p_cfg               Pointer to the server configuration.
+*
+*               pp_entry_replace    Pointer to variable that will receive the entry to replace if the server
+*                                   is not found (see Note #2).
+*
+* Return(s)   : Pointer to the statistics entry of the server, if found.
+*
+*               DEF_NULL,                                     otherwise.
+*
+* Caller(s)   : SNTPc_StatReqRecord(),
+*               SNTPc_StatServerGet().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The entry to replace is a free entry, if any. Otherwise, it is the entry updated least
+*                   recently.
+*********************************************************************************************************
+*/
 
-    cw       = li | vn | mode;
-    cw     <<= SNTPc_MSG_FLAG_SHIFT;
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+static  SNTPc_STAT_ENTRY  *SNTPc_StatSrch (const SNTPc_CFG          *p_cfg,
+                                                 SNTPc_STAT_ENTRY  **pp_entry_replace)
+{
+    SNTPc_STAT_ENTRY  *p_entry;
+    NET_TS_MS          ts_cur_ms;
+    NET_TS_MS          elapsed_ms;
+    NET_TS_MS          elapsed_max_ms;
+    CPU_BOOLEAN        is_free;
+    CPU_INT16U         ix;
 
-    pkt.CW   = NET_UTIL_HOST_TO_NET_32(cw);
 
-                                                                /* Set tx timestamp.                                    */
-    timestamp         = NetUtil_TS_Get_ms();
-    second            = (CPU_INT32U)(timestamp / SNTP_MS_NBR_PER_SEC );
-    frac_float        = ((CPU_FP64) (timestamp % SNTP_MS_NBR_PER_SEC)) / SNTP_MS_NBR_PER_SEC ;
-    frac              = (CPU_INT32U)(frac_float * SNTP_TS_SEC_FRAC_SIZE);
-    pkt.TS_Tx.Sec     = NET_UTIL_HOST_TO_NET_32(second);
-    pkt.TS_Tx.Frac    = NET_UTIL_HOST_TO_NET_32(frac);
+   *pp_entry_replace = &SNTPc_StatTbl[0];
+    elapsed_max_ms   = 0u;
+    is_free          = DEF_NO;
+    ts_cur_ms        = NetUtil_TS_Get_ms();
 
-                                                                /* ---------------------- TX PKT ---------------------- */
-    res = NetSock_TxDataTo(sock,
-                          &pkt,
-                           sizeof(SNTP_PKT),
-                           NET_SOCK_FLAG_SOCK_NONE,
-                           paddr,
-                           sizeof(NET_SOCK_ADDR),
-                          &err);
+    for (ix = 0u; ix < SNTPc_CFG_STAT_NBR_ENTRIES; ix++) {
+        p_entry = &SNTPc_StatTbl[ix];
+        if (p_entry->IsValid == DEF_NO) {
+            if (is_free == DEF_NO) {                            /* See Note #2.                                         */
+               *pp_entry_replace = p_entry;
+                is_free          = DEF_YES;
+            }
+            continue;
+        }
 
-    if (res <= 0) {
-       *p_err  = SNTPc_ERR_TX;
-        result = DEF_FAIL;
-    } else {
-       *p_err  = SNTPc_ERR_NONE;
-        result = DEF_OK;
+        if ((p_entry->PortNbr == p_cfg->ServerPortNbr) &&
+            (Str_Cmp(p_entry->Hostname, p_cfg->ServerHostnamePtr) == 0)) {
+            return (p_entry);
+        }
+
+        elapsed_ms = ts_cur_ms - p_entry->UpdateTS_ms;
+        if ((is_free    == DEF_NO        ) &&
+            (elapsed_ms >= elapsed_max_ms)) {
+           *pp_entry_replace = p_entry;
+            elapsed_max_ms   = elapsed_ms;
+        }
     }
 
-#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
-exit:
-#endif
-    return (result);
+    return (DEF_NULL);
 }
+#endif
 
 
 /*
@@ -773,16 +9305,60 @@ exit:
 * Return(s)   : none.
 *
 * Caller(s)   : SNTPc_ReqRemoteTime(),
-*               SNTPc_SetDfltCfg().
+*               SNTPc_SetDfltCfg(),
+*               SNTPc_SockPoolFlush(),
+*               SNTPc_SockPoolStatGet(),
+*               SNTPc_AddrCacheFlush(),
+*               SNTPc_AddrCacheStatGet(),
+*               SNTPc_SockGet(),
+*               SNTPc_SockRelease(),
+*               SNTPc_MuxSockGet(),
+*               SNTPc_MuxTx(),
+*               SNTPc_MuxRx(),
+*               SNTPc_MuxSockRx(),
+*               SNTPc_MuxSockRd(),
+*               SNTPc_MuxReqFree(),
+*               SNTPc_ServerAddrGet(),
+*               SNTPc_AddrFamilyPrefSet(),
+*               SNTPc_AddrCacheRefresh(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ServerAddrSel(),
+*               SNTPc_SyncStart(),
+*               SNTPc_SyncStop(),
+*               SNTPc_SyncStatusGet(),
+*               SNTPc_SyncProcess(),
+*               SNTPc_BcastStart(),
+*               SNTPc_BcastStop(),
+*               SNTPc_BcastStatusGet(),
+*               SNTPc_BcastListen(),
+*               SNTPc_BcastRxProcess(),
+*               SNTPc_ManycastDiscover(),
+*               SNTPc_ManycastServerGet(),
+*               SNTPc_ManycastFlush(),
+*               SNTPc_ManycastResultSet(),
+*               SNTPc_NTS_Flush(),
+*               SNTPc_NTS_KE(),
+*               SNTPc_NTS_CookiePop(),
+*               SNTPc_NTS_CookiePush(),
+*               SNTPc_NTS_CookieRestore(),
+*               SNTPc_NTS_AssocDiscard(),
+*               SNTPc_StatServerGet(),
+*               SNTPc_StatClr(),
+*               SNTPc_StatReqRecord().
 *
-* Note(s)     : none.
+* Note(s)     : (1) If SNTPc_CFG_STAT_EN is enabled, the wait on the lock is counted in the lock wait
+*                   histogram, at the resolution of SNTPc_ClkLocalGet().
 *
 *********************************************************************************************************
 */
 
 static void SNTPc_AcquireLock (SNTPc_ERR   *p_err)
 {
-    KAL_ERR  err_kal;
+    KAL_ERR        err_kal;
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    SNTP_FIXED_TS  ts_start;
+    CPU_INT64S     wait_us;
+#endif
 
 
 #if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
@@ -791,8 +9367,16 @@ static void SNTPc_AcquireLock (SNTPc_ERR   *p_err)
     }
 #endif
 
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+    ts_start = SNTPc_ClkLocalGet();                             /* See Note #1.                                         */
+#endif
+
     KAL_LockAcquire(SNTPc_Lock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &err_kal);
     if(err_kal == KAL_ERR_NONE) {
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+        wait_us = SNTPc_FixedToUs((SNTP_FIXED)(SNTPc_ClkLocalGet() - ts_start));
+        SNTPc_StatLockWaitAdd((CPU_INT64U)DEF_MAX(wait_us, 0));
+#endif
         *p_err = SNTPc_ERR_NONE;
     } else {
         *p_err = SNTPc_ERR_ACQUIRE_LOCK;
@@ -811,7 +9395,46 @@ static void SNTPc_AcquireLock (SNTPc_ERR   *p_err)
 * Return(s)   : none.
 *
 * Caller(s)   : SNTPc_ReqRemoteTime(),
-*               SNTPc_SetDfltCfg().
+*               SNTPc_SetDfltCfg(),
+*               SNTPc_SockPoolFlush(),
+*               SNTPc_SockPoolStatGet(),
+*               SNTPc_AddrCacheFlush(),
+*               SNTPc_AddrCacheStatGet(),
+*               SNTPc_SockGet(),
+*               SNTPc_SockRelease(),
+*               SNTPc_MuxSockGet(),
+*               SNTPc_MuxTx(),
+*               SNTPc_MuxRx(),
+*               SNTPc_MuxSockRx(),
+*               SNTPc_MuxSockRd(),
+*               SNTPc_MuxReqFree(),
+*               SNTPc_ServerAddrGet(),
+*               SNTPc_AddrFamilyPrefSet(),
+*               SNTPc_AddrCacheRefresh(),
+*               SNTPc_ReqRemoteTimeBurst(),
+*               SNTPc_ServerAddrSel(),
+*               SNTPc_SyncStart(),
+*               SNTPc_SyncStop(),
+*               SNTPc_SyncStatusGet(),
+*               SNTPc_SyncProcess(),
+*               SNTPc_BcastStart(),
+*               SNTPc_BcastStop(),
+*               SNTPc_BcastStatusGet(),
+*               SNTPc_BcastListen(),
+*               SNTPc_BcastRxProcess(),
+*               SNTPc_ManycastDiscover(),
+*               SNTPc_ManycastServerGet(),
+*               SNTPc_ManycastFlush(),
+*               SNTPc_ManycastResultSet(),
+*               SNTPc_NTS_Flush(),
+*               SNTPc_NTS_KE(),
+*               SNTPc_NTS_CookiePop(),
+*               SNTPc_NTS_CookiePush(),
+*               SNTPc_NTS_CookieRestore(),
+*               SNTPc_NTS_AssocDiscard(),
+*               SNTPc_StatServerGet(),
+*               SNTPc_StatClr(),
+*               SNTPc_StatReqRecord().
 *
 * Note(s)     : none.
 *
@@ -94,6 +94,22 @@
 *
 *               (c) \<SNTPc>\Source\sntp-c.h
 *                                  \sntp-c.c
+*                                  \sntp-c_sel.h
+*                                  \sntp-c_sel.c
+*                                  \sntp-c_clk.h
+*                                  \sntp-c_clk.c
+*                                  \sntp-c_fixed.h
+*                                  \sntp-c_fixed.c
+*                                  \sntp-c_filter.h
+*                                  \sntp-c_filter.c
+*                                  \sntp-c_drift.h
+*                                  \sntp-c_drift.c
+*                                  \sntp-c_nts.h
+*                                  \sntp-c_nts.c
+*                                  \sntp-c_stat.h
+*                                  \sntp-c_stat.c
+*                                  \sntp-c_trace.h
+*                                  \sntp-c_trace.c
 *
 *                       where
 *                               <Your Product Application>      directory path for Your Product's Application
@@ -144,6 +160,7 @@
 #include  <Source/net_type.h>                                   /* Network Protocol Suite         (see Note #1b)        */
 
 #include  <Source/net_sock.h>
+#include  <Source/net_ascii.h>
 
 #include  "Source/sntp-c_type.h"
 
@@ -169,6 +186,11 @@
 #define  SNTPc_MSG_FLAG_LI_SHIFT                           6
 #define  SNTPc_MSG_FLAG_VN_SHIFT                           3
 
+#define  SNTPc_MSG_STRATUM_SHIFT                          16
+#define  SNTPc_MSG_POLL_SHIFT                              8
+
+#define  SNTPc_MSG_STRATUM_MAX                            15    /* Stratum 16 means unsynchronized.                     */
+
 
 /*
 *********************************************************************************************************
@@ -188,6 +210,7 @@
 *********************************************************************************************************
 */
 
+#define  SNTPc_MSG_VER_3                                   3
 #define  SNTPc_MSG_VER_4                                   4
 
 
@@ -207,6 +230,23 @@
 #define  SNTPc_MSG_MODE_RESERVED_PRIVATE                   7
 
 
+/*
+*********************************************************************************************************
+*                                    SNTP KISS-O'-DEATH CODE DEFINES
+*
+* Note(s) : (1) A Kiss-o'-Death reply has a stratum of 0 & a four ASCII characters code in its reference ID
+*               (see RFC #5905, Section 7.4).
+*
+*           (2) Sent by a server that cannot decrypt the NTS cookie of a request (see RFC #8915, Section 5.7).
+*********************************************************************************************************
+*/
+
+#define  SNTPc_KOD_CODE_RATE                     0x52415445u    /* "RATE" : Rate exceeded, reduce the poll rate.        */
+#define  SNTPc_KOD_CODE_DENY                     0x44454E59u    /* "DENY" : Access denied by the server.                */
+#define  SNTPc_KOD_CODE_RSTR                     0x52535452u    /* "RSTR" : Access restricted by the server.            */
+#define  SNTPc_KOD_CODE_NTSN                     0x4E54534Eu    /* "NTSN" : NTS cookie rejected (see Note #2).          */
+
+
 /*
 *********************************************************************************************************
 *                                       SNTP DFLT CONFIG VALUE
@@ -216,6 +256,33 @@
 #define  SNTPc_DFLT_MAX_RX_TIMEOUT_MS                    5000    /* Maximum inactivity time (ms) on RX.                  */
 #define  SNTPc_DFLT_MAX_TX_TIMEOUT_MS                    5000    /* Maximum inactivity time (ms) on TX.                  */
 #define  SNTPc_DFLT_IPPORT                                123
+#define  SNTPc_NTS_KE_DFLT_IPPORT                        4460    /* NTS key establishment port (see RFC #8915).          */
+
+
+/*
+*********************************************************************************************************
+*                                      SNTP NTS ALGORITHM DEFINES
+*
+* Note(s) : (1) The only AEAD algorithm negotiated is AEAD_AES_SIV_CMAC_256 (see RFC #5297), which is
+*               mandatory to implement for NTS (see RFC #8915, Section 5.1). Its keys are 256 bits long &
+*               its authentication tag, prepended to the ciphertext, is 128 bits long.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_NTS_KEY_LEN                                 32u   /* Len of the C2S & S2C keys (see Note #1).             */
+#define  SNTPc_NTS_TAG_LEN                                 16u   /* Len of the auth tag        (see Note #1).            */
+
+
+/*
+*********************************************************************************************************
+*                                          SNTP TIME DEFINES
+*
+* Note(s) : (1) Number of seconds between 1900-01-01 00:00:00 UTC, the prime epoch of NTP era 0, & the Unix
+*               epoch, 1970-01-01 00:00:00 UTC (see SNTPc_TS_ToTime64()).
+*********************************************************************************************************
+*/
+
+#define  SNTPc_UNIX_EPOCH_NTP_SEC                  2208988800u   /* See Note #1.                                         */
 
 
 /*
@@ -234,6 +301,21 @@ typedef enum {
     SNTPc_ERR_RX,                                               /* Error occured during packet reception.               */
     SNTPc_ERR_TX,                                               /* Error occurred during request transmission.          */
     SNTPc_ERR_SERVER_CFG,                                       /* Error in the configuration of the server.            */
+    SNTPc_ERR_FAULT,                                            /* Internal fault, req could not be processed.          */
+    SNTPc_ERR_NO_MORE_RSRC,                                     /* No more resources available to process the req.      */
+    SNTPc_ERR_REQ_NOT_FOUND,                                    /* Req not found or already completed.                  */
+    SNTPc_ERR_NO_MAJORITY,                                      /* No majority of the servers agree on the time.        */
+    SNTPc_ERR_CLK_NOT_SET,                                      /* Disciplined clock not set yet.                       */
+    SNTPc_ERR_RX_INVALID,                                       /* Invalid packet received & dropped.                   */
+    SNTPc_ERR_KOD,                                              /* Kiss-o'-Death received, server put in backoff.       */
+    SNTPc_ERR_SERVER_BACKOFF,                                   /* Server in backoff, req not sent.                     */
+    SNTPc_ERR_FILTER_EMPTY,                                     /* No usable sample in the clock filter of the server.  */
+    SNTPc_ERR_DRIFT_NOT_READY,                                  /* Not enough polls to estimate the freq error.         */
+    SNTPc_ERR_MANYCAST_NONE,                                    /* No server answered the manycast discovery.           */
+    SNTPc_ERR_NTS_KE,                                           /* NTS key establishment failed.                        */
+    SNTPc_ERR_NTS_NAK,                                          /* NTS cookie rejected, keys & cookies discarded.       */
+    SNTPc_ERR_STAT_NOT_FOUND,                                   /* No statistics kept for the server.                   */
+    SNTPc_ERR_CLK_IN_USE,                                       /* Clock already disciplined by another client.         */
 
 }SNTPc_ERR;
 
@@ -272,6 +354,501 @@ typedef struct sntp_pkt {
 } SNTP_PKT;
 
 
+/*
+*********************************************************************************************************
+*                                 SNTP FIXED-POINT TIMESTAMP DATA TYPES
+*
+* Note(s) : (1) Timestamps in 32.32 fixed point hold the seconds in the 32 most significant bits & the
+*               fractions of a second in the 32 least significant bits, like the NTP timestamps. They wrap
+*               around every 2^32 seconds.
+*
+*           (2) Durations, such as offsets & delays, are signed 32.32 fixed-point seconds. A difference of
+*               two timestamps is a duration, as long as they are less than 2^31 seconds apart.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT64U  SNTP_FIXED_TS;                             /* See Note #1.                                         */
+
+typedef  CPU_INT64S  SNTP_FIXED;                                /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc DECODED SAMPLE DATA TYPE
+*
+* Note(s) : (1) A sample is decoded once from a received SNTP packet by SNTPc_PktDecode(). All its fields are
+*               in host order & can be read without parsing the packet again.
+*
+*           (2) The four timestamps of the exchange are kept in 32.32 fixed point. The terminate timestamp
+*               (T4) is the local time at which the reply was received.
+*
+*           (3) The offset of the server clock from the local clock & the round trip delay are computed
+*               as in RFC #5905, Section 8. A delay shorter than the resolution of the clocks is set to 0.
+*
+*           (4) The root delay & root dispersion are advertised by the server, in 16.16 fixed-point seconds,
+*               & converted to microseconds.
+*
+*           (5) The precision is advertised by the server, as a power of two in seconds.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_sample {
+    SNTP_FIXED_TS  TS_Originate;                                /* Local  time at which the req was sent        (T1).   */
+    SNTP_FIXED_TS  TS_Rx;                                       /* Server time at which the req was received    (T2).   */
+    SNTP_FIXED_TS  TS_Tx;                                       /* Server time at which the reply was sent      (T3).   */
+    SNTP_FIXED_TS  TS_Terminate;                                /* Local  time at which the reply was received  (T4).   */
+    CPU_INT64S     Offset_ns;                                   /* Offset of the server clock (see Note #3).            */
+    CPU_INT64S     RoundTripDly_ns;                             /* Round trip dly             (see Note #3).            */
+    CPU_INT32U     RootDly_us;                                  /* See Note #4.                                         */
+    CPU_INT32U     RootDisp_us;                                 /* See Note #4.                                         */
+    CPU_INT32U     RefID;                                       /* Server ref ID.                                       */
+    CPU_INT08U     LI;                                          /* Leap indicator (see SNTPc_MSG_LI_xxx).               */
+    CPU_INT08U     Stratum;                                     /* Server stratum.                                      */
+    CPU_INT08S     Precision;                                   /* See Note #5.                                         */
+} SNTPc_SAMPLE;
+
+
+/*
+*********************************************************************************************************
+*                                   SNTPc ASYNCHRONOUS REQUEST DATA TYPES
+*
+* Note(s) : (1) An asynchronous request is identified by a non-zero ID returned by SNTPc_ReqRemoteTimeAsync().
+*
+*           (2) The completion callback is called from the SNTPc task with :
+*
+*               (a) ppkt    Pointer to the received SNTP packet, valid only during the callback,
+*                           DEF_NULL if the request failed.
+*
+*               (b) err     Error code of the request, as returned by SNTPc_ReqRemoteTime().
+*
+*               The callback MUST NOT block, since other asynchronous requests wait for its completion.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT32U  SNTPc_REQ_ID;                              /* See Note #1.                                         */
+
+#define  SNTPc_REQ_ID_NONE                                 0u
+
+typedef  void  (*SNTPc_REQ_CMPL_CB)(SNTPc_REQ_ID   req_id,      /* See Note #2.                                         */
+                                    SNTP_PKT      *ppkt,
+                                    SNTPc_ERR      err,
+                                    void          *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                  SNTPc SOCKET POOL STATISTICS DATA TYPE
+*
+* Note(s) : (1) Sockets are kept open between requests & re-opened only after an error occurred on them.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_sock_pool_stat {
+    CPU_INT32U  SockOpenCtr;                                    /* Nbr of sockets opened for a new server/family.       */
+    CPU_INT32U  SockReuseCtr;                                   /* Nbr of requests that reused an open socket.          */
+    CPU_INT32U  SockReopenCtr;                                  /* Nbr of sockets re-opened after an error.             */
+    CPU_INT32U  SockEvictCtr;                                   /* Nbr of sockets closed to free a pool entry.          */
+} SNTPc_SOCK_POOL_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc SERVER ADDRESS CACHE STATISTICS DATA TYPE
+*
+* Note(s) : (1) A request that finds the server address in the cache does not resolve the server hostname.
+*               On a cache miss, the server hostname is resolved by the requesting task.
+*
+*           (2) Refreshes are performed by the SNTPc task before the entries expire.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_addr_cache_stat {
+    CPU_INT32U  HitCtr;                                         /* Nbr of requests that found the addr in the cache.    */
+    CPU_INT32U  MissCtr;                                        /* Nbr of requests that resolved the addr (see Note #1).*/
+    CPU_INT32U  RefreshCtr;                                     /* Nbr of entries refreshed (see Note #2).              */
+    CPU_INT32U  RefreshFailCtr;                                 /* Nbr of entries that failed to be refreshed.          */
+    CPU_INT32U  ExpireCtr;                                      /* Nbr of unused entries that expired.                  */
+} SNTPc_ADDR_CACHE_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                    SNTPc RECEPTION STATISTICS DATA TYPE
+*
+* Note(s) : (1) Each received packet is counted in RxCtr. A packet that fails validation is dropped & also
+*               counted in the counter of the first check it failed. The reception then continues until a
+*               valid reply is received or the Rx timeout expires.
+*
+*           (2) Only the replies to SNTPc_ReqRemoteTimeNTS() are authenticated.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_rx_stat {
+    CPU_INT32U  RxCtr;                                          /* Nbr of pkts received (see Note #1).                  */
+    CPU_INT32U  DropLenCtr;                                     /* Nbr of pkts dropped, shorter than a SNTP pkt.        */
+    CPU_INT32U  DropAddrCtr;                                    /* Nbr of pkts dropped, not from the queried server.    */
+    CPU_INT32U  DropModeCtr;                                    /* Nbr of pkts dropped, not in server mode.             */
+    CPU_INT32U  DropVerCtr;                                     /* Nbr of pkts dropped, unsupported version.            */
+    CPU_INT32U  DropStratumCtr;                                 /* Nbr of pkts dropped, unknown KoD or unsynchronized.  */
+    CPU_INT32U  DropTxTS_Ctr;                                   /* Nbr of pkts dropped, null transmit timestamp.        */
+    CPU_INT32U  DropOriginateCtr;                               /* Nbr of pkts dropped, not answering a pending req.    */
+    CPU_INT32U  KoD_Ctr;                                        /* Nbr of Kiss-o'-Death replies received.               */
+    CPU_INT32U  DropAuthCtr;                                    /* Nbr of pkts dropped, not authenticated (see Note #2).*/
+} SNTPc_RX_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                    SNTPc CLOCK FILTER STATUS DATA TYPE
+*
+* Note(s) : (1) The clock filter of a server keeps its last eight samples & selects the one with the lowest
+*               round trip delay, as in RFC #5905, Section 10. Offsets are relative to the local clock used
+*               to timestamp the SNTP packets.
+*
+*           (2) The dispersion of each sample grows with its age. The filter dispersion is the weighted sum
+*               of the dispersions of the samples, sorted by round trip delay.
+*
+*           (3) The jitter is the root mean square of the differences between the offsets of the samples &
+*               the offset of the selected sample.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_filter_status {
+    CPU_INT64S  Offset_us;                                      /* Offset of the selected sample (see Note #1).         */
+    CPU_INT32U  RoundTripDly_us;                                /* Round trip delay of the selected sample.             */
+    CPU_INT32U  Age_ms;                                         /* Time elapsed since the selected sample was received. */
+    CPU_INT32U  Disp_us;                                        /* Filter dispersion (see Note #2).                     */
+    CPU_INT32U  Jitter_us;                                      /* Filter jitter     (see Note #3).                     */
+    CPU_INT08U  SampleNbr;                                      /* Nbr of samples used by the filter.                   */
+} SNTPc_FILTER_STATUS;
+
+
+/*
+*********************************************************************************************************
+*                                   SNTPc MULTI-SERVER RESULT DATA TYPE
+*
+* Note(s) : (1) Bit n of the masks refers to the server configuration at index n of the table passed to
+*               SNTPc_ReqRemoteTimeMulti().
+*
+*           (2) Truechimers are the servers whose correctness interval overlaps the interval on which a
+*               majority of the servers agree. Survivors are the truechimers kept by the clustering
+*               algorithm, whose offsets are combined (see RFC #5905, Section 11.2).
+*
+*           (3) The offset is the difference between the server time & the local time, in microseconds.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_multi_result {
+    SNTP_TS     RemoteTime;                                     /* Local time corrected by the combined offset.         */
+    CPU_INT64S  Offset_us;                                      /* Combined offset of the survivors (see Note #3).      */
+    CPU_INT32U  Jitter_us;                                      /* RMS of the survivor offsets around Offset_us.        */
+    CPU_INT32U  RxMask;                                         /* Servers that replied          (see Note #1).         */
+    CPU_INT32U  TruechimerMask;                                 /* Servers found truechimers     (see Note #2).         */
+    CPU_INT32U  SurvivorMask;                                   /* Servers combined into offset  (see Note #2).         */
+    CPU_INT08U  SurvivorNbr;                                    /* Nbr of survivors.                                    */
+} SNTPc_MULTI_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc BURST RESULT DATA TYPE
+*
+* Note(s) : (1) The packet kept is the reply with the lowest round trip delay. It can be passed to
+*               SNTPc_GetRemoteTime() & SNTPc_GetRoundTripDly_us(). The sample decoded from it is also
+*               returned.
+*
+*           (2) The spreads of the round trip delays & of the offsets measure the consistency of the replies
+*               of the burst.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_burst_result {
+    SNTP_PKT      Pkt;                                          /* Reply with the lowest dly (see Note #1).             */
+    SNTPc_SAMPLE  Sample;                                       /* Sample decoded from Pkt.                             */
+    CPU_INT32U    RoundTripDlyMin_us;                           /* Lowest  round trip dly of the replies.               */
+    CPU_INT32U    RoundTripDlyMax_us;                           /* Highest round trip dly of the replies.               */
+    CPU_INT32U    OffsetSpread_us;                              /* Highest minus lowest offset of the replies.          */
+    CPU_INT08U    TxNbr;                                        /* Nbr of reqs sent.                                    */
+    CPU_INT08U    RxNbr;                                        /* Nbr of replies received.                             */
+} SNTPc_BURST_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                   SNTPc SYNCHRONIZATION DATA TYPES
+*
+* Note(s) : (1) The synchronization callback is called from the SNTPc task after each successful poll with :
+*
+*               (a) remote_time     Remote time, as returned by SNTPc_GetRemoteTime() for the reply kept.
+*
+*               (b) offset_us       Offset of the server clock from the disciplined clock before the
+*                                   update, in microseconds (see SNTPc_ClkUpdate()).
+*
+*               The disciplined clock is updated before the callback is called & can be read with
+*               SNTPc_ClkGet(). The callback MUST NOT block, since the other operations of the SNTPc task
+*               wait for its completion.
+*
+*           (2) The poll interval is 2^PollExp seconds.
+*
+*           (3) The jitter is the RMS of the differences between consecutive offsets.
+*********************************************************************************************************
+*/
+
+typedef  void  (*SNTPc_SYNC_CB)(SNTP_TS      remote_time,       /* See Note #1.                                         */
+                                CPU_INT64S   offset_us,
+                                void        *p_arg);
+
+typedef struct sntpc_sync_status {
+    CPU_BOOLEAN  IsRunning;                                     /* Sync started & not stopped.                          */
+    CPU_BOOLEAN  IsSync;                                        /* At least one poll succeeded since the start.         */
+    CPU_INT08U   PollExp;                                       /* Current poll exponent (see Note #2).                 */
+    CPU_INT64S   Offset_us;                                     /* Offset measured by the last successful poll.         */
+    CPU_INT32U   Jitter_us;                                     /* See Note #3.                                         */
+    CPU_INT32U   SyncCtr;                                       /* Nbr of successful polls.                             */
+    CPU_INT32U   FailCtr;                                       /* Nbr of failed polls.                                 */
+} SNTPc_SYNC_STATUS;
+
+
+/*
+*********************************************************************************************************
+*                                   SNTPc CLOCK DISCIPLINE STATUS DATA TYPE
+*
+* Note(s) : (1) The offset is the difference between the server time & the disciplined time measured by the
+*               last update of the clock (see SNTPc_ClkUpdate()).
+*
+*           (2) The frequency correction compensates the drift of the local time base. A positive value means
+*               that the local time base runs slow.
+*
+*           (3) The remaining phase correction is the part of the last offset not slewed yet.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_clk_status {
+    CPU_BOOLEAN  IsSet;                                         /* Clock set by at least one update.                    */
+    CPU_INT64S   Offset_us;                                     /* See Note #1.                                         */
+    CPU_INT32S   Freq_ppb;                                      /* See Note #2.                                         */
+    CPU_INT64S   PhaseRem_us;                                   /* See Note #3.                                         */
+    CPU_INT32U   UpdateCtr;                                     /* Nbr of updates.                                      */
+    CPU_INT32U   StepCtr;                                       /* Nbr of updates that stepped the clock.               */
+} SNTPc_CLK_STATUS;
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc FREQUENCY DRIFT STATUS DATA TYPE
+*
+* Note(s) : (1) The frequency error of the local time base is the slope of the least squares line fitted to
+*               the offsets of the last polls of the background synchronization. A positive value means
+*               that the local time base runs slow.
+*
+*           (2) The standard error of the frequency error, from the residuals of the fit.
+*
+*           (3) RMS of the differences between the offsets of the polls & the fitted line.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_drift_status {
+    CPU_INT32S  Freq_ppb;                                       /* See Note #1.                                         */
+    CPU_INT32U  FreqErr_ppb;                                    /* See Note #2.                                         */
+    CPU_INT32U  Resid_us;                                       /* See Note #3.                                         */
+    CPU_INT32U  Holdover_sec;                                   /* Time elapsed since the last poll.                    */
+    CPU_INT08U  PollNbr;                                        /* Nbr of polls used by the estimation.                 */
+} SNTPc_DRIFT_STATUS;
+
+
+/*
+*********************************************************************************************************
+*                                 SNTPc BROADCAST CLIENT STATUS DATA TYPE
+*
+* Note(s) : (1) The round trip delay to the broadcast server is measured by a few client/server exchanges
+*               before its broadcasts are used. Half of it is taken as the delay of each broadcast packet
+*               from the server (see SNTPc_BcastStart()).
+*
+*           (2) Packets dropped because they are not valid broadcasts (see 'SNTPc_Rx() Note #2').
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_bcast_status {
+    CPU_BOOLEAN    IsRunning;                                   /* Broadcast client started & not stopped.              */
+    CPU_BOOLEAN    IsCal;                                       /* Dly to the broadcast server measured (see Note #1).  */
+    NET_SOCK_ADDR  ServerAddr;                                  /* Addr of the broadcast server in use.                 */
+    CPU_INT32U     RoundTripDly_us;                             /* See Note #1.                                         */
+    CPU_INT64S     Offset_us;                                   /* Offset measured by the last broadcast.               */
+    CPU_INT32U     RxCtr;                                       /* Nbr of broadcasts that updated the clock.            */
+    CPU_INT32U     DropCtr;                                     /* See Note #2.                                         */
+    CPU_INT32U     CalCtr;                                      /* Nbr of dly measurements.                             */
+    CPU_INT32U     CalFailCtr;                                  /* Nbr of failed dly measurements.                      */
+} SNTPc_BCAST_STATUS;
+
+
+/*
+*********************************************************************************************************
+*                                  SNTPc MANYCAST SERVER DATA TYPE
+*
+* Note(s) : (1) IP address string of the server, which can be used as the hostname of a server configuration.
+*
+*           (2) Half the round trip delay to the server plus the root distance advertised by the server,
+*               used to rank the servers (see 'SNTPc_ManycastDiscover() Note #2').
+*
+*           (3) A server is marked failed when a request with the default configuration fails, so that the
+*               next request uses the next server (see 'SNTPc_ManycastDiscover() Note #3').
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_manycast_server {
+    CPU_CHAR      Addr[NET_ASCII_LEN_MAX_ADDR_IPv4];            /* See Note #1.                                         */
+    NET_PORT_NBR  PortNbr;                                      /* Port nbr the server replied from.                    */
+    CPU_INT08U    Stratum;
+    CPU_INT32U    RoundTripDly_us;                              /* Round trip dly of the best reply.                    */
+    CPU_INT32U    RootDist_us;                                  /* See Note #2.                                         */
+    CPU_BOOLEAN   IsFailed;                                     /* See Note #3.                                         */
+} SNTPc_MANYCAST_SERVER;
+
+
+/*
+*********************************************************************************************************
+*                                     SNTPc STATISTICS DATA TYPES
+*
+* Note(s) : (1) The histograms have logarithmic buckets, in microseconds. Bucket 0 counts the values lower
+*               than 1 us & bucket n counts the values from 2^(n-1) us to 2^n us excluded. The last bucket
+*               also counts all the larger values.
+*
+*           (2) The stage of a failed request is derived from its error code :
+*
+*               (a) SNTPc_STAT_STAGE_LOCK       SNTPc_ERR_ACQUIRE_LOCK.
+*               (b) SNTPc_STAT_STAGE_ADDR       SNTPc_ERR_NULL_PTR, SNTPc_ERR_SERVER_CFG (invalid configuration
+*                                               or server hostname not resolved).
+*               (c) SNTPc_STAT_STAGE_BACKOFF    SNTPc_ERR_SERVER_BACKOFF.
+*               (d) SNTPc_STAT_STAGE_RSRC       SNTPc_ERR_MEM_ALLOC, SNTPc_ERR_NO_MORE_RSRC.
+*               (e) SNTPc_STAT_STAGE_TX         SNTPc_ERR_TX.
+*               (f) SNTPc_STAT_STAGE_RX         SNTPc_ERR_RX, SNTPc_ERR_RX_INVALID.
+*               (g) SNTPc_STAT_STAGE_KOD        SNTPc_ERR_KOD.
+*               (h) SNTPc_STAT_STAGE_NTS        SNTPc_ERR_NTS_KE, SNTPc_ERR_NTS_NAK.
+*               (i) SNTPc_STAT_STAGE_OTHER      Any other error code.
+*
+*           (3) The failures are also counted by error code, at index SNTPc_ERR_xxx of FailErrCtrTbl.
+*               SNTPc_ERR_CLK_IN_USE MUST remain the last error code.
+*
+*           (4) The offset histogram counts the absolute values of the offsets of the successful requests.
+*
+*           (5) The module lock waits are measured by the local time base of the SNTP client. Their
+*               resolution is the one of SNTPc_ExtTS_Get() or, if SNTPc_CFG_EXT_TS_EN is disabled, one
+*               millisecond.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_STAT_HIST_BUCKET_NBR                       24u   /* Nbr of buckets of a histogram (see Note #1).         */
+
+                                                                /* Nbr of error codes (see Note #3).                    */
+#define  SNTPc_STAT_ERR_NBR                     (SNTPc_ERR_CLK_IN_USE + 1u)
+
+typedef enum sntpc_stat_stage {                                 /* See Note #2.                                         */
+    SNTPc_STAT_STAGE_LOCK,
+    SNTPc_STAT_STAGE_ADDR,
+    SNTPc_STAT_STAGE_BACKOFF,
+    SNTPc_STAT_STAGE_RSRC,
+    SNTPc_STAT_STAGE_TX,
+    SNTPc_STAT_STAGE_RX,
+    SNTPc_STAT_STAGE_KOD,
+    SNTPc_STAT_STAGE_NTS,
+    SNTPc_STAT_STAGE_OTHER,
+    SNTPc_STAT_STAGE_NBR
+} SNTPc_STAT_STAGE;
+
+typedef struct sntpc_stat_hist {
+    CPU_INT32U  Ctr;                                            /* Nbr of values counted.                               */
+    CPU_INT32U  Max_us;                                         /* Largest value counted.                               */
+    CPU_INT64U  Sum_us;                                         /* Sum of the values counted.                           */
+    CPU_INT32U  BucketTbl[SNTPc_STAT_HIST_BUCKET_NBR];          /* See Note #1.                                         */
+} SNTPc_STAT_HIST;
+
+typedef struct sntpc_stat_req {
+    CPU_INT32U       ReqCtr;                                    /* Nbr of reqs completed.                               */
+    CPU_INT32U       OkCtr;                                     /* Nbr of reqs that succeeded.                          */
+    CPU_INT32U       FailStageCtrTbl[SNTPc_STAT_STAGE_NBR];     /* Nbr of reqs that failed, by stage (see Note #2).     */
+    CPU_INT32U       FailErrCtrTbl[SNTPc_STAT_ERR_NBR];         /* Nbr of reqs that failed, by error (see Note #3).     */
+    SNTPc_STAT_HIST  RoundTripDlyHist;                          /* Round trip dly of the successful reqs.               */
+    SNTPc_STAT_HIST  OffsetHist;                                /* See Note #4.                                         */
+} SNTPc_STAT_REQ;
+
+typedef struct sntpc_stat {
+    SNTPc_STAT_REQ   Req;                                       /* Reqs to all the servers.                             */
+    SNTPc_STAT_HIST  LockWaitHist;                              /* Module lock waits (see Note #5).                     */
+} SNTPc_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc TRACE DATA TYPES
+*
+* Note(s) : (1) If SNTPc_TRACE_BIN_EN is enabled, the trace events are written as binary records in a ring
+*               buffer. They are never printed. The buffer is returned by SNTPc_TraceBufGet() & decoded on
+*               the host by 'Tool/sntp-c_trace_dec.c', from a dump of its sizeof(SNTPc_TRACE_BUF) octets.
+*
+*           (2) The header describes the buffer to the decoder. Its fields & the records are in the byte
+*               order of the CPU, which the decoder detects from the magic number.
+*
+*           (3) SeqNext is the sequence number of the next record. Record n is written at index
+*               (n % SNTPc_TRACE_BIN_NBR_RECORDS) & holds sequence number n once complete, or
+*               SNTPc_TRACE_SEQ_NONE while it is written.
+*
+*           (4) The timestamp is the local time of the SNTP client, in 32.32 fixed point (see
+*               'sntp-c_clk.c  SNTPc_ClkLocalGet()').
+*
+*           (5) The event identifiers & their arguments MUST be kept in sync with 'Tool/sntp-c_trace_dec.c' :
+*
+*               (a) SNTPc_TRACE_EVT_REQ        Request completed. Arg0 : error code. Arg1 : round trip delay
+*                                              (us). Arg2 : offset (us, signed & saturated).
+*               (b) SNTPc_TRACE_EVT_TX         Request transmitted. Arg0 : error code. Arg1 : socket.
+*               (c) SNTPc_TRACE_EVT_RX         Packet received. Arg0 : error code. Arg1 : control word.
+*                                              Arg2 : length (octets).
+*               (d) SNTPc_TRACE_EVT_KOD        Kiss-o'-Death received. Arg1 : kiss code.
+*               (e) SNTPc_TRACE_EVT_BACKOFF    Server put in backoff. Arg1 : kiss code. Arg2 : duration (ms).
+*               (f) SNTPc_TRACE_EVT_NTS_KE     NTS key establishment. Arg0 : error code. Arg1 : nbr of
+*                                              cookies received.
+*               (g) SNTPc_TRACE_EVT_SYNC       Synchronization poll. Arg0 : DEF_OK or DEF_FAIL. Arg1 : poll
+*                                              exponent. Arg2 : offset (us, signed & saturated).
+*
+*           (6) The fields of a record are volatile, so that the compiler keeps the writes of the record
+*               between the two writes of its sequence number (see 'sntp-c_trace.c  Note #2b').
+*********************************************************************************************************
+*/
+
+#define  SNTPc_TRACE_MAGIC                        0x534E5452u   /* "SNTR" (see Note #2).                                */
+#define  SNTPc_TRACE_VER                                   1u
+#define  SNTPc_TRACE_SEQ_NONE                     0xFFFFFFFFu   /* See Note #3.                                         */
+
+#define  SNTPc_TRACE_EVT_REQ                               1u   /* See Note #5.                                         */
+#define  SNTPc_TRACE_EVT_TX                                2u
+#define  SNTPc_TRACE_EVT_RX                                3u
+#define  SNTPc_TRACE_EVT_KOD                               4u
+#define  SNTPc_TRACE_EVT_BACKOFF                           5u
+#define  SNTPc_TRACE_EVT_NTS_KE                            6u
+#define  SNTPc_TRACE_EVT_SYNC                              7u
+
+typedef struct sntpc_trace_record {
+    volatile  SNTP_FIXED_TS  TS;                                /* See Note #4.                                         */
+    volatile  CPU_INT32U     Seq;                               /* See Note #3.                                         */
+    volatile  CPU_INT16U     EvtId;                             /* See Note #5.                                         */
+    volatile  CPU_INT16U     Arg0;
+    volatile  CPU_INT32U     Arg1;
+    volatile  CPU_INT32U     Arg2;
+} SNTPc_TRACE_RECORD;
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_INFO) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))
+typedef struct sntpc_trace_buf {
+    CPU_INT32U           Magic;                                 /* See Note #2.                                         */
+    CPU_INT16U           Ver;
+    CPU_INT16U           RecordSize;
+    CPU_INT32U           RecordNbr;
+    volatile CPU_INT32U  SeqNext;                               /* See Note #3.                                         */
+    SNTPc_TRACE_RECORD   RecordTbl[SNTPc_TRACE_BIN_NBR_RECORDS];
+} SNTPc_TRACE_BUF;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -296,6 +873,720 @@ SNTP_TS      SNTPc_GetRemoteTime      (      SNTP_PKT       *ppkt,        /* Get
 CPU_INT32U   SNTPc_GetRoundTripDly_us (      SNTP_PKT       *ppkt,        /* Get pkt round trip delay.                  */
                                              SNTPc_ERR      *p_err);
 
+void         SNTPc_PktDecode          (      SNTP_PKT       *ppkt,        /* Decode a sample from a received pkt.       */
+                                             SNTPc_SAMPLE   *p_sample,
+                                             SNTPc_ERR      *p_err);
+
+CPU_INT64S   SNTPc_GetOffset_ns       (const SNTPc_SAMPLE   *p_sample,    /* Get the offset of a sample.                */
+                                             SNTPc_ERR      *p_err);
+
+CPU_INT64S   SNTPc_GetRoundTripDly_ns (const SNTPc_SAMPLE   *p_sample,    /* Get the round trip delay of a sample.      */
+                                             SNTPc_ERR      *p_err);
+
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeMulti (const SNTPc_CFG      *p_cfg_tbl,   /* Request remote time from a set of servers. */
+                                             CPU_INT08U      cfg_nbr,
+                                             CPU_INT32U      timeout_ms,
+                                             SNTPc_MULTI_RESULT *p_result,
+                                             SNTPc_ERR      *p_err);
+
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeBurst (const SNTPc_CFG      *p_cfg,       /* Request remote time with a burst of reqs.  */
+                                             CPU_INT08U      req_nbr,
+                                             CPU_INT32U      interval_ms,
+                                             SNTPc_BURST_RESULT *p_result,
+                                             SNTPc_ERR      *p_err);
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+CPU_BOOLEAN  SNTPc_ReqRemoteTimeNTS   (const SNTPc_CFG      *p_cfg,       /* Request authenticated remote time (NTS).   */
+                                             SNTP_PKT       *ppkt,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_NTS_Flush          (      SNTPc_ERR      *p_err);      /* Discard all NTS keys & cookies.            */
+#endif
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+SNTPc_REQ_ID SNTPc_ReqRemoteTimeAsync (const SNTPc_CFG      *p_cfg,       /* Request remote time without blocking.      */
+                                             SNTPc_REQ_CMPL_CB cmpl_cb,
+                                             void           *p_cb_arg,
+                                             SNTPc_ERR      *p_err);
+
+CPU_BOOLEAN  SNTPc_ReqCancel          (      SNTPc_REQ_ID    req_id,      /* Cancel an asynchronous request.            */
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_SyncStart          (const SNTPc_CFG      *p_cfg,       /* Start the background synchronization.      */
+                                             SNTPc_SYNC_CB   sync_cb,
+                                             void           *p_cb_arg,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_SyncStop           (      SNTPc_ERR      *p_err);      /* Stop the background synchronization.       */
+
+void         SNTPc_SyncStatusGet      (      SNTPc_SYNC_STATUS *p_status, /* Get the background synchronization status. */
+                                             SNTPc_ERR      *p_err);
+
+SNTP_TS      SNTPc_DriftTimeGet       (      CPU_INT32U     *p_bound_us,  /* Get the time predicted from the freq error.*/
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_DriftStatusGet     (      SNTPc_DRIFT_STATUS *p_status,/* Get the freq drift estimation status.      */
+                                             SNTPc_ERR      *p_err);
+#endif
+
+#if (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+void         SNTPc_BcastStart         (const CPU_CHAR       *p_grp_addr,  /* Start the broadcast client.                */
+                                             NET_IF_NBR      if_nbr,
+                                             SNTPc_SYNC_CB   sync_cb,
+                                             void           *p_cb_arg,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_BcastStop          (      SNTPc_ERR      *p_err);      /* Stop the broadcast client.                 */
+
+void         SNTPc_BcastStatusGet     (      SNTPc_BCAST_STATUS *p_status,/* Get the broadcast client status.           */
+                                             SNTPc_ERR      *p_err);
+#endif
+
+#if (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+CPU_INT08U   SNTPc_ManycastDiscover   (const CPU_CHAR       *p_grp_addr,  /* Discover the nearest servers.              */
+                                             SNTPc_ERR      *p_err);
+
+CPU_INT08U   SNTPc_ManycastServerGet  (      SNTPc_MANYCAST_SERVER *p_tbl,/* Get the discovered servers.                */
+                                             CPU_INT08U      tbl_size,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_ManycastFlush      (      SNTPc_ERR      *p_err);      /* Forget the discovered servers.             */
+#endif
+
+SNTP_TS      SNTPc_Now                (      SNTPc_ERR      *p_err);      /* Get the disciplined time, without lock.    */
+
+SNTP_TS      SNTPc_ClkGet             (      SNTPc_ERR      *p_err);      /* Get the disciplined time.                  */
+
+CPU_INT64S   SNTPc_ClkUpdate          (      SNTP_TS         remote_time, /* Discipline the clock with a remote time.   */
+                                             CPU_INT08U      poll_exp,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_ClkStatusGet       (      SNTPc_CLK_STATUS *p_status,  /* Get the clock discipline status.           */
+                                             SNTPc_ERR      *p_err);
+
+CPU_INT64S   SNTPc_TS_ToTime64        (      SNTP_TS         ts);         /* Convert a timestamp to a 64-bit time.      */
+
+void         SNTPc_EraPivotSet        (      CPU_INT64S      pivot_sec);  /* Set the era pivot.                         */
+
+CPU_INT64S   SNTPc_EraPivotGet        (void);                             /* Get the era pivot.                         */
+
+void         SNTPc_SockPoolFlush      (      SNTPc_ERR      *p_err);      /* Close all sockets kept in the pool.        */
+
+void         SNTPc_SockPoolStatGet    (      SNTPc_SOCK_POOL_STAT *p_stat,/* Get the socket pool statistics.            */
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_AddrCacheFlush     (      SNTPc_ERR      *p_err);      /* Remove all entries of the addr cache.      */
+
+void         SNTPc_AddrCacheStatGet   (      SNTPc_ADDR_CACHE_STAT *p_stat,/* Get the server addr cache statistics.    */
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_RxStatGet          (      SNTPc_RX_STAT  *p_stat,      /* Get the reception statistics.              */
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_FilterStatusGet    (const SNTPc_CFG      *p_cfg,       /* Get the clock filter status of a server.   */
+                                             SNTPc_FILTER_STATUS *p_status,
+                                             SNTPc_ERR      *p_err);
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+void         SNTPc_StatGet            (      SNTPc_STAT     *p_stat,      /* Get the request statistics, without lock.  */
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_StatServerGet      (const SNTPc_CFG      *p_cfg,       /* Get the request statistics of a server.    */
+                                             SNTPc_STAT_REQ *p_stat,
+                                             SNTPc_ERR      *p_err);
+
+void         SNTPc_StatClr            (      SNTPc_ERR      *p_err);      /* Clear all the request statistics.          */
+#endif
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_INFO) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))
+const SNTPc_TRACE_BUF *SNTPc_TraceBufGet (void);                          /* Get the binary trace buffer.               */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*                                      DEFINED IN PRODUCT'S BSP
+*
+* Note(s) : (1) SNTPc_ExtTS_Get() returns the local time since an arbitrary origin as a NTP timestamp in 32.32
+*               fixed point, i.e. seconds in the 32 most significant bits & fractions of a second in the 32
+*               least significant bits. The local time MUST be monotonic & MAY wrap around after 2^32
+*               seconds. See 'sntp-c_ext_ts.c' for a template implementation.
+*
+*           (2) SNTPc_NetTS_TxGet() & SNTPc_NetTS_RxGet() return the times at which the network layer (e.g.
+*               the Ethernet driver) transmitted a request & received a reply, in the time base of
+*               SNTPc_ExtTS_Get(). A request is identified by its transmit timestamp & a reply by its
+*               originate timestamp, both in network order. They return DEF_OK if the time is available &
+*               DEF_FAIL otherwise, in which case the time read by the SNTP client is used. See
+*               'sntp-c_net_ts.c' for a template implementation.
+*
+*           (3) The NTS functions perform the cryptographic operations of NTS (see RFC #8915), with the TLS
+*               & cryptographic libraries of the product. They return DEF_OK on success & DEF_FAIL otherwise.
+*               See 'sntp-c_nts_crypto.c' for a template implementation.
+*
+*               (a) SNTPc_NTS_KE_Exchange() connects to a NTS key establishment server over TLS 1.3, with
+*                   the ALPN protocol "ntske/1". It sends the request records, receives the response records
+*                   until the server closes the connection, & exports the C2S & S2C keys (see RFC #8915,
+*                   Section 5.1).
+*
+*               (b) SNTPc_NTS_AEAD_Seal() & SNTPc_NTS_AEAD_Open() encrypt & decrypt with
+*                   AEAD_AES_SIV_CMAC_256. The ciphertext is SNTPc_NTS_TAG_LEN octets longer than the
+*                   plaintext.
+*
+*               (c) SNTPc_NTS_RandGet() fills a buffer with cryptographically secure random octets.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_EXT_TS_EN == DEF_ENABLED)
+SNTP_FIXED_TS  SNTPc_ExtTS_Get        (void);                             /* See Note #1.                               */
+#endif
+
+#if (SNTPc_CFG_NET_TS_EN == DEF_ENABLED)
+CPU_BOOLEAN    SNTPc_NetTS_TxGet      (const SNTP_TS        *p_ts_tx,     /* See Note #2.                               */
+                                             SNTP_FIXED_TS  *p_ts);
+
+CPU_BOOLEAN    SNTPc_NetTS_RxGet      (const SNTP_PKT       *ppkt,        /* See Note #2.                               */
+                                             SNTP_FIXED_TS  *p_ts);
+#endif
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+CPU_BOOLEAN    SNTPc_NTS_KE_Exchange  (const CPU_CHAR       *p_hostname,  /* See Note #3a.                              */
+                                             NET_PORT_NBR    port_nbr,
+                                       const CPU_INT08U     *p_req,
+                                             CPU_INT16U      req_len,
+                                             CPU_INT08U     *p_resp,
+                                             CPU_INT16U      resp_size,
+                                             CPU_INT16U     *p_resp_len,
+                                             CPU_INT08U     *p_key_c2s,
+                                             CPU_INT08U     *p_key_s2c);
+
+CPU_BOOLEAN    SNTPc_NTS_AEAD_Seal    (const CPU_INT08U     *p_key,       /* See Note #3b.                              */
+                                       const CPU_INT08U     *p_nonce,
+                                             CPU_INT16U      nonce_len,
+                                       const CPU_INT08U     *p_ad,
+                                             CPU_INT16U      ad_len,
+                                       const CPU_INT08U     *p_pt,
+                                             CPU_INT16U      pt_len,
+                                             CPU_INT08U     *p_ct);
+
+CPU_BOOLEAN    SNTPc_NTS_AEAD_Open    (const CPU_INT08U     *p_key,       /* See Note #3b.                              */
+                                       const CPU_INT08U     *p_nonce,
+                                             CPU_INT16U      nonce_len,
+                                       const CPU_INT08U     *p_ad,
+                                             CPU_INT16U      ad_len,
+                                       const CPU_INT08U     *p_ct,
+                                             CPU_INT16U      ct_len,
+                                             CPU_INT08U     *p_pt);
+
+CPU_BOOLEAN    SNTPc_NTS_RandGet      (      CPU_INT08U     *p_buf,       /* See Note #3c.                              */
+                                             CPU_INT16U      len);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_CFG_SOCK_POOL_NBR_ENTRIES
+#error  "SNTPc_CFG_SOCK_POOL_NBR_ENTRIES              not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_SOCK_POOL_NBR_ENTRIES < 1u)
+#error  "SNTPc_CFG_SOCK_POOL_NBR_ENTRIES        illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX
+#error  "SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX            not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX < 1u)
+#error  "SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX      illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_SOCK_SHARED_EN
+#error  "SNTPc_CFG_SOCK_SHARED_EN                     not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_SOCK_SHARED_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_SOCK_SHARED_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_SOCK_SHARED_EN               illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_SOCK_SHARED_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX
+#error  "SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX            not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#elif  ((SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX <   1u) || \
+        (SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX > 255u))
+#error  "SNTPc_CFG_SOCK_SHARED_REQ_NBR_MAX      illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES
+#error  "SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES             not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES < 1u)
+#error  "SNTPc_CFG_ADDR_CACHE_NBR_ENTRIES       illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_ADDR_CACHE_TTL_SEC
+#error  "SNTPc_CFG_ADDR_CACHE_TTL_SEC                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_ADDR_CACHE_TTL_SEC < 1u)
+#error  "SNTPc_CFG_ADDR_CACHE_TTL_SEC           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_ADDR_CACHE_REFRESH_SEC
+#error  "SNTPc_CFG_ADDR_CACHE_REFRESH_SEC             not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 2 &&                  "
+#error  "                                       MUST be  <  SNTPc_CFG_ADDR_CACHE_TTL_SEC]"
+#elif  ((SNTPc_CFG_ADDR_CACHE_REFRESH_SEC < 2u                          ) || \
+        (SNTPc_CFG_ADDR_CACHE_REFRESH_SEC >= SNTPc_CFG_ADDR_CACHE_TTL_SEC))
+#error  "SNTPc_CFG_ADDR_CACHE_REFRESH_SEC       illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 2 &&                  "
+#error  "                                       MUST be  <  SNTPc_CFG_ADDR_CACHE_TTL_SEC]"
+#endif
+
+#ifndef  SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS
+#error  "SNTPc_CFG_ADDR_FAMILY_RACE_DLY_MS            not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_MULTI_SERVER_NBR_MAX
+#error  "SNTPc_CFG_MULTI_SERVER_NBR_MAX               not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 32]                   "
+#elif  ((SNTPc_CFG_MULTI_SERVER_NBR_MAX <  1u) || \
+        (SNTPc_CFG_MULTI_SERVER_NBR_MAX > 32u))
+#error  "SNTPc_CFG_MULTI_SERVER_NBR_MAX         illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 32]                   "
+#endif
+
+#ifndef  SNTPc_CFG_SEL_SURVIVOR_NBR_MIN
+#error  "SNTPc_CFG_SEL_SURVIVOR_NBR_MIN               not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_SEL_SURVIVOR_NBR_MIN < 1u)
+#error  "SNTPc_CFG_SEL_SURVIVOR_NBR_MIN         illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_BURST_REQ_NBR_MAX
+#error  "SNTPc_CFG_BURST_REQ_NBR_MAX                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_BURST_REQ_NBR_MAX < 1u)
+#error  "SNTPc_CFG_BURST_REQ_NBR_MAX            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_BACKOFF_NBR_ENTRIES
+#error  "SNTPc_CFG_BACKOFF_NBR_ENTRIES                not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_BACKOFF_NBR_ENTRIES < 1u)
+#error  "SNTPc_CFG_BACKOFF_NBR_ENTRIES          illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_BACKOFF_MIN_SEC
+#error  "SNTPc_CFG_BACKOFF_MIN_SEC                    not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_BACKOFF_MIN_SEC < 1u)
+#error  "SNTPc_CFG_BACKOFF_MIN_SEC              illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_BACKOFF_MAX_SEC
+#error  "SNTPc_CFG_BACKOFF_MAX_SEC                    not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= SNTPc_CFG_BACKOFF_MIN_SEC &&"
+#error  "                                       MUST be  <= 1000000]              "
+#elif  ((SNTPc_CFG_BACKOFF_MAX_SEC < SNTPc_CFG_BACKOFF_MIN_SEC) || \
+        (SNTPc_CFG_BACKOFF_MAX_SEC > 1000000u                ))
+#error  "SNTPc_CFG_BACKOFF_MAX_SEC              illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= SNTPc_CFG_BACKOFF_MIN_SEC &&"
+#error  "                                       MUST be  <= 1000000]              "
+#endif
+
+#ifndef  SNTPc_CFG_BACKOFF_JITTER_PCT
+#error  "SNTPc_CFG_BACKOFF_JITTER_PCT                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 100]                  "
+#elif   (SNTPc_CFG_BACKOFF_JITTER_PCT > 100u)
+#error  "SNTPc_CFG_BACKOFF_JITTER_PCT           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 100]                  "
+#endif
+
+#ifndef  SNTPc_CFG_FILTER_NBR_ENTRIES
+#error  "SNTPc_CFG_FILTER_NBR_ENTRIES                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_FILTER_NBR_ENTRIES < 1u)
+#error  "SNTPc_CFG_FILTER_NBR_ENTRIES           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_EXT_TS_EN
+#error  "SNTPc_CFG_EXT_TS_EN                          not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_EXT_TS_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_EXT_TS_EN                    illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_EXT_TS_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_EXT_TS_RES_NS
+#error  "SNTPc_CFG_EXT_TS_RES_NS                      not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_EXT_TS_RES_NS < 1u)
+#error  "SNTPc_CFG_EXT_TS_RES_NS                illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_NET_TS_EN
+#error  "SNTPc_CFG_NET_TS_EN                          not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_NET_TS_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_NET_TS_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_NET_TS_EN                    illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_NET_TS_EN == DEF_ENABLED ) && \
+        (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_NET_TS_EN                    illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED when           ]"
+#error  "                                      [SNTPc_CFG_EXT_TS_EN is DEF_DISABLED]"
+#endif
+
+#ifndef  SNTPc_CFG_CLK_PANIC_THRESH_MS
+#error  "SNTPc_CFG_CLK_PANIC_THRESH_MS                not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_CLK_PANIC_THRESH_MS < 1u)
+#error  "SNTPc_CFG_CLK_PANIC_THRESH_MS          illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_CLK_SLEW_MAX_PPM
+#error  "SNTPc_CFG_CLK_SLEW_MAX_PPM                   not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#error  "                                      [     &&  <= 500]                  "
+#elif  ((SNTPc_CFG_CLK_SLEW_MAX_PPM <   1u) || \
+        (SNTPc_CFG_CLK_SLEW_MAX_PPM > 500u))
+#error  "SNTPc_CFG_CLK_SLEW_MAX_PPM             illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#error  "                                      [     &&  <= 500]                  "
+#endif
+
+#ifndef  SNTPc_CFG_ERA_PIVOT_SEC
+#error  "SNTPc_CFG_ERA_PIVOT_SEC                      not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_TASK_EN
+#error  "SNTPc_CFG_TASK_EN                            not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_TASK_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_TASK_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_TASK_EN                      illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_TASK_PRIO
+#error  "SNTPc_CFG_TASK_PRIO                          not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_ASYNC_REQ_NBR_MAX
+#error  "SNTPc_CFG_ASYNC_REQ_NBR_MAX                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_ASYNC_REQ_NBR_MAX < 1u)
+#error  "SNTPc_CFG_ASYNC_REQ_NBR_MAX            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_TASK_STK_SIZE_BYTES
+#error  "SNTPc_CFG_TASK_STK_SIZE_BYTES                not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_TASK_STK_SIZE_BYTES < 1u)
+#error  "SNTPc_CFG_TASK_STK_SIZE_BYTES          illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_SYNC_POLL_EXP_MIN
+#error  "SNTPc_CFG_SYNC_POLL_EXP_MIN                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 4]                    "
+#error  "                                      [     &&  <= 17]                   "
+#elif  ((SNTPc_CFG_SYNC_POLL_EXP_MIN <  4u) || \
+        (SNTPc_CFG_SYNC_POLL_EXP_MIN > 17u))
+#error  "SNTPc_CFG_SYNC_POLL_EXP_MIN            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 4]                    "
+#error  "                                      [     &&  <= 17]                   "
+#endif
+
+#ifndef  SNTPc_CFG_SYNC_POLL_EXP_MAX
+#error  "SNTPc_CFG_SYNC_POLL_EXP_MAX                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= SNTPc_CFG_SYNC_POLL_EXP_MIN]"
+#error  "                                      [     &&  <= 17]                   "
+#elif  ((SNTPc_CFG_SYNC_POLL_EXP_MAX < SNTPc_CFG_SYNC_POLL_EXP_MIN) || \
+        (SNTPc_CFG_SYNC_POLL_EXP_MAX > 17u))
+#error  "SNTPc_CFG_SYNC_POLL_EXP_MAX            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= SNTPc_CFG_SYNC_POLL_EXP_MIN]"
+#error  "                                      [     &&  <= 17]                   "
+#endif
+
+#ifndef  SNTPc_CFG_SYNC_BURST_REQ_NBR
+#error  "SNTPc_CFG_SYNC_BURST_REQ_NBR                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#error  "                                      [     &&  <= SNTPc_CFG_BURST_REQ_NBR_MAX]"
+#elif  ((SNTPc_CFG_SYNC_BURST_REQ_NBR < 1u) || \
+        (SNTPc_CFG_SYNC_BURST_REQ_NBR > SNTPc_CFG_BURST_REQ_NBR_MAX))
+#error  "SNTPc_CFG_SYNC_BURST_REQ_NBR           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#error  "                                      [     &&  <= SNTPc_CFG_BURST_REQ_NBR_MAX]"
+#endif
+
+#ifndef  SNTPc_CFG_SYNC_BURST_INTERVAL_MS
+#error  "SNTPc_CFG_SYNC_BURST_INTERVAL_MS             not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_DRIFT_WIN_NBR
+#error  "SNTPc_CFG_DRIFT_WIN_NBR                      not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 3 &&"
+#error  "                                       MUST be  <= 32]                   "
+#elif  ((SNTPc_CFG_DRIFT_WIN_NBR <  3u) || \
+        (SNTPc_CFG_DRIFT_WIN_NBR > 32u))
+#error  "SNTPc_CFG_DRIFT_WIN_NBR                illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 3 &&"
+#error  "                                       MUST be  <= 32]                   "
+#endif
+
+#ifndef  SNTPc_CFG_DRIFT_WANDER_PPB
+#error  "SNTPc_CFG_DRIFT_WANDER_PPB                   not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 1000000]              "
+#elif   (SNTPc_CFG_DRIFT_WANDER_PPB > 1000000u)
+#error  "SNTPc_CFG_DRIFT_WANDER_PPB             illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 1000000]              "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_BCAST_EN
+#error  "SNTPc_CFG_BCAST_EN                           not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_BCAST_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_BCAST_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_BCAST_EN                     illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_BCAST_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_BCAST_TASK_PRIO
+#error  "SNTPc_CFG_BCAST_TASK_PRIO                    not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES
+#error  "SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES          not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES < 1u)
+#error  "SNTPc_CFG_BCAST_TASK_STK_SIZE_BYTES    illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#ifndef  SNTPc_CFG_BCAST_CAL_REQ_NBR
+#error  "SNTPc_CFG_BCAST_CAL_REQ_NBR                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#elif  ((SNTPc_CFG_BCAST_CAL_REQ_NBR <   1u) || \
+        (SNTPc_CFG_BCAST_CAL_REQ_NBR > 255u))
+#error  "SNTPc_CFG_BCAST_CAL_REQ_NBR            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#endif
+
+#ifndef  SNTPc_CFG_BCAST_CAL_PERIOD_SEC
+#error  "SNTPc_CFG_BCAST_CAL_PERIOD_SEC               not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 604800]               "
+#elif   (SNTPc_CFG_BCAST_CAL_PERIOD_SEC > 604800u)
+#error  "SNTPc_CFG_BCAST_CAL_PERIOD_SEC         illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  <= 604800]               "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_MANYCAST_EN
+#error  "SNTPc_CFG_MANYCAST_EN                        not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_MANYCAST_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_MANYCAST_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_MANYCAST_EN                  illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_MANYCAST_EN == DEF_ENABLED)
+
+#ifndef  NET_MCAST_TX_MODULE_EN
+#error  "SNTPc_CFG_MANYCAST_EN                  illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED when       ]"
+#error  "                                      [IPv4 multicast Tx is DISABLED   ]"
+#endif
+
+#ifndef  SNTPc_CFG_MANYCAST_GRP_ADDR
+#error  "SNTPc_CFG_MANYCAST_GRP_ADDR                  not #define'd in 'sntp-c_cfg.h'"
+#endif
+
+#ifndef  SNTPc_CFG_MANYCAST_TTL_MAX
+#error  "SNTPc_CFG_MANYCAST_TTL_MAX                   not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#elif  ((SNTPc_CFG_MANYCAST_TTL_MAX <   1u) || \
+        (SNTPc_CFG_MANYCAST_TTL_MAX > 255u))
+#error  "SNTPc_CFG_MANYCAST_TTL_MAX             illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#endif
+
+#ifndef  SNTPc_CFG_MANYCAST_SERVER_NBR_MAX
+#error  "SNTPc_CFG_MANYCAST_SERVER_NBR_MAX            not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#elif  ((SNTPc_CFG_MANYCAST_SERVER_NBR_MAX <   1u) || \
+        (SNTPc_CFG_MANYCAST_SERVER_NBR_MAX > 255u))
+#error  "SNTPc_CFG_MANYCAST_SERVER_NBR_MAX      illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#endif
+
+#ifndef  SNTPc_CFG_MANYCAST_RX_WINDOW_MS
+#error  "SNTPc_CFG_MANYCAST_RX_WINDOW_MS              not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_MANYCAST_RX_WINDOW_MS < 1u)
+#error  "SNTPc_CFG_MANYCAST_RX_WINDOW_MS        illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_NTS_EN
+#error  "SNTPc_CFG_NTS_EN                             not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_NTS_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_NTS_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_NTS_EN                       illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_NTS_SERVER_NBR_MAX
+#error  "SNTPc_CFG_NTS_SERVER_NBR_MAX                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#elif  ((SNTPc_CFG_NTS_SERVER_NBR_MAX <   1u) || \
+        (SNTPc_CFG_NTS_SERVER_NBR_MAX > 255u))
+#error  "SNTPc_CFG_NTS_SERVER_NBR_MAX           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 255]                  "
+#endif
+
+#ifndef  SNTPc_CFG_NTS_COOKIE_NBR_MAX
+#error  "SNTPc_CFG_NTS_COOKIE_NBR_MAX                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 16]                   "
+#elif  ((SNTPc_CFG_NTS_COOKIE_NBR_MAX <  1u) || \
+        (SNTPc_CFG_NTS_COOKIE_NBR_MAX > 16u))
+#error  "SNTPc_CFG_NTS_COOKIE_NBR_MAX           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1 &&                  "
+#error  "                                       MUST be  <= 16]                   "
+#endif
+
+#ifndef  SNTPc_CFG_NTS_COOKIE_LEN_MAX
+#error  "SNTPc_CFG_NTS_COOKIE_LEN_MAX                 not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 16 &&                 "
+#error  "                                       MUST be  <= 256 &&                "
+#error  "                                       MUST be  a multiple of 4]         "
+#elif  ((SNTPc_CFG_NTS_COOKIE_LEN_MAX <  16u) || \
+        (SNTPc_CFG_NTS_COOKIE_LEN_MAX > 256u) || \
+        ((SNTPc_CFG_NTS_COOKIE_LEN_MAX % 4u) != 0u))
+#error  "SNTPc_CFG_NTS_COOKIE_LEN_MAX           illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 16 &&                 "
+#error  "                                       MUST be  <= 256 &&                "
+#error  "                                       MUST be  a multiple of 4]         "
+#endif
+
+#endif
+
+#ifndef  SNTPc_CFG_STAT_EN
+#error  "SNTPc_CFG_STAT_EN                            not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_CFG_STAT_EN != DEF_DISABLED) && \
+        (SNTPc_CFG_STAT_EN != DEF_ENABLED ))
+#error  "SNTPc_CFG_STAT_EN                      illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_CFG_STAT_NBR_ENTRIES
+#error  "SNTPc_CFG_STAT_NBR_ENTRIES                   not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#elif   (SNTPc_CFG_STAT_NBR_ENTRIES < 1u)
+#error  "SNTPc_CFG_STAT_NBR_ENTRIES             illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 1]                    "
+#endif
+
+#endif
+
+#if ((defined(SNTPc_TRACE_LEVEL)) && \
+     (SNTPc_TRACE_LEVEL >= TRACE_LEVEL_INFO))
+
+#ifndef  SNTPc_TRACE_BIN_EN
+#error  "SNTPc_TRACE_BIN_EN                           not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+#elif  ((SNTPc_TRACE_BIN_EN != DEF_DISABLED) && \
+        (SNTPc_TRACE_BIN_EN != DEF_ENABLED ))
+#error  "SNTPc_TRACE_BIN_EN                     illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  DEF_DISABLED]            "
+#error  "                                      [     ||  DEF_ENABLED ]            "
+
+#elif   (SNTPc_TRACE_BIN_EN == DEF_ENABLED)
+
+#ifndef  SNTPc_TRACE_BIN_NBR_RECORDS
+#error  "SNTPc_TRACE_BIN_NBR_RECORDS                  not #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 2 &&                  "
+#error  "                                       MUST be  a power of 2]            "
+#elif  ((SNTPc_TRACE_BIN_NBR_RECORDS < 2u) || \
+       ((SNTPc_TRACE_BIN_NBR_RECORDS & (SNTPc_TRACE_BIN_NBR_RECORDS - 1u)) != 0u))
+#error  "SNTPc_TRACE_BIN_NBR_RECORDS            illegally #define'd in 'sntp-c_cfg.h'"
+#error  "                                      [MUST be  >= 2 &&                  "
+#error  "                                       MUST be  a power of 2]            "
+#endif
+
+#endif
+
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -0,0 +1,939 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT CLOCK DISCIPLINE
+*
+* Filename : sntp-c_clk.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Maintains a software clock, disciplined by the offsets measured from an NTP server with the
+*                hybrid phase/frequency-locked loop of RFC #5905, Appendix A.5.5.6.
+*
+*            (2) The disciplined clock runs from the local time base (see SNTPc_ClkLocalGet()). Its time is
+*                the time set at the last update, plus the elapsed local time corrected by :
+*
+*                (a) The frequency correction, which compensates the drift of the local time base.
+*
+*                (b) The phase correction, which amortizes the last measured offset at a rate limited to
+*                    SNTPc_CFG_CLK_SLEW_MAX_PPM, so that the clock never jumps nor runs backward.
+*
+*                The clock is stepped only when it is set for the first time & when the measured offset
+*                exceeds SNTPc_CFG_CLK_PANIC_THRESH_MS.
+*
+*            (3) All the computations use integer arithmetic. Times are NTP timestamps in 32.32 fixed point,
+*                corrections are in nanoseconds.
+*
+*            (4) NTP timestamps hold the seconds modulo 2^32 & wrap around every 136 years, the first time
+*                on 2036-02-07 06:28:16 UTC (see RFC #5905, Section 6). The disciplined clock & the offsets
+*                are computed modulo 2^32 seconds & are not affected by the wrap-around. Only the conversion
+*                of a timestamp to an absolute time needs to resolve its era (see SNTPc_TS_ToTime64()).
+*
+*            (5) The clock state is read without lock nor critical section, so that the disciplined time can
+*                be read from any task, ISR or CPU core (see SNTPc_Now()). It is protected by a sequence
+*                counter (seqlock) :
+*
+*                (a) The writers increment the counter before & after they modify the state, so that the
+*                    counter is odd while the state is modified. The writers are serialized by a critical
+*                    section & MUST run on the same CPU core.
+*
+*                (b) The readers copy the state & retry while the counter is odd or changed during the copy.
+*
+*            (6) If SNTPc_CFG_EXT_TS_EN is disabled, the 32-bit local time of NetUtil_TS_Get_ms() is extended to
+*                64 bits from an epoch, the last extended local time published, protected by its own sequence
+*                counter like the clock state (see Note #5). The epoch is published by the writers of the
+*                clock state only, so that the local time is also read without lock nor critical section.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c.h"
+#include  "sntp-c_clk.h"
+#include  "sntp-c_fixed.h"
+#include  <Source/net_util.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_CLK_NS_NBR_PER_SEC               1000000000u     /* Nbr of ns in a second.                               */
+#define  SNTPc_CLK_NS_NBR_PER_MS                   1000000u     /* Nbr of ns in a millisecond.                          */
+#define  SNTPc_CLK_US_NBR_PER_SEC                  1000000u     /* Nbr of us in a second.                               */
+#define  SNTPc_CLK_MS_NBR_PER_SEC                     1000u     /* Nbr of ms in a second.                               */
+
+#define  SNTPc_CLK_FREQ_SCALE                        65536      /* Freq correction unit is 2^-16 ppb.                   */
+#define  SNTPc_CLK_FREQ_MAX    ((CPU_INT64S)500000 * SNTPc_CLK_FREQ_SCALE)   /* Max freq correction (500 ppm).            */
+
+#define  SNTPc_CLK_PLL                                  65      /* PLL loop gain (see RFC #5905, Appendix A.1.1).       */
+#define  SNTPc_CLK_FLL                                  18      /* FLL loop gain.                                       */
+#define  SNTPc_CLK_AVG                                   4      /* Parameter averaging constant.                        */
+#define  SNTPc_CLK_ALLAN_SEC                          1500      /* Compromise Allan intercept.                          */
+#define  SNTPc_CLK_WATCH_SEC                           900      /* Freq measurement interval.                           */
+
+#define  SNTPc_CLK_REBASE_SEC                     0x100000u     /* Max elapsed time before the clock is rebased.        */
+
+                                                                /* Memory barrier of the seqlock (see Note #5).         */
+#ifdef   CPU_MB
+#define  SNTPc_CLK_MB()                         CPU_MB()
+#else
+#define  SNTPc_CLK_MB()                                         /* Single core CPU : volatile accesses are ordered.     */
+#endif
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     CLOCK DISCIPLINE DATA TYPE
+*
+* Note(s) : (1) The clock state is protected by a sequence counter (see 'sntp-c_clk.c  Note #5'). The
+*               computations are performed on a copy of the state.
+*
+*           (2) The clock is rebased, i.e. its base time is moved to the current local time, at each update &
+*               periodically by the SNTPc task, to bound the elapsed time in the computations (see
+*               SNTPc_ClkRebase()).
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_clk {
+    CPU_BOOLEAN    IsSet;
+    CPU_BOOLEAN    IsFreqSet;                                   /* Freq correction measured since the clock was set.    */
+    SNTP_FIXED_TS  BaseLocal;                                   /* Local time of the base (see Note #2).                */
+    SNTP_FIXED_TS  BaseTime;                                    /* Disciplined time at the base.                        */
+    CPU_INT64S     Freq;                                        /* Freq correction, in 2^-16 ppb.                       */
+    CPU_INT64S     PhaseRem_ns;                                 /* Phase correction not yet applied.                    */
+    CPU_INT64S     OffsetPrev_ns;                               /* Offset measured at the last update.                  */
+    SNTP_FIXED_TS  UpdateLocal;                                 /* Local time of the last update.                       */
+    CPU_INT32U     UpdateCtr;
+    CPU_INT32U     StepCtr;
+} SNTPc_CLK;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  volatile  SNTPc_CLK   SNTPc_Clk;
+static  volatile  CPU_DATA    SNTPc_ClkSeq;                     /* Seq ctr of the clock state (see Note #5).            */
+
+static  CPU_INT64S  SNTPc_ClkEraPivotSec;                       /* Era pivot (see SNTPc_TS_ToTime64()).                 */
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+static  volatile  CPU_INT64U  SNTPc_ClkLocalEpoch_ms;           /* Epoch of the local time (see Note #6).               */
+static  volatile  CPU_DATA    SNTPc_ClkLocalSeq;                /* Seq ctr of the epoch.                                */
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void           SNTPc_ClkRd       (      SNTPc_CLK      *p_clk);
+
+static  void           SNTPc_ClkWr       (const SNTPc_CLK      *p_clk);
+
+static  SNTP_FIXED_TS  SNTPc_ClkTimeCalc (      SNTPc_CLK      *p_clk,
+                                                SNTP_FIXED_TS   ts_local);
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+static  CPU_INT64U     SNTPc_ClkLocalRd_ms (void);
+
+static  void           SNTPc_ClkLocalTrack (void);
+#endif
+
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_ClkInit()
+*
+* Description : Initialize the clock discipline.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_ClkInit (void)
+{
+    SNTPc_CLK  clk;
+    CPU_SR_ALLOC();
+
+
+    Mem_Clr(&clk, sizeof(clk));
+    CPU_CRITICAL_ENTER();
+    SNTPc_ClkWr(&clk);
+    CPU_CRITICAL_EXIT();
+
+    SNTPc_ClkEraPivotSec = (CPU_INT64S)SNTPc_CFG_ERA_PIVOT_SEC;
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+    CPU_CRITICAL_ENTER();
+    SNTPc_ClkLocalSeq++;
+    SNTPc_CLK_MB();
+    SNTPc_ClkLocalEpoch_ms = NetUtil_TS_Get_ms();
+    SNTPc_CLK_MB();
+    SNTPc_ClkLocalSeq++;
+    CPU_CRITICAL_EXIT();
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ClkLocalGet()
+*
+* Description : Get the local time used to timestamp the SNTP packets & to run the disciplined clock.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Local time since an arbitrary origin, in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_AcquireLock(),
+*               SNTPc_ClkRebase(),
+*               SNTPc_ClkUpdate(),
+*               SNTPc_DriftStatusGet(),
+*               SNTPc_DriftTimeGet(),
+*               SNTPc_FilterStatusGet(),
+*               SNTPc_GetRemoteTime(),
+*               SNTPc_LocalTimeOffsetGet(),
+*               SNTPc_Now(),
+*               SNTPc_RxTS_Set(),
+*               SNTPc_Tx(),
+*               SNTPc_TraceWr().
+*
+* Note(s)     : (1) If SNTPc_CFG_EXT_TS_EN is enabled, the local time is returned by SNTPc_ExtTS_Get(),
+*                   implemented by the application from a high resolution timer.
+*
+*               (2) Otherwise, the local time is built from NetUtil_TS_Get_ms(), extended to 64 bits without
+*                   lock nor critical section (see SNTPc_ClkLocalRd_ms()).
+*********************************************************************************************************
+*/
+
+SNTP_FIXED_TS  SNTPc_ClkLocalGet (void)
+{
+#if (SNTPc_CFG_EXT_TS_EN == DEF_ENABLED)
+    return (SNTPc_ExtTS_Get());                                 /* See Note #1.                                         */
+#else
+    CPU_INT64U  ts_ms_ext;
+
+                                                                /* See Note #2.                                         */
+    ts_ms_ext = SNTPc_ClkLocalRd_ms();
+
+    return (((ts_ms_ext / SNTPc_CLK_MS_NBR_PER_SEC) << 32u) +
+           (((ts_ms_ext % SNTPc_CLK_MS_NBR_PER_SEC) << 32u) / SNTPc_CLK_MS_NBR_PER_SEC));
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                             SNTPc_Now()
+*
+* Description : Get the time of the disciplined clock, without lock.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Time successfully returned.
+*                               SNTPc_ERR_CLK_NOT_SET    Clock not set yet.
+*
+* Return(s)   : Disciplined time (NTP timestamp), if NO error(s).
+*
+*               Null timestamp,                   otherwise.
+*
+* Caller(s)   : Application,
+*               SNTPc_ClkGet().
+*
+* Note(s)     : (1) The time is computed from the local time base & from the clock state published by the last
+*                   update, without lock, OS call nor network access. The function can be called from any
+*                   task, from an ISR & from any CPU core (see 'sntp-c_clk.c  Note #5').
+*
+*               (2) The local time is also read without lock nor critical section (see SNTPc_ClkLocalGet()).
+*                   On a multi-core CPU, SNTPc_ExtTS_Get() or NetUtil_TS_Get_ms() MUST read a time base shared
+*                   by the cores.
+*
+*               (3) The local time is read after the clock state, so that it is never earlier than the base
+*                   of the state.
+*
+*               (4) The disciplined clock is monotonic, except when it is stepped (see SNTPc_ClkUpdate()).
+*********************************************************************************************************
+*/
+
+SNTP_TS  SNTPc_Now (SNTPc_ERR  *p_err)
+{
+    SNTPc_CLK      clk;
+    SNTP_FIXED_TS  ts_local;
+    SNTP_FIXED_TS  time;
+    SNTP_TS        ts;
+
+
+    ts.Sec  = 0u;
+    ts.Frac = 0u;
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(ts);
+    }
+#endif
+
+    SNTPc_ClkRd(&clk);
+    if (clk.IsSet == DEF_NO) {
+       *p_err = SNTPc_ERR_CLK_NOT_SET;
+        return (ts);
+    }
+
+    ts_local = SNTPc_ClkLocalGet();                             /* See Note #3.                                         */
+    time     = SNTPc_ClkTimeCalc(&clk, ts_local);
+
+    ts.Sec  = (CPU_INT32U)(time >> 32u);
+    ts.Frac = (CPU_INT32U)(time & DEF_INT_32U_MAX_VAL);
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_ClkGet()
+*
+* Description : Get the time of the disciplined clock.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Time successfully returned.
+*                               SNTPc_ERR_CLK_NOT_SET    Clock not set yet.
+*
+* Return(s)   : Disciplined time (NTP timestamp), if NO error(s).
+*
+*               Null timestamp,                   otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Same as SNTPc_Now() (see 'SNTPc_Now()  Note(s)').
+*********************************************************************************************************
+*/
+
+SNTP_TS  SNTPc_ClkGet (SNTPc_ERR  *p_err)
+{
+    return (SNTPc_Now(p_err));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_ClkRebase()
+*
+* Description : Rebase the disciplined clock if it was not updated for long.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Task().
+*
+* Note(s)     : (1) The elapsed time since the base of the clock is bounded to SNTPc_CLK_REBASE_SEC (12 days),
+*                   well below the 2^31 seconds accepted by the computations (see 'SNTPc_ClkTimeCalc()
+*                   Note #1'). Without the SNTPc task, the application SHOULD update the clock at least as often
+*                   (see SNTPc_ClkUpdate()), so that the truncations of the corrections do not accumulate.
+*
+*               (2) The clock is not rebased if it was updated meanwhile.
+*
+*               (3) The epoch of the local time is published at each call, i.e. at least once per
+*                   SNTPc_CFG_ADDR_CACHE_REFRESH_SEC / 2 (see SNTPc_ClkLocalRd_ms()).
+*********************************************************************************************************
+*/
+
+void  SNTPc_ClkRebase (void)
+{
+    SNTPc_CLK      clk;
+    SNTP_FIXED_TS  ts_local;
+    SNTP_FIXED_TS  base_local;
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+    SNTPc_ClkLocalTrack();                                      /* See Note #3.                                         */
+#endif
+
+    SNTPc_ClkRd(&clk);
+    ts_local   = SNTPc_ClkLocalGet();
+    base_local = clk.BaseLocal;
+    if ((clk.IsSet == DEF_NO) ||
+        (((ts_local - base_local) >> 32u) < SNTPc_CLK_REBASE_SEC)) {
+        return;
+    }
+
+    (void)SNTPc_ClkTimeCalc(&clk, ts_local);
+
+    CPU_CRITICAL_ENTER();
+    if (SNTPc_Clk.BaseLocal == base_local) {                    /* See Note #2.                                         */
+        SNTPc_ClkWr(&clk);
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_ClkUpdate()
+*
+* Description : Discipline the clock with the time obtained from an NTP server.
+*
+* Argument(s) : remote_time     Remote time, as returned by SNTPc_GetRemoteTime().
+*
+*               poll_exp        Poll exponent of the server, as a power of 2 seconds (see Note #2).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   SNTPc_ERR_NONE           Clock successfully updated.
+*
+* Return(s)   : Offset of the remote time from the disciplined clock, in microseconds, before the update,
+*
+*               0, if the clock was not set yet.
+*
+* Caller(s)   : Application,
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : (1) MUST be called as soon as possible after SNTPc_GetRemoteTime(), since the remote time is
+*                   compared to the disciplined time at the moment of the call.
+*
+*               (2) The poll exponent sets the time constant of the phase-locked loop. It SHOULD match the
+*                   interval between the updates.
+*
+*               (3) The clock is stepped to the remote time when it is not set yet or when the offset exceeds
+*                   SNTPc_CFG_CLK_PANIC_THRESH_MS. Otherwise :
+*
+*                   (a) The offset replaces the phase correction not yet applied.
+*
+*                   (b) The frequency correction is adjusted by the phase-locked loop, &, when the interval
+*                       since the last update exceeds half the Allan intercept, by the frequency-locked loop.
+*                       It is limited to +/- 500 ppm.
+*
+*               (4) After the clock is set for the first time, the frequency correction is measured directly
+*                   from the offset accumulated over SNTPc_CLK_WATCH_SEC (see RFC #5905, Appendix A.5.5.6,
+*                   FREQ state). Updates received before are ignored, except to step the clock.
+*
+*               (5) The updates MUST be performed from a single task, or from tasks running on the same CPU
+*                   core (see 'sntp-c_clk.c  Note #5a'). The synchronization & the broadcast client of
+*                   'sntp-c.c' update the clock under the module lock (see 'SNTPc_BcastStart()  Note #4').
+*
+*               (6) The epoch of the local time is published at each update (see SNTPc_ClkLocalRd_ms()).
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_ClkUpdate (SNTP_TS      remote_time,
+                             CPU_INT08U   poll_exp,
+                             SNTPc_ERR   *p_err)
+{
+    SNTPc_CLK      clk;
+    SNTP_FIXED_TS  ts_local;
+    SNTP_FIXED_TS  time;
+    SNTP_FIXED_TS  time_remote;
+    CPU_INT64S     offset_ns;
+    CPU_INT64S     offset_abs_ns;
+    CPU_INT64S     mu_sec;
+    CPU_INT64S     gain;
+    CPU_INT64S     gain_fll;
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(0);
+    }
+#endif
+
+    time_remote = ((SNTP_FIXED_TS)remote_time.Sec << 32u) | remote_time.Frac;
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+    SNTPc_ClkLocalTrack();                                      /* See Note #6.                                         */
+#endif
+
+    SNTPc_ClkRd(&clk);
+    ts_local = SNTPc_ClkLocalGet();
+
+    time          = SNTPc_ClkTimeCalc(&clk, ts_local);          /* Rebase the clock at the current local time.          */
+    offset_ns     = SNTPc_FixedToNs((SNTP_FIXED)(time_remote - time));
+    offset_abs_ns = (offset_ns < 0) ? -offset_ns : offset_ns;
+    mu_sec        = (CPU_INT64S)((ts_local - clk.UpdateLocal) >> 32u);
+                                                                /* See Note #3.                                         */
+    if ((clk.IsSet      == DEF_NO) ||
+        (offset_abs_ns  > ((CPU_INT64S)SNTPc_CFG_CLK_PANIC_THRESH_MS * SNTPc_CLK_NS_NBR_PER_MS))) {
+        if (clk.IsSet == DEF_NO) {
+            clk.IsSet     = DEF_YES;
+            clk.IsFreqSet = DEF_NO;
+            offset_ns     = 0;                                  /* No offset from an unset clock.                       */
+        }
+        clk.BaseTime      = time_remote;                        /* Step the clock.                                      */
+        clk.PhaseRem_ns   = 0;
+        clk.OffsetPrev_ns = 0;
+        clk.UpdateLocal   = ts_local;
+        clk.StepCtr++;
+
+    } else if (clk.IsFreqSet == DEF_NO) {                       /* See Note #4.                                         */
+        if (mu_sec >= SNTPc_CLK_WATCH_SEC) {
+            clk.Freq         += (offset_ns * SNTPc_CLK_FREQ_SCALE) / mu_sec;
+            clk.Freq          = DEF_MIN(clk.Freq,  SNTPc_CLK_FREQ_MAX);
+            clk.Freq          = DEF_MAX(clk.Freq, -SNTPc_CLK_FREQ_MAX);
+            clk.IsFreqSet     = DEF_YES;
+            clk.PhaseRem_ns   = offset_ns;
+            clk.OffsetPrev_ns = offset_ns;
+            clk.UpdateLocal   = ts_local;
+        }
+
+    } else {
+        if (mu_sec > SNTPc_CLK_ALLAN_SEC / 2) {                 /* FLL (see Note #3b).                                  */
+            gain_fll = DEF_MAX(SNTPc_CLK_FLL - (CPU_INT64S)poll_exp, SNTPc_CLK_AVG);
+            clk.Freq += ((offset_ns - clk.OffsetPrev_ns) * SNTPc_CLK_FREQ_SCALE) /
+                        (DEF_MAX(mu_sec, SNTPc_CLK_ALLAN_SEC) * gain_fll);
+        }
+                                                                /* PLL.                                                 */
+        gain      = 4 * SNTPc_CLK_PLL * (CPU_INT64S)DEF_BIT64(poll_exp);
+        clk.Freq += (offset_ns * DEF_MIN(mu_sec, SNTPc_CLK_ALLAN_SEC) * SNTPc_CLK_FREQ_SCALE) / (gain * gain);
+        clk.Freq  = DEF_MIN(clk.Freq,  SNTPc_CLK_FREQ_MAX);
+        clk.Freq  = DEF_MAX(clk.Freq, -SNTPc_CLK_FREQ_MAX);
+
+        clk.PhaseRem_ns   = offset_ns;                          /* See Note #3a.                                        */
+        clk.OffsetPrev_ns = offset_ns;
+        clk.UpdateLocal   = ts_local;
+    }
+    clk.UpdateCtr++;
+
+    CPU_CRITICAL_ENTER();
+    SNTPc_ClkWr(&clk);
+    CPU_CRITICAL_EXIT();
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (offset_ns / 1000);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ClkStatusGet()
+*
+* Description : Get the status of the clock discipline.
+*
+* Argument(s) : p_status    Pointer to a variable that will receive the clock status.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Status successfully returned.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_ClkStatusGet (SNTPc_CLK_STATUS  *p_status,
+                          SNTPc_ERR         *p_err)
+{
+    SNTPc_CLK  clk;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_status == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    SNTPc_ClkRd(&clk);
+
+    p_status->IsSet       = clk.IsSet;
+    p_status->Freq_ppb    = (CPU_INT32S)(clk.Freq / SNTPc_CLK_FREQ_SCALE);
+    p_status->Offset_us   = clk.OffsetPrev_ns / 1000;
+    p_status->PhaseRem_us = clk.PhaseRem_ns   / 1000;
+    p_status->UpdateCtr   = clk.UpdateCtr;
+    p_status->StepCtr     = clk.StepCtr;
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_TS_ToTime64()
+*
+* Description : Convert an NTP timestamp to a 64-bit time, resolving its era.
+*
+* Argument(s) : ts          NTP timestamp, in host order, as returned by SNTPc_GetRemoteTime() or
+*                           SNTPc_ClkGet().
+*
+* Return(s)   : Number of seconds since 1900-01-01 00:00:00 UTC, the prime epoch of era 0.
+*
+* Caller(s)   : Application,
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : (1) The era of the timestamp is chosen so that the time returned is within 2^31 seconds
+*                   (68 years) of the era pivot (see SNTPc_EraPivotSet()).
+*
+*               (2) The fraction of second of the timestamp is discarded.
+*
+*               (3) Subtract SNTPc_UNIX_EPOCH_NTP_SEC from the time returned to get a Unix time.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_TS_ToTime64 (SNTP_TS  ts)
+{
+    CPU_INT64S  pivot_sec;
+    CPU_INT32S  diff_sec;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    pivot_sec = SNTPc_ClkEraPivotSec;
+    CPU_CRITICAL_EXIT();
+                                                                /* See Note #1.                                         */
+    diff_sec = (CPU_INT32S)(ts.Sec - (CPU_INT32U)((CPU_INT64U)pivot_sec & DEF_INT_32U_MAX_VAL));
+
+    return (pivot_sec + diff_sec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_EraPivotSet()
+*
+* Description : Set the era pivot used to convert NTP timestamps to 64-bit times.
+*
+* Argument(s) : pivot_sec   Era pivot, in seconds since 1900-01-01 00:00:00 UTC (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : (1) The pivot SHOULD be close to the current time. It is initialized by SNTPc_Init() to
+*                   SNTPc_CFG_ERA_PIVOT_SEC, usually the build time of the application, & is moved to the
+*                   time of each successful poll of the background synchronization. An application without
+*                   a battery-backed clock can persist the pivot returned by SNTPc_EraPivotGet() & restore
+*                   it after SNTPc_Init(), so that the pivot remains valid over the lifetime of the device.
+*
+*               (2) Times from 2^31 seconds before the pivot to 2^31 seconds after it are converted
+*                   correctly, e.g. from 1952 to 2088 for a pivot in 2020.
+*********************************************************************************************************
+*/
+
+void  SNTPc_EraPivotSet (CPU_INT64S  pivot_sec)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    SNTPc_ClkEraPivotSec = pivot_sec;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_EraPivotGet()
+*
+* Description : Get the era pivot used to convert NTP timestamps to 64-bit times.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Era pivot, in seconds since 1900-01-01 00:00:00 UTC.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'SNTPc_EraPivotSet() Note #1'.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_EraPivotGet (void)
+{
+    CPU_INT64S  pivot_sec;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    pivot_sec = SNTPc_ClkEraPivotSec;
+    CPU_CRITICAL_EXIT();
+
+    return (pivot_sec);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_ClkRd()
+*
+* Description : Read a consistent copy of the clock state.
+*
+* Argument(s) : p_clk       Pointer to the variable that will receive the copy of the clock state.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ClkRebase(),
+*               SNTPc_ClkStatusGet(),
+*               SNTPc_ClkUpdate(),
+*               SNTPc_Now().
+*
+* Note(s)     : (1) The copy is retried while the state is modified (see 'sntp-c_clk.c  Note #5b'). Since the
+*                   writers modify the state in a critical section, an ISR never waits for a writer of its
+*                   own CPU core.
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_ClkRd (SNTPc_CLK  *p_clk)
+{
+    CPU_DATA  seq;
+
+
+    do {                                                        /* See Note #1.                                         */
+        seq   = SNTPc_ClkSeq;
+        SNTPc_CLK_MB();
+       *p_clk = SNTPc_Clk;
+        SNTPc_CLK_MB();
+    } while (((seq & 1u) != 0u) ||
+             ( seq       != SNTPc_ClkSeq));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            SNTPc_ClkWr()
+*
+* Description : Publish a new clock state.
+*
+* Argument(s) : p_clk       Pointer to the new clock state.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ClkInit(),
+*               SNTPc_ClkRebase(),
+*               SNTPc_ClkUpdate().
+*
+* Note(s)     : (1) MUST be called in a critical section (see 'sntp-c_clk.c  Note #5a').
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_ClkWr (const SNTPc_CLK  *p_clk)
+{
+    SNTPc_ClkSeq++;                                             /* Odd while the state is modified.                     */
+    SNTPc_CLK_MB();
+    SNTPc_Clk = *p_clk;
+    SNTPc_CLK_MB();
+    SNTPc_ClkSeq++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ClkLocalRd_ms()
+*
+* Description : Read the local time of NetUtil_TS_Get_ms(), extended to 64 bits, without lock.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Local time since an arbitrary origin, in milliseconds.
+*
+* Caller(s)   : SNTPc_ClkLocalGet(),
+*               SNTPc_ClkLocalTrack().
+*
+* Note(s)     : (1) The local time is the epoch plus the time elapsed since the epoch, modulo 2^32 ms (see
+*                   'sntp-c_clk.c  Note #6'). The epoch MUST therefore be published at least once per 2^32 ms
+*                   (49 days), by SNTPc_ClkRebase() or SNTPc_ClkUpdate().
+*
+*               (2) NetUtil_TS_Get_ms() is read after the epoch, so that it is never earlier than the epoch.
+*                   The read is retried if the epoch was published meanwhile.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+static  CPU_INT64U  SNTPc_ClkLocalRd_ms (void)
+{
+    CPU_INT64U  epoch_ms;
+    NET_TS_MS   ts_ms;
+    CPU_DATA    seq;
+
+
+    do {                                                        /* See Note #2.                                         */
+        seq      = SNTPc_ClkLocalSeq;
+        SNTPc_CLK_MB();
+        epoch_ms = SNTPc_ClkLocalEpoch_ms;
+        SNTPc_CLK_MB();
+        ts_ms    = NetUtil_TS_Get_ms();
+        SNTPc_CLK_MB();
+    } while (((seq & 1u) != 0u) ||
+             ( seq       != SNTPc_ClkLocalSeq));
+                                                                /* See Note #1.                                         */
+    return (epoch_ms + (NET_TS_MS)(ts_ms - (NET_TS_MS)epoch_ms));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_ClkLocalTrack()
+*
+* Description : Publish the current local time as the epoch of the local time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_ClkRebase(),
+*               SNTPc_ClkUpdate().
+*
+* Note(s)     : (1) The writers of the epoch are serialized by a critical section, like the writers of the
+*                   clock state (see 'sntp-c_clk.c  Note #5a').
+*
+*               (2) SNTPc_ClkLocalRd_ms() waits while the sequence counter is odd : the current local time is
+*                   read before the counter is incremented.
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_EXT_TS_EN != DEF_ENABLED)
+static  void  SNTPc_ClkLocalTrack (void)
+{
+    CPU_INT64U  epoch_ms;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    epoch_ms               = SNTPc_ClkLocalRd_ms();             /* Read before the seq ctr is odd (see Note #2).        */
+    SNTPc_ClkLocalSeq++;
+    SNTPc_CLK_MB();
+    SNTPc_ClkLocalEpoch_ms = epoch_ms;
+    SNTPc_CLK_MB();
+    SNTPc_ClkLocalSeq++;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ClkTimeCalc()
+*
+* Description : Calculate the disciplined time at a given local time & rebase the clock copy on it.
+*
+* Argument(s) : p_clk       Pointer to a copy of the clock state.
+*
+*               ts_local    Local time, as returned by SNTPc_ClkLocalGet().
+*
+* Return(s)   : Disciplined time, in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_ClkRebase(),
+*               SNTPc_ClkUpdate(),
+*               SNTPc_Now().
+*
+* Note(s)     : (1) The elapsed time is split in seconds & nanoseconds, so that the corrections do not
+*                   overflow over any elapsed time of a signed 32.32 duration, i.e. up to 2^31 seconds :
+*
+*                   (a) The frequency correction, in 2^-16 ppb up to 500 ppm, is applied to the seconds in
+*                       its integer & fractional ppb parts, & to the remaining microseconds.
+*
+*                   (b) The maximum slew is applied to the seconds & to the remaining nanoseconds.
+*
+*               (2) The phase correction applied over the elapsed time is limited to SNTPc_CFG_CLK_SLEW_MAX_PPM
+*                   of it.
+*********************************************************************************************************
+*/
+
+static  SNTP_FIXED_TS  SNTPc_ClkTimeCalc (SNTPc_CLK      *p_clk,
+                                          SNTP_FIXED_TS   ts_local)
+{
+    CPU_INT64S  elapsed_ns;
+    CPU_INT64S  elapsed_sec;
+    CPU_INT64S  rem_ns;
+    CPU_INT64S  freq_ns;
+    CPU_INT64S  slew_ns;
+    CPU_INT64S  slew_max_ns;
+
+
+    elapsed_ns  = SNTPc_FixedToNs((SNTP_FIXED)(ts_local - p_clk->BaseLocal));
+    elapsed_sec = elapsed_ns / SNTPc_CLK_NS_NBR_PER_SEC;        /* See Note #1.                                         */
+    rem_ns      = elapsed_ns % SNTPc_CLK_NS_NBR_PER_SEC;
+                                                                /* See Note #1a.                                        */
+    freq_ns     =  (elapsed_sec * (p_clk->Freq / SNTPc_CLK_FREQ_SCALE)) +
+                  ((elapsed_sec * (p_clk->Freq % SNTPc_CLK_FREQ_SCALE)) / SNTPc_CLK_FREQ_SCALE) +
+                  (((rem_ns / 1000) * p_clk->Freq) / ((CPU_INT64S)SNTPc_CLK_US_NBR_PER_SEC * SNTPc_CLK_FREQ_SCALE));
+                                                                /* See Notes #1b & #2.                                  */
+    slew_max_ns = (elapsed_sec *  SNTPc_CFG_CLK_SLEW_MAX_PPM * 1000) +
+                 ((rem_ns      *  SNTPc_CFG_CLK_SLEW_MAX_PPM)        / SNTPc_CLK_US_NBR_PER_SEC);
+    slew_ns     = DEF_MIN(p_clk->PhaseRem_ns,  slew_max_ns);
+    slew_ns     = DEF_MAX(slew_ns,            -slew_max_ns);
+
+    p_clk->BaseLocal    = ts_local;
+    p_clk->BaseTime    += (SNTP_FIXED_TS)SNTPc_NsToFixed(elapsed_ns + freq_ns + slew_ns);
+    p_clk->PhaseRem_ns -= slew_ns;
+
+    return (p_clk->BaseTime);
+}
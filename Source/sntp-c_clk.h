@@ -0,0 +1,94 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT CLOCK DISCIPLINE
+*
+* Filename : sntp-c_clk.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc clock present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_CLK_PRESENT                                      /* See Note #1.                                         */
+#define  SNTPc_CLK_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_EXT_TS_EN == DEF_ENABLED)                        /* Resolution of SNTPc_ClkLocalGet().                   */
+#define  SNTPc_CLK_LOCAL_RES_NS             SNTPc_CFG_EXT_TS_RES_NS
+#else
+#define  SNTPc_CLK_LOCAL_RES_NS                     1000000u    /* Resolution of NetUtil_TS_Get_ms().                   */
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+void           SNTPc_ClkInit     (void);
+
+SNTP_FIXED_TS  SNTPc_ClkLocalGet (void);
+
+void           SNTPc_ClkRebase   (void);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc clock module include.                   */
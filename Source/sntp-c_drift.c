@@ -0,0 +1,526 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                               SNTP CLIENT FREQUENCY DRIFT ESTIMATION
+*
+* Filename : sntp-c_drift.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Estimates the frequency error of the local time base from the offsets measured by the last
+*                SNTPc_CFG_DRIFT_WIN_NBR polls of the background synchronization. The offsets are relative
+*                to the local time base itself (see SNTPc_ClkLocalGet()), not to the disciplined clock, so
+*                that they lie on a line whose slope is the frequency error.
+*
+*            (2) The line is fitted by least squares. The time is then predicted between the polls, or when
+*                the server is unreachable, by extrapolating the line from the last poll.
+*
+*            (3) All the computations use integer arithmetic. The local times of the fit are in 1/16 s &
+*                the offsets in microseconds, relative to the last poll, so that the sums of products cannot
+*                overflow with a window of 32 polls at the largest poll interval.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_drift.h"
+#include  "sntp-c_clk.h"
+#include  "sntp-c_fixed.h"
+#include  "sntp-c_sel.h"
+
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_DRIFT_POLL_NBR_MIN                          3u   /* Min nbr of polls to fit a line & its residuals.      */
+
+#define  SNTPc_DRIFT_X_SHIFT                              28u   /* Shift of a 32.32 duration to 1/16 s.                 */
+#define  SNTPc_DRIFT_X_US                              62500    /* Nbr of us in 1/16 s.                                 */
+#define  SNTPc_DRIFT_PPB_PER_SLOPE                     16000    /* Nbr of ppb in 1 us per 1/16 s.                       */
+
+#define  SNTPc_DRIFT_VAR_MAX            ((CPU_INT64S)1 << 40)   /* Max variance  before scaling down.                   */
+#define  SNTPc_DRIFT_COV_MAX            ((CPU_INT64S)1 << 44)   /* Max covariance before scaling down.                  */
+
+#define  SNTPc_DRIFT_FREQ_MAX_PPB                     500000    /* Max freq error (500 ppm).                            */
+
+#define  SNTPc_DRIFT_US_NBR_PER_SEC                  1000000    /* Nbr of us in a second.                               */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        DRIFT POINT DATA TYPE
+*
+* Note(s) : (1) The points are accessed only with the module lock acquired.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_drift_point {
+    SNTP_FIXED_TS  LocalTS;                                     /* Local time of the poll.                              */
+    CPU_INT64S     Offset_us;                                   /* Offset of the server clock from the local time base. */
+    CPU_INT32U     Dly_us;                                      /* Round trip delay of the poll.                        */
+} SNTPc_DRIFT_POINT;
+
+
+/*
+*********************************************************************************************************
+*                                        DRIFT MODEL DATA TYPE
+*
+* Note(s) : (1) The model is protected by critical sections, so that the predicted time can be read from any
+*               task without the module lock.
+*
+*           (2) The mean local time of the polls is kept as its age relative to the last poll.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_drift_model {
+    CPU_BOOLEAN    IsValid;
+    SNTP_FIXED_TS  RefLocal;                                    /* Local time of the last poll.                         */
+    CPU_INT64S     RefOffset_us;                                /* Offset on the fitted line at the last poll.          */
+    CPU_INT64S     MeanAge_us;                                  /* See Note #2.                                         */
+    CPU_INT32S     Freq_ppb;                                    /* Freq error, slope of the fitted line.                */
+    CPU_INT32U     FreqErr_ppb;                                 /* Standard error of the freq error.                    */
+    CPU_INT32U     Resid_us;                                    /* RMS of the residuals of the fit.                     */
+    CPU_INT32U     Dly_us;                                      /* Half round trip delay of the last poll.              */
+    CPU_INT08U     PollNbr;
+} SNTPc_DRIFT_MODEL;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  SNTPc_DRIFT_POINT  SNTPc_DriftPointTbl[SNTPc_CFG_DRIFT_WIN_NBR];
+
+static  CPU_INT08U         SNTPc_DriftPointIxNext;              /* Ix of the point replaced by the next poll.           */
+
+static  CPU_INT08U         SNTPc_DriftPointNbr;
+
+static  SNTPc_DRIFT_MODEL  SNTPc_DriftModel;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT64S  SNTPc_DriftFreqApply (CPU_INT64S  freq_ppb,
+                                          CPU_INT64S  elapsed_us);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_DriftInit()
+*
+* Description : Remove all the polls & the estimated frequency error.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init(),
+*               SNTPc_SyncStart().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller, except from SNTPc_Init().
+*********************************************************************************************************
+*/
+
+void  SNTPc_DriftInit (void)
+{
+    CPU_SR_ALLOC();
+
+
+    Mem_Clr(&SNTPc_DriftPointTbl, sizeof(SNTPc_DriftPointTbl));
+    SNTPc_DriftPointIxNext = 0u;
+    SNTPc_DriftPointNbr    = 0u;
+
+    CPU_CRITICAL_ENTER();
+    Mem_Clr(&SNTPc_DriftModel, sizeof(SNTPc_DriftModel));
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_DriftAdd()
+*
+* Description : Add the offset measured by a poll & estimate the frequency error again.
+*
+* Argument(s) : ts_local    Local time at which the offset was measured.
+*
+*               offset_us   Offset of the server clock from the local time base, in microseconds.
+*
+*               dly_us      Round trip delay of the poll, in microseconds.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_SyncProcess().
+*
+* Note(s)     : (1) The module lock MUST be acquired by the caller.
+*
+*               (2) The slope of the least squares line is cov(x, y) / var(x). Both are averaged over the
+*                   polls & scaled down by the same power of 2 until the slope can be computed in 64 bits.
+*                   The slope is limited to +/- 500 ppm, as the frequency correction of the clock.
+*
+*               (3) The residuals are the differences between the offsets & the fitted line. Their mean
+*                   square is computed over n - 2 degrees of freedom & the standard error of the slope is
+*                   sqrt(mean_sq / sum((x - mean_x)^2)).
+*********************************************************************************************************
+*/
+
+void  SNTPc_DriftAdd (SNTP_FIXED_TS  ts_local,
+                      CPU_INT64S     offset_us,
+                      CPU_INT32U     dly_us)
+{
+    SNTPc_DRIFT_POINT  *p_point;
+    SNTPc_DRIFT_POINT  *p_point_ref;
+    SNTPc_DRIFT_MODEL   model;
+    CPU_INT64S          x_tbl[SNTPc_CFG_DRIFT_WIN_NBR];
+    CPU_INT64S          y_tbl[SNTPc_CFG_DRIFT_WIN_NBR];
+    CPU_INT64S          x_sum;
+    CPU_INT64S          y_sum;
+    CPU_INT64S          x_mean;
+    CPU_INT64S          y_mean;
+    CPU_INT64S          dx;
+    CPU_INT64S          var;
+    CPU_INT64S          cov;
+    CPU_INT64S          y_fit;
+    CPU_INT64S          freq_ppb;
+    CPU_INT64U          sum_sq;
+    CPU_INT64U          freq_err_ppb;
+    CPU_INT32U          var_sqrt;
+    CPU_INT08U          nbr;
+    CPU_INT08U          ix;
+    CPU_SR_ALLOC();
+
+                                                                /* -------------------- ADD POLL ---------------------- */
+    p_point_ref            = &SNTPc_DriftPointTbl[SNTPc_DriftPointIxNext];
+    p_point_ref->LocalTS   =  ts_local;
+    p_point_ref->Offset_us =  offset_us;
+    p_point_ref->Dly_us    =  dly_us;
+
+    SNTPc_DriftPointIxNext = (SNTPc_DriftPointIxNext + 1u) % SNTPc_CFG_DRIFT_WIN_NBR;
+    if (SNTPc_DriftPointNbr < SNTPc_CFG_DRIFT_WIN_NBR) {
+        SNTPc_DriftPointNbr++;
+    }
+    nbr = SNTPc_DriftPointNbr;
+
+    Mem_Clr(&model, sizeof(model));
+    model.PollNbr = nbr;
+    if (nbr < SNTPc_DRIFT_POLL_NBR_MIN) {
+        goto exit;
+    }
+                                                                /* ------------ MEANS, RELATIVE TO LAST POLL ---------- */
+    x_sum = 0;
+    y_sum = 0;
+    for (ix = 0u; ix < nbr; ix++) {
+        p_point   = &SNTPc_DriftPointTbl[ix];
+        x_tbl[ix] = (SNTP_FIXED)(p_point->LocalTS - p_point_ref->LocalTS) >> SNTPc_DRIFT_X_SHIFT;
+        y_tbl[ix] =  p_point->Offset_us - p_point_ref->Offset_us;
+        y_tbl[ix] =  DEF_MIN(y_tbl[ix],  (CPU_INT64S)DEF_INT_32S_MAX_VAL);
+        y_tbl[ix] =  DEF_MAX(y_tbl[ix], -(CPU_INT64S)DEF_INT_32S_MAX_VAL);
+        x_sum    += x_tbl[ix];
+        y_sum    += y_tbl[ix];
+    }
+    x_mean = x_sum / (CPU_INT64S)nbr;
+    y_mean = y_sum / (CPU_INT64S)nbr;
+                                                                /* ------------------ FIT THE LINE -------------------- */
+    var = 0;
+    cov = 0;
+    for (ix = 0u; ix < nbr; ix++) {
+        dx   = x_tbl[ix] - x_mean;
+        var += (dx * dx)                   / (CPU_INT64S)nbr;
+        cov += (dx * (y_tbl[ix] - y_mean)) / (CPU_INT64S)nbr;
+    }
+    var_sqrt = SNTPc_SelSqrt((CPU_INT64U)var * nbr);
+
+    while ((var >  SNTPc_DRIFT_VAR_MAX) ||                      /* See Note #2.                                         */
+           (cov >  SNTPc_DRIFT_COV_MAX) ||
+           (cov < -SNTPc_DRIFT_COV_MAX)) {
+        var /= 2;
+        cov /= 2;
+    }
+    if (var == 0) {                                             /* All the polls at the same time.                      */
+        goto exit;
+    }
+
+    freq_ppb = (cov * SNTPc_DRIFT_PPB_PER_SLOPE) / var;
+    freq_ppb = DEF_MIN(freq_ppb,  SNTPc_DRIFT_FREQ_MAX_PPB);
+    freq_ppb = DEF_MAX(freq_ppb, -SNTPc_DRIFT_FREQ_MAX_PPB);
+                                                                /* -------------------- RESIDUALS --------------------- */
+    sum_sq = 0u;                                                /* See Note #3.                                         */
+    for (ix = 0u; ix < nbr; ix++) {
+        y_fit   = y_mean + ((freq_ppb * (x_tbl[ix] - x_mean)) / SNTPc_DRIFT_PPB_PER_SLOPE);
+        sum_sq += SNTPc_SelDeltaSqGet(y_tbl[ix], y_fit) / (nbr - 2u);
+    }
+
+    model.Resid_us     = SNTPc_SelSqrt(sum_sq);
+    freq_err_ppb       = ((CPU_INT64U)model.Resid_us * SNTPc_DRIFT_PPB_PER_SLOPE) / DEF_MAX(var_sqrt, 1u);
+    model.FreqErr_ppb  = (CPU_INT32U)DEF_MIN(freq_err_ppb, DEF_INT_32U_MAX_VAL);
+    model.Freq_ppb     = (CPU_INT32S)freq_ppb;
+    model.RefLocal     = p_point_ref->LocalTS;
+    model.RefOffset_us = p_point_ref->Offset_us + y_mean - ((freq_ppb * x_mean) / SNTPc_DRIFT_PPB_PER_SLOPE);
+    model.MeanAge_us   = -x_mean * SNTPc_DRIFT_X_US;
+    model.Dly_us       = p_point_ref->Dly_us / 2u;
+    model.IsValid      = DEF_YES;
+
+exit:
+    CPU_CRITICAL_ENTER();
+    SNTPc_DriftModel = model;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_DriftTimeGet()
+*
+* Description : Get the current time predicted from the last poll & the estimated frequency error.
+*
+* Argument(s) : p_bound_us  Pointer to variable that will receive the error bound of the predicted time, in
+*                           microseconds (see Note #2). DEF_NULL if not needed.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE              Time successfully predicted.
+*                               SNTPc_ERR_DRIFT_NOT_READY   Not enough polls to estimate the frequency error.
+*
+* Return(s)   : Predicted time (NTP timestamp), if NO error(s).
+*
+*               Null timestamp,                 otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The time is extrapolated from the fitted line at the last poll, with the estimated
+*                   frequency error. It does not need the server to be reachable & does not access the
+*                   network. The module lock is not acquired, so this function can be called from any task.
+*
+*               (2) The error bound is the sum of :
+*
+*                   (a) The RMS of the residuals of the fit & half the round trip delay of the last poll.
+*
+*                   (b) The standard error of the frequency error, over the time elapsed since the mean
+*                       time of the polls.
+*
+*                   (c) SNTPc_CFG_DRIFT_WANDER_PPB, over the time elapsed since the last poll.
+*
+*                   It thus grows with the holdover time, at a rate that is lower when the frequency error
+*                   was estimated over more polls & when the local time base is more stable. The bound is
+*                   an estimate & is not guaranteed.
+*
+*               (3) The predicted time is independent from the disciplined clock (see SNTPc_ClkGet()). It is
+*                   not slewed & jumps slightly at each poll, when the line is fitted again.
+*********************************************************************************************************
+*/
+
+SNTP_TS  SNTPc_DriftTimeGet (CPU_INT32U  *p_bound_us,
+                             SNTPc_ERR   *p_err)
+{
+    SNTPc_DRIFT_MODEL  model;
+    SNTP_FIXED_TS      ts_local;
+    SNTP_FIXED_TS      time;
+    SNTP_TS            ts;
+    CPU_INT64S         elapsed_us;
+    CPU_INT64S         offset_us;
+    CPU_INT64S         bound_us;
+    CPU_SR_ALLOC();
+
+
+    ts.Sec  = 0u;
+    ts.Frac = 0u;
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(ts);
+    }
+#endif
+
+    ts_local = SNTPc_ClkLocalGet();
+    CPU_CRITICAL_ENTER();
+    model    = SNTPc_DriftModel;
+    CPU_CRITICAL_EXIT();
+
+    if (model.IsValid == DEF_NO) {
+       *p_err = SNTPc_ERR_DRIFT_NOT_READY;
+        return (ts);
+    }
+
+    elapsed_us = SNTPc_FixedToUs((SNTP_FIXED)(ts_local - model.RefLocal));
+    elapsed_us = DEF_MAX(elapsed_us, 0);
+                                                                /* See Note #1.                                         */
+    offset_us  = model.RefOffset_us + SNTPc_DriftFreqApply(model.Freq_ppb, elapsed_us);
+    time       = ts_local + (SNTP_FIXED_TS)SNTPc_UsToFixed(offset_us);
+
+    if (p_bound_us != DEF_NULL) {                               /* See Note #2.                                         */
+        bound_us    = (CPU_INT64S)model.Resid_us + model.Dly_us;
+        bound_us   += SNTPc_DriftFreqApply(model.FreqErr_ppb, elapsed_us + model.MeanAge_us);
+        bound_us   += SNTPc_DriftFreqApply(SNTPc_CFG_DRIFT_WANDER_PPB, elapsed_us);
+       *p_bound_us  = (CPU_INT32U)DEF_MIN(bound_us, (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+    }
+
+    ts.Sec  = (CPU_INT32U)(time >> 32u);
+    ts.Frac = (CPU_INT32U)(time & DEF_INT_32U_MAX_VAL);
+
+   *p_err = SNTPc_ERR_NONE;
+
+    return (ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_DriftStatusGet()
+*
+* Description : Get the status of the frequency drift estimation.
+*
+* Argument(s) : p_status    Pointer to a variable that will receive the drift status.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE              Status successfully returned.
+*                               SNTPc_ERR_NULL_PTR          Invalid pointer.
+*                               SNTPc_ERR_DRIFT_NOT_READY   Not enough polls to estimate the frequency error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) On SNTPc_ERR_DRIFT_NOT_READY, only the number of polls is returned in the status.
+*********************************************************************************************************
+*/
+
+void  SNTPc_DriftStatusGet (SNTPc_DRIFT_STATUS  *p_status,
+                            SNTPc_ERR           *p_err)
+{
+    SNTPc_DRIFT_MODEL  model;
+    SNTP_FIXED_TS      ts_local;
+    CPU_INT64S         elapsed_us;
+    CPU_SR_ALLOC();
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_status == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    ts_local = SNTPc_ClkLocalGet();
+    CPU_CRITICAL_ENTER();
+    model    = SNTPc_DriftModel;
+    CPU_CRITICAL_EXIT();
+
+    Mem_Clr(p_status, sizeof(SNTPc_DRIFT_STATUS));
+    p_status->PollNbr = model.PollNbr;
+
+    if (model.IsValid == DEF_NO) {                              /* See Note #1.                                         */
+       *p_err = SNTPc_ERR_DRIFT_NOT_READY;
+        return;
+    }
+
+    elapsed_us = SNTPc_FixedToUs((SNTP_FIXED)(ts_local - model.RefLocal));
+    elapsed_us = DEF_MAX(elapsed_us, 0);
+
+    p_status->Freq_ppb     = model.Freq_ppb;
+    p_status->FreqErr_ppb  = model.FreqErr_ppb;
+    p_status->Resid_us     = model.Resid_us;
+    p_status->Holdover_sec = (CPU_INT32U)DEF_MIN(elapsed_us / SNTPc_DRIFT_US_NBR_PER_SEC,
+                                                 (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_DriftFreqApply()
+*
+* Description : Compute the time accumulated by a frequency error over a duration.
+*
+* Argument(s) : freq_ppb    Frequency error, in parts per billion.
+*
+*               elapsed_us  Duration, in microseconds.
+*
+* Return(s)   : Accumulated time, in microseconds.
+*
+* Caller(s)   : SNTPc_DriftTimeGet().
+*
+* Note(s)     : (1) The duration is split in seconds & microseconds to avoid overflows, as in
+*                   SNTPc_ClkTimeCalc(). A frequency error in ppb accumulates 1 ns per second.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64S  SNTPc_DriftFreqApply (CPU_INT64S  freq_ppb,
+                                          CPU_INT64S  elapsed_us)
+{
+    CPU_INT64S  acc_ns;
+
+                                                                /* See Note #1.                                         */
+    acc_ns = ((elapsed_us / SNTPc_DRIFT_US_NBR_PER_SEC) *  freq_ppb) +
+             (((elapsed_us % SNTPc_DRIFT_US_NBR_PER_SEC) * freq_ppb) / SNTPc_DRIFT_US_NBR_PER_SEC);
+
+    return (acc_ns / 1000);
+}
+#endif
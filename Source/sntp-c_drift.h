@@ -0,0 +1,81 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                               SNTP CLIENT FREQUENCY DRIFT ESTIMATION
+*
+* Filename : sntp-c_drift.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc drift present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_DRIFT_PRESENT                                    /* See Note #1.                                         */
+#define  SNTPc_DRIFT_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_TASK_EN == DEF_ENABLED)
+void  SNTPc_DriftInit (void);
+
+void  SNTPc_DriftAdd  (SNTP_FIXED_TS  ts_local,
+                       CPU_INT64S     offset_us,
+                       CPU_INT32U     dly_us);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc drift module include.                   */
@@ -0,0 +1,233 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      SNTP CLIENT CLOCK FILTER
+*
+* Filename : sntp-c_filter.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Implements the clock filter algorithm of RFC #5905, Section 10, over the last eight samples
+*                of a server.
+*
+*            (2) All the computations use integer arithmetic on offsets in microseconds. The filter state is
+*                kept in the filter structure provided by the caller; no memory is allocated.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_filter.h"
+#include  "sntp-c_fixed.h"
+#include  "sntp-c_sel.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_FilterInit()
+*
+* Description : Initialize a clock filter with no sample.
+*
+* Argument(s) : p_filter    Pointer to the clock filter.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_FilterSampleAdd().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_FilterInit (SNTPc_FILTER  *p_filter)
+{
+    p_filter->StageIxNext = 0u;
+    p_filter->StageNbr    = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_FilterAdd()
+*
+* Description : Shift a new sample into a clock filter.
+*
+* Argument(s) : p_filter    Pointer to the clock filter.
+*
+*               offset_us   Offset of the server clock from the local clock, in microseconds.
+*
+*               dly_us      Round trip delay, in microseconds.
+*
+*               disp_us     Dispersion of the sample when it was received, in microseconds (see Note #1).
+*
+*               epoch       Local time at which the sample was received.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_FilterSampleAdd().
+*
+* Note(s)     : (1) The dispersion of a new sample is the sum of the precisions of the server & local clocks
+*                   & of the frequency tolerance over the round trip delay (see RFC #5905, Section 8).
+*
+*               (2) The sample replaces the oldest one once the eight stages are used.
+*********************************************************************************************************
+*/
+
+void  SNTPc_FilterAdd (SNTPc_FILTER   *p_filter,
+                       CPU_INT64S      offset_us,
+                       CPU_INT32U      dly_us,
+                       CPU_INT32U      disp_us,
+                       SNTP_FIXED_TS   epoch)
+{
+    SNTPc_FILTER_STAGE  *p_stage;
+
+
+    p_stage            = &p_filter->StageTbl[p_filter->StageIxNext];
+    p_stage->Offset_us =  offset_us;
+    p_stage->Dly_us    =  dly_us;
+    p_stage->Disp_us   =  DEF_MIN(disp_us, SNTPc_FILTER_MAX_DISP_US);
+    p_stage->Epoch     =  epoch;
+                                                                /* See Note #2.                                         */
+    p_filter->StageIxNext = (p_filter->StageIxNext + 1u) % SNTPc_FILTER_STAGE_NBR;
+    if (p_filter->StageNbr < SNTPc_FILTER_STAGE_NBR) {
+        p_filter->StageNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_FilterEval()
+*
+* Description : Select the best sample of a clock filter & compute the filter dispersion & jitter.
+*
+* Argument(s) : p_filter    Pointer to the clock filter.
+*
+*               ts_cur      Current local time, used to age the samples.
+*
+*               p_status    Pointer to the variable that will receive the filter status.
+*
+* Return(s)   : DEF_OK,   if a sample was selected.
+*
+*               DEF_FAIL, if the filter holds no usable sample.
+*
+* Caller(s)   : SNTPc_FilterStatusGet().
+*
+* Note(s)     : (1) The dispersion of each sample grows by PHI, the frequency tolerance of the local clock, for
+*                   each second elapsed since it was received. A sample whose dispersion reaches MAXDISP is
+*                   too old to be used.
+*
+*               (2) The samples are sorted by increasing round trip delay & the first one is selected, as
+*                   it suffered the least queuing delay.
+*
+*               (3) The filter dispersion is the sum of the dispersions of the sorted samples, weighted by
+*                   1/2, 1/4, 1/8, ... The stages that hold no usable sample count as MAXDISP.
+*
+*               (4) The jitter is the root mean square of the differences between the offsets of the usable
+*                   samples & the offset of the selected sample. The mean is computed over all the samples
+*                   but the selected one. Each squared difference is divided before the sum so that the
+*                   sum cannot overflow.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_FilterEval (const SNTPc_FILTER         *p_filter,
+                                     SNTP_FIXED_TS         ts_cur,
+                                     SNTPc_FILTER_STATUS  *p_status)
+{
+    const SNTPc_FILTER_STAGE  *p_stage;
+    const SNTPc_FILTER_STAGE  *p_stage_sel;
+          CPU_INT64S           age_us;
+          CPU_INT64S           age_sel_us;
+          CPU_INT64U           disp_us;
+          CPU_INT64U           disp_sum_us;
+          CPU_INT64U           sum_sq;
+          CPU_INT32U           disp_tbl[SNTPc_FILTER_STAGE_NBR];
+          CPU_INT08U           ord_tbl[SNTPc_FILTER_STAGE_NBR];
+          CPU_INT08U           valid_nbr;
+          CPU_INT08U           pos;
+          CPU_INT08U           ix;
+
+
+    valid_nbr  = 0u;
+    age_sel_us = 0;
+    for (ix = 0u; ix < p_filter->StageNbr; ix++) {
+        p_stage = &p_filter->StageTbl[ix];
+                                                                /* Age the dispersion (see Note #1).                    */
+        age_us  = SNTPc_FixedToUs((SNTP_FIXED)(ts_cur - p_stage->Epoch));
+        age_us  = DEF_MAX(age_us, 0);
+        disp_us = p_stage->Disp_us + (((CPU_INT64U)age_us * SNTPc_FILTER_PHI_PPM) / DEF_TIME_NBR_uS_PER_SEC);
+        disp_us = DEF_MIN(disp_us, SNTPc_FILTER_MAX_DISP_US);
+        disp_tbl[ix] = (CPU_INT32U)disp_us;
+        if (disp_us >= SNTPc_FILTER_MAX_DISP_US) {
+            continue;
+        }
+                                                                /* Insert the stage in the sorted list (see Note #2).   */
+        pos = valid_nbr;
+        while ((pos > 0u) &&
+               (p_filter->StageTbl[ord_tbl[pos - 1u]].Dly_us > p_stage->Dly_us)) {
+            ord_tbl[pos] = ord_tbl[pos - 1u];
+            pos--;
+        }
+        ord_tbl[pos] = ix;
+        if (pos == 0u) {
+            age_sel_us = age_us;
+        }
+        valid_nbr++;
+    }
+
+    if (valid_nbr == 0u) {
+        return (DEF_FAIL);
+    }
+
+    p_stage_sel = &p_filter->StageTbl[ord_tbl[0]];
+                                                                /* Compute the filter dispersion (see Note #3).         */
+    disp_sum_us = 0u;
+    for (pos = 0u; pos < SNTPc_FILTER_STAGE_NBR; pos++) {
+        disp_us      = (pos < valid_nbr) ? disp_tbl[ord_tbl[pos]] : SNTPc_FILTER_MAX_DISP_US;
+        disp_sum_us += disp_us >> (pos + 1u);
+    }
+                                                                /* Compute the filter jitter (see Note #4).             */
+    sum_sq = 0u;
+    for (pos = 1u; pos < valid_nbr; pos++) {
+        p_stage = &p_filter->StageTbl[ord_tbl[pos]];
+        sum_sq += SNTPc_SelDeltaSqGet(p_stage->Offset_us, p_stage_sel->Offset_us) / (valid_nbr - 1u);
+    }
+
+    p_status->Offset_us       = p_stage_sel->Offset_us;
+    p_status->RoundTripDly_us = p_stage_sel->Dly_us;
+    p_status->Age_ms          = (CPU_INT32U)DEF_MIN(age_sel_us / 1000, (CPU_INT64S)DEF_INT_32U_MAX_VAL);
+    p_status->Disp_us         = (CPU_INT32U)disp_sum_us;
+    p_status->Jitter_us       = SNTPc_SelSqrt(sum_sq);
+    p_status->SampleNbr       = valid_nbr;
+
+    return (DEF_OK);
+}
@@ -0,0 +1,133 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      SNTP CLIENT CLOCK FILTER
+*
+* Filename : sntp-c_filter.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc clock filter present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_FILTER_PRESENT                                   /* See Note #1.                                         */
+#define  SNTPc_FILTER_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_FILTER_STAGE_NBR                            8u   /* Nbr of stages of the filter (see RFC #5905).         */
+
+#define  SNTPc_FILTER_MAX_DISP_US                   16000000u   /* Max dispersion  (see RFC #5905, Section 7.2).        */
+#define  SNTPc_FILTER_PHI_PPM                             15u   /* Freq tolerance  (see RFC #5905, Section 7.2).        */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       CLOCK FILTER DATA TYPE
+*
+* Note(s) : (1) The stages form a shift register, kept as a ring : each new sample replaces the oldest one.
+*
+*           (2) The dispersion of a stage is the one of the sample when it was received. It is aged by
+*               SNTPc_FilterEval().
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_filter_stage {
+    CPU_INT64S     Offset_us;                                   /* Offset of the server clock from the local clock.     */
+    CPU_INT32U     Dly_us;                                      /* Round trip delay.                                    */
+    CPU_INT32U     Disp_us;                                     /* Dispersion at the epoch (see Note #2).               */
+    SNTP_FIXED_TS  Epoch;                                       /* Local time at which the sample was received.         */
+} SNTPc_FILTER_STAGE;
+
+
+typedef struct sntpc_filter {
+    SNTPc_FILTER_STAGE  StageTbl[SNTPc_FILTER_STAGE_NBR];       /* See Note #1.                                         */
+    CPU_INT08U          StageIxNext;                            /* Ix of the stage replaced by the next sample.         */
+    CPU_INT08U          StageNbr;                               /* Nbr of stages holding a sample.                      */
+} SNTPc_FILTER;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+void         SNTPc_FilterInit (      SNTPc_FILTER         *p_filter);
+
+void         SNTPc_FilterAdd  (      SNTPc_FILTER         *p_filter,
+                                     CPU_INT64S            offset_us,
+                                     CPU_INT32U            dly_us,
+                                     CPU_INT32U            disp_us,
+                                     SNTP_FIXED_TS         epoch);
+
+CPU_BOOLEAN  SNTPc_FilterEval (const SNTPc_FILTER         *p_filter,
+                                     SNTP_FIXED_TS         ts_cur,
+                                     SNTPc_FILTER_STATUS  *p_status);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc clock filter module include.            */
@@ -0,0 +1,330 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  SNTP CLIENT FIXED-POINT ARITHMETIC
+*
+* Filename : sntp-c_fixed.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Timestamps & durations are handled in 32.32 fixed point, i.e. the format of the NTP
+*                timestamps, so that the offset & delay computations are exact & use no floating point.
+*
+*            (2) Timestamps are unsigned & wrap around every 2^32 seconds. Differences between timestamps
+*                are computed modulo 2^64 & interpreted as signed durations, which is exact as long as the
+*                timestamps are less than 2^31 seconds apart (see RFC #5905, Section 6).
+*
+*            (3) Conversions to & from microseconds & nanoseconds split the integer & fractional parts, so
+*                that no intermediate product overflows 64 bits.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_fixed.h"
+#include  <Source/net_util.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_FIXED_NS_NBR_PER_SEC             1000000000u     /* Nbr of ns in a second.                               */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_TS_ToFixed()
+*
+* Description : Convert an NTP timestamp, in network order, to 32.32 fixed point.
+*
+* Argument(s) : p_ts    Pointer to the NTP timestamp.
+*
+* Return(s)   : Timestamp in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_PktDecode().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED_TS  SNTPc_TS_ToFixed (const SNTP_TS  *p_ts)
+{
+    SNTP_FIXED_TS  ts;
+
+
+    ts = ((SNTP_FIXED_TS)NET_UTIL_NET_TO_HOST_32(p_ts->Sec) << 32u) |
+          (SNTP_FIXED_TS)NET_UTIL_NET_TO_HOST_32(p_ts->Frac);
+
+    return (ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_FixedToTS()
+*
+* Description : Convert a 32.32 fixed-point timestamp to an NTP timestamp, in host order.
+*
+* Argument(s) : ts      Timestamp in 32.32 fixed point.
+*
+* Return(s)   : NTP timestamp, in host order.
+*
+* Caller(s)   : SNTPc_LocalTimeOffsetGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+SNTP_TS  SNTPc_FixedToTS (SNTP_FIXED_TS  ts)
+{
+    SNTP_TS  ntp_ts;
+
+
+    ntp_ts.Sec  = (CPU_INT32U)(ts >> 32u);
+    ntp_ts.Frac = (CPU_INT32U)(ts &  DEF_INT_32U_MAX_VAL);
+
+    return (ntp_ts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_FixedOffsetGet()
+*
+* Description : Compute the offset of the server clock from the local clock from the four timestamps of an
+*               exchange.
+*
+* Argument(s) : ts_originate    Local  time at which the request was sent     (T1).
+*
+*               ts_rx           Server time at which the request was received (T2).
+*
+*               ts_tx           Server time at which the reply was sent       (T3).
+*
+*               ts_terminate    Local  time at which the reply was received   (T4).
+*
+* Return(s)   : Offset, in signed 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_PktDecode().
+*
+* Note(s)     : (1) The offset is ((T2 - T1) + (T3 - T4)) / 2 (see RFC #5905, Section 8). Each difference is
+*                   halved before the sum so that the sum cannot overflow. The low bit dropped from both
+*                   differences is added back when both are odd, so that the offset is the exact half of the
+*                   sum, rounded toward minus infinity.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED  SNTPc_FixedOffsetGet (SNTP_FIXED_TS  ts_originate,
+                                  SNTP_FIXED_TS  ts_rx,
+                                  SNTP_FIXED_TS  ts_tx,
+                                  SNTP_FIXED_TS  ts_terminate)
+{
+    SNTP_FIXED  diff_rx;
+    SNTP_FIXED  diff_tx;
+    SNTP_FIXED  offset;
+
+
+    diff_rx = (SNTP_FIXED)(ts_rx - ts_originate);
+    diff_tx = (SNTP_FIXED)(ts_tx - ts_terminate);
+                                                                /* See Note #1.                                         */
+    offset  = (diff_rx >> 1u) + (diff_tx >> 1u) + (diff_rx & diff_tx & 1);
+
+    return (offset);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_FixedDlyGet()
+*
+* Description : Compute the round trip delay from the four timestamps of an exchange.
+*
+* Argument(s) : ts_originate    Local  time at which the request was sent     (T1).
+*
+*               ts_rx           Server time at which the request was received (T2).
+*
+*               ts_tx           Server time at which the reply was sent       (T3).
+*
+*               ts_terminate    Local  time at which the reply was received   (T4).
+*
+* Return(s)   : Round trip delay, in signed 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_PktDecode().
+*
+* Note(s)     : (1) The delay is (T4 - T1) - (T3 - T2) (see RFC #5905, Section 8). It can be slightly
+*                   negative when the local & server clocks have a coarser resolution than the delay.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED  SNTPc_FixedDlyGet (SNTP_FIXED_TS  ts_originate,
+                               SNTP_FIXED_TS  ts_rx,
+                               SNTP_FIXED_TS  ts_tx,
+                               SNTP_FIXED_TS  ts_terminate)
+{
+    SNTP_FIXED  dly;
+
+                                                                /* See Note #1.                                         */
+    dly = (SNTP_FIXED)(ts_terminate - ts_originate) -
+          (SNTP_FIXED)(ts_tx        - ts_rx);
+
+    return (dly);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_FixedToUs()
+*
+* Description : Convert a signed 32.32 fixed-point duration to microseconds.
+*
+* Argument(s) : val     Duration in 32.32 fixed point.
+*
+* Return(s)   : Duration in microseconds.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_FixedToUs (SNTP_FIXED  val)
+{
+    CPU_INT64U  mag;
+    CPU_INT64S  us;
+
+
+    mag = (val < 0) ? (CPU_INT64U)0u - (CPU_INT64U)val : (CPU_INT64U)val;
+    us  = (CPU_INT64S)(((mag >> 32u) * DEF_TIME_NBR_uS_PER_SEC) +
+                      (((mag & DEF_INT_32U_MAX_VAL) * DEF_TIME_NBR_uS_PER_SEC) >> 32u));
+
+    return ((val < 0) ? -us : us);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_UsToFixed()
+*
+* Description : Convert a signed duration in microseconds to 32.32 fixed point.
+*
+* Argument(s) : val_us  Duration in microseconds.
+*
+* Return(s)   : Duration in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_DriftTimeGet(),
+*               SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED  SNTPc_UsToFixed (CPU_INT64S  val_us)
+{
+    CPU_INT64U  mag;
+    CPU_INT64U  val;
+
+
+    mag = (val_us < 0) ? (CPU_INT64U)0u - (CPU_INT64U)val_us : (CPU_INT64U)val_us;
+    val = ((mag / DEF_TIME_NBR_uS_PER_SEC) << 32u) +
+         (((mag % DEF_TIME_NBR_uS_PER_SEC) << 32u) / DEF_TIME_NBR_uS_PER_SEC);
+
+    return ((val_us < 0) ? -(SNTP_FIXED)val : (SNTP_FIXED)val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_FixedToNs()
+*
+* Description : Convert a signed 32.32 fixed-point duration to nanoseconds.
+*
+* Argument(s) : val     Duration in 32.32 fixed point.
+*
+* Return(s)   : Duration in nanoseconds.
+*
+* Caller(s)   : SNTPc_ClkTimeCalc(),
+*               SNTPc_ClkUpdate(),
+*               SNTPc_PktDecode().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_FixedToNs (SNTP_FIXED  val)
+{
+    CPU_INT64U  mag;
+    CPU_INT64S  ns;
+
+
+    mag = (val < 0) ? (CPU_INT64U)0u - (CPU_INT64U)val : (CPU_INT64U)val;
+    ns  = (CPU_INT64S)(((mag >> 32u) * SNTPc_FIXED_NS_NBR_PER_SEC) +
+                      (((mag & DEF_INT_32U_MAX_VAL) * SNTPc_FIXED_NS_NBR_PER_SEC) >> 32u));
+
+    return ((val < 0) ? -ns : ns);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_NsToFixed()
+*
+* Description : Convert a signed duration in nanoseconds to 32.32 fixed point.
+*
+* Argument(s) : val_ns  Duration in nanoseconds.
+*
+* Return(s)   : Duration in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_ClkTimeCalc(),
+*               SNTPc_GetRemoteTime(),
+*               SNTPc_SyncProcess().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED  SNTPc_NsToFixed (CPU_INT64S  val_ns)
+{
+    CPU_INT64U  mag;
+    CPU_INT64U  val;
+
+
+    mag = (val_ns < 0) ? (CPU_INT64U)0u - (CPU_INT64U)val_ns : (CPU_INT64U)val_ns;
+    val = ((mag / SNTPc_FIXED_NS_NBR_PER_SEC) << 32u) +
+         (((mag % SNTPc_FIXED_NS_NBR_PER_SEC) << 32u) / SNTPc_FIXED_NS_NBR_PER_SEC);
+
+    return ((val_ns < 0) ? -(SNTP_FIXED)val : (SNTP_FIXED)val);
+}
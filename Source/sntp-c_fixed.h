@@ -0,0 +1,95 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT FIXED-POINT ARITHMETIC
+*
+* Filename : sntp-c_fixed.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc fixed-point present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_FIXED_PRESENT                                      /* See Note #1.                                         */
+#define  SNTPc_FIXED_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+SNTP_FIXED_TS  SNTPc_TS_ToFixed     (const SNTP_TS        *p_ts);
+
+SNTP_TS        SNTPc_FixedToTS      (      SNTP_FIXED_TS   ts);
+
+SNTP_FIXED     SNTPc_FixedOffsetGet (      SNTP_FIXED_TS   ts_originate,
+                                           SNTP_FIXED_TS   ts_rx,
+                                           SNTP_FIXED_TS   ts_tx,
+                                           SNTP_FIXED_TS   ts_terminate);
+
+SNTP_FIXED     SNTPc_FixedDlyGet    (      SNTP_FIXED_TS   ts_originate,
+                                           SNTP_FIXED_TS   ts_rx,
+                                           SNTP_FIXED_TS   ts_tx,
+                                           SNTP_FIXED_TS   ts_terminate);
+
+CPU_INT64S     SNTPc_FixedToUs      (      SNTP_FIXED      val);
+
+SNTP_FIXED     SNTPc_UsToFixed      (      CPU_INT64S      val_us);
+
+CPU_INT64S     SNTPc_FixedToNs      (      SNTP_FIXED      val);
+
+SNTP_FIXED     SNTPc_NsToFixed      (      CPU_INT64S      val_ns);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc fixed-point module include.             */
@@ -0,0 +1,675 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT NETWORK TIME SECURITY (NTS)
+*
+* Filename : sntp-c_nts.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Encodes & decodes the records of the NTS key establishment & the NTS extension fields of
+*                the NTP packets, as specified by RFC #8915. The TLS session & the AEAD algorithm are
+*                provided by the product's BSP (see 'sntp-c.h  FUNCTION PROTOTYPES DEFINED IN PRODUCT'S BSP
+*                Note #3').
+*
+*            (2) All the fields are in network order & may not be aligned in the buffers, so they are read &
+*                written one octet at a time.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_nts.h"
+#include  <lib_mem.h>
+#include  <lib_str.h>
+
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_NTS_KE_REC_HDR_LEN                          4u   /* Len of a NTS-KE record hdr (type & body len).        */
+#define  SNTPc_NTS_KE_REC_CRITICAL                    0x8000u   /* Critical bit of the record type.                     */
+
+#define  SNTPc_NTS_KE_REC_END                              0u   /* End of Message.                                      */
+#define  SNTPc_NTS_KE_REC_NEXT_PROTO                       1u   /* NTS Next Protocol Negotiation.                       */
+#define  SNTPc_NTS_KE_REC_ERR                              2u   /* Error.                                               */
+#define  SNTPc_NTS_KE_REC_WARN                             3u   /* Warning.                                             */
+#define  SNTPc_NTS_KE_REC_AEAD                             4u   /* AEAD Algorithm Negotiation.                          */
+#define  SNTPc_NTS_KE_REC_COOKIE                           5u   /* New Cookie for NTPv4.                                */
+#define  SNTPc_NTS_KE_REC_SERVER                           6u   /* NTPv4 Server Negotiation.                            */
+#define  SNTPc_NTS_KE_REC_PORT                             7u   /* NTPv4 Port Negotiation.                              */
+
+#define  SNTPc_NTS_KE_PROTO_NTPv4                          0u   /* Protocol ID of NTPv4.                                */
+#define  SNTPc_NTS_AEAD_AES_SIV_CMAC_256                  15u   /* AEAD ID of AEAD_AES_SIV_CMAC_256.                    */
+
+#define  SNTPc_NTS_EF_TYPE_UID                        0x0104u   /* Unique Identifier.                                   */
+#define  SNTPc_NTS_EF_TYPE_COOKIE                     0x0204u   /* NTS Cookie.                                          */
+#define  SNTPc_NTS_EF_TYPE_PLACEHOLDER                0x0304u   /* NTS Cookie Placeholder.                              */
+#define  SNTPc_NTS_EF_TYPE_AUTH                       0x0404u   /* NTS Authenticator & Encrypted Extension Fields.      */
+
+#define  SNTPc_NTS_ALIGN_4(len)                  (((len) + 3u) & ~3u)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  SNTPc_NTS_RecWr (      CPU_INT08U  *p_buf,
+                                           CPU_INT16U   type,
+                                           CPU_INT16U   val);
+
+static  CPU_INT16U  SNTPc_NTS_EF_Wr (      CPU_INT08U  *p_buf,
+                                           CPU_INT16U   type,
+                                     const CPU_INT08U  *p_body,
+                                           CPU_INT16U   body_len);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_NTS_KE_ReqBuild()
+*
+* Description : Build the records of a NTS key establishment request.
+*
+* Argument(s) : p_buf       Pointer to a buffer of at least SNTPc_NTS_KE_REQ_LEN octets.
+*
+* Return(s)   : Length of the request, in octets.
+*
+* Caller(s)   : SNTPc_NTS_KE().
+*
+* Note(s)     : (1) The request offers NTPv4 & AEAD_AES_SIV_CMAC_256 only, & does not ask for a specific
+*                   NTP server or port (see RFC #8915, Section 4).
+*********************************************************************************************************
+*/
+
+CPU_INT16U  SNTPc_NTS_KE_ReqBuild (CPU_INT08U  *p_buf)
+{
+    CPU_INT16U  len;
+
+                                                                /* See Note #1.                                         */
+    len  = SNTPc_NTS_RecWr(&p_buf[0u],
+                            SNTPc_NTS_KE_REC_NEXT_PROTO | SNTPc_NTS_KE_REC_CRITICAL,
+                            SNTPc_NTS_KE_PROTO_NTPv4);
+    len += SNTPc_NTS_RecWr(&p_buf[len],
+                            SNTPc_NTS_KE_REC_AEAD,
+                            SNTPc_NTS_AEAD_AES_SIV_CMAC_256);
+                                                                /* End of Message, without body.                        */
+    MEM_VAL_SET_INT16U_BIG(&p_buf[len],      SNTPc_NTS_KE_REC_END | SNTPc_NTS_KE_REC_CRITICAL);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[len + 2u], 0u);
+    len += SNTPc_NTS_KE_REC_HDR_LEN;
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      SNTPc_NTS_KE_RespParse()
+*
+* Description : Parse the records of a NTS key establishment response.
+*
+* Argument(s) : p_buf       Pointer to the response.
+*
+*               len         Length of the response, in octets.
+*
+*               p_assoc     Pointer to the association that will receive the negotiated NTP server, port &
+*                           cookies. The keys are not modified.
+*
+* Return(s)   : DEF_OK,   if NTPv4 & AEAD_AES_SIV_CMAC_256 were accepted & at least one cookie was received.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_KE().
+*
+* Note(s)     : (1) The response MUST end with an End of Message record. An Error record, or a critical record
+*                   of an unknown type, fails the key establishment (see RFC #8915, Section 4.1). Warnings &
+*                   non-critical records of an unknown type are ignored.
+*
+*               (2) Cookies longer than SNTPc_CFG_NTS_COOKIE_LEN_MAX & the cookies in excess of
+*                   SNTPc_CFG_NTS_COOKIE_NBR_MAX are discarded.
+*
+*               (3) A server hostname too long to be kept fails the key establishment, since the keys are
+*                   only valid for this server.
+*
+*               (4) The End of Message & NTS Next Protocol Negotiation records MUST have their critical bit
+*                   set (see RFC #8915, Sections 4.1.1 & 4.1.2).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_KE_RespParse (const CPU_INT08U       *p_buf,
+                                           CPU_INT16U        len,
+                                           SNTPc_NTS_ASSOC  *p_assoc)
+{
+    SNTPc_NTS_COOKIE  *p_cookie;
+    CPU_INT16U         type;
+    CPU_INT16U         body_len;
+    CPU_INT16U         ix;
+    CPU_BOOLEAN        is_proto;
+    CPU_BOOLEAN        is_aead;
+
+
+    p_assoc->ServerHostname[0] = ASCII_CHAR_NULL;
+    p_assoc->ServerPortNbr     = SNTPc_DFLT_IPPORT;
+    p_assoc->CookieNbr         = 0u;
+    is_proto                   = DEF_NO;
+    is_aead                    = DEF_NO;
+
+    ix = 0u;
+    while ((ix + SNTPc_NTS_KE_REC_HDR_LEN) <= len) {
+        type     = MEM_VAL_GET_INT16U_BIG(&p_buf[ix]);
+        body_len = MEM_VAL_GET_INT16U_BIG(&p_buf[ix + 2u]);
+        ix      += SNTPc_NTS_KE_REC_HDR_LEN;
+        if (body_len > (len - ix)) {
+            return (DEF_FAIL);
+        }
+
+        switch (type & ~SNTPc_NTS_KE_REC_CRITICAL) {
+            case SNTPc_NTS_KE_REC_END:                          /* See Notes #1 & #4.                                   */
+                 return ((((type & SNTPc_NTS_KE_REC_CRITICAL) != 0u     ) &&
+                          (is_proto                           == DEF_YES) &&
+                          (is_aead                            == DEF_YES) &&
+                          (p_assoc->CookieNbr                 >  0u     )) ? DEF_OK : DEF_FAIL);
+
+            case SNTPc_NTS_KE_REC_NEXT_PROTO:                   /* See Note #4.                                         */
+                 if (((type & SNTPc_NTS_KE_REC_CRITICAL) == 0u                      ) ||
+                     (body_len                           != 2u                      ) ||
+                     (MEM_VAL_GET_INT16U_BIG(&p_buf[ix]) != SNTPc_NTS_KE_PROTO_NTPv4)) {
+                     return (DEF_FAIL);
+                 }
+                 is_proto = DEF_YES;
+                 break;
+
+            case SNTPc_NTS_KE_REC_AEAD:
+                 if ((body_len                                != 2u                             ) ||
+                     (MEM_VAL_GET_INT16U_BIG(&p_buf[ix]) != SNTPc_NTS_AEAD_AES_SIV_CMAC_256)) {
+                     return (DEF_FAIL);
+                 }
+                 is_aead = DEF_YES;
+                 break;
+
+            case SNTPc_NTS_KE_REC_COOKIE:                       /* See Note #2.                                         */
+                 if ((p_assoc->CookieNbr <  SNTPc_CFG_NTS_COOKIE_NBR_MAX) &&
+                     (body_len           >  0u                          ) &&
+                     (body_len           <= SNTPc_CFG_NTS_COOKIE_LEN_MAX)) {
+                     p_cookie      = &p_assoc->CookieTbl[p_assoc->CookieNbr];
+                     p_cookie->Len =  body_len;
+                     Mem_Copy(p_cookie->Data, &p_buf[ix], body_len);
+                     p_assoc->CookieNbr++;
+                 }
+                 break;
+
+            case SNTPc_NTS_KE_REC_SERVER:                       /* See Note #3.                                         */
+                 if ((body_len == 0u                               ) ||
+                     (body_len >  SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX)) {
+                     return (DEF_FAIL);
+                 }
+                 Mem_Copy(p_assoc->ServerHostname, &p_buf[ix], body_len);
+                 p_assoc->ServerHostname[body_len] = ASCII_CHAR_NULL;
+                 break;
+
+            case SNTPc_NTS_KE_REC_PORT:
+                 if (body_len != 2u) {
+                     return (DEF_FAIL);
+                 }
+                 p_assoc->ServerPortNbr = MEM_VAL_GET_INT16U_BIG(&p_buf[ix]);
+                 break;
+
+            case SNTPc_NTS_KE_REC_ERR:
+                 return (DEF_FAIL);
+
+            case SNTPc_NTS_KE_REC_WARN:
+                 break;
+
+            default:
+                 if ((type & SNTPc_NTS_KE_REC_CRITICAL) != 0u) {
+                     return (DEF_FAIL);
+                 }
+                 break;
+        }
+
+        ix += body_len;
+    }
+
+    return (DEF_FAIL);                                          /* No End of Message (see Note #1).                     */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_ReqBuild()
+*
+* Description : Build a NTS request, from its NTP header.
+*
+* Argument(s) : p_buf               Pointer to a buffer of at least SNTPc_NTS_PKT_LEN_MAX octets.
+*
+*               p_hdr               Pointer to the NTP header of the request.
+*
+*               p_uid               Pointer to the unique identifier of the request (SNTPc_NTS_UID_LEN octets).
+*
+*               p_cookie            Pointer to the cookie sent with the request.
+*
+*               placeholder_nbr     Number of additional cookies requested.
+*
+*               p_key_c2s           Pointer to the client to server key.
+*
+* Return(s)   : Length of the request, in octets, if NO error(s).
+*
+*               0,                                            otherwise.
+*
+* Caller(s)   : SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) Each placeholder has the length of the cookie, so that the reply is no larger than the
+*                   request (see RFC #8915, Section 5.5).
+*
+*               (2) The authenticator holds a random nonce & the encryption of an empty plaintext, whose
+*                   associated data is the whole packet up to the authenticator (see RFC #8915, Section 5.6).
+*                   The ciphertext is then the authentication tag only.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  SNTPc_NTS_ReqBuild (      CPU_INT08U        *p_buf,
+                                const SNTP_PKT          *p_hdr,
+                                const CPU_INT08U        *p_uid,
+                                const SNTPc_NTS_COOKIE  *p_cookie,
+                                      CPU_INT08U         placeholder_nbr,
+                                const CPU_INT08U        *p_key_c2s)
+{
+    CPU_INT16U   len;
+    CPU_INT16U   ef_len;
+    CPU_INT08U  *p_auth;
+    CPU_INT08U   ix;
+    CPU_BOOLEAN  result;
+
+
+    if (placeholder_nbr >= SNTPc_CFG_NTS_COOKIE_NBR_MAX) {
+        return (0u);
+    }
+
+    Mem_Copy(p_buf, p_hdr, sizeof(SNTP_PKT));
+    len  = sizeof(SNTP_PKT);
+
+    len += SNTPc_NTS_EF_Wr(&p_buf[len],
+                            SNTPc_NTS_EF_TYPE_UID,
+                            p_uid,
+                            SNTPc_NTS_UID_LEN);
+
+    ef_len = SNTPc_NTS_EF_Wr(&p_buf[len],
+                              SNTPc_NTS_EF_TYPE_COOKIE,
+                              p_cookie->Data,
+                              p_cookie->Len);
+    len   += ef_len;
+
+    for (ix = 0u; ix < placeholder_nbr; ix++) {                 /* See Note #1.                                         */
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len],      SNTPc_NTS_EF_TYPE_PLACEHOLDER);
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len + 2u], ef_len);
+        Mem_Clr(&p_buf[len + SNTPc_NTS_EF_HDR_LEN], ef_len - SNTPc_NTS_EF_HDR_LEN);
+        len += ef_len;
+    }
+                                                                /* ------------------ AUTHENTICATOR ------------------- */
+    p_auth = &p_buf[len];
+    MEM_VAL_SET_INT16U_BIG(&p_auth[0u], SNTPc_NTS_EF_TYPE_AUTH);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[2u], SNTPc_NTS_EF_AUTH_LEN);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[4u], SNTPc_NTS_NONCE_LEN);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[6u], SNTPc_NTS_TAG_LEN);
+
+    result = SNTPc_NTS_RandGet(&p_auth[8u], SNTPc_NTS_NONCE_LEN);
+    if (result != DEF_OK) {
+        return (0u);
+    }
+                                                                /* See Note #2.                                         */
+    result = SNTPc_NTS_AEAD_Seal( p_key_c2s,
+                                 &p_auth[8u],
+                                  SNTPc_NTS_NONCE_LEN,
+                                  p_buf,
+                                  len,
+                                  DEF_NULL,
+                                  0u,
+                                 &p_auth[8u + SNTPc_NTS_NONCE_LEN]);
+    if (result != DEF_OK) {
+        return (0u);
+    }
+
+    return (len + SNTPc_NTS_EF_AUTH_LEN);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_RespParse()
+*
+* Description : Authenticate a NTS reply & decrypt its encrypted extension fields.
+*
+* Argument(s) : p_buf           Pointer to the reply.
+*
+*               len             Length of the reply, in octets.
+*
+*               p_uid           Pointer to the unique identifier of the request.
+*
+*               p_key_s2c       Pointer to the server to client key.
+*
+*               p_buf_pt        Pointer to a buffer of at least SNTPc_NTS_PKT_LEN_MAX octets, that will
+*                               receive the decrypted extension fields.
+*
+*               p_pt_len        Pointer to a variable that will receive the length of the decrypted extension
+*                               fields, in octets.
+*
+* Return(s)   : DEF_OK,   if the reply answers the request & is authenticated.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) The unique identifier MUST precede the authenticator, so that it is authenticated. The
+*                   extension fields that follow the authenticator are not authenticated & are ignored (see
+*                   RFC #8915, Section 5.7).
+*
+*               (2) The associated data is the whole packet up to the authenticator. The nonce & the
+*                   ciphertext are padded to a multiple of 4 octets (see RFC #8915, Section 5.6).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_RespParse (const CPU_INT08U  *p_buf,
+                                        CPU_INT16U   len,
+                                  const CPU_INT08U  *p_uid,
+                                  const CPU_INT08U  *p_key_s2c,
+                                        CPU_INT08U  *p_buf_pt,
+                                        CPU_INT16U  *p_pt_len)
+{
+    const CPU_INT08U   *p_ef;
+          CPU_INT16U    type;
+          CPU_INT16U    ef_len;
+          CPU_INT16U    nonce_len;
+          CPU_INT16U    ct_len;
+          CPU_INT16U    ix;
+          CPU_BOOLEAN   is_uid;
+          CPU_BOOLEAN   result;
+
+
+   *p_pt_len = 0u;
+    is_uid   = DEF_NO;
+
+    ix = sizeof(SNTP_PKT);
+    while ((ix + SNTPc_NTS_EF_HDR_LEN) <= len) {
+        p_ef   = &p_buf[ix];
+        type   =  MEM_VAL_GET_INT16U_BIG(&p_ef[0u]);
+        ef_len =  MEM_VAL_GET_INT16U_BIG(&p_ef[2u]);
+        if ((ef_len         <  SNTPc_NTS_EF_HDR_LEN) ||
+            (ef_len         > (len - ix)           ) ||
+            ((ef_len % 4u) != 0u                   )) {
+            return (DEF_FAIL);
+        }
+
+        if (type == SNTPc_NTS_EF_TYPE_UID) {
+            if ((ef_len                                                           == SNTPc_NTS_EF_UID_LEN) &&
+                (Mem_Cmp(&p_ef[SNTPc_NTS_EF_HDR_LEN], p_uid, SNTPc_NTS_UID_LEN) == DEF_YES             )) {
+                is_uid = DEF_YES;
+            }
+
+        } else if (type == SNTPc_NTS_EF_TYPE_AUTH) {
+            if ((is_uid == DEF_NO                     ) ||      /* See Note #1.                                         */
+                (ef_len <  (SNTPc_NTS_EF_HDR_LEN + 4u))) {
+                return (DEF_FAIL);
+            }
+            nonce_len = MEM_VAL_GET_INT16U_BIG(&p_ef[4u]);
+            ct_len    = MEM_VAL_GET_INT16U_BIG(&p_ef[6u]);
+            if ((ct_len < SNTPc_NTS_TAG_LEN) ||                 /* See Note #2.                                         */
+                (((CPU_INT32U)SNTPc_NTS_ALIGN_4(nonce_len) + SNTPc_NTS_ALIGN_4(ct_len) + 8u) > ef_len)) {
+                return (DEF_FAIL);
+            }
+
+            result = SNTPc_NTS_AEAD_Open( p_key_s2c,
+                                         &p_ef[8u],
+                                          nonce_len,
+                                          p_buf,
+                                          ix,
+                                         &p_ef[8u + SNTPc_NTS_ALIGN_4(nonce_len)],
+                                          ct_len,
+                                          p_buf_pt);
+            if (result != DEF_OK) {
+                return (DEF_FAIL);
+            }
+
+           *p_pt_len = ct_len - SNTPc_NTS_TAG_LEN;
+
+            return (DEF_OK);                                    /* See Note #1.                                         */
+        }
+
+        ix += ef_len;
+    }
+
+    return (DEF_FAIL);                                          /* No authenticator.                                    */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_NTS_CookieParse()
+*
+* Description : Get the cookies of the decrypted extension fields of a NTS reply.
+*
+* Argument(s) : p_buf_pt        Pointer to the decrypted extension fields, as returned by SNTPc_NTS_RespParse().
+*
+*               pt_len          Length of the decrypted extension fields, in octets.
+*
+*               p_cookie_tbl    Pointer to the cookie table the cookies are added to.
+*
+*               cookie_nbr      Number of cookies in the table.
+*
+*               cookie_size     Number of entries in the cookie table.
+*
+* Return(s)   : Number of cookies in the table once the new cookies are added.
+*
+* Caller(s)   : SNTPc_NTS_CookiePush().
+*
+* Note(s)     : (1) Cookies too long to be kept & the cookies in excess of the table are discarded.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  SNTPc_NTS_CookieParse (const CPU_INT08U        *p_buf_pt,
+                                         CPU_INT16U         pt_len,
+                                         SNTPc_NTS_COOKIE  *p_cookie_tbl,
+                                         CPU_INT08U         cookie_nbr,
+                                         CPU_INT08U         cookie_size)
+{
+    CPU_INT16U  type;
+    CPU_INT16U  ef_len;
+    CPU_INT16U  body_len;
+    CPU_INT16U  ix;
+
+
+    ix = 0u;
+    while (((ix + SNTPc_NTS_EF_HDR_LEN) <= pt_len     ) &&
+           (cookie_nbr                  <  cookie_size)) {
+        type   = MEM_VAL_GET_INT16U_BIG(&p_buf_pt[ix]);
+        ef_len = MEM_VAL_GET_INT16U_BIG(&p_buf_pt[ix + 2u]);
+        if ((ef_len <  SNTPc_NTS_EF_HDR_LEN) ||
+            (ef_len > (pt_len - ix)        )) {
+            break;
+        }
+
+        body_len = ef_len - SNTPc_NTS_EF_HDR_LEN;
+        if ((type     == SNTPc_NTS_EF_TYPE_COOKIE    ) &&       /* See Note #1.                                         */
+            (body_len >  0u                          ) &&
+            (body_len <= SNTPc_CFG_NTS_COOKIE_LEN_MAX)) {
+            p_cookie_tbl[cookie_nbr].Len = body_len;
+            Mem_Copy(p_cookie_tbl[cookie_nbr].Data, &p_buf_pt[ix + SNTPc_NTS_EF_HDR_LEN], body_len);
+            cookie_nbr++;
+        }
+
+        ix += ef_len;
+    }
+
+    return (cookie_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_UID_IsEq()
+*
+* Description : Check whether a packet carries the unique identifier of a request.
+*
+* Argument(s) : p_buf       Pointer to the packet.
+*
+*               len         Length of the packet, in octets.
+*
+*               p_uid       Pointer to the unique identifier of the request.
+*
+* Return(s)   : DEF_YES, if the packet carries the unique identifier.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : SNTPc_NTS_Exchange().
+*
+* Note(s)     : (1) Used to match a NTSN Kiss-o'-Death reply, which is not authenticated, to its request (see
+*                   RFC #8915, Section 5.7).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_UID_IsEq (const CPU_INT08U  *p_buf,
+                                       CPU_INT16U   len,
+                                 const CPU_INT08U  *p_uid)
+{
+    CPU_INT16U  type;
+    CPU_INT16U  ef_len;
+    CPU_INT16U  ix;
+
+
+    ix = sizeof(SNTP_PKT);
+    while ((ix + SNTPc_NTS_EF_HDR_LEN) <= len) {
+        type   = MEM_VAL_GET_INT16U_BIG(&p_buf[ix]);
+        ef_len = MEM_VAL_GET_INT16U_BIG(&p_buf[ix + 2u]);
+        if ((ef_len <  SNTPc_NTS_EF_HDR_LEN) ||
+            (ef_len > (len - ix)           )) {
+            break;
+        }
+        if ((type   == SNTPc_NTS_EF_TYPE_UID) &&
+            (ef_len == SNTPc_NTS_EF_UID_LEN )) {
+            return (Mem_Cmp(&p_buf[ix + SNTPc_NTS_EF_HDR_LEN], p_uid, SNTPc_NTS_UID_LEN));
+        }
+        ix += ef_len;
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_NTS_RecWr()
+*
+* Description : Write a NTS key establishment record with a 16-bit body.
+*
+* Argument(s) : p_buf       Pointer to the buffer.
+*
+*               type        Type of the record, with its critical bit.
+*
+*               val         Value of the body.
+*
+* Return(s)   : Length of the record, in octets.
+*
+* Caller(s)   : SNTPc_NTS_KE_ReqBuild().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  SNTPc_NTS_RecWr (CPU_INT08U  *p_buf,
+                                     CPU_INT16U   type,
+                                     CPU_INT16U   val)
+{
+    MEM_VAL_SET_INT16U_BIG(&p_buf[0u], type);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[2u], 2u);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[4u], val);
+
+    return (SNTPc_NTS_KE_REC_HDR_LEN + 2u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_NTS_EF_Wr()
+*
+* Description : Write a NTP extension field.
+*
+* Argument(s) : p_buf       Pointer to the buffer.
+*
+*               type        Type of the extension field.
+*
+*               p_body      Pointer to the body.
+*
+*               body_len    Length of the body, in octets.
+*
+* Return(s)   : Length of the extension field, in octets.
+*
+* Caller(s)   : SNTPc_NTS_ReqBuild().
+*
+* Note(s)     : (1) The body is padded with zeros to a multiple of 4 octets (see RFC #7822, Section 3).
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  SNTPc_NTS_EF_Wr (      CPU_INT08U  *p_buf,
+                                           CPU_INT16U   type,
+                                     const CPU_INT08U  *p_body,
+                                           CPU_INT16U   body_len)
+{
+    CPU_INT16U  ef_len;
+
+
+    ef_len = SNTPc_NTS_EF_HDR_LEN + SNTPc_NTS_ALIGN_4(body_len);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[0u], type);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[2u], ef_len);
+    Mem_Copy(&p_buf[SNTPc_NTS_EF_HDR_LEN], p_body, body_len);
+                                                                /* See Note #1.                                         */
+    Mem_Clr(&p_buf[SNTPc_NTS_EF_HDR_LEN + body_len], ef_len - SNTPc_NTS_EF_HDR_LEN - body_len);
+
+    return (ef_len);
+}
+#endif
@@ -0,0 +1,191 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT NETWORK TIME SECURITY (NTS)
+*
+* Filename : sntp-c_nts.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc NTS present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_NTS_PRESENT                                      /* See Note #1.                                         */
+#define  SNTPc_NTS_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         NTS PACKET DEFINES
+*
+* Note(s) : (1) A NTS request carries a unique identifier, a cookie, one placeholder per additional cookie
+*               requested & an authenticator (see RFC #8915, Section 5.7). A reply carries the unique
+*               identifier & an authenticator that encrypts one cookie per cookie & placeholder of the
+*               request, so both fit in SNTPc_NTS_PKT_LEN_MAX octets.
+*********************************************************************************************************
+*/
+
+#define  SNTPc_NTS_UID_LEN                                32u   /* Len of the unique identifier (see RFC #8915).        */
+#define  SNTPc_NTS_NONCE_LEN                              16u   /* Len of the authenticator nonce.                      */
+
+#define  SNTPc_NTS_EF_HDR_LEN                              4u   /* Len of an extension field hdr (type & len).          */
+#define  SNTPc_NTS_EF_UID_LEN                    (SNTPc_NTS_EF_HDR_LEN + SNTPc_NTS_UID_LEN)
+#define  SNTPc_NTS_EF_COOKIE_LEN_MAX             (SNTPc_NTS_EF_HDR_LEN + SNTPc_CFG_NTS_COOKIE_LEN_MAX)
+#define  SNTPc_NTS_EF_AUTH_LEN                   (SNTPc_NTS_EF_HDR_LEN + 4u + SNTPc_NTS_NONCE_LEN + SNTPc_NTS_TAG_LEN)
+
+#define  SNTPc_NTS_PKT_LEN_MAX                   (sizeof(SNTP_PKT)           + \
+                                                  SNTPc_NTS_EF_UID_LEN       + \
+                                                  SNTPc_NTS_EF_AUTH_LEN      + \
+                                                 (SNTPc_NTS_EF_COOKIE_LEN_MAX * SNTPc_CFG_NTS_COOKIE_NBR_MAX))
+
+#define  SNTPc_NTS_KE_REQ_LEN                             16u   /* Len of the NTS-KE req records.                       */
+#define  SNTPc_NTS_KE_RESP_LEN_MAX               ((SNTPc_NTS_EF_COOKIE_LEN_MAX * SNTPc_CFG_NTS_COOKIE_NBR_MAX) + \
+                                                   SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX                          + \
+                                                   64u)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         NTS COOKIE DATA TYPE
+*
+* Note(s) : (1) A cookie is opaque to the client. It holds the keys of the association, encrypted by the
+*               server, & is sent back to the server once (see RFC #8915, Section 6).
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_nts_cookie {
+    CPU_INT16U        Len;
+    CPU_INT08U        Data[SNTPc_CFG_NTS_COOKIE_LEN_MAX];
+} SNTPc_NTS_COOKIE;
+
+
+/*
+*********************************************************************************************************
+*                                       NTS ASSOCIATION DATA TYPE
+*
+* Note(s) : (1) The keys are exported from the TLS session of the key establishment (see RFC #8915,
+*               Section 5.1).
+*
+*           (2) The NTP server & port negotiated by the key establishment. If none is negotiated, the key
+*               establishment server & the NTP port are used.
+*
+*           (3) The cookies form a stack : each request uses the last one & the cookies of its reply are
+*               pushed back (see 'SNTPc_ReqRemoteTimeNTS() Note #2').
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_nts_assoc {
+    CPU_INT08U        KeyC2S[SNTPc_NTS_KEY_LEN];                /* Client to server key (see Note #1).                  */
+    CPU_INT08U        KeyS2C[SNTPc_NTS_KEY_LEN];                /* Server to client key (see Note #1).                  */
+    CPU_CHAR          ServerHostname[SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u];
+    NET_PORT_NBR      ServerPortNbr;                            /* See Note #2.                                         */
+    SNTPc_NTS_COOKIE  CookieTbl[SNTPc_CFG_NTS_COOKIE_NBR_MAX];  /* See Note #3.                                         */
+    CPU_INT08U        CookieNbr;
+} SNTPc_NTS_ASSOC;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_CFG_NTS_EN == DEF_ENABLED)
+CPU_INT16U   SNTPc_NTS_KE_ReqBuild   (      CPU_INT08U        *p_buf);
+
+CPU_BOOLEAN  SNTPc_NTS_KE_RespParse  (const CPU_INT08U        *p_buf,
+                                            CPU_INT16U         len,
+                                            SNTPc_NTS_ASSOC   *p_assoc);
+
+CPU_INT16U   SNTPc_NTS_ReqBuild      (      CPU_INT08U        *p_buf,
+                                      const SNTP_PKT          *p_hdr,
+                                      const CPU_INT08U        *p_uid,
+                                      const SNTPc_NTS_COOKIE  *p_cookie,
+                                            CPU_INT08U         placeholder_nbr,
+                                      const CPU_INT08U        *p_key_c2s);
+
+CPU_BOOLEAN  SNTPc_NTS_RespParse     (const CPU_INT08U        *p_buf,
+                                            CPU_INT16U         len,
+                                      const CPU_INT08U        *p_uid,
+                                      const CPU_INT08U        *p_key_s2c,
+                                            CPU_INT08U        *p_buf_pt,
+                                            CPU_INT16U        *p_pt_len);
+
+CPU_INT08U   SNTPc_NTS_CookieParse   (const CPU_INT08U        *p_buf_pt,
+                                            CPU_INT16U         pt_len,
+                                            SNTPc_NTS_COOKIE  *p_cookie_tbl,
+                                            CPU_INT08U         cookie_nbr,
+                                            CPU_INT08U         cookie_size);
+
+CPU_BOOLEAN  SNTPc_NTS_UID_IsEq      (const CPU_INT08U        *p_buf,
+                                            CPU_INT16U         len,
+                                      const CPU_INT08U        *p_uid);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc NTS module include.                     */
@@ -0,0 +1,467 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT SERVER SELECTION
+*
+* Filename : sntp-c_sel.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) Implements the selection, clustering & combining algorithms of RFC #5905, Section 11.2,
+*                over one sample per server.
+*
+*            (2) All the computations use integer arithmetic on offsets in microseconds.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_sel.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_SEL_DELTA_MAX_US          ((CPU_INT64S)DEF_INT_32S_MAX_VAL)  /* Max offset diff used in jitter calc.     */
+
+#define  SNTPc_SEL_WEIGHT_SCALE           16777216u             /* Equivalent to 2^24.                                  */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SelIntersect()
+*
+* Description : Find the truechimers among a set of server samples, using the intersection algorithm.
+*
+* Argument(s) : p_sample_tbl    Pointer to the table of server samples.
+*
+*               sample_nbr      Number of samples in the table.
+*
+* Return(s)   : Number of truechimers, if a majority of the samples agree.
+*
+*               0,                     otherwise.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : (1) See RFC #5905, Section 11.2.1. The algorithm finds the smallest interval that contains
+*                   the midpoints of at least (sample_nbr - f) correctness intervals, where f, the number
+*                   of allowed falsetickers, is increased until an interval is found or f reaches half
+*                   the number of samples.
+*
+*               (2) The endpoints are found by counting the intervals on each side of every endpoint
+*                   rather than by sorting the endpoints, which needs no extra memory & is fast enough
+*                   for the small number of servers configured.
+*
+*               (3) A sample is a truechimer if its correctness interval overlaps the intersection
+*                   interval. The IsTruechimer & IsSurvivor flags of all the samples are updated.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  SNTPc_SelIntersect (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                                CPU_INT08U         sample_nbr)
+{
+    SNTPc_SEL_SAMPLE  *p_sample;
+    CPU_INT64S         low;
+    CPU_INT64S         high;
+    CPU_INT64S         endpoint;
+    CPU_INT64S         lo;
+    CPU_INT64S         hi;
+    CPU_INT16S         chime;
+    CPU_INT08U         allow;
+    CPU_INT08U         found;
+    CPU_INT08U         truechimer_nbr;
+    CPU_INT08U         ix;
+    CPU_INT08U         ix_endpoint;
+    CPU_BOOLEAN        is_found;
+
+
+    is_found = DEF_NO;
+    low      = 0;
+    high     = 0;
+
+    for (allow = 0u; (2u * allow) < sample_nbr; allow++) {      /* See Note #1.                                         */
+        found = 0u;
+                                                                /* ------------- FIND LOW END OF INTERVAL ------------- */
+        is_found = DEF_NO;
+        for (ix_endpoint = 0u; ix_endpoint < sample_nbr; ix_endpoint++) {
+            endpoint = p_sample_tbl[ix_endpoint].Offset_us - (CPU_INT64S)p_sample_tbl[ix_endpoint].RootDist_us;
+            if ((is_found == DEF_YES ) &&
+                (endpoint >= low     )) {
+                continue;                                       /* Only a lower endpoint can lower the low end.         */
+            }
+            chime = 0;
+            for (ix = 0u; ix < sample_nbr; ix++) {              /* See Note #2.                                         */
+                p_sample = &p_sample_tbl[ix];
+                lo       =  p_sample->Offset_us - (CPU_INT64S)p_sample->RootDist_us;
+                hi       =  p_sample->Offset_us + (CPU_INT64S)p_sample->RootDist_us;
+                if (lo <= endpoint) {
+                    chime++;
+                }
+                if (hi <  endpoint) {
+                    chime--;
+                }
+            }
+            if (chime >= (CPU_INT16S)(sample_nbr - allow)) {
+                low      = endpoint;
+                is_found = DEF_YES;
+            }
+        }
+        if (is_found == DEF_NO) {
+            continue;
+        }
+                                                                /* ------------ FIND HIGH END OF INTERVAL ------------- */
+        is_found = DEF_NO;
+        for (ix_endpoint = 0u; ix_endpoint < sample_nbr; ix_endpoint++) {
+            endpoint = p_sample_tbl[ix_endpoint].Offset_us + (CPU_INT64S)p_sample_tbl[ix_endpoint].RootDist_us;
+            if ((is_found == DEF_YES ) &&
+                (endpoint <= high    )) {
+                continue;
+            }
+            chime = 0;
+            for (ix = 0u; ix < sample_nbr; ix++) {
+                p_sample = &p_sample_tbl[ix];
+                lo       =  p_sample->Offset_us - (CPU_INT64S)p_sample->RootDist_us;
+                hi       =  p_sample->Offset_us + (CPU_INT64S)p_sample->RootDist_us;
+                if (hi >= endpoint) {
+                    chime++;
+                }
+                if (lo >  endpoint) {
+                    chime--;
+                }
+            }
+            if (chime >= (CPU_INT16S)(sample_nbr - allow)) {
+                high     = endpoint;
+                is_found = DEF_YES;
+            }
+        }
+        if (is_found == DEF_NO) {
+            continue;
+        }
+                                                                /* ------------ COUNT MIDPOINTS OUTSIDE --------------- */
+        for (ix = 0u; ix < sample_nbr; ix++) {
+            if ((p_sample_tbl[ix].Offset_us < low ) ||
+                (p_sample_tbl[ix].Offset_us > high)) {
+                found++;
+            }
+        }
+
+        if ((found <= allow) &&
+            (low   <  high )) {
+            break;                                              /* Majority agrees on the interval.                     */
+        }
+        is_found = DEF_NO;
+    }
+                                                                /* ------------------ MARK SAMPLES -------------------- */
+    truechimer_nbr = 0u;
+    for (ix = 0u; ix < sample_nbr; ix++) {
+        p_sample = &p_sample_tbl[ix];
+        lo       =  p_sample->Offset_us - (CPU_INT64S)p_sample->RootDist_us;
+        hi       =  p_sample->Offset_us + (CPU_INT64S)p_sample->RootDist_us;
+        if ((is_found == DEF_YES) &&                            /* See Note #3.                                         */
+            (lo       <= high   ) &&
+            (hi       >= low    )) {
+            p_sample->IsTruechimer = DEF_YES;
+            p_sample->IsSurvivor   = DEF_YES;
+            truechimer_nbr++;
+        } else {
+            p_sample->IsTruechimer = DEF_NO;
+            p_sample->IsSurvivor   = DEF_NO;
+        }
+    }
+
+    return (truechimer_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_SelCluster()
+*
+* Description : Discard the truechimers that are statistical outliers, using the clustering algorithm.
+*
+* Argument(s) : p_sample_tbl        Pointer to the table of server samples.
+*
+*               sample_nbr          Number of samples in the table.
+*
+*               survivor_nbr_min    Number of survivors under which no sample is discarded.
+*
+* Return(s)   : Number of survivors.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : (1) See RFC #5905, Section 11.2.2. For each survivor, the selection jitter is the RMS of the
+*                   differences between its offset & the offsets of the other survivors. The survivor with
+*                   the largest selection jitter is discarded, until this jitter is smaller than the
+*                   smallest jitter of the survivors or the minimum number of survivors is reached.
+*
+*               (2) Only the samples marked as survivors by SNTPc_SelIntersect() are considered.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  SNTPc_SelCluster (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                              CPU_INT08U         sample_nbr,
+                              CPU_INT08U         survivor_nbr_min)
+{
+    SNTPc_SEL_SAMPLE  *p_sample;
+    CPU_INT64U         sum;
+    CPU_INT32U         jitter_sel;
+    CPU_INT32U         jitter_sel_max;
+    CPU_INT32U         jitter_min;
+    CPU_INT08U         survivor_nbr;
+    CPU_INT08U         ix;
+    CPU_INT08U         ix_other;
+    CPU_INT08U         ix_max;
+
+
+    survivor_nbr = 0u;
+    for (ix = 0u; ix < sample_nbr; ix++) {                      /* See Note #2.                                         */
+        if (p_sample_tbl[ix].IsSurvivor == DEF_YES) {
+            survivor_nbr++;
+        }
+    }
+
+    while (survivor_nbr > survivor_nbr_min) {                   /* See Note #1.                                         */
+        jitter_sel_max = 0u;
+        jitter_min     = DEF_INT_32U_MAX_VAL;
+        ix_max         = 0u;
+
+        for (ix = 0u; ix < sample_nbr; ix++) {
+            p_sample = &p_sample_tbl[ix];
+            if (p_sample->IsSurvivor == DEF_NO) {
+                continue;
+            }
+            sum = 0u;
+            for (ix_other = 0u; ix_other < sample_nbr; ix_other++) {
+                if (p_sample_tbl[ix_other].IsSurvivor == DEF_YES) {
+                    sum += SNTPc_SelDeltaSqGet(p_sample_tbl[ix_other].Offset_us, p_sample->Offset_us) /
+                           (CPU_INT64U)(survivor_nbr - 1u);
+                }
+            }
+            jitter_sel = SNTPc_SelSqrt(sum);
+            if (jitter_sel >= jitter_sel_max) {
+                jitter_sel_max = jitter_sel;
+                ix_max         = ix;
+            }
+            if (p_sample->Jitter_us < jitter_min) {
+                jitter_min = p_sample->Jitter_us;
+            }
+        }
+
+        if (jitter_sel_max < jitter_min) {
+            break;                                              /* Discarding more survivors would not help.            */
+        }
+
+        p_sample_tbl[ix_max].IsSurvivor = DEF_NO;
+        survivor_nbr--;
+    }
+
+    return (survivor_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_SelCombine()
+*
+* Description : Combine the offsets of the survivors into a single offset.
+*
+* Argument(s) : p_sample_tbl    Pointer to the table of server samples.
+*
+*               sample_nbr      Number of samples in the table.
+*
+*               p_jitter_us     Pointer to variable that will receive the RMS of the differences between the
+*                               survivor offsets & the combined offset.
+*
+* Return(s)   : Combined offset, in microseconds.
+*
+* Caller(s)   : SNTPc_ReqRemoteTimeMulti().
+*
+* Note(s)     : (1) See RFC #5905, Section 11.2.3. Each survivor offset is weighted by the inverse of its
+*                   root distance.
+*
+*               (2) The offsets are averaged relative to the offset of the first survivor, so that the
+*                   weighted sums cannot overflow whatever the absolute offset is.
+*
+*               (3) At least one sample MUST be marked as a survivor.
+*********************************************************************************************************
+*/
+
+CPU_INT64S  SNTPc_SelCombine (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                              CPU_INT08U         sample_nbr,
+                              CPU_INT32U        *p_jitter_us)
+{
+    SNTPc_SEL_SAMPLE  *p_sample;
+    CPU_INT64S         offset_ref;
+    CPU_INT64S         offset;
+    CPU_INT64S         delta;
+    CPU_INT64S         sum_delta;
+    CPU_INT64U         sum_weight;
+    CPU_INT64U         sum_sq;
+    CPU_INT32U         weight;
+    CPU_BOOLEAN        is_ref;
+    CPU_INT08U         survivor_nbr;
+    CPU_INT08U         ix;
+
+
+    offset_ref   = 0;
+    sum_delta    = 0;
+    sum_weight   = 0u;
+    survivor_nbr = 0u;
+    is_ref       = DEF_NO;
+
+    for (ix = 0u; ix < sample_nbr; ix++) {
+        p_sample = &p_sample_tbl[ix];
+        if (p_sample->IsSurvivor == DEF_NO) {
+            continue;
+        }
+        if (is_ref == DEF_NO) {
+            offset_ref = p_sample->Offset_us;                   /* See Note #2.                                         */
+            is_ref     = DEF_YES;
+        }
+        delta       = p_sample->Offset_us - offset_ref;
+        delta       = DEF_MIN(delta,  SNTPc_SEL_DELTA_MAX_US);
+        delta       = DEF_MAX(delta, -SNTPc_SEL_DELTA_MAX_US);
+        weight      = SNTPc_SEL_WEIGHT_SCALE / DEF_MAX(p_sample->RootDist_us, 1u);
+        weight      = DEF_MAX(weight, 1u);                      /* See Note #1.                                         */
+        sum_delta  += delta * (CPU_INT64S)weight;
+        sum_weight += weight;
+        survivor_nbr++;
+    }
+
+    if (survivor_nbr == 0u) {
+       *p_jitter_us = 0u;
+        return (0);
+    }
+
+    offset = offset_ref + (sum_delta / (CPU_INT64S)sum_weight);
+
+    sum_sq = 0u;
+    for (ix = 0u; ix < sample_nbr; ix++) {
+        if (p_sample_tbl[ix].IsSurvivor == DEF_YES) {
+            sum_sq += SNTPc_SelDeltaSqGet(p_sample_tbl[ix].Offset_us, offset) / survivor_nbr;
+        }
+    }
+
+   *p_jitter_us = SNTPc_SelSqrt(sum_sq);
+
+    return (offset);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_SelSqrt()
+*
+* Description : Compute the integer square root of a value.
+*
+* Argument(s) : val     Value to compute the square root of.
+*
+* Return(s)   : Largest integer whose square is lower than or equal to the value.
+*
+* Caller(s)   : SNTPc_DriftAdd(),
+*               SNTPc_FilterEval(),
+*               SNTPc_SelCluster(),
+*               SNTPc_SelCombine(),
+*               SNTPc_SyncPollUpdate().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  SNTPc_SelSqrt (CPU_INT64U  val)
+{
+    CPU_INT64U  res;
+    CPU_INT64U  bit;
+
+
+    res = 0u;
+    bit = (CPU_INT64U)1u << 62u;
+    while (bit > val) {
+        bit >>= 2u;
+    }
+
+    while (bit != 0u) {
+        if (val >= (res + bit)) {
+            val -= res + bit;
+            res  = (res >> 1u) + bit;
+        } else {
+            res >>= 1u;
+        }
+        bit >>= 2u;
+    }
+
+    return ((CPU_INT32U)res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_SelDeltaSqGet()
+*
+* Description : Compute the square of the difference between two offsets.
+*
+* Argument(s) : offset_a_us     First  offset, in microseconds.
+*
+*               offset_b_us     Second offset, in microseconds.
+*
+* Return(s)   : Square of the difference, in square microseconds.
+*
+* Caller(s)   : SNTPc_DriftAdd(),
+*               SNTPc_FilterEval(),
+*               SNTPc_SelCluster(),
+*               SNTPc_SelCombine().
+*
+* Note(s)     : (1) The difference is limited to SNTPc_SEL_DELTA_MAX_US, so that the square cannot exceed
+*                   2^62 & the averages of squares computed by the callers cannot overflow.
+*********************************************************************************************************
+*/
+
+CPU_INT64U  SNTPc_SelDeltaSqGet (CPU_INT64S  offset_a_us,
+                                 CPU_INT64S  offset_b_us)
+{
+    CPU_INT64S  delta;
+
+
+    delta = offset_a_us - offset_b_us;
+    if (delta < 0) {
+        delta = -delta;
+    }
+    delta = DEF_MIN(delta, SNTPc_SEL_DELTA_MAX_US);             /* See Note #1.                                         */
+
+    return ((CPU_INT64U)delta * (CPU_INT64U)delta);
+}
@@ -0,0 +1,128 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT SERVER SELECTION
+*
+* Filename : sntp-c_sel.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions of this file are internal to the SNTPc module & MUST NOT be called by the
+*                application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc selection present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_SEL_PRESENT                                      /* See Note #1.                                         */
+#define  SNTPc_SEL_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_SEL_MIN_DISP_US                         10000u   /* Min distance thresh (see RFC #5905, Section 7.2).    */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     SERVER SELECTION SAMPLE DATA TYPE
+*
+* Note(s) : (1) The correctness interval of a sample is [Offset_us - RootDist_us, Offset_us + RootDist_us].
+*
+*           (2) The flags are set by the selection functions.
+*********************************************************************************************************
+*/
+
+typedef struct sntpc_sel_sample {
+    CPU_INT64S   Offset_us;                                     /* Offset of the server clock from the local clock.     */
+    CPU_INT32U   RootDist_us;                                   /* Root distance of the server (see Note #1).           */
+    CPU_INT32U   Jitter_us;                                     /* Jitter of the server samples.                        */
+    CPU_BOOLEAN  IsTruechimer;                                  /* See Note #2.                                         */
+    CPU_BOOLEAN  IsSurvivor;
+} SNTPc_SEL_SAMPLE;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+CPU_INT08U  SNTPc_SelIntersect (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                                CPU_INT08U         sample_nbr);
+
+CPU_INT08U  SNTPc_SelCluster   (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                                CPU_INT08U         sample_nbr,
+                                CPU_INT08U         survivor_nbr_min);
+
+CPU_INT64S  SNTPc_SelCombine   (SNTPc_SEL_SAMPLE  *p_sample_tbl,
+                                CPU_INT08U         sample_nbr,
+                                CPU_INT32U        *p_jitter_us);
+
+CPU_INT32U  SNTPc_SelSqrt      (CPU_INT64U         val);
+
+CPU_INT64U  SNTPc_SelDeltaSqGet(CPU_INT64S         offset_a_us,
+                                CPU_INT64S         offset_b_us);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc selection module include.               */
@@ -0,0 +1,461 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        SNTP CLIENT STATISTICS
+*
+* Filename : sntp-c_stat.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The statistics are counted in fixed-size structures; no memory is allocated. The statistics
+*                of each server are kept by the caller, in the table of 'sntp-c.c'.
+*
+*            (2) The statistics are updated without the module lock, which is not held during network I/O &
+*                whose waits are counted. The global statistics are protected by a sequence counter
+*                (seqlock), as the disciplined clock (see 'sntp-c_clk.c  Note #5') :
+*
+*                (a) The writers increment the counter before & after they update the statistics, in a
+*                    critical section. The bucket indexes are computed before the critical section is
+*                    entered, so that it holds only a few increments.
+*
+*                (b) The readers copy the statistics & retry while the counter is odd or changed during the
+*                    copy, so that the copy is consistent & the readers never disable the interrupts.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_stat.h"
+#include  <lib_mem.h>
+
+
+#if (SNTPc_CFG_STAT_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_STAT_REQ_TBL_SIZE                           2u   /* Global & server stats updated by each req.           */
+
+                                                                /* Memory barrier of the seqlock (see Note #2).         */
+#ifdef   CPU_MB
+#define  SNTPc_STAT_MB()                        CPU_MB()
+#else
+#define  SNTPc_STAT_MB()                                        /* Single core CPU : volatile accesses are ordered.     */
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  volatile  SNTPc_STAT  SNTPc_Stat;
+static  volatile  CPU_DATA    SNTPc_StatSeq;                    /* Seq ctr of the global stats (see Note #2).           */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  SNTPc_STAT_STAGE  SNTPc_StatStageGet    (         SNTPc_ERR         err);
+
+static  CPU_INT08U        SNTPc_StatBucketIxGet (         CPU_INT64U        val_us);
+
+static  void              SNTPc_StatHistAdd     (volatile SNTPc_STAT_HIST  *p_hist,
+                                                          CPU_INT64U        val_us,
+                                                          CPU_INT08U        bucket_ix);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_StatGet()
+*
+* Description : Get the request statistics of all the servers, without lock.
+*
+* Argument(s) : p_stat      Pointer to variable that will receive the request statistics.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               SNTPc_ERR_NONE           Statistics successfully copied.
+*                               SNTPc_ERR_NULL_PTR       Invalid pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The statistics are copied without the module lock, so that reading them does not add to
+*                   the module lock waits they count. The copy is consistent : it is retried while the
+*                   statistics are updated (see 'sntp-c_stat.c  Note #2b').
+*
+*               (2) The statistics count the requests of SNTPc_ReqRemoteTime(), SNTPc_ReqRemoteTimeBurst(),
+*                   SNTPc_ReqRemoteTimeMulti() & SNTPc_ReqRemoteTimeNTS(), including the requests of the
+*                   SNTPc task. A burst counts as one request & each server of a multi-server request as
+*                   one request.
+*********************************************************************************************************
+*/
+
+void  SNTPc_StatGet (SNTPc_STAT  *p_stat,
+                     SNTPc_ERR   *p_err)
+{
+    CPU_DATA  seq;
+
+
+#if (SNTPc_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_stat == DEF_NULL) {
+       *p_err = SNTPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    do {                                                        /* See Note #1.                                         */
+        seq     = SNTPc_StatSeq;
+        SNTPc_STAT_MB();
+       *p_stat  = SNTPc_Stat;
+        SNTPc_STAT_MB();
+    } while (((seq & 1u) != 0u) ||
+             ( seq       != SNTPc_StatSeq));
+
+   *p_err = SNTPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SNTPc_StatInit()
+*
+* Description : Clear the global statistics.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_Init(),
+*               SNTPc_StatClr().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_StatInit (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    SNTPc_StatSeq++;                                            /* Odd while the stats are modified.                    */
+    SNTPc_STAT_MB();
+    Mem_Clr((void *)&SNTPc_Stat, sizeof(SNTPc_Stat));
+    SNTPc_STAT_MB();
+    SNTPc_StatSeq++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_StatReqAdd()
+*
+* Description : Count a completed request in the global statistics & in the statistics of its server.
+*
+* Argument(s) : p_stat_server   Pointer to the statistics of the server, DEF_NULL if none (see Note #1).
+*
+*               err             Error code of the request.
+*
+*               p_sample        Pointer to the sample decoded from the reply, if the request succeeded.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_StatReqRecord().
+*
+* Note(s)     : (1) The statistics of the server are read & replaced with the module lock held, which MUST be
+*                   acquired by the caller if p_stat_server is not DEF_NULL.
+*
+*               (2) The stage of the failure is derived from the error code (see 'SNTPc STATISTICS DATA
+*                   TYPES  Note #2').
+*********************************************************************************************************
+*/
+
+void  SNTPc_StatReqAdd (      SNTPc_STAT_REQ  *p_stat_server,
+                              SNTPc_ERR        err,
+                        const SNTPc_SAMPLE    *p_sample)
+{
+    volatile  SNTPc_STAT_REQ    *p_stat_tbl[SNTPc_STAT_REQ_TBL_SIZE];
+    volatile  SNTPc_STAT_REQ    *p_stat;
+              SNTPc_STAT_STAGE   stage;
+              CPU_INT64U         dly_us;
+              CPU_INT64U         offset_us;
+              CPU_INT08U         dly_ix;
+              CPU_INT08U         offset_ix;
+              CPU_INT08U         err_ix;
+              CPU_INT08U         ix;
+    CPU_SR_ALLOC();
+
+
+    dly_us    = 0u;
+    offset_us = 0u;
+    dly_ix    = 0u;
+    offset_ix = 0u;
+    if (err == SNTPc_ERR_NONE) {
+        dly_us    = (CPU_INT64U)DEF_MAX(p_sample->RoundTripDly_ns / 1000, 0);
+        offset_us = (p_sample->Offset_ns < 0) ? (CPU_INT64U)(-(p_sample->Offset_ns / 1000))
+                                              : (CPU_INT64U)(  p_sample->Offset_ns / 1000 );
+        dly_ix    = SNTPc_StatBucketIxGet(dly_us);
+        offset_ix = SNTPc_StatBucketIxGet(offset_us);
+    }
+    stage  = SNTPc_StatStageGet(err);                           /* See Note #2.                                         */
+    err_ix = (CPU_INT08U)DEF_MIN((CPU_INT32U)err, SNTPc_STAT_ERR_NBR - 1u);
+
+    p_stat_tbl[0] = &SNTPc_Stat.Req;
+    p_stat_tbl[1] =  p_stat_server;
+
+    CPU_CRITICAL_ENTER();
+    SNTPc_StatSeq++;                                            /* Odd while the stats are modified.                    */
+    SNTPc_STAT_MB();
+    for (ix = 0u; ix < SNTPc_STAT_REQ_TBL_SIZE; ix++) {
+        p_stat = p_stat_tbl[ix];
+        if (p_stat == DEF_NULL) {
+            continue;
+        }
+
+        p_stat->ReqCtr++;
+        if (err == SNTPc_ERR_NONE) {
+            p_stat->OkCtr++;
+            SNTPc_StatHistAdd(&p_stat->RoundTripDlyHist, dly_us,    dly_ix);
+            SNTPc_StatHistAdd(&p_stat->OffsetHist,       offset_us, offset_ix);
+        } else {
+            p_stat->FailStageCtrTbl[stage]++;
+            p_stat->FailErrCtrTbl[err_ix]++;
+        }
+    }
+    SNTPc_STAT_MB();
+    SNTPc_StatSeq++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_StatLockWaitAdd()
+*
+* Description : Count a wait on the module lock.
+*
+* Argument(s) : wait_us     Time waited to acquire the module lock, in microseconds.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_AcquireLock().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  SNTPc_StatLockWaitAdd (CPU_INT64U  wait_us)
+{
+    CPU_INT08U  bucket_ix;
+    CPU_SR_ALLOC();
+
+
+    bucket_ix = SNTPc_StatBucketIxGet(wait_us);
+
+    CPU_CRITICAL_ENTER();
+    SNTPc_StatSeq++;                                            /* Odd while the stats are modified.                    */
+    SNTPc_STAT_MB();
+    SNTPc_StatHistAdd(&SNTPc_Stat.LockWaitHist, wait_us, bucket_ix);
+    SNTPc_STAT_MB();
+    SNTPc_StatSeq++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_StatStageGet()
+*
+* Description : Get the stage at which a request failed.
+*
+* Argument(s) : err         Error code of the failed request.
+*
+* Return(s)   : Stage of the failure (see 'SNTPc STATISTICS DATA TYPES  Note #2').
+*
+* Caller(s)   : SNTPc_StatReqAdd().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  SNTPc_STAT_STAGE  SNTPc_StatStageGet (SNTPc_ERR  err)
+{
+    SNTPc_STAT_STAGE  stage;
+
+
+    switch (err) {
+        case SNTPc_ERR_ACQUIRE_LOCK:
+             stage = SNTPc_STAT_STAGE_LOCK;
+             break;
+
+        case SNTPc_ERR_NULL_PTR:
+        case SNTPc_ERR_SERVER_CFG:
+             stage = SNTPc_STAT_STAGE_ADDR;
+             break;
+
+        case SNTPc_ERR_SERVER_BACKOFF:
+             stage = SNTPc_STAT_STAGE_BACKOFF;
+             break;
+
+        case SNTPc_ERR_MEM_ALLOC:
+        case SNTPc_ERR_NO_MORE_RSRC:
+             stage = SNTPc_STAT_STAGE_RSRC;
+             break;
+
+        case SNTPc_ERR_TX:
+             stage = SNTPc_STAT_STAGE_TX;
+             break;
+
+        case SNTPc_ERR_RX:
+        case SNTPc_ERR_RX_INVALID:
+             stage = SNTPc_STAT_STAGE_RX;
+             break;
+
+        case SNTPc_ERR_KOD:
+             stage = SNTPc_STAT_STAGE_KOD;
+             break;
+
+        case SNTPc_ERR_NTS_KE:
+        case SNTPc_ERR_NTS_NAK:
+             stage = SNTPc_STAT_STAGE_NTS;
+             break;
+
+        default:
+             stage = SNTPc_STAT_STAGE_OTHER;
+             break;
+    }
+
+    return (stage);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SNTPc_StatBucketIxGet()
+*
+* Description : Get the histogram bucket of a value.
+*
+* Argument(s) : val_us      Value, in microseconds.
+*
+* Return(s)   : Index of the bucket (see 'SNTPc STATISTICS DATA TYPES  Note #1').
+*
+* Caller(s)   : SNTPc_StatReqAdd(),
+*               SNTPc_StatLockWaitAdd().
+*
+* Note(s)     : (1) The index is the number of significant bits of the value, limited to the last bucket.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  SNTPc_StatBucketIxGet (CPU_INT64U  val_us)
+{
+    CPU_INT08U  ix;
+
+
+    ix = 0u;                                                    /* See Note #1.                                         */
+    while ((val_us != 0u                              ) &&
+           (ix     <  (SNTPc_STAT_HIST_BUCKET_NBR - 1u))) {
+        val_us >>= 1u;
+        ix++;
+    }
+
+    return (ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_StatHistAdd()
+*
+* Description : Count a value in a histogram.
+*
+* Argument(s) : p_hist      Pointer to the histogram.
+*
+*               val_us      Value, in microseconds.
+*
+*               bucket_ix   Index of the bucket of the value, as returned by SNTPc_StatBucketIxGet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_StatReqAdd(),
+*               SNTPc_StatLockWaitAdd().
+*
+* Note(s)     : (1) MUST be called in a critical section, between the increments of the sequence counter
+*                   (see 'sntp-c_stat.c  Note #2a').
+*********************************************************************************************************
+*/
+
+static  void  SNTPc_StatHistAdd (volatile SNTPc_STAT_HIST  *p_hist,
+                                          CPU_INT64U        val_us,
+                                          CPU_INT08U        bucket_ix)
+{
+    CPU_INT32U  val_max_us;
+
+
+    val_max_us = (CPU_INT32U)DEF_MIN(val_us, DEF_INT_32U_MAX_VAL);
+
+    p_hist->Ctr++;
+    p_hist->Sum_us += val_us;
+    if (val_max_us > p_hist->Max_us) {
+        p_hist->Max_us = val_max_us;
+    }
+    p_hist->BucketTbl[bucket_ix]++;
+}
+#endif
@@ -0,0 +1,218 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT BINARY TRACE BUFFER
+*
+* Filename : sntp-c_trace.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This file is used only if SNTPc_TRACE_LEVEL is at least TRACE_LEVEL_INFO in 'sntp-c_cfg.h'.
+*                The binary trace buffer is used only if SNTPc_TRACE_BIN_EN is also enabled.
+*
+*            (2) The trace records are written without the module lock, from any task :
+*
+*                (a) A writer claims the sequence number of its record in a critical section that holds only
+*                    the increment of SeqNext. The record is written after the critical section.
+*
+*                (b) The sequence number of the record is set to SNTPc_TRACE_SEQ_NONE before the record is
+*                    written & to the claimed number after, so that the decoder discards a record dumped
+*                    while it was written (see 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #3'). The fields of
+*                    the record are volatile, so that the compiler keeps their writes between those of the
+*                    sequence number (see 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #6'). CPU_MB() also
+*                    orders them for the other cores, where defined.
+*
+*                (c) A writer preempted for as long as SNTPc_TRACE_BIN_NBR_RECORDS other records are
+*                    written may complete its record after a newer one was written at the same index. The
+*                    decoder then reports the newer record as lost.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  "sntp-c_trace.h"
+#include  "sntp-c_clk.h"
+
+
+#if ((defined(SNTPc_TRACE_LEVEL)) && \
+     (SNTPc_TRACE_LEVEL >= TRACE_LEVEL_INFO))
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  SNTPc_TRACE_ARG_32S_MAX                ((CPU_INT64S)DEF_INT_32S_MAX_VAL)
+
+#define  SNTPc_TRACE_IX_MASK                    (SNTPc_TRACE_BIN_NBR_RECORDS - 1u)
+
+                                                                /* Memory barrier of the record seq nbr (see Note #2b). */
+#ifdef   CPU_MB
+#define  SNTPc_TRACE_MB()                       CPU_MB()
+#else
+#define  SNTPc_TRACE_MB()                                       /* Single core CPU : the volatile writes are ordered.   */
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (SNTPc_TRACE_BIN_EN == DEF_ENABLED)
+static  SNTPc_TRACE_BUF  SNTPc_TraceBuf = {
+    SNTPc_TRACE_MAGIC,
+    SNTPc_TRACE_VER,
+    sizeof(SNTPc_TRACE_RECORD),
+    SNTPc_TRACE_BIN_NBR_RECORDS,
+    0u,
+  {{0u}}
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_TraceArg32S()
+*
+* Description : Saturate a signed 64-bit value to the 32-bit argument of a trace record.
+*
+* Argument(s) : val         Value to saturate.
+*
+* Return(s)   : Value saturated to [-DEF_INT_32S_MAX_VAL, DEF_INT_32S_MAX_VAL], in two's complement.
+*
+* Caller(s)   : SNTPc_TRACE_ARG_32S().
+*
+* Note(s)     : (1) A function is used rather than a macro, so that the value is evaluated once.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  SNTPc_TraceArg32S (CPU_INT64S  val)
+{
+    if (val > SNTPc_TRACE_ARG_32S_MAX) {
+        val = SNTPc_TRACE_ARG_32S_MAX;
+    } else if (val < -SNTPc_TRACE_ARG_32S_MAX) {
+        val = -SNTPc_TRACE_ARG_32S_MAX;
+    }
+
+    return ((CPU_INT32U)(CPU_INT32S)val);
+}
+
+
+#if (SNTPc_TRACE_BIN_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                         SNTPc_TraceBufGet()
+*
+* Description : Get the binary trace buffer.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Pointer to the binary trace buffer.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The sizeof(SNTPc_TRACE_BUF) octets of the buffer can be copied to the host (e.g. saved by
+*                   a debugger or sent on a serial link) while the SNTP client runs, & decoded by
+*                   'Tool/sntp-c_trace_dec.c'. The records written during the copy may be reported as
+*                   incomplete or lost.
+*********************************************************************************************************
+*/
+
+const  SNTPc_TRACE_BUF  *SNTPc_TraceBufGet (void)
+{
+    return (&SNTPc_TraceBuf);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           SNTPc_TraceWr()
+*
+* Description : Write a trace record in the binary trace buffer.
+*
+* Argument(s) : evt_id      Event identifier (see 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #5').
+*
+*               arg0        First  argument of the event.
+*
+*               arg1        Second argument of the event.
+*
+*               arg2        Third  argument of the event.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_TRACE_INFO(),
+*               SNTPc_TRACE_DBG().
+*
+* Note(s)     : (1) See Note #2.
+*********************************************************************************************************
+*/
+
+void  SNTPc_TraceWr (CPU_INT16U  evt_id,
+                     CPU_INT16U  arg0,
+                     CPU_INT32U  arg1,
+                     CPU_INT32U  arg2)
+{
+    SNTPc_TRACE_RECORD  *p_record;
+    SNTP_FIXED_TS        ts;
+    CPU_INT32U           seq;
+    CPU_SR_ALLOC();
+
+
+    ts = SNTPc_ClkLocalGet();
+                                                                /* Claim the next record (see Note #2a).                */
+    CPU_CRITICAL_ENTER();
+    seq                    = SNTPc_TraceBuf.SeqNext;
+    SNTPc_TraceBuf.SeqNext = seq + 1u;
+    CPU_CRITICAL_EXIT();
+
+    p_record      = &SNTPc_TraceBuf.RecordTbl[seq & SNTPc_TRACE_IX_MASK];
+    p_record->Seq =  SNTPc_TRACE_SEQ_NONE;                      /* See Note #2b.                                        */
+    SNTPc_TRACE_MB();
+
+    p_record->TS    = ts;
+    p_record->EvtId = evt_id;
+    p_record->Arg0  = arg0;
+    p_record->Arg1  = arg1;
+    p_record->Arg2  = arg2;
+
+    SNTPc_TRACE_MB();
+    p_record->Seq   = seq;
+}
+#endif
+#endif
@@ -0,0 +1,145 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          SNTP CLIENT TRACING
+*
+* Filename : sntp-c_trace.h
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) The functions & macros of this file are internal to the SNTPc module & MUST NOT be called
+*                by the application.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               SNTPc trace present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  SNTPc_TRACE_PRESENT                                    /* See Note #1.                                         */
+#define  SNTPc_TRACE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "sntp-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                                MACROS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          TRACE EVENT MACROS
+*
+* Note(s) : (1) A trace point is written as :
+*
+*                   SNTPc_TRACE_INFO(SNTPc_TRACE_EVT_xxx, arg0, arg1, arg2);
+*
+*               with the arguments of the event (see 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #5'). The
+*               trace points of a level above SNTPc_TRACE_LEVEL expand to nothing : their arguments are
+*               not evaluated.
+*
+*           (2) The events are written in the binary trace buffer, only if SNTPc_TRACE_BIN_EN is enabled.
+*               Otherwise, the trace points expand to nothing : the events are never printed with
+*               SNTPc_TRACE, which would format text on the request path (see 'sntp-c_cfg.h  TRACING').
+*
+*           (3) SNTPc_TRACE_ARG_32S() saturates a signed 64-bit value to the 32-bit argument of a record.
+*               Its argument is evaluated once (see 'sntp-c_trace.c  SNTPc_TraceArg32S()').
+*********************************************************************************************************
+*/
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_INFO) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))                       /* See Note #2.                                         */
+#define  SNTPc_TRACE_EVT(evt_id, arg0, arg1, arg2)              SNTPc_TraceWr((CPU_INT16U)(evt_id),                    \
+                                                                              (CPU_INT16U)(arg0),                      \
+                                                                              (CPU_INT32U)(arg1),                      \
+                                                                              (CPU_INT32U)(arg2))
+#endif
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_INFO) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))
+#define  SNTPc_TRACE_INFO(evt_id, arg0, arg1, arg2)             SNTPc_TRACE_EVT(evt_id, arg0, arg1, arg2)
+#else
+#define  SNTPc_TRACE_INFO(evt_id, arg0, arg1, arg2)
+#endif
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_DBG ) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))
+#define  SNTPc_TRACE_DBG(evt_id, arg0, arg1, arg2)              SNTPc_TRACE_EVT(evt_id, arg0, arg1, arg2)
+#else
+#define  SNTPc_TRACE_DBG(evt_id, arg0, arg1, arg2)
+#endif
+
+                                                                /* See Note #3.                                         */
+#define  SNTPc_TRACE_ARG_32S(val)                               SNTPc_TraceArg32S((CPU_INT64S)(val))
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if ((defined(SNTPc_TRACE_LEVEL)) && \
+     (SNTPc_TRACE_LEVEL >= TRACE_LEVEL_INFO))
+CPU_INT32U  SNTPc_TraceArg32S (CPU_INT64S  val);
+#endif
+
+#if ((defined(SNTPc_TRACE_LEVEL))             && \
+     (SNTPc_TRACE_LEVEL  >= TRACE_LEVEL_INFO) && \
+     (SNTPc_TRACE_BIN_EN == DEF_ENABLED))
+void        SNTPc_TraceWr     (CPU_INT16U  evt_id,
+                               CPU_INT16U  arg0,
+                               CPU_INT32U  arg1,
+                               CPU_INT32U  arg2);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of SNTPc trace module include.                   */
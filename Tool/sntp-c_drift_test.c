@@ -0,0 +1,526 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT FREQUENCY DRIFT ESTIMATION TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_drift_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It checks the frequency error estimated
+*                by 'sntp-c_drift.c' from the offsets of the polls, the residuals of the fit, the replacement
+*                of the oldest poll & the time predicted in holdover with its error bound.
+*
+*            (2) It is linked with 'sntp-c_drift.c', 'sntp-c_fixed.c' & 'sntp-c_sel.c', built for the host
+*                with the include paths of the application (uC/CPU host port, uC/LIB, uC/TCPIP & the
+*                directory of a 'sntp-c_cfg.h' with SNTPc_CFG_TASK_EN enabled & SNTPc_CFG_DRIFT_WIN_NBR set
+*                to 8), e.g. :
+*
+*                    cc $(INC) -o sntp-c_drift_test Tool/sntp-c_drift_test.c Source/sntp-c_drift.c \
+*                       Source/sntp-c_fixed.c Source/sntp-c_sel.c
+*
+*                & returns EXIT_SUCCESS if every check passes.
+*
+*            (3) The local time base is provided by this program in place of 'sntp-c_clk.c', so that the
+*                holdover time is set by the checks.
+*
+*            (4) The polls are 64 s apart & their offsets lie on lines whose slopes are multiples of
+*                1 ppm, so that the expected frequency errors are exact.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_clk.h>
+#include  <Source/sntp-c_drift.h>
+#include  <Source/sntp-c_fixed.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DRIFT_TEST_TS              0xE3D1A2B300000000uLL       /* 2021-02-13 00:58:27 UTC, in 32.32 fixed point.       */
+#define  DRIFT_TEST_SEC                    0x100000000uLL       /* 1 s, in 32.32 fixed point.                           */
+
+#define  DRIFT_TEST_POLL_SEC                          64u       /* Interval between the polls (see Note #4).            */
+#define  DRIFT_TEST_DLY_US                           200u       /* Round trip delay of the polls.                       */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  SNTP_FIXED_TS  DriftTestLocalTS;                        /* Local time base (see Note #3).                       */
+
+static  CPU_INT32U     DriftTestNbr;
+static  CPU_INT32U     DriftTestFailNbr;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  DriftTestChk       (      CPU_BOOLEAN   is_ok,
+                                  const CPU_CHAR     *p_name);
+
+static  void  DriftTestPollAdd   (      CPU_INT32U    poll_nbr,
+                                        CPU_INT64S    offset_us,
+                                        CPU_INT32S    freq_ppm);
+
+static  void  DriftTestNotReady  (void);
+
+static  void  DriftTestLine      (void);
+
+static  void  DriftTestHoldover  (void);
+
+static  void  DriftTestWin       (void);
+
+static  void  DriftTestClamp     (void);
+
+static  void  DriftTestResid     (void);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the frequency drift estimation test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every check passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    DriftTestNotReady();
+    DriftTestLine();
+    DriftTestHoldover();
+    DriftTestWin();
+    DriftTestClamp();
+    DriftTestResid();
+
+    printf("%lu checks, %lu failed\n",
+           (unsigned long)DriftTestNbr,
+           (unsigned long)DriftTestFailNbr);
+
+    return ((DriftTestFailNbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ClkLocalGet()
+*
+* Description : Get the local time base of the test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Local time set by the checks, in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_DriftStatusGet(),
+*               SNTPc_DriftTimeGet().
+*
+* Note(s)     : (1) See 'sntp-c_drift_test.c  Note #3'.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED_TS  SNTPc_ClkLocalGet (void)
+{
+    return (DriftTestLocalTS);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           DriftTestChk()
+*
+* Description : Count a check & report it if it failed.
+*
+* Argument(s) : is_ok       Result of the check.
+*
+*               p_name      Pointer to the name of the check.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestChk (      CPU_BOOLEAN   is_ok,
+                            const CPU_CHAR     *p_name)
+{
+    DriftTestNbr++;
+    if (is_ok != DEF_YES) {
+        printf("FAIL  %s\n", p_name);
+        DriftTestFailNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DriftTestPollAdd()
+*
+* Description : Add polls whose offsets lie on a line, starting at the current local time.
+*
+* Argument(s) : poll_nbr    Number of polls to add.
+*
+*               offset_us   Offset of the first poll, in microseconds.
+*
+*               freq_ppm    Slope of the line, in parts per million.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) The local time is left at the last poll.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestPollAdd (CPU_INT32U  poll_nbr,
+                                CPU_INT64S  offset_us,
+                                CPU_INT32S  freq_ppm)
+{
+    CPU_INT32U  ix;
+
+
+    for (ix = 0u; ix < poll_nbr; ix++) {
+        if (ix != 0u) {
+            DriftTestLocalTS += DRIFT_TEST_POLL_SEC * DRIFT_TEST_SEC;
+            offset_us        += (CPU_INT64S)freq_ppm * DRIFT_TEST_POLL_SEC;
+        }
+        SNTPc_DriftAdd(DriftTestLocalTS, offset_us, DRIFT_TEST_DLY_US);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DriftTestNotReady()
+*
+* Description : Check that no frequency error is estimated from less than three polls.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestNotReady (void)
+{
+    SNTPc_DRIFT_STATUS  status;
+    SNTP_TS             ts;
+    SNTPc_ERR           err;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(2u, 1000, 50);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(err            == SNTPc_ERR_DRIFT_NOT_READY), "not ready : status err");
+    DriftTestChk((CPU_BOOLEAN)(status.PollNbr == 2u),                        "not ready : poll nbr");
+
+    ts = SNTPc_DriftTimeGet(DEF_NULL, &err);
+    DriftTestChk((CPU_BOOLEAN)(err            == SNTPc_ERR_DRIFT_NOT_READY), "not ready : time err");
+    DriftTestChk((CPU_BOOLEAN)((ts.Sec == 0u) && (ts.Frac == 0u)),           "not ready : null time");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DriftTestLine()
+*
+* Description : Check the frequency error estimated from offsets lying exactly on a line.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The fit has no residuals, so the standard error of the frequency error is null.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestLine (void)
+{
+    SNTPc_DRIFT_STATUS  status;
+    SNTPc_ERR           err;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(3u, 1000, 50);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(err                 == SNTPc_ERR_NONE), "line, 3 polls : err");
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb     ==  50000), "line, 3 polls : freq");
+    DriftTestChk((CPU_BOOLEAN)(status.PollNbr      ==      3u), "line, 3 polls : poll nbr");
+
+    DriftTestLocalTS += DRIFT_TEST_POLL_SEC * DRIFT_TEST_SEC;
+    DriftTestPollAdd(6u, 1000 + (3 * 50 * DRIFT_TEST_POLL_SEC), 50);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(err                 == SNTPc_ERR_NONE), "line, full : err");
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb     ==  50000), "line, full : freq");
+    DriftTestChk((CPU_BOOLEAN)(status.FreqErr_ppb  ==      0u), "line, full : freq err");
+    DriftTestChk((CPU_BOOLEAN)(status.Resid_us     ==      0u), "line, full : resid");
+    DriftTestChk((CPU_BOOLEAN)(status.Holdover_sec ==      0u), "line, full : holdover");
+    DriftTestChk((CPU_BOOLEAN)(status.PollNbr      == SNTPc_CFG_DRIFT_WIN_NBR), "line, full : poll nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DriftTestHoldover()
+*
+* Description : Check the time predicted after the last poll & its error bound.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The offset of the last poll is 1000 + 7 * 64 * 50 us. After 10 s of holdover, the
+*                   predicted offset has grown by 10 * 50 us.
+*
+*               (2) Without residuals, the error bound is half the round trip delay of the last poll plus
+*                   the wander of the frequency over the holdover time.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestHoldover (void)
+{
+    SNTPc_DRIFT_STATUS  status;
+    SNTP_FIXED_TS       time;
+    SNTP_TS             ts;
+    SNTPc_ERR           err;
+    CPU_INT32U          bound_us;
+    CPU_INT64S          offset_us;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(SNTPc_CFG_DRIFT_WIN_NBR, 1000, 50);
+
+    DriftTestLocalTS += 10u * DRIFT_TEST_SEC;
+
+    ts = SNTPc_DriftTimeGet(&bound_us, &err);
+    DriftTestChk((CPU_BOOLEAN)(err == SNTPc_ERR_NONE), "holdover : err");
+
+    time      = ((SNTP_FIXED_TS)ts.Sec << 32u) | ts.Frac;
+    offset_us = 1000 + (7 * 64 * 50) + (10 * 50);               /* See Note #1.                                         */
+    DriftTestChk((CPU_BOOLEAN)((SNTP_FIXED)(time - DriftTestLocalTS) == SNTPc_UsToFixed(offset_us)),
+                 "holdover : offset");
+                                                                /* See Note #2.                                         */
+    DriftTestChk((CPU_BOOLEAN)(bound_us == (DRIFT_TEST_DLY_US / 2u) + ((10u * SNTPc_CFG_DRIFT_WANDER_PPB) / 1000u)),
+                 "holdover : bound");
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(status.Holdover_sec == 10u), "holdover : holdover");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DriftTestWin()
+*
+* Description : Check that the oldest polls are replaced once the window is full.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) Once a full window of polls on a second line is added, the polls of the first line no
+*                   longer contribute to the fit.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestWin (void)
+{
+    SNTPc_DRIFT_STATUS  status;
+    SNTPc_ERR           err;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(SNTPc_CFG_DRIFT_WIN_NBR, 1000, 50);
+
+    DriftTestLocalTS += DRIFT_TEST_POLL_SEC * DRIFT_TEST_SEC;
+    DriftTestPollAdd(SNTPc_CFG_DRIFT_WIN_NBR - 1u, -3000, -20);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb    != -20000), "win, 1 poll left : freq mixed");
+
+    DriftTestLocalTS += DRIFT_TEST_POLL_SEC * DRIFT_TEST_SEC;
+    SNTPc_DriftAdd(DriftTestLocalTS, -3000 - ((CPU_INT64S)(SNTPc_CFG_DRIFT_WIN_NBR - 1u) * 20 * DRIFT_TEST_POLL_SEC),
+                   DRIFT_TEST_DLY_US);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(err                == SNTPc_ERR_NONE), "win, replaced : err");
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb    == -20000), "win, replaced : freq");
+    DriftTestChk((CPU_BOOLEAN)(status.Resid_us    ==      0u), "win, replaced : resid");
+    DriftTestChk((CPU_BOOLEAN)(status.PollNbr     == SNTPc_CFG_DRIFT_WIN_NBR), "win, replaced : poll nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DriftTestClamp()
+*
+* Description : Check that the frequency error is limited to +/- 500 ppm.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestClamp (void)
+{
+    SNTPc_DRIFT_STATUS  status;
+    SNTPc_ERR           err;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(SNTPc_CFG_DRIFT_WIN_NBR, 0, 1000);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb ==  500000), "clamp : max");
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    DriftTestPollAdd(SNTPc_CFG_DRIFT_WIN_NBR, 0, -1000);
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb == -500000), "clamp : min");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DriftTestResid()
+*
+* Description : Check the residuals of the fit & the standard error of the frequency error.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The offsets are +/- 10 us around a flat line, in a pattern symmetric about the mean time
+*                   of the polls, so that the fitted slope is null.
+*
+*               (2) Each squared residual of 100 is divided by the 6 degrees of freedom before the sum :
+*                   sqrt(8 * 16) = 11 us.
+*
+*               (3) The sum of the squared distances to the mean time is 168 * (32 s)^2, i.e. the square of
+*                   6636 in 1/16 s : 11 * 16000 / 6636 = 26 ppb.
+*********************************************************************************************************
+*/
+
+static  void  DriftTestResid (void)
+{
+    static  const  CPU_INT64S  offset_tbl[] = { 10, -10, -10, 10, 10, -10, -10, 10 };
+    SNTPc_DRIFT_STATUS  status;
+    SNTPc_ERR           err;
+    CPU_INT32U          ix;
+
+
+    DriftTestLocalTS = DRIFT_TEST_TS;
+    SNTPc_DriftInit();
+    for (ix = 0u; ix < sizeof(offset_tbl) / sizeof(offset_tbl[0]); ix++) {
+        if (ix != 0u) {
+            DriftTestLocalTS += DRIFT_TEST_POLL_SEC * DRIFT_TEST_SEC;
+        }
+        SNTPc_DriftAdd(DriftTestLocalTS, offset_tbl[ix], DRIFT_TEST_DLY_US);
+    }
+
+    SNTPc_DriftStatusGet(&status, &err);
+    DriftTestChk((CPU_BOOLEAN)(err                == SNTPc_ERR_NONE), "resid : err");
+                                                                /* See Note #1.                                         */
+    DriftTestChk((CPU_BOOLEAN)(status.Freq_ppb    ==  0 ), "resid : freq");
+                                                                /* See Note #2.                                         */
+    DriftTestChk((CPU_BOOLEAN)(status.Resid_us    == 11u), "resid : resid");
+                                                                /* See Note #3.                                         */
+    DriftTestChk((CPU_BOOLEAN)(status.FreqErr_ppb == 26u), "resid : freq err");
+}
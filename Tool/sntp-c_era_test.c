@@ -0,0 +1,396 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  SNTP CLIENT NTP ERA ROLLOVER TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_era_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. Across the end of NTP era 0, at
+*                2036-02-07 06:28:16 UTC, it checks :
+*
+*                (a) The conversion of NTP timestamps to 64-bit times by SNTPc_TS_ToTime64(), against
+*                    several era pivots set by SNTPc_EraPivotSet().
+*
+*                (b) The offset & round trip delay computed by SNTPc_FixedOffsetGet(), SNTPc_FixedDlyGet()
+*                    & SNTPc_PktDecode() from exchanges whose timestamps straddle the rollover.
+*
+*            (2) It is linked with the modules of the SNTP client, built for the host with the include paths
+*                & libraries of the application (uC/CPU host port, uC/LIB, KAL, uC/TCPIP & the directory of
+*                'sntp-c_cfg.h'), SNTPc_CFG_EXT_TS_EN & SNTPc_CFG_NTS_EN disabled, e.g. :
+*
+*                    cc $(INC) -o sntp-c_era_test Tool/sntp-c_era_test.c Source/sntp-c*.c $(LIB)
+*
+*                & returns EXIT_SUCCESS if every case passes.
+*
+*            (3) The expected times of the era table are computed independently of SNTPc_TS_ToTime64(), as
+*                the time within 2^31 seconds of the pivot whose low 32 bits are the timestamp seconds.
+*
+*            (4) The expected offsets & delays of the exchange table are computed from the durations between
+*                the timestamps, independently of the rollover.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_clk.h>
+#include  <Source/sntp-c_fixed.h>
+#include  <Source/net_util.h>
+#include  <lib_mem.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  ERA_TEST_PIVOT_2020               3786825600LL         /* 2020-01-01 00:00:00 UTC.                             */
+#define  ERA_TEST_PIVOT_2036               4294967296LL         /* 2036-02-07 06:28:16 UTC, first second of era 1.      */
+#define  ERA_TEST_PIVOT_2040               4417977600LL         /* 2040-01-01 00:00:00 UTC.                             */
+
+#define  ERA_TEST_SEC                     0x100000000LL         /* 1 s,   in 32.32 fixed point.                         */
+#define  ERA_TEST_HALF_SEC                 0x80000000LL         /* 1/2 s, in 32.32 fixed point.                         */
+#define  ERA_TEST_QUARTER_SEC              0x40000000LL         /* 1/4 s, in 32.32 fixed point.                         */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct era_test_case {
+    CPU_INT64S  PivotSec;                                       /* Era pivot, in seconds since 1900.                    */
+    CPU_INT32U  TS_Sec;                                         /* Seconds of the NTP timestamp.                        */
+    CPU_INT64S  ExpSec;                                         /* Expected time, in seconds since 1900.                */
+} ERA_TEST_CASE;
+
+
+typedef struct era_test_xchg {
+    SNTP_FIXED_TS  TS_Originate;                                /* T1.                                                  */
+    SNTP_FIXED_TS  TS_Rx;                                       /* T2.                                                  */
+    SNTP_FIXED_TS  TS_Tx;                                       /* T3.                                                  */
+    SNTP_FIXED_TS  TS_Terminate;                                /* T4.                                                  */
+    SNTP_FIXED     ExpOffset;                                   /* Expected offset (see Note #4).                       */
+    SNTP_FIXED     ExpDly;                                      /* Expected round trip delay.                           */
+} ERA_TEST_XCHG;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  ERA_TEST_CASE  EraTestTbl[] = {
+                                                                /* ----------- STRADDLE THE 2036 ROLLOVER ------------- */
+    { ERA_TEST_PIVOT_2020,         0xFFFFFFFEu, 4294967294LL },
+    { ERA_TEST_PIVOT_2020,         0xFFFFFFFFu, 4294967295LL },
+    { ERA_TEST_PIVOT_2020,         0x00000000u, 4294967296LL },
+    { ERA_TEST_PIVOT_2020,         0x00000001u, 4294967297LL },
+
+    { ERA_TEST_PIVOT_2036 - 1LL,   0xFFFFFFFEu, 4294967294LL },
+    { ERA_TEST_PIVOT_2036 - 1LL,   0xFFFFFFFFu, 4294967295LL },
+    { ERA_TEST_PIVOT_2036 - 1LL,   0x00000000u, 4294967296LL },
+    { ERA_TEST_PIVOT_2036 - 1LL,   0x00000001u, 4294967297LL },
+
+    { ERA_TEST_PIVOT_2036,         0xFFFFFFFEu, 4294967294LL }, /* Pivot at the rollover itself.                       */
+    { ERA_TEST_PIVOT_2036,         0xFFFFFFFFu, 4294967295LL },
+    { ERA_TEST_PIVOT_2036,         0x00000000u, 4294967296LL },
+    { ERA_TEST_PIVOT_2036,         0x00000001u, 4294967297LL },
+
+    { ERA_TEST_PIVOT_2036 + 1LL,   0xFFFFFFFEu, 4294967294LL },
+    { ERA_TEST_PIVOT_2036 + 1LL,   0xFFFFFFFFu, 4294967295LL },
+    { ERA_TEST_PIVOT_2036 + 1LL,   0x00000000u, 4294967296LL },
+    { ERA_TEST_PIVOT_2036 + 1LL,   0x00000001u, 4294967297LL },
+
+    { ERA_TEST_PIVOT_2040,         0xFFFFFFFEu, 4294967294LL },
+    { ERA_TEST_PIVOT_2040,         0xFFFFFFFFu, 4294967295LL },
+    { ERA_TEST_PIVOT_2040,         0x00000000u, 4294967296LL },
+    { ERA_TEST_PIVOT_2040,         0x00000001u, 4294967297LL },
+                                                                /* ------------ LIMITS OF THE PIVOT WINDOW ------------ */
+    { ERA_TEST_PIVOT_2036,         0x7FFFFFFFu, 6442450943LL }, /* 2^31 - 1 s after the pivot.                         */
+    { ERA_TEST_PIVOT_2036,         0x80000000u, 2147483648LL }, /* 2^31     s before the pivot.                        */
+    { ERA_TEST_PIVOT_2020,         0x61B65F7Fu, 5934309247LL }, /* 2^31 - 1 s after the pivot, in era 1.               */
+    { ERA_TEST_PIVOT_2020,         0x61B65F80u, 1639341952LL }, /* 2^31     s after the pivot, taken as before it.     */
+    { 0LL,                         0xFFFFFFFFu,         -1LL }  /* Before the prime epoch.                             */
+};
+
+
+static  const  ERA_TEST_XCHG  EraTestXchgTbl[] = {
+    {                                                           /* Local & server clocks straddle the rollover.         */
+        0xFFFFFFFF00000000uLL,                                  /* T1 :  -1    s.                                       */
+        0xFFFFFFFF80000000uLL,                                  /* T2 :  -1/2  s.                                       */
+        0x0000000040000000uLL,                                  /* T3 :  +1/4  s.                                       */
+        0x00000000C0000000uLL,                                  /* T4 :  +3/4  s.                                       */
+         0LL,
+         ERA_TEST_SEC
+    },
+    {                                                           /* Server clock after the rollover.                     */
+        0xFFFFFFF000000000uLL,                                  /* T1 : -16    s.                                       */
+        0x0000000500000000uLL,                                  /* T2 :  +5    s.                                       */
+        0x0000000580000000uLL,                                  /* T3 :  +5.5  s.                                       */
+        0xFFFFFFF100000000uLL,                                  /* T4 : -15    s.                                       */
+        (20LL * ERA_TEST_SEC) + ERA_TEST_HALF_SEC + ERA_TEST_QUARTER_SEC,
+         ERA_TEST_HALF_SEC
+    },
+    {                                                           /* Server clock before the rollover.                    */
+        0x0000000A00000000uLL,                                  /* T1 : +10    s.                                       */
+        0xFFFFFFF000000000uLL,                                  /* T2 : -16    s.                                       */
+        0xFFFFFFF040000000uLL,                                  /* T3 : -15.75 s.                                       */
+        0x0000000A80000000uLL,                                  /* T4 : +10.5  s.                                       */
+        -((26LL * ERA_TEST_SEC) + (ERA_TEST_QUARTER_SEC / 2)),
+         ERA_TEST_QUARTER_SEC
+    },
+    {                                                           /* Odd differences across the rollover.                 */
+        0xFFFFFFFFFFFFFFFFuLL,                                  /* T1 : -2^-32 s.                                       */
+        0x0000000000000000uLL,                                  /* T2 :  0     s.                                       */
+        0x0000000000000001uLL,                                  /* T3 : +2^-32 s.                                       */
+        0x0000000000000000uLL,                                  /* T4 :  0     s.                                       */
+         1LL,
+         0LL
+    }
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  EraTestXchgChk (const  ERA_TEST_XCHG  *p_xchg);
+
+static  void         EraTestTS_Wr   (       SNTP_TS        *p_ts,
+                                            SNTP_FIXED_TS   ts);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the NTP era rollover test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every case passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : (1) SNTPc_ClkInit() seeds the pivot with SNTPc_CFG_ERA_PIVOT_SEC, the build-time pivot.
+*
+*               (2) The fraction of second of the timestamp MUST NOT change the time returned.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    const  ERA_TEST_CASE  *p_case;
+           SNTP_TS         ts;
+           CPU_INT64S      time_sec;
+           CPU_INT32U      case_nbr;
+           CPU_INT32U      fail_nbr;
+           CPU_INT32U      ix;
+
+
+    case_nbr = 0u;
+    fail_nbr = 0u;
+
+    SNTPc_ClkInit();                                            /* See Note #1.                                         */
+    if (SNTPc_EraPivotGet() != (CPU_INT64S)SNTPc_CFG_ERA_PIVOT_SEC) {
+        printf("FAIL  init pivot %lld, expected %lld\n",
+               (long long)SNTPc_EraPivotGet(),
+               (long long)SNTPc_CFG_ERA_PIVOT_SEC);
+        fail_nbr++;
+    }
+                                                                /* ------------------ ERA CONVERSION ------------------ */
+    for (ix = 0u; ix < sizeof(EraTestTbl) / sizeof(EraTestTbl[0]); ix++) {
+        p_case = &EraTestTbl[ix];
+
+        SNTPc_EraPivotSet(p_case->PivotSec);
+        ts.Sec   = p_case->TS_Sec;
+        ts.Frac  = 0xFFFFFFFFu;                                 /* See Note #2.                                         */
+        time_sec = SNTPc_TS_ToTime64(ts);
+
+        if ((time_sec            != p_case->ExpSec  ) ||
+            (SNTPc_EraPivotGet() != p_case->PivotSec)) {
+            printf("FAIL  pivot %lld  ts 0x%08lX : %lld, expected %lld\n",
+                   (long long    )p_case->PivotSec,
+                   (unsigned long)p_case->TS_Sec,
+                   (long long    )time_sec,
+                   (long long    )p_case->ExpSec);
+            fail_nbr++;
+        }
+        case_nbr++;
+    }
+                                                                /* ---------------- OFFSET & DELAY -------------------- */
+    for (ix = 0u; ix < sizeof(EraTestXchgTbl) / sizeof(EraTestXchgTbl[0]); ix++) {
+        if (EraTestXchgChk(&EraTestXchgTbl[ix]) != DEF_OK) {
+            printf("FAIL  exchange %lu\n", (unsigned long)ix);
+            fail_nbr++;
+        }
+        case_nbr++;
+    }
+
+    printf("%lu cases, %lu failed\n",
+           (unsigned long)case_nbr,
+           (unsigned long)fail_nbr);
+
+    return ((fail_nbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          EraTestXchgChk()
+*
+* Description : Check the offset & round trip delay of an exchange.
+*
+* Argument(s) : p_xchg      Pointer to the exchange.
+*
+* Return(s)   : DEF_OK,   if the offset & delay of SNTPc_FixedOffsetGet(), SNTPc_FixedDlyGet() &
+*                         SNTPc_PktDecode() are the expected ones.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The local reception timestamp (T4) is passed to SNTPc_PktDecode() in the reference
+*                   timestamp field of the packet (see 'sntp-c.c  SNTPc_PktDecode()  Note #1').
+*
+*               (2) SNTPc_PktDecode() sets a negative round trip delay to 0.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  EraTestXchgChk (const  ERA_TEST_XCHG  *p_xchg)
+{
+    SNTP_PKT      pkt;
+    SNTPc_SAMPLE  sample;
+    SNTP_FIXED    offset;
+    SNTP_FIXED    dly;
+    SNTPc_ERR     err;
+    CPU_BOOLEAN   result;
+
+
+    result = DEF_OK;
+                                                                /* -------------- FIXED-POINT FUNCTIONS --------------- */
+    offset = SNTPc_FixedOffsetGet(p_xchg->TS_Originate,
+                                  p_xchg->TS_Rx,
+                                  p_xchg->TS_Tx,
+                                  p_xchg->TS_Terminate);
+    dly    = SNTPc_FixedDlyGet(p_xchg->TS_Originate,
+                               p_xchg->TS_Rx,
+                               p_xchg->TS_Tx,
+                               p_xchg->TS_Terminate);
+    if ((offset != p_xchg->ExpOffset) ||
+        (dly    != p_xchg->ExpDly   )) {
+        printf("      fixed : offset %lld, expected %lld, delay %lld, expected %lld\n",
+               (long long)offset,
+               (long long)p_xchg->ExpOffset,
+               (long long)dly,
+               (long long)p_xchg->ExpDly);
+        result = DEF_FAIL;
+    }
+                                                                /* ----------------- PACKET DECODING ------------------ */
+    Mem_Clr(&pkt, sizeof(pkt));
+    EraTestTS_Wr(&pkt.TS_Originate, p_xchg->TS_Originate);
+    EraTestTS_Wr(&pkt.TS_Rx,        p_xchg->TS_Rx);
+    EraTestTS_Wr(&pkt.TS_Tx,        p_xchg->TS_Tx);
+    EraTestTS_Wr(&pkt.TS_Ref,       p_xchg->TS_Terminate);      /* See Note #1.                                         */
+
+    SNTPc_PktDecode(&pkt, &sample, &err);
+    if ((err                    != SNTPc_ERR_NONE                                  ) ||
+        (sample.TS_Originate    != p_xchg->TS_Originate                            ) ||
+        (sample.TS_Terminate    != p_xchg->TS_Terminate                            ) ||
+        (sample.Offset_ns       != SNTPc_FixedToNs(p_xchg->ExpOffset)              ) ||
+        (sample.RoundTripDly_ns != SNTPc_FixedToNs(DEF_MAX(p_xchg->ExpDly, 0)))) { /* See Note #2.                */
+        printf("      decode : offset %lld ns, expected %lld ns, delay %lld ns, expected %lld ns\n",
+               (long long)sample.Offset_ns,
+               (long long)SNTPc_FixedToNs(p_xchg->ExpOffset),
+               (long long)sample.RoundTripDly_ns,
+               (long long)SNTPc_FixedToNs(p_xchg->ExpDly));
+        result = DEF_FAIL;
+    }
+
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           EraTestTS_Wr()
+*
+* Description : Write a 32.32 fixed-point timestamp to an NTP timestamp field of a packet.
+*
+* Argument(s) : p_ts        Pointer to the timestamp field, in network order.
+*
+*               ts          Timestamp, in 32.32 fixed point.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : EraTestXchgChk().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  EraTestTS_Wr (SNTP_TS        *p_ts,
+                            SNTP_FIXED_TS   ts)
+{
+    p_ts->Sec  = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts >> 32u));
+    p_ts->Frac = NET_UTIL_HOST_TO_NET_32((CPU_INT32U)(ts &  DEF_INT_32U_MAX_VAL));
+}
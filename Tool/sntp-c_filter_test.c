@@ -0,0 +1,386 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT CLOCK FILTER TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_filter_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It checks the clock filter of
+*                'sntp-c_filter.c' : selection of the sample with the lowest round trip delay, aging of the
+*                dispersion, filter dispersion & jitter, & replacement of the oldest sample.
+*
+*            (2) It is linked with 'sntp-c_filter.c', 'sntp-c_fixed.c' & 'sntp-c_sel.c', built for the host
+*                with the include paths of the application (uC/CPU host port, uC/LIB, uC/TCPIP & the
+*                directory of 'sntp-c_cfg.h'), e.g. :
+*
+*                    cc $(INC) -o sntp-c_filter_test Tool/sntp-c_filter_test.c Source/sntp-c_filter.c \
+*                       Source/sntp-c_fixed.c Source/sntp-c_sel.c
+*
+*                & returns EXIT_SUCCESS if every check passes.
+*
+*            (3) The expected values are computed by hand from RFC #5905, Section 10 : the dispersion of a
+*                sample grows by 15 us per second of age, & the filter dispersion weights the sorted samples
+*                by 1/2, 1/4, ..., the empty stages counting as 16 s.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_filter.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  FILTER_TEST_TS             0xE3D1A2B300000000uLL       /* 2021-02-13 00:58:27 UTC, in 32.32 fixed point.       */
+#define  FILTER_TEST_SEC                   0x100000000uLL       /* 1 s, in 32.32 fixed point.                           */
+
+                                                                /* Dispersion of the 7 empty stages of a 1-sample ...   */
+                                                                /* ... filter : 16 s * (1/4 + 1/8 + ... + 1/256).       */
+#define  FILTER_TEST_DISP_EMPTY_7_US                 7937500u
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  FilterTestNbr;
+static  CPU_INT32U  FilterTestFailNbr;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  FilterTestChk    (      CPU_BOOLEAN   is_ok,
+                                const CPU_CHAR     *p_name);
+
+static  void  FilterTestEmpty  (void);
+
+static  void  FilterTestOne    (void);
+
+static  void  FilterTestSel    (void);
+
+static  void  FilterTestAge    (void);
+
+static  void  FilterTestRing   (void);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the clock filter test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every check passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    FilterTestEmpty();
+    FilterTestOne();
+    FilterTestSel();
+    FilterTestAge();
+    FilterTestRing();
+
+    printf("%lu checks, %lu failed\n",
+           (unsigned long)FilterTestNbr,
+           (unsigned long)FilterTestFailNbr);
+
+    return ((FilterTestFailNbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          FilterTestChk()
+*
+* Description : Count a check & report it if it failed.
+*
+* Argument(s) : is_ok       Result of the check.
+*
+*               p_name      Pointer to the name of the check.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FilterTestChk (      CPU_BOOLEAN   is_ok,
+                             const CPU_CHAR     *p_name)
+{
+    FilterTestNbr++;
+    if (is_ok != DEF_YES) {
+        printf("FAIL  %s\n", p_name);
+        FilterTestFailNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FilterTestEmpty()
+*
+* Description : Check that an empty filter selects no sample.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FilterTestEmpty (void)
+{
+    SNTPc_FILTER         filter;
+    SNTPc_FILTER_STATUS  status;
+    CPU_BOOLEAN          result;
+
+
+    SNTPc_FilterInit(&filter);
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS, &status);
+    FilterTestChk((CPU_BOOLEAN)(result == DEF_FAIL), "empty : no sample");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FilterTestOne()
+*
+* Description : Check the status of a filter holding a single sample.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The filter dispersion is half the dispersion of the sample, plus the seven empty stages
+*                   (see 'sntp-c_filter_test.c  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  FilterTestOne (void)
+{
+    SNTPc_FILTER         filter;
+    SNTPc_FILTER_STATUS  status;
+    CPU_BOOLEAN          result;
+
+
+    SNTPc_FilterInit(&filter);
+    SNTPc_FilterAdd(&filter, -1000, 500u, 100u, FILTER_TEST_TS);
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS, &status);
+    FilterTestChk((CPU_BOOLEAN)(result                 == DEF_OK), "one : selected");
+    FilterTestChk((CPU_BOOLEAN)(status.Offset_us       == -1000 ), "one : offset");
+    FilterTestChk((CPU_BOOLEAN)(status.RoundTripDly_us ==   500u), "one : delay");
+    FilterTestChk((CPU_BOOLEAN)(status.Age_ms          ==     0u), "one : age");
+    FilterTestChk((CPU_BOOLEAN)(status.Disp_us         == 50u + FILTER_TEST_DISP_EMPTY_7_US), "one : disp");
+    FilterTestChk((CPU_BOOLEAN)(status.Jitter_us       ==     0u), "one : jitter");
+    FilterTestChk((CPU_BOOLEAN)(status.SampleNbr       ==     1u), "one : sample nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FilterTestSel()
+*
+* Description : Check the selection of the sample with the lowest round trip delay & the jitter.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The offsets of the two other samples differ by 100 us from the selected one : the jitter
+*                   is sqrt((100^2 + 100^2) / 2) = 100 us.
+*********************************************************************************************************
+*/
+
+static  void  FilterTestSel (void)
+{
+    SNTPc_FILTER         filter;
+    SNTPc_FILTER_STATUS  status;
+    CPU_BOOLEAN          result;
+
+
+    SNTPc_FilterInit(&filter);
+    SNTPc_FilterAdd(&filter, 100, 900u, 0u, FILTER_TEST_TS);
+    SNTPc_FilterAdd(&filter, 200, 300u, 0u, FILTER_TEST_TS);
+    SNTPc_FilterAdd(&filter, 300, 600u, 0u, FILTER_TEST_TS);
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS, &status);
+    FilterTestChk((CPU_BOOLEAN)(result                 == DEF_OK), "sel : selected");
+    FilterTestChk((CPU_BOOLEAN)(status.Offset_us       ==  200  ), "sel : offset of the lowest delay");
+    FilterTestChk((CPU_BOOLEAN)(status.RoundTripDly_us ==  300u ), "sel : lowest delay");
+    FilterTestChk((CPU_BOOLEAN)(status.Jitter_us       ==  100u ), "sel : jitter");
+    FilterTestChk((CPU_BOOLEAN)(status.SampleNbr       ==    3u ), "sel : sample nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FilterTestAge()
+*
+* Description : Check the aging of the dispersion & the exclusion of the samples too old to be used.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) After 10 s, the dispersion of a sample grows by 10 * 15 us.
+*
+*               (2) A sample whose aged dispersion reaches 16 s is not used, even if its round trip delay is
+*                   the lowest.
+*********************************************************************************************************
+*/
+
+static  void  FilterTestAge (void)
+{
+    SNTPc_FILTER         filter;
+    SNTPc_FILTER_STATUS  status;
+    CPU_BOOLEAN          result;
+
+                                                                /* See Note #1.                                         */
+    SNTPc_FilterInit(&filter);
+    SNTPc_FilterAdd(&filter, 0, 100u, 0u, FILTER_TEST_TS);
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS + (10u * FILTER_TEST_SEC), &status);
+    FilterTestChk((CPU_BOOLEAN)(result         == DEF_OK), "age : selected");
+    FilterTestChk((CPU_BOOLEAN)(status.Age_ms  == 10000u), "age : age");
+    FilterTestChk((CPU_BOOLEAN)(status.Disp_us == 75u + FILTER_TEST_DISP_EMPTY_7_US), "age : disp");
+                                                                /* See Note #2.                                         */
+    SNTPc_FilterInit(&filter);
+    SNTPc_FilterAdd(&filter, 0, 100u, SNTPc_FILTER_MAX_DISP_US - 1000u, FILTER_TEST_TS);
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS + (100u * FILTER_TEST_SEC), &status);
+    FilterTestChk((CPU_BOOLEAN)(result == DEF_FAIL), "age : too old, alone");
+
+    SNTPc_FilterAdd(&filter, 500, 200u, 0u, FILTER_TEST_TS + (100u * FILTER_TEST_SEC));
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS + (100u * FILTER_TEST_SEC), &status);
+    FilterTestChk((CPU_BOOLEAN)(result           == DEF_OK), "age : too old, with a new one");
+    FilterTestChk((CPU_BOOLEAN)(status.Offset_us ==  500  ), "age : too old sample skipped");
+    FilterTestChk((CPU_BOOLEAN)(status.SampleNbr ==    1u ), "age : sample nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FilterTestRing()
+*
+* Description : Check that a new sample replaces the oldest one once the eight stages are used.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The first sample has the lowest round trip delay & is selected until the ninth sample
+*                   replaces it. The ninth sample has the lowest delay of the remaining ones.
+*********************************************************************************************************
+*/
+
+static  void  FilterTestRing (void)
+{
+    SNTPc_FILTER         filter;
+    SNTPc_FILTER_STATUS  status;
+    CPU_BOOLEAN          result;
+    CPU_INT32U           ix;
+
+
+    SNTPc_FilterInit(&filter);
+    SNTPc_FilterAdd(&filter, 1, 10u, 0u, FILTER_TEST_TS);       /* See Note #1.                                         */
+    for (ix = 1u; ix < SNTPc_FILTER_STAGE_NBR; ix++) {
+        SNTPc_FilterAdd(&filter, (CPU_INT64S)ix + 1, 1000u - ix, 0u, FILTER_TEST_TS);
+    }
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS, &status);
+    FilterTestChk((CPU_BOOLEAN)(result           == DEF_OK), "ring : full, selected");
+    FilterTestChk((CPU_BOOLEAN)(status.Offset_us ==  1    ), "ring : full, first sample");
+    FilterTestChk((CPU_BOOLEAN)(status.SampleNbr ==  SNTPc_FILTER_STAGE_NBR), "ring : full, sample nbr");
+
+    SNTPc_FilterAdd(&filter, 9, 900u, 0u, FILTER_TEST_TS);
+
+    result = SNTPc_FilterEval(&filter, FILTER_TEST_TS, &status);
+    FilterTestChk((CPU_BOOLEAN)(result                 == DEF_OK), "ring : shifted, selected");
+    FilterTestChk((CPU_BOOLEAN)(status.Offset_us       ==  9    ), "ring : shifted, first sample replaced");
+    FilterTestChk((CPU_BOOLEAN)(status.RoundTripDly_us ==  900u ), "ring : shifted, delay");
+    FilterTestChk((CPU_BOOLEAN)(status.SampleNbr       ==  SNTPc_FILTER_STAGE_NBR), "ring : shifted, sample nbr");
+}
@@ -0,0 +1,180 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SNTP CLIENT FIXED-POINT OFFSET & DELAY TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_fixed_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It checks the offset & the round trip
+*                delay computed by SNTPc_FixedOffsetGet() & SNTPc_FixedDlyGet() from the four timestamps of
+*                an exchange, in particular when both differences of the offset are odd.
+*
+*            (2) It is linked with 'sntp-c_fixed.c', built for the host with the include paths of the
+*                application (uC/CPU host port, uC/LIB, uC/TCPIP & the directory of 'sntp-c_cfg.h'), e.g. :
+*
+*                    cc $(INC) -o sntp-c_fixed_test Tool/sntp-c_fixed_test.c Source/sntp-c_fixed.c
+*
+*                & returns EXIT_SUCCESS if every case passes.
+*
+*            (3) The expected offsets of the table are the exact half of ((T2 - T1) + (T3 - T4)), rounded
+*                toward minus infinity, in units of 2^-32 seconds.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_fixed.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  FIXED_TEST_TS              0xE3D1A2B300000000uLL       /* 2021-02-13 00:58:27 UTC, in 32.32 fixed point.       */
+#define  FIXED_TEST_HALF_SEC                0x80000000uLL       /* 1/2 s, in 32.32 fixed point.                         */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct fixed_test_case {
+    SNTP_FIXED_TS  TS_Originate;                                /* T1.                                                  */
+    SNTP_FIXED_TS  TS_Rx;                                       /* T2.                                                  */
+    SNTP_FIXED_TS  TS_Tx;                                       /* T3.                                                  */
+    SNTP_FIXED_TS  TS_Terminate;                                /* T4.                                                  */
+    SNTP_FIXED     ExpOffset;                                   /* Expected offset (see Note #3).                       */
+    SNTP_FIXED     ExpDly;                                      /* Expected round trip delay.                           */
+} FIXED_TEST_CASE;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  FIXED_TEST_CASE  FixedTestTbl[] = {
+                                                                /* -------------- BOTH DIFFERENCES ODD --------------- */
+    { FIXED_TEST_TS, FIXED_TEST_TS + 1u,  FIXED_TEST_TS + 2u,  FIXED_TEST_TS + 1u,           1,  0 },
+    { FIXED_TEST_TS, FIXED_TEST_TS - 1u,  FIXED_TEST_TS - 2u,  FIXED_TEST_TS - 1u,          -1,  0 },
+    { FIXED_TEST_TS, FIXED_TEST_TS + 3u,  FIXED_TEST_TS + 3u,  FIXED_TEST_TS + 6u,           0,  6 },
+    { FIXED_TEST_TS, FIXED_TEST_TS + 5u,  FIXED_TEST_TS + 9u,  FIXED_TEST_TS + 2u,           6, -2 },
+    { FIXED_TEST_TS, FIXED_TEST_TS + FIXED_TEST_HALF_SEC + 1u,  /* Offset of 1/2 s + 2^-32 s.                          */
+                     FIXED_TEST_TS + FIXED_TEST_HALF_SEC + 3u,
+                                                           FIXED_TEST_TS + 2u,  0x80000001LL,  0 },
+                                                                /* --------------- ONE DIFFERENCE ODD ----------------- */
+    { FIXED_TEST_TS, FIXED_TEST_TS + 4u,  FIXED_TEST_TS + 5u,  FIXED_TEST_TS + 3u,           3,  2 },
+    { FIXED_TEST_TS, FIXED_TEST_TS - 3u,  FIXED_TEST_TS + 10u, FIXED_TEST_TS + 8u,          -1, -5 },
+                                                                /* ---------------------- LIMITS ---------------------- */
+    { 0u,            0x7FFFFFFFFFFFFFFFuLL, 0x7FFFFFFFFFFFFFFFuLL, 0u,   0x7FFFFFFFFFFFFFFFLL,        0 },
+    { 0u,            0x8000000000000000uLL, 0x8000000000000000uLL, 0u,  -0x7FFFFFFFFFFFFFFFLL - 1LL,  0 },
+    { 0u,            0x7FFFFFFFFFFFFFFFuLL, 0x8000000000000000uLL, 0u,  -1LL,                        -1 }
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the fixed-point offset & delay test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every case passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    const  FIXED_TEST_CASE  *p_case;
+           SNTP_FIXED        offset;
+           SNTP_FIXED        dly;
+           CPU_INT32U        fail_nbr;
+           CPU_INT32U        ix;
+
+
+    fail_nbr = 0u;
+
+    for (ix = 0u; ix < sizeof(FixedTestTbl) / sizeof(FixedTestTbl[0]); ix++) {
+        p_case = &FixedTestTbl[ix];
+
+        offset = SNTPc_FixedOffsetGet(p_case->TS_Originate,
+                                      p_case->TS_Rx,
+                                      p_case->TS_Tx,
+                                      p_case->TS_Terminate);
+        dly    = SNTPc_FixedDlyGet(p_case->TS_Originate,
+                                   p_case->TS_Rx,
+                                   p_case->TS_Tx,
+                                   p_case->TS_Terminate);
+
+        if ((offset != p_case->ExpOffset) ||
+            (dly    != p_case->ExpDly   )) {
+            printf("FAIL  case %lu : offset %lld, expected %lld, delay %lld, expected %lld\n",
+                   (unsigned long)ix,
+                   (long long    )offset,
+                   (long long    )p_case->ExpOffset,
+                   (long long    )dly,
+                   (long long    )p_case->ExpDly);
+            fail_nbr++;
+        }
+    }
+
+    printf("%lu cases, %lu failed\n",
+           (unsigned long)ix,
+           (unsigned long)fail_nbr);
+
+    return ((fail_nbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
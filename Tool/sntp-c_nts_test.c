@@ -0,0 +1,1095 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  SNTP CLIENT NTS ENCODING & DECODING TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_nts_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It checks the NTS key establishment
+*                records & the NTS extension fields built & parsed by 'sntp-c_nts.c' : round trips, &
+*                truncated records, bad lengths, missing critical bits & unknown critical records.
+*
+*            (2) It is linked with 'sntp-c_nts.c', built for the host with the include paths of the
+*                application (uC/CPU host port, uC/LIB, uC/TCPIP & the directory of 'sntp-c_cfg.h') &
+*                SNTPc_CFG_NTS_EN enabled, e.g. :
+*
+*                    cc $(INC) -o sntp-c_nts_test Tool/sntp-c_nts_test.c Source/sntp-c_nts.c lib_mem.c
+*
+*                & returns EXIT_SUCCESS if every check passes.
+*
+*            (3) The functions of the product's BSP are replaced by test functions (see 'LOCAL BSP
+*                FUNCTIONS'). The AEAD is a keyed checksum, NOT AEAD_AES_SIV_CMAC_256 : the test covers the
+*                encoding & decoding of the packets, not the cryptography.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <lib_mem.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_nts.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  NTS_TEST_BUF_LEN                               2048u
+
+#define  NTS_TEST_REC_NBR_MAX                             10u   /* Max nbr of records of a KE resp case.                */
+#define  NTS_TEST_COOKIE_LEN                              70u   /* Len of the cookies, padded to 72 in the EF.          */
+#define  NTS_TEST_COOKIE_EF_LEN                           76u
+#define  NTS_TEST_PT_COOKIE_LEN                           40u   /* Len of the cookies of the replies.                   */
+#define  NTS_TEST_PT_LEN                                  88u   /* Two cookie EFs of the replies.                       */
+#define  NTS_TEST_PORT_NBR                              4460u
+
+                                                                /* NTS-KE record types, with the critical bit (C).      */
+#define  NTS_TEST_REC_END_C                           0x8000u
+#define  NTS_TEST_REC_END                             0x0000u
+#define  NTS_TEST_REC_NEXT_PROTO_C                    0x8001u
+#define  NTS_TEST_REC_NEXT_PROTO                      0x0001u
+#define  NTS_TEST_REC_ERR_C                           0x8002u
+#define  NTS_TEST_REC_WARN                            0x0003u
+#define  NTS_TEST_REC_AEAD                            0x0004u
+#define  NTS_TEST_REC_AEAD_C                          0x8004u
+#define  NTS_TEST_REC_COOKIE                          0x0005u
+#define  NTS_TEST_REC_SERVER                          0x0006u
+#define  NTS_TEST_REC_PORT                            0x0007u
+#define  NTS_TEST_REC_UNKNOWN                         0x0032u
+#define  NTS_TEST_REC_UNKNOWN_C                       0x8032u
+
+                                                                /* Records of the KE resp cases.                        */
+#define  NTS_TEST_NEXT_PROTO                     { NTS_TEST_REC_NEXT_PROTO_C,  2u,  0u }
+#define  NTS_TEST_AEAD                           { NTS_TEST_REC_AEAD,          2u, 15u }
+#define  NTS_TEST_COOKIE                         { NTS_TEST_REC_COOKIE,       64u, 0xC1u }
+#define  NTS_TEST_END                            { NTS_TEST_REC_END_C,         0u,  0u }
+
+                                                                /* NTP extension field types.                           */
+#define  NTS_TEST_EF_UID                              0x0104u
+#define  NTS_TEST_EF_COOKIE                           0x0204u
+#define  NTS_TEST_EF_PLACEHOLDER                      0x0304u
+#define  NTS_TEST_EF_AUTH                             0x0404u
+
+#define  NTS_TEST_AUTH_OFFSET                            312u   /* Offset of the authenticator of the test req.         */
+#define  NTS_TEST_REQ_LEN            (NTS_TEST_AUTH_OFFSET + SNTPc_NTS_EF_AUTH_LEN)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct nts_test_rec {
+    CPU_INT16U  Type;
+    CPU_INT16U  Len;                                            /* Len of the body.                                     */
+    CPU_INT16U  Val;                                            /* Body value, if 2 octets long. Else, fill octet.      */
+} NTS_TEST_REC;
+
+typedef struct nts_test_ke_case {
+    const CPU_CHAR      *NamePtr;
+          CPU_BOOLEAN    Exp;                                   /* Expected result.                                     */
+          CPU_INT16U     TruncLen;                              /* Nbr of octets removed from the end of the resp.      */
+          NTS_TEST_REC   RecTbl[NTS_TEST_REC_NBR_MAX];
+          CPU_INT08U     RecNbr;
+} NTS_TEST_KE_CASE;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  NTS_TEST_KE_CASE  NTS_TestKE_Tbl[] = {
+    { "ke valid",                         DEF_OK,    0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke valid, server & port",          DEF_OK,    0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE,
+        { NTS_TEST_REC_SERVER, 15u, 's' }, { NTS_TEST_REC_PORT, 2u, NTS_TEST_PORT_NBR }, NTS_TEST_END }, 6u },
+    { "ke warning & unknown record",      DEF_OK,    0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_WARN, 2u, 0u }, { NTS_TEST_REC_UNKNOWN, 4u, 0u },
+        NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 6u },
+    { "ke critical aead",                 DEF_OK,    0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_AEAD_C, 2u, 15u }, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke records after end",             DEF_OK,    0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END,
+        { NTS_TEST_REC_UNKNOWN_C, 4u, 0u } }, 5u },
+                                                                /* ------------------ TRUNCATED RESP ------------------ */
+    { "ke no end",                        DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE }, 3u },
+    { "ke truncated end hdr",             DEF_FAIL,  2u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke truncated cookie body",         DEF_FAIL, 14u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+                                                                /* -------------------- BAD LENGTHS ------------------- */
+    { "ke next proto len",                DEF_FAIL,  0u,
+      { { NTS_TEST_REC_NEXT_PROTO_C, 4u, 0u }, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke aead len",                      DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_AEAD, 4u, 15u }, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke port len",                      DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, { NTS_TEST_REC_PORT, 1u, 0u }, NTS_TEST_END }, 5u },
+    { "ke empty server",                  DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, { NTS_TEST_REC_SERVER, 0u, 0u }, NTS_TEST_END }, 5u },
+    { "ke server too long",               DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE,
+        { NTS_TEST_REC_SERVER, SNTPc_CFG_SERVER_HOSTNAME_LEN_MAX + 1u, 's' }, NTS_TEST_END }, 5u },
+    { "ke cookie too long",               DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, { NTS_TEST_REC_COOKIE, SNTPc_CFG_NTS_COOKIE_LEN_MAX + 1u, 0xC1u },
+        NTS_TEST_END }, 4u },
+                                                                /* ---------------- MISSING CRITICAL BIT -------------- */
+    { "ke end not critical",              DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_COOKIE, { NTS_TEST_REC_END, 0u, 0u } }, 4u },
+    { "ke next proto not critical",       DEF_FAIL,  0u,
+      { { NTS_TEST_REC_NEXT_PROTO, 2u, 0u }, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+                                                                /* -------- UNKNOWN CRITICAL & REJECTED RECORDS ------- */
+    { "ke unknown critical record",       DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_UNKNOWN_C, 4u, 0u }, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 5u },
+    { "ke error record",                  DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_ERR_C, 2u, 0u }, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 5u },
+    { "ke next proto not ntpv4",          DEF_FAIL,  0u,
+      { { NTS_TEST_REC_NEXT_PROTO_C, 2u, 1u }, NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke aead not siv",                  DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, { NTS_TEST_REC_AEAD, 2u, 30u }, NTS_TEST_COOKIE, NTS_TEST_END }, 4u },
+    { "ke no next proto",                 DEF_FAIL,  0u,
+      { NTS_TEST_AEAD, NTS_TEST_COOKIE, NTS_TEST_END }, 3u },
+    { "ke no aead",                       DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_COOKIE, NTS_TEST_END }, 3u },
+    { "ke no cookie",                     DEF_FAIL,  0u,
+      { NTS_TEST_NEXT_PROTO, NTS_TEST_AEAD, NTS_TEST_END }, 3u }
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U   NTS_TestNbr;
+static  CPU_INT32U   NTS_TestFailNbr;
+
+static  CPU_BOOLEAN  NTS_TestRandFail;                          /* Fail SNTPc_NTS_RandGet().                            */
+static  CPU_INT08U   NTS_TestRandVal;                           /* Next octet returned by SNTPc_NTS_RandGet().          */
+
+static  CPU_INT08U   NTS_TestKeyC2S[SNTPc_NTS_KEY_LEN];
+static  CPU_INT08U   NTS_TestKeyS2C[SNTPc_NTS_KEY_LEN];
+static  CPU_INT08U   NTS_TestUID[SNTPc_NTS_UID_LEN];
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void        NTS_TestChk          (      CPU_BOOLEAN        is_ok,
+                                          const CPU_CHAR          *p_name);
+
+static  void        NTS_TestKE_Req       (void);
+
+static  void        NTS_TestKE_Resp      (void);
+
+static  void        NTS_TestReq          (void);
+
+static  void        NTS_TestResp         (void);
+
+static  void        NTS_TestCookie       (void);
+
+static  void        NTS_TestUID_Chk      (void);
+
+static  CPU_INT16U  NTS_TestRecWr        (      CPU_INT08U        *p_buf,
+                                          const NTS_TEST_REC      *p_rec);
+
+static  CPU_INT16U  NTS_TestEF_Wr        (      CPU_INT08U        *p_buf,
+                                                CPU_INT16U         type,
+                                                CPU_INT16U         body_len,
+                                                CPU_INT08U         fill);
+
+static  CPU_INT16U  NTS_TestRespBuild    (      CPU_INT08U        *p_buf,
+                                                CPU_BOOLEAN        is_uid_after);
+
+static  void        NTS_TestTagCalc      (const CPU_INT08U        *p_key,
+                                          const CPU_INT08U        *p_nonce,
+                                                CPU_INT16U         nonce_len,
+                                          const CPU_INT08U        *p_ad,
+                                                CPU_INT16U         ad_len,
+                                          const CPU_INT08U        *p_pt,
+                                                CPU_INT16U         pt_len,
+                                                CPU_INT08U        *p_tag);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the NTS encoding & decoding test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every check passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < SNTPc_NTS_KEY_LEN; ix++) {
+        NTS_TestKeyC2S[ix] = (CPU_INT08U)(0x10u + ix);
+        NTS_TestKeyS2C[ix] = (CPU_INT08U)(0x80u + ix);
+    }
+    for (ix = 0u; ix < SNTPc_NTS_UID_LEN; ix++) {
+        NTS_TestUID[ix] = (CPU_INT08U)(0xA0u + ix);
+    }
+
+    NTS_TestKE_Req();
+    NTS_TestKE_Resp();
+    NTS_TestReq();
+    NTS_TestResp();
+    NTS_TestCookie();
+    NTS_TestUID_Chk();
+
+    printf("%lu checks, %lu failed\n",
+           (unsigned long)NTS_TestNbr,
+           (unsigned long)NTS_TestFailNbr);
+
+    return ((NTS_TestFailNbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        LOCAL BSP FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_AEAD_Seal()
+*
+* Description : Encrypt with the test AEAD (see Note #3).
+*
+* Argument(s) : See 'sntp-c.h  FUNCTION PROTOTYPES DEFINED IN PRODUCT'S BSP'.
+*
+* Return(s)   : DEF_OK.
+*
+* Caller(s)   : SNTPc_NTS_ReqBuild(),
+*               NTS_TestRespBuild().
+*
+* Note(s)     : (1) As with AEAD_AES_SIV_CMAC_256, the ciphertext is the tag followed by the encrypted
+*                   plaintext.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_AEAD_Seal (const CPU_INT08U  *p_key,
+                                  const CPU_INT08U  *p_nonce,
+                                        CPU_INT16U   nonce_len,
+                                  const CPU_INT08U  *p_ad,
+                                        CPU_INT16U   ad_len,
+                                  const CPU_INT08U  *p_pt,
+                                        CPU_INT16U   pt_len,
+                                        CPU_INT08U  *p_ct)
+{
+    CPU_INT16U  ix;
+
+
+    NTS_TestTagCalc(p_key, p_nonce, nonce_len, p_ad, ad_len, p_pt, pt_len, p_ct);
+    for (ix = 0u; ix < pt_len; ix++) {                          /* See Note #1.                                         */
+        p_ct[SNTPc_NTS_TAG_LEN + ix] = p_pt[ix] ^ p_key[ix % SNTPc_NTS_KEY_LEN] ^ p_ct[ix % SNTPc_NTS_TAG_LEN];
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SNTPc_NTS_AEAD_Open()
+*
+* Description : Decrypt & authenticate with the test AEAD (see Note #3).
+*
+* Argument(s) : See 'sntp-c.h  FUNCTION PROTOTYPES DEFINED IN PRODUCT'S BSP'.
+*
+* Return(s)   : DEF_OK,   if the ciphertext is authenticated.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : SNTPc_NTS_RespParse(),
+*               NTS_TestReq().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_AEAD_Open (const CPU_INT08U  *p_key,
+                                  const CPU_INT08U  *p_nonce,
+                                        CPU_INT16U   nonce_len,
+                                  const CPU_INT08U  *p_ad,
+                                        CPU_INT16U   ad_len,
+                                  const CPU_INT08U  *p_ct,
+                                        CPU_INT16U   ct_len,
+                                        CPU_INT08U  *p_pt)
+{
+    CPU_INT08U  tag[SNTPc_NTS_TAG_LEN];
+    CPU_INT16U  pt_len;
+    CPU_INT16U  ix;
+
+
+    if (ct_len < SNTPc_NTS_TAG_LEN) {
+        return (DEF_FAIL);
+    }
+    pt_len = ct_len - SNTPc_NTS_TAG_LEN;
+    for (ix = 0u; ix < pt_len; ix++) {
+        p_pt[ix] = p_ct[SNTPc_NTS_TAG_LEN + ix] ^ p_key[ix % SNTPc_NTS_KEY_LEN] ^ p_ct[ix % SNTPc_NTS_TAG_LEN];
+    }
+
+    NTS_TestTagCalc(p_key, p_nonce, nonce_len, p_ad, ad_len, p_pt, pt_len, tag);
+
+    return ((Mem_Cmp(tag, p_ct, SNTPc_NTS_TAG_LEN) == DEF_YES) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_NTS_RandGet()
+*
+* Description : Fill a buffer with a predictable sequence, in place of random octets.
+*
+* Argument(s) : See 'sntp-c.h  FUNCTION PROTOTYPES DEFINED IN PRODUCT'S BSP'.
+*
+* Return(s)   : DEF_FAIL, if NTS_TestRandFail is set.
+*
+*               DEF_OK,   otherwise.
+*
+* Caller(s)   : SNTPc_NTS_ReqBuild(),
+*               NTS_TestRespBuild().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  SNTPc_NTS_RandGet (CPU_INT08U  *p_buf,
+                                CPU_INT16U   len)
+{
+    CPU_INT16U  ix;
+
+
+    if (NTS_TestRandFail == DEF_YES) {
+        return (DEF_FAIL);
+    }
+    for (ix = 0u; ix < len; ix++) {
+        p_buf[ix] = NTS_TestRandVal++;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           NTS_TestChk()
+*
+* Description : Count a check & report it if it failed.
+*
+* Argument(s) : is_ok       Result of the check.
+*
+*               p_name      Pointer to the name of the check.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestChk (      CPU_BOOLEAN   is_ok,
+                           const CPU_CHAR     *p_name)
+{
+    NTS_TestNbr++;
+    if (is_ok != DEF_YES) {
+        printf("FAIL  %s\n", p_name);
+        NTS_TestFailNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NTS_TestKE_Req()
+*
+* Description : Check the records of a NTS key establishment request.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) NTPv4 (critical), AEAD_AES_SIV_CMAC_256 & End of Message (critical) (see RFC #8915,
+*                   Section 4).
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestKE_Req (void)
+{
+    static  const  CPU_INT08U  req_exp[SNTPc_NTS_KE_REQ_LEN] = {
+        0x80u, 0x01u, 0x00u, 0x02u, 0x00u, 0x00u,               /* See Note #1.                                         */
+        0x00u, 0x04u, 0x00u, 0x02u, 0x00u, 0x0Fu,
+        0x80u, 0x00u, 0x00u, 0x00u
+    };
+    CPU_INT08U  buf[NTS_TEST_BUF_LEN];
+    CPU_INT16U  len;
+
+
+    len = SNTPc_NTS_KE_ReqBuild(buf);
+    NTS_TestChk((CPU_BOOLEAN)(len == SNTPc_NTS_KE_REQ_LEN), "ke req len");
+    NTS_TestChk(Mem_Cmp(buf, req_exp, SNTPc_NTS_KE_REQ_LEN), "ke req records");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NTS_TestKE_Resp()
+*
+* Description : Check the parsing of NTS key establishment responses.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The cookies in excess of SNTPc_CFG_NTS_COOKIE_NBR_MAX are discarded.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestKE_Resp (void)
+{
+    const  NTS_TEST_KE_CASE  *p_case;
+           NTS_TEST_REC       rec;
+           SNTPc_NTS_ASSOC    assoc;
+           SNTPc_NTS_COOKIE  *p_cookie;
+           CPU_INT08U         buf[NTS_TEST_BUF_LEN];
+           CPU_INT16U         len;
+           CPU_INT16U         ix;
+           CPU_INT08U         rec_ix;
+           CPU_BOOLEAN        result;
+
+
+    for (ix = 0u; ix < sizeof(NTS_TestKE_Tbl) / sizeof(NTS_TestKE_Tbl[0]); ix++) {
+        p_case = &NTS_TestKE_Tbl[ix];
+        len    = 0u;
+        for (rec_ix = 0u; rec_ix < p_case->RecNbr; rec_ix++) {
+            len += NTS_TestRecWr(&buf[len], &p_case->RecTbl[rec_ix]);
+        }
+
+        Mem_Set(&assoc, 0xFFu, sizeof(assoc));
+        result = SNTPc_NTS_KE_RespParse(buf, len - p_case->TruncLen, &assoc);
+        NTS_TestChk((CPU_BOOLEAN)(result == p_case->Exp), p_case->NamePtr);
+    }
+                                                                /* --------------- NEGOTIATED FIELDS ------------------ */
+    p_case = &NTS_TestKE_Tbl[0];
+    len    = 0u;
+    for (rec_ix = 0u; rec_ix < p_case->RecNbr; rec_ix++) {
+        len += NTS_TestRecWr(&buf[len], &p_case->RecTbl[rec_ix]);
+    }
+    (void)SNTPc_NTS_KE_RespParse(buf, len, &assoc);
+    NTS_TestChk((CPU_BOOLEAN)((assoc.ServerHostname[0]     == ASCII_CHAR_NULL  ) &&
+                              (assoc.ServerPortNbr         == SNTPc_DFLT_IPPORT) &&
+                              (assoc.CookieNbr             == 1u               ) &&
+                              (assoc.CookieTbl[0].Len      == 64u              ) &&
+                              (assoc.CookieTbl[0].Data[63] == 0xC1u            )), "ke dflt server & port");
+
+    p_case = &NTS_TestKE_Tbl[1];
+    len    = 0u;
+    for (rec_ix = 0u; rec_ix < p_case->RecNbr; rec_ix++) {
+        len += NTS_TestRecWr(&buf[len], &p_case->RecTbl[rec_ix]);
+    }
+    (void)SNTPc_NTS_KE_RespParse(buf, len, &assoc);
+    NTS_TestChk((CPU_BOOLEAN)((Mem_Cmp(assoc.ServerHostname, "sssssssssssssss", 16u) == DEF_YES          ) &&
+                              (assoc.ServerPortNbr                                  == NTS_TEST_PORT_NBR)),
+                "ke negotiated server & port");
+                                                                /* See Note #1.                                         */
+    rec.Type = NTS_TEST_REC_NEXT_PROTO_C;
+    rec.Len  = 2u;
+    rec.Val  = 0u;
+    len      = NTS_TestRecWr(&buf[0], &rec);
+    rec.Type = NTS_TEST_REC_AEAD;
+    rec.Val  = 15u;
+    len     += NTS_TestRecWr(&buf[len], &rec);
+    rec.Type = NTS_TEST_REC_COOKIE;
+    rec.Len  = 16u;
+    for (ix = 0u; ix < (SNTPc_CFG_NTS_COOKIE_NBR_MAX + 2u); ix++) {
+        rec.Val  = ix;
+        len     += NTS_TestRecWr(&buf[len], &rec);
+    }
+    rec.Type = NTS_TEST_REC_END_C;
+    rec.Len  = 0u;
+    len     += NTS_TestRecWr(&buf[len], &rec);
+
+    result   = SNTPc_NTS_KE_RespParse(buf, len, &assoc);
+    p_cookie = &assoc.CookieTbl[SNTPc_CFG_NTS_COOKIE_NBR_MAX - 1u];
+    NTS_TestChk((CPU_BOOLEAN)((result            == DEF_OK                                       ) &&
+                              (assoc.CookieNbr   == SNTPc_CFG_NTS_COOKIE_NBR_MAX                 ) &&
+                              (p_cookie->Data[0] == (CPU_INT08U)(SNTPc_CFG_NTS_COOKIE_NBR_MAX - 1u))),
+                "ke cookies in excess");
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NTS_TestReq()
+*
+* Description : Check the NTS requests built by SNTPc_NTS_ReqBuild().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The request is the NTP header, the unique identifier, the cookie, 2 placeholders of the
+*                   length of the cookie & the authenticator, whose tag authenticates all that precedes it.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestReq (void)
+{
+    SNTP_PKT           hdr;
+    SNTPc_NTS_COOKIE   cookie;
+    CPU_INT08U         buf[NTS_TEST_BUF_LEN];
+    CPU_INT08U        *p_auth;
+    CPU_INT16U         len;
+    CPU_INT16U         ix;
+    CPU_BOOLEAN        is_ok;
+
+
+    Mem_Set(&hdr, 0x5Au, sizeof(hdr));
+    cookie.Len = NTS_TEST_COOKIE_LEN;
+    for (ix = 0u; ix < NTS_TEST_COOKIE_LEN; ix++) {
+        cookie.Data[ix] = (CPU_INT08U)ix;
+    }
+
+    len = SNTPc_NTS_ReqBuild(buf, &hdr, NTS_TestUID, &cookie, 2u, NTS_TestKeyC2S);
+    NTS_TestChk((CPU_BOOLEAN)(len == NTS_TEST_REQ_LEN), "req len");
+    if (len != NTS_TEST_REQ_LEN) {
+        return;
+    }
+                                                                /* See Note #1.                                         */
+    NTS_TestChk(Mem_Cmp(buf, &hdr, sizeof(hdr)), "req ntp hdr");
+    NTS_TestChk((CPU_BOOLEAN)((MEM_VAL_GET_INT16U_BIG(&buf[48u]) == NTS_TEST_EF_UID     ) &&
+                              (MEM_VAL_GET_INT16U_BIG(&buf[50u]) == SNTPc_NTS_EF_UID_LEN) &&
+                              (Mem_Cmp(&buf[52u], NTS_TestUID, SNTPc_NTS_UID_LEN) == DEF_YES)), "req uid");
+    NTS_TestChk((CPU_BOOLEAN)((MEM_VAL_GET_INT16U_BIG(&buf[84u]) == NTS_TEST_EF_COOKIE    ) &&
+                              (MEM_VAL_GET_INT16U_BIG(&buf[86u]) == NTS_TEST_COOKIE_EF_LEN) &&
+                              (Mem_Cmp(&buf[88u], cookie.Data, NTS_TEST_COOKIE_LEN) == DEF_YES) &&
+                              (buf[88u + NTS_TEST_COOKIE_LEN]       == 0u) &&
+                              (buf[88u + NTS_TEST_COOKIE_LEN + 1u]  == 0u)), "req cookie & padding");
+
+    is_ok = DEF_YES;
+    for (ix = 160u; ix < NTS_TEST_AUTH_OFFSET; ix += NTS_TEST_COOKIE_EF_LEN) {
+        if ((MEM_VAL_GET_INT16U_BIG(&buf[ix])      != NTS_TEST_EF_PLACEHOLDER) ||
+            (MEM_VAL_GET_INT16U_BIG(&buf[ix + 2u]) != NTS_TEST_COOKIE_EF_LEN )) {
+            is_ok = DEF_NO;
+        }
+    }
+    NTS_TestChk(is_ok, "req placeholders");
+
+    p_auth = &buf[NTS_TEST_AUTH_OFFSET];
+    NTS_TestChk((CPU_BOOLEAN)((MEM_VAL_GET_INT16U_BIG(&p_auth[0u]) == NTS_TEST_EF_AUTH     ) &&
+                              (MEM_VAL_GET_INT16U_BIG(&p_auth[2u]) == SNTPc_NTS_EF_AUTH_LEN) &&
+                              (MEM_VAL_GET_INT16U_BIG(&p_auth[4u]) == SNTPc_NTS_NONCE_LEN  ) &&
+                              (MEM_VAL_GET_INT16U_BIG(&p_auth[6u]) == SNTPc_NTS_TAG_LEN    )), "req auth hdr");
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_AEAD_Open( NTS_TestKeyC2S,
+                                                  &p_auth[8u],
+                                                   SNTPc_NTS_NONCE_LEN,
+                                                   buf,
+                                                   NTS_TEST_AUTH_OFFSET,
+                                                  &p_auth[8u + SNTPc_NTS_NONCE_LEN],
+                                                   SNTPc_NTS_TAG_LEN,
+                                                   DEF_NULL) == DEF_OK), "req auth tag");
+                                                                /* ------------------ FAILED BUILDS ------------------- */
+    len = SNTPc_NTS_ReqBuild(buf, &hdr, NTS_TestUID, &cookie, SNTPc_CFG_NTS_COOKIE_NBR_MAX, NTS_TestKeyC2S);
+    NTS_TestChk((CPU_BOOLEAN)(len == 0u), "req too many placeholders");
+
+    NTS_TestRandFail = DEF_YES;
+    len = SNTPc_NTS_ReqBuild(buf, &hdr, NTS_TestUID, &cookie, 0u, NTS_TestKeyC2S);
+    NTS_TestRandFail = DEF_NO;
+    NTS_TestChk((CPU_BOOLEAN)(len == 0u), "req rand failed");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NTS_TestResp()
+*
+* Description : Check the authentication & decryption of NTS replies by SNTPc_NTS_RespParse().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) Each negative case alters a copy of a valid reply, built by NTS_TestRespBuild(). The
+*                   unique identifier is at offset 48 & the authenticator at offset 84.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestResp (void)
+{
+    CPU_INT08U   resp[NTS_TEST_BUF_LEN];
+    CPU_INT08U   buf[NTS_TEST_BUF_LEN];
+    CPU_INT08U   pt[NTS_TEST_BUF_LEN];
+    CPU_INT08U   uid_other[SNTPc_NTS_UID_LEN];
+    CPU_INT16U   resp_len;
+    CPU_INT16U   pt_len;
+    CPU_BOOLEAN  result;
+
+
+    resp_len = NTS_TestRespBuild(resp, DEF_NO);
+
+    result = SNTPc_NTS_RespParse(resp, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)((result                          == DEF_OK            ) &&
+                              (pt_len                          == NTS_TEST_PT_LEN   ) &&
+                              (MEM_VAL_GET_INT16U_BIG(&pt[0u]) == NTS_TEST_EF_COOKIE) &&
+                              (pt[NTS_TEST_PT_LEN - 1u]        == 0xB2u             )),
+                "resp valid");
+                                                                /* See Note #1.                                         */
+    Mem_Copy(uid_other, NTS_TestUID, SNTPc_NTS_UID_LEN);
+    uid_other[0] ^= 0x01u;
+    result = SNTPc_NTS_RespParse(resp, resp_len, uid_other, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp other uid");
+
+    result = SNTPc_NTS_RespParse(resp, resp_len, NTS_TestUID, NTS_TestKeyC2S, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp wrong key");
+
+    Mem_Copy(buf, resp, resp_len);
+    buf[40u] ^= 0x01u;                                          /* Alter the transmit timestamp.                        */
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp altered hdr");
+
+    Mem_Copy(buf, resp, resp_len);
+    buf[resp_len - 1u] ^= 0x01u;
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp altered ciphertext");
+                                                                /* ------------------ TRUNCATED REPLY ----------------- */
+    result = SNTPc_NTS_RespParse(resp, resp_len - 4u, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp truncated auth");
+
+    result = SNTPc_NTS_RespParse(resp, 84u, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp no auth");
+
+    result = SNTPc_NTS_RespParse(resp, 60u, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp truncated uid");
+                                                                /* -------------------- BAD LENGTHS ------------------- */
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[50u], SNTPc_NTS_EF_UID_LEN - 1u);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp ef len not aligned");
+
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[50u], 0u);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp ef len too short");
+
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[86u], 4u);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp auth too short");
+
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[90u], SNTPc_NTS_TAG_LEN - 1u);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp ciphertext shorter than tag");
+
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[88u], 200u);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp nonce beyond auth");
+                                                                /* ------------------ UID PLACEMENT ------------------- */
+    Mem_Copy(buf, resp, resp_len);
+    MEM_VAL_SET_INT16U_BIG(&buf[48u], NTS_TEST_EF_PLACEHOLDER);
+    result = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp no uid");
+
+    resp_len = NTS_TestRespBuild(buf, DEF_YES);
+    result   = SNTPc_NTS_RespParse(buf, resp_len, NTS_TestUID, NTS_TestKeyS2C, pt, &pt_len);
+    NTS_TestChk((CPU_BOOLEAN)(result == DEF_FAIL), "resp uid after auth");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NTS_TestCookie()
+*
+* Description : Check the cookies got from decrypted extension fields by SNTPc_NTS_CookieParse().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestCookie (void)
+{
+    SNTPc_NTS_COOKIE  cookie_tbl[SNTPc_CFG_NTS_COOKIE_NBR_MAX];
+    CPU_INT08U        pt[NTS_TEST_BUF_LEN];
+    CPU_INT16U        pt_len;
+    CPU_INT08U        nbr;
+
+
+    pt_len  = NTS_TestEF_Wr(&pt[0],      NTS_TEST_EF_COOKIE, 12u, 0x11u);
+    pt_len += NTS_TestEF_Wr(&pt[pt_len], NTS_TEST_EF_UID,    32u, 0x22u);
+    pt_len += NTS_TestEF_Wr(&pt[pt_len], NTS_TEST_EF_COOKIE, 0u,  0x33u);
+    pt_len += NTS_TestEF_Wr(&pt[pt_len], NTS_TEST_EF_COOKIE, SNTPc_CFG_NTS_COOKIE_LEN_MAX + 4u, 0x44u);
+    pt_len += NTS_TestEF_Wr(&pt[pt_len], NTS_TEST_EF_COOKIE, 20u, 0x55u);
+
+    nbr = SNTPc_NTS_CookieParse(pt, pt_len, cookie_tbl, 0u, SNTPc_CFG_NTS_COOKIE_NBR_MAX);
+    NTS_TestChk((CPU_BOOLEAN)((nbr                    == 2u   ) &&
+                              (cookie_tbl[0].Len      == 12u  ) &&
+                              (cookie_tbl[0].Data[11] == 0x11u) &&
+                              (cookie_tbl[1].Len      == 20u  ) &&
+                              (cookie_tbl[1].Data[19] == 0x55u)), "cookie parse");
+
+    nbr = SNTPc_NTS_CookieParse(pt, pt_len, cookie_tbl, SNTPc_CFG_NTS_COOKIE_NBR_MAX - 1u,
+                                SNTPc_CFG_NTS_COOKIE_NBR_MAX);
+    NTS_TestChk((CPU_BOOLEAN)(nbr == SNTPc_CFG_NTS_COOKIE_NBR_MAX), "cookie tbl filled");
+
+    nbr = SNTPc_NTS_CookieParse(pt, pt_len, cookie_tbl, SNTPc_CFG_NTS_COOKIE_NBR_MAX,
+                                SNTPc_CFG_NTS_COOKIE_NBR_MAX);
+    NTS_TestChk((CPU_BOOLEAN)(nbr == SNTPc_CFG_NTS_COOKIE_NBR_MAX), "cookie tbl full");
+
+    nbr = SNTPc_NTS_CookieParse(pt, pt_len - 1u, cookie_tbl, 0u, SNTPc_CFG_NTS_COOKIE_NBR_MAX);
+    NTS_TestChk((CPU_BOOLEAN)(nbr == 1u), "cookie truncated");
+
+    MEM_VAL_SET_INT16U_BIG(&pt[2u], 2u);
+    nbr = SNTPc_NTS_CookieParse(pt, pt_len, cookie_tbl, 0u, SNTPc_CFG_NTS_COOKIE_NBR_MAX);
+    NTS_TestChk((CPU_BOOLEAN)(nbr == 0u), "cookie ef len too short");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NTS_TestUID_Chk()
+*
+* Description : Check the matching of a reply to its request by SNTPc_NTS_UID_IsEq().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestUID_Chk (void)
+{
+    CPU_INT08U  resp[NTS_TEST_BUF_LEN];
+    CPU_INT08U  uid_other[SNTPc_NTS_UID_LEN];
+    CPU_INT16U  resp_len;
+
+
+    resp_len = NTS_TestRespBuild(resp, DEF_NO);
+    NTS_TestChk(SNTPc_NTS_UID_IsEq(resp, resp_len, NTS_TestUID), "uid match");
+
+    Mem_Copy(uid_other, NTS_TestUID, SNTPc_NTS_UID_LEN);
+    uid_other[SNTPc_NTS_UID_LEN - 1u] ^= 0x80u;
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_UID_IsEq(resp, resp_len, uid_other) == DEF_NO), "uid other");
+
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_UID_IsEq(resp, 48u, NTS_TestUID) == DEF_NO), "uid no ef");
+
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_UID_IsEq(resp, 60u, NTS_TestUID) == DEF_NO), "uid truncated");
+
+    MEM_VAL_SET_INT16U_BIG(&resp[50u], SNTPc_NTS_EF_UID_LEN + 4u);
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_UID_IsEq(resp, resp_len, NTS_TestUID) == DEF_NO), "uid bad len");
+
+    MEM_VAL_SET_INT16U_BIG(&resp[50u], 0u);
+    NTS_TestChk((CPU_BOOLEAN)(SNTPc_NTS_UID_IsEq(resp, resp_len, NTS_TestUID) == DEF_NO), "uid ef len too short");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NTS_TestRecWr()
+*
+* Description : Write a NTS key establishment record.
+*
+* Argument(s) : p_buf       Pointer to the buffer.
+*
+*               p_rec       Pointer to the record.
+*
+* Return(s)   : Length of the record, in octets.
+*
+* Caller(s)   : NTS_TestKE_Resp().
+*
+* Note(s)     : (1) A body of 2 octets holds the record value, in network order. Other bodies are filled
+*                   with the low octet of the value.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NTS_TestRecWr (      CPU_INT08U    *p_buf,
+                                   const NTS_TEST_REC  *p_rec)
+{
+    MEM_VAL_SET_INT16U_BIG(&p_buf[0u], p_rec->Type);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[2u], p_rec->Len);
+    if (p_rec->Len == 2u) {                                     /* See Note #1.                                         */
+        MEM_VAL_SET_INT16U_BIG(&p_buf[4u], p_rec->Val);
+    } else {
+        Mem_Set(&p_buf[4u], (CPU_INT08U)p_rec->Val, p_rec->Len);
+    }
+
+    return (4u + p_rec->Len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NTS_TestEF_Wr()
+*
+* Description : Write a NTP extension field, whose body is filled with a given octet.
+*
+* Argument(s) : p_buf       Pointer to the buffer.
+*
+*               type        Type of the extension field.
+*
+*               body_len    Length of the body, in octets (multiple of 4).
+*
+*               fill        Fill octet of the body.
+*
+* Return(s)   : Length of the extension field, in octets.
+*
+* Caller(s)   : NTS_TestCookie(),
+*               NTS_TestRespBuild().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NTS_TestEF_Wr (CPU_INT08U  *p_buf,
+                                   CPU_INT16U   type,
+                                   CPU_INT16U   body_len,
+                                   CPU_INT08U   fill)
+{
+    MEM_VAL_SET_INT16U_BIG(&p_buf[0u], type);
+    MEM_VAL_SET_INT16U_BIG(&p_buf[2u], SNTPc_NTS_EF_HDR_LEN + body_len);
+    Mem_Set(&p_buf[SNTPc_NTS_EF_HDR_LEN], fill, body_len);
+
+    return (SNTPc_NTS_EF_HDR_LEN + body_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NTS_TestRespBuild()
+*
+* Description : Build a NTS reply, as sent by a server.
+*
+* Argument(s) : p_buf           Pointer to the buffer.
+*
+*               is_uid_after    DEF_YES, to write the unique identifier after the authenticator.
+*
+*                               DEF_NO,  to write it before.
+*
+* Return(s)   : Length of the reply, in octets.
+*
+* Caller(s)   : NTS_TestResp(),
+*               NTS_TestUID_Chk().
+*
+* Note(s)     : (1) The encrypted extension fields are 2 cookies of NTS_TEST_PT_COOKIE_LEN octets.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NTS_TestRespBuild (CPU_INT08U   *p_buf,
+                                       CPU_BOOLEAN   is_uid_after)
+{
+    CPU_INT08U   pt[NTS_TEST_PT_LEN];
+    CPU_INT08U  *p_auth;
+    CPU_INT16U   len;
+    CPU_INT16U   pt_len;
+
+
+    Mem_Set(p_buf, 0x24u, sizeof(SNTP_PKT));
+    len = sizeof(SNTP_PKT);
+    if (is_uid_after == DEF_NO) {
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len],      NTS_TEST_EF_UID);
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len + 2u], SNTPc_NTS_EF_UID_LEN);
+        Mem_Copy(&p_buf[len + SNTPc_NTS_EF_HDR_LEN], NTS_TestUID, SNTPc_NTS_UID_LEN);
+        len += SNTPc_NTS_EF_UID_LEN;
+    }
+                                                                /* See Note #1.                                         */
+    pt_len  = NTS_TestEF_Wr(&pt[0],      NTS_TEST_EF_COOKIE, NTS_TEST_PT_COOKIE_LEN, 0xB1u);
+    pt_len += NTS_TestEF_Wr(&pt[pt_len], NTS_TEST_EF_COOKIE, NTS_TEST_PT_COOKIE_LEN, 0xB2u);
+
+    p_auth = &p_buf[len];
+    MEM_VAL_SET_INT16U_BIG(&p_auth[0u], NTS_TEST_EF_AUTH);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[2u], 8u + SNTPc_NTS_NONCE_LEN + SNTPc_NTS_TAG_LEN + pt_len);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[4u], SNTPc_NTS_NONCE_LEN);
+    MEM_VAL_SET_INT16U_BIG(&p_auth[6u], SNTPc_NTS_TAG_LEN + pt_len);
+    (void)SNTPc_NTS_RandGet(&p_auth[8u], SNTPc_NTS_NONCE_LEN);
+    (void)SNTPc_NTS_AEAD_Seal( NTS_TestKeyS2C,
+                              &p_auth[8u],
+                               SNTPc_NTS_NONCE_LEN,
+                               p_buf,
+                               len,
+                               pt,
+                               pt_len,
+                              &p_auth[8u + SNTPc_NTS_NONCE_LEN]);
+    len += 8u + SNTPc_NTS_NONCE_LEN + SNTPc_NTS_TAG_LEN + pt_len;
+
+    if (is_uid_after == DEF_YES) {
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len],      NTS_TEST_EF_UID);
+        MEM_VAL_SET_INT16U_BIG(&p_buf[len + 2u], SNTPc_NTS_EF_UID_LEN);
+        Mem_Copy(&p_buf[len + SNTPc_NTS_EF_HDR_LEN], NTS_TestUID, SNTPc_NTS_UID_LEN);
+        len += SNTPc_NTS_EF_UID_LEN;
+    }
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NTS_TestTagCalc()
+*
+* Description : Compute the tag of the test AEAD (see Note #3).
+*
+* Argument(s) : p_key       Pointer to the key (SNTPc_NTS_KEY_LEN octets).
+*
+*               p_nonce     Pointer to the nonce.
+*
+*               nonce_len   Length of the nonce, in octets.
+*
+*               p_ad        Pointer to the associated data.
+*
+*               ad_len      Length of the associated data, in octets.
+*
+*               p_pt        Pointer to the plaintext.
+*
+*               pt_len      Length of the plaintext, in octets.
+*
+*               p_tag       Pointer to a buffer that will receive the tag (SNTPc_NTS_TAG_LEN octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : SNTPc_NTS_AEAD_Seal(),
+*               SNTPc_NTS_AEAD_Open().
+*
+* Note(s)     : (1) Two FNV-1a hashes with different offset bases, over the lengths & the octets of the
+*                   key, nonce, associated data & plaintext. A change of any octet changes the tag.
+*********************************************************************************************************
+*/
+
+static  void  NTS_TestTagCalc (const CPU_INT08U  *p_key,
+                               const CPU_INT08U  *p_nonce,
+                                     CPU_INT16U   nonce_len,
+                               const CPU_INT08U  *p_ad,
+                                     CPU_INT16U   ad_len,
+                               const CPU_INT08U  *p_pt,
+                                     CPU_INT16U   pt_len,
+                                     CPU_INT08U  *p_tag)
+{
+    const CPU_INT08U  *p_data_tbl[4];
+          CPU_INT16U   len_tbl[4];
+          CPU_INT64U   hash_tbl[2];
+          CPU_INT16U   ix;
+          CPU_INT08U   data_ix;
+          CPU_INT08U   hash_ix;
+
+
+    p_data_tbl[0] = p_key;
+    len_tbl[0]    = SNTPc_NTS_KEY_LEN;
+    p_data_tbl[1] = p_nonce;
+    len_tbl[1]    = nonce_len;
+    p_data_tbl[2] = p_ad;
+    len_tbl[2]    = ad_len;
+    p_data_tbl[3] = p_pt;
+    len_tbl[3]    = pt_len;
+
+    hash_tbl[0] = 0xCBF29CE484222325u;                          /* See Note #1.                                         */
+    hash_tbl[1] = 0x84222325CBF29CE4u;
+    for (hash_ix = 0u; hash_ix < 2u; hash_ix++) {
+        for (data_ix = 0u; data_ix < 4u; data_ix++) {
+            hash_tbl[hash_ix] = (hash_tbl[hash_ix] ^ len_tbl[data_ix]) * 0x100000001B3u;
+            for (ix = 0u; ix < len_tbl[data_ix]; ix++) {
+                hash_tbl[hash_ix] = (hash_tbl[hash_ix] ^ p_data_tbl[data_ix][ix]) * 0x100000001B3u;
+            }
+        }
+    }
+
+    for (ix = 0u; ix < SNTPc_NTS_TAG_LEN; ix++) {
+        p_tag[ix] = (CPU_INT08U)(hash_tbl[ix / 8u] >> ((ix % 8u) * 8u));
+    }
+}
@@ -0,0 +1,415 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     SNTP CLIENT STATISTICS TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_stat_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It checks the request statistics of
+*                'sntp-c_stat.c' : the boundaries of the histogram buckets, the counters of the successful
+*                requests, the stage & error counters of the failed ones, & the global & server statistics.
+*
+*            (2) It is linked with 'sntp-c_stat.c', built for the host with the include paths of the
+*                application (uC/CPU host port, uC/LIB, uC/TCPIP & the directory of a 'sntp-c_cfg.h' with
+*                SNTPc_CFG_STAT_EN enabled), e.g. :
+*
+*                    cc $(INC) -o sntp-c_stat_test Tool/sntp-c_stat_test.c Source/sntp-c_stat.c
+*
+*                & returns EXIT_SUCCESS if every check passes.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_stat.h>
+#include  <lib_mem.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct stat_test_bucket {
+    CPU_INT64U  Val_us;
+    CPU_INT08U  BucketIx;                                       /* Expected bucket (see 'sntp-c.h  Note #1').           */
+} STAT_TEST_BUCKET;
+
+
+typedef struct stat_test_stage {
+    SNTPc_ERR         Err;
+    SNTPc_STAT_STAGE  Stage;                                    /* Expected stage  (see 'sntp-c.h  Note #2').           */
+} STAT_TEST_STAGE;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  STAT_TEST_BUCKET  StatTestBucketTbl[] = {
+    {                  0u,  0u },
+    {                  1u,  1u },
+    {                  2u,  2u },
+    {                  3u,  2u },
+    {                  4u,  3u },
+    {               1023u, 10u },
+    {               1024u, 11u },
+    {          0x3FFFFFuLL, 22u },
+    {          0x400000uLL, 23u },                              /* First value of the last bucket.                      */
+    {      0xFFFFFFFFFFuLL, 23u }                               /* Larger values, in the last bucket.                   */
+};
+
+
+static  const  STAT_TEST_STAGE  StatTestStageTbl[] = {
+    { SNTPc_ERR_ACQUIRE_LOCK,     SNTPc_STAT_STAGE_LOCK    },
+    { SNTPc_ERR_NULL_PTR,         SNTPc_STAT_STAGE_ADDR    },
+    { SNTPc_ERR_SERVER_CFG,       SNTPc_STAT_STAGE_ADDR    },
+    { SNTPc_ERR_SERVER_BACKOFF,   SNTPc_STAT_STAGE_BACKOFF },
+    { SNTPc_ERR_MEM_ALLOC,        SNTPc_STAT_STAGE_RSRC    },
+    { SNTPc_ERR_NO_MORE_RSRC,     SNTPc_STAT_STAGE_RSRC    },
+    { SNTPc_ERR_TX,               SNTPc_STAT_STAGE_TX      },
+    { SNTPc_ERR_RX,               SNTPc_STAT_STAGE_RX      },
+    { SNTPc_ERR_RX_INVALID,       SNTPc_STAT_STAGE_RX      },
+    { SNTPc_ERR_KOD,              SNTPc_STAT_STAGE_KOD     },
+    { SNTPc_ERR_NTS_KE,           SNTPc_STAT_STAGE_NTS     },
+    { SNTPc_ERR_NTS_NAK,          SNTPc_STAT_STAGE_NTS     },
+    { SNTPc_ERR_FAULT,            SNTPc_STAT_STAGE_OTHER   },
+    { SNTPc_ERR_CLK_IN_USE,       SNTPc_STAT_STAGE_OTHER   }
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  StatTestNbr;
+static  CPU_INT32U  StatTestFailNbr;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  StatTestChk     (      CPU_BOOLEAN   is_ok,
+                               const CPU_CHAR     *p_name);
+
+static  void  StatTestInit    (void);
+
+static  void  StatTestBucket  (void);
+
+static  void  StatTestReqOk   (void);
+
+static  void  StatTestReqFail (void);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the statistics test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : EXIT_SUCCESS, if every check passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    StatTestInit();
+    StatTestBucket();
+    StatTestReqOk();
+    StatTestReqFail();
+
+    printf("%lu checks, %lu failed\n",
+           (unsigned long)StatTestNbr,
+           (unsigned long)StatTestFailNbr);
+
+    return ((StatTestFailNbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           StatTestChk()
+*
+* Description : Count a check & report it if it failed.
+*
+* Argument(s) : is_ok       Result of the check.
+*
+*               p_name      Pointer to the name of the check.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  StatTestChk (      CPU_BOOLEAN   is_ok,
+                           const CPU_CHAR     *p_name)
+{
+    StatTestNbr++;
+    if (is_ok != DEF_YES) {
+        printf("FAIL  %s\n", p_name);
+        StatTestFailNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           StatTestInit()
+*
+* Description : Check that the statistics are cleared.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  StatTestInit (void)
+{
+    SNTPc_STAT  stat;
+    SNTPc_STAT  stat_clr;
+    SNTPc_ERR   err;
+
+
+    SNTPc_StatLockWaitAdd(10u);
+    SNTPc_StatReqAdd(DEF_NULL, SNTPc_ERR_TX, DEF_NULL);
+    SNTPc_StatInit();
+
+    Mem_Clr(&stat_clr, sizeof(stat_clr));
+    SNTPc_StatGet(&stat, &err);
+    StatTestChk((CPU_BOOLEAN)(err == SNTPc_ERR_NONE), "init : err");
+    StatTestChk(Mem_Cmp(&stat, &stat_clr, sizeof(stat)), "init : cleared");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          StatTestBucket()
+*
+* Description : Check the boundaries of the histogram buckets, the sum & the max of a histogram.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The max is limited to the largest 32-bit value.
+*********************************************************************************************************
+*/
+
+static  void  StatTestBucket (void)
+{
+    const  STAT_TEST_BUCKET  *p_bucket;
+           SNTPc_STAT         stat;
+           SNTPc_ERR          err;
+           CPU_INT64U         sum_us;
+           CPU_INT32U         ix;
+
+
+    for (ix = 0u; ix < sizeof(StatTestBucketTbl) / sizeof(StatTestBucketTbl[0]); ix++) {
+        p_bucket = &StatTestBucketTbl[ix];
+
+        SNTPc_StatInit();
+        SNTPc_StatLockWaitAdd(p_bucket->Val_us);
+        SNTPc_StatGet(&stat, &err);
+
+        if ((stat.LockWaitHist.BucketTbl[p_bucket->BucketIx] != 1u) ||
+            (stat.LockWaitHist.Ctr                           != 1u)) {
+            printf("FAIL  bucket : value %llu, expected bucket %u\n",
+                   (unsigned long long)p_bucket->Val_us,
+                   (unsigned int      )p_bucket->BucketIx);
+            StatTestFailNbr++;
+        }
+        StatTestNbr++;
+    }
+
+    SNTPc_StatInit();
+    sum_us = 0u;
+    for (ix = 0u; ix < sizeof(StatTestBucketTbl) / sizeof(StatTestBucketTbl[0]); ix++) {
+        SNTPc_StatLockWaitAdd(StatTestBucketTbl[ix].Val_us);
+        sum_us += StatTestBucketTbl[ix].Val_us;
+    }
+    SNTPc_StatGet(&stat, &err);
+    StatTestChk((CPU_BOOLEAN)(stat.LockWaitHist.Ctr          == ix),                  "hist : ctr");
+    StatTestChk((CPU_BOOLEAN)(stat.LockWaitHist.Sum_us       == sum_us),              "hist : sum");
+    StatTestChk((CPU_BOOLEAN)(stat.LockWaitHist.Max_us       == DEF_INT_32U_MAX_VAL), "hist : max");
+    StatTestChk((CPU_BOOLEAN)(stat.LockWaitHist.BucketTbl[2] == 2u),                  "hist : bucket 2");
+    StatTestChk((CPU_BOOLEAN)(stat.LockWaitHist.BucketTbl[SNTPc_STAT_HIST_BUCKET_NBR - 1u] == 2u),
+                "hist : last bucket");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           StatTestReqOk()
+*
+* Description : Check the counters of the successful requests, with & without server statistics.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The offset histogram counts the absolute value of the offset : -1500 us falls in the
+*                   bucket of 1024 us to 2048 us excluded.
+*********************************************************************************************************
+*/
+
+static  void  StatTestReqOk (void)
+{
+    SNTPc_STAT      stat;
+    SNTPc_STAT_REQ  stat_server;
+    SNTPc_SAMPLE    sample;
+    SNTPc_ERR       err;
+
+
+    SNTPc_StatInit();
+    Mem_Clr(&stat_server, sizeof(stat_server));
+    Mem_Clr(&sample,      sizeof(sample));
+
+    sample.Offset_ns       = -1500000;                          /* See Note #1.                                         */
+    sample.RoundTripDly_ns =   300000;
+    SNTPc_StatReqAdd(&stat_server, SNTPc_ERR_NONE, &sample);
+    SNTPc_StatReqAdd( DEF_NULL,    SNTPc_ERR_NONE, &sample);
+
+    SNTPc_StatGet(&stat, &err);
+    StatTestChk((CPU_BOOLEAN)(stat.Req.ReqCtr                       ==    2u), "ok : req ctr");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.OkCtr                        ==    2u), "ok : ok ctr");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.RoundTripDlyHist.Sum_us      ==  600u), "ok : dly sum");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.RoundTripDlyHist.Max_us      ==  300u), "ok : dly max");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.RoundTripDlyHist.BucketTbl[9] == 2u),   "ok : dly bucket");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.OffsetHist.Sum_us            == 3000u), "ok : offset sum");
+    StatTestChk((CPU_BOOLEAN)(stat.Req.OffsetHist.BucketTbl[11]     ==    2u), "ok : offset bucket");
+
+    StatTestChk((CPU_BOOLEAN)(stat_server.ReqCtr                    ==    1u), "ok : server req ctr");
+    StatTestChk((CPU_BOOLEAN)(stat_server.OkCtr                     ==    1u), "ok : server ok ctr");
+    StatTestChk((CPU_BOOLEAN)(stat_server.OffsetHist.Max_us         == 1500u), "ok : server offset max");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          StatTestReqFail()
+*
+* Description : Check the stage & error counters of the failed requests.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The failed requests are not counted in the histograms.
+*********************************************************************************************************
+*/
+
+static  void  StatTestReqFail (void)
+{
+    const  STAT_TEST_STAGE  *p_stage;
+           SNTPc_STAT        stat;
+           SNTPc_STAT_REQ    stat_server;
+           SNTPc_ERR         err;
+           CPU_INT32U        ix;
+
+
+    for (ix = 0u; ix < sizeof(StatTestStageTbl) / sizeof(StatTestStageTbl[0]); ix++) {
+        p_stage = &StatTestStageTbl[ix];
+
+        SNTPc_StatInit();
+        Mem_Clr(&stat_server, sizeof(stat_server));
+        SNTPc_StatReqAdd(&stat_server, p_stage->Err, DEF_NULL);
+        SNTPc_StatGet(&stat, &err);
+                                                                /* See Note #1.                                         */
+        if ((stat.Req.FailStageCtrTbl[p_stage->Stage]    != 1u) ||
+            (stat.Req.FailErrCtrTbl[p_stage->Err]        != 1u) ||
+            (stat_server.FailStageCtrTbl[p_stage->Stage] != 1u) ||
+            (stat_server.FailErrCtrTbl[p_stage->Err]     != 1u) ||
+            (stat.Req.ReqCtr                             != 1u) ||
+            (stat.Req.OkCtr                              != 0u) ||
+            (stat.Req.RoundTripDlyHist.Ctr               != 0u) ||
+            (stat.Req.OffsetHist.Ctr                     != 0u)) {
+            printf("FAIL  stage : error %u, expected stage %u\n",
+                   (unsigned int)p_stage->Err,
+                   (unsigned int)p_stage->Stage);
+            StatTestFailNbr++;
+        }
+        StatTestNbr++;
+    }
+}
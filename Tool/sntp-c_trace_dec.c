@@ -0,0 +1,520 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  SNTP CLIENT BINARY TRACE DECODER
+*
+*                                               HOST TOOL
+*
+* Filename : sntp-c_trace_dec.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It decodes a dump of the binary trace
+*                buffer of the SNTP client (see 'sntp-c.h  SNTPc TRACE DATA TYPES') & prints its records
+*                from the oldest to the newest, one per line.
+*
+*            (2) It is built with any hosted C99 compiler, e.g. :
+*
+*                    cc -o sntp-c_trace_dec sntp-c_trace_dec.c
+*
+*                & run with the file holding the sizeof(SNTPc_TRACE_BUF) octets dumped from the target :
+*
+*                    sntp-c_trace_dec trace.bin
+*
+*            (3) The layout of the buffer, the event identifiers & the error codes MUST be kept in sync with
+*                'sntp-c.h'. They are checked by 'sntp-c_trace_test.c'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stdint.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  TRACE_MAGIC                              0x534E5452u   /* See 'sntp-c.h  SNTPc_TRACE_MAGIC'.                   */
+#define  TRACE_VER                                         1u
+#define  TRACE_SEQ_NONE                           0xFFFFFFFFu
+
+#define  TRACE_HDR_LEN                                    16u   /* Len of the buf hdr, up to the record tbl.            */
+#define  TRACE_RECORD_LEN                                 24u
+
+                                                                /* Offsets of the buf hdr fields.                       */
+#define  TRACE_HDR_OFFSET_MAGIC                            0u
+#define  TRACE_HDR_OFFSET_VER                              4u
+#define  TRACE_HDR_OFFSET_RECORD_SIZE                      6u
+#define  TRACE_HDR_OFFSET_RECORD_NBR                       8u
+#define  TRACE_HDR_OFFSET_SEQ_NEXT                        12u
+
+                                                                /* Offsets of the record fields.                        */
+#define  TRACE_RECORD_OFFSET_TS                            0u
+#define  TRACE_RECORD_OFFSET_SEQ                           8u
+#define  TRACE_RECORD_OFFSET_EVT_ID                       12u
+#define  TRACE_RECORD_OFFSET_ARG0                         14u
+#define  TRACE_RECORD_OFFSET_ARG1                         16u
+#define  TRACE_RECORD_OFFSET_ARG2                         20u
+
+                                                                /* Event identifiers (see 'sntp-c.h').                  */
+#define  TRACE_EVT_REQ                                     1u
+#define  TRACE_EVT_TX                                      2u
+#define  TRACE_EVT_RX                                      3u
+#define  TRACE_EVT_KOD                                     4u
+#define  TRACE_EVT_BACKOFF                                 5u
+#define  TRACE_EVT_NTS_KE                                  6u
+#define  TRACE_EVT_SYNC                                    7u
+
+                                                                /* Fields of the NTP ctrl word (see 'sntp-c.c').        */
+#define  TRACE_CW_MODE_SHIFT                              24u
+#define  TRACE_CW_VN_SHIFT                                27u
+#define  TRACE_CW_STRATUM_SHIFT                           16u
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef struct trace_dec {
+    const uint8_t  *BufPtr;
+    size_t          Len;
+    int             IsBigEndian;                                /* Byte order of the target (see 'main()  Note #1').    */
+} TRACE_DEC;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+                                                                /* Names of the SNTPc_ERR codes (see 'sntp-c.h').       */
+static  const  char  *const  TraceErrNameTbl[] = {
+    "NONE",
+    "MEM_ALLOC",
+    "FAULT_INIT",
+    "NULL_PTR",
+    "ACQUIRE_LOCK",
+    "RX",
+    "TX",
+    "SERVER_CFG",
+    "FAULT",
+    "NO_MORE_RSRC",
+    "REQ_NOT_FOUND",
+    "NO_MAJORITY",
+    "CLK_NOT_SET",
+    "RX_INVALID",
+    "KOD",
+    "SERVER_BACKOFF",
+    "FILTER_EMPTY",
+    "DRIFT_NOT_READY",
+    "MANYCAST_NONE",
+    "NTS_KE",
+    "NTS_NAK",
+    "STAT_NOT_FOUND",
+    "CLK_IN_USE"
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  uint16_t     TraceRd16        (const TRACE_DEC  *p_dec,
+                                             size_t      offset);
+
+static  uint32_t     TraceRd32        (const TRACE_DEC  *p_dec,
+                                             size_t      offset);
+
+static  uint64_t     TraceRd64        (const TRACE_DEC  *p_dec,
+                                             size_t      offset);
+
+static  const char  *TraceErrStrGet   (      uint32_t    err);
+
+static  void         TraceKissPrint   (      uint32_t    kiss_code);
+
+static  void         TraceRecordPrint (const TRACE_DEC  *p_dec,
+                                             size_t      offset,
+                                             uint32_t    seq);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Decode a dump of the binary trace buffer.
+*
+* Argument(s) : argc        Number of arguments.
+*
+*               argv        Arguments : the name of the file holding the dump.
+*
+* Return(s)   : EXIT_SUCCESS, if the dump was decoded.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : (1) The byte order of the dump is detected from the magic number.
+*
+*               (2) The records still in the buffer are the last record_nbr records, up to SeqNext. A record
+*                   whose sequence number is SNTPc_TRACE_SEQ_NONE was dumped while it was written & is
+*                   reported as incomplete. A record holding another sequence number was overwritten by a
+*                   delayed writer & is reported as lost (see 'sntp-c_trace.c  Note #2').
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    TRACE_DEC   dec;
+    FILE       *p_file;
+    uint8_t    *p_buf;
+    long        file_len;
+    uint32_t    magic;
+    uint32_t    record_nbr;
+    uint32_t    seq_next;
+    uint32_t    seq_first;
+    uint32_t    seq;
+    uint32_t    seq_record;
+    size_t      offset;
+
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <trace dump file>\n", argv[0]);
+        return (EXIT_FAILURE);
+    }
+                                                                /* -------------------- READ DUMP --------------------- */
+    p_file = fopen(argv[1], "rb");
+    if (p_file == NULL) {
+        perror(argv[1]);
+        return (EXIT_FAILURE);
+    }
+    fseek(p_file, 0L, SEEK_END);
+    file_len = ftell(p_file);
+    fseek(p_file, 0L, SEEK_SET);
+    if (file_len < (long)TRACE_HDR_LEN) {
+        fprintf(stderr, "%s: too short for a trace buffer\n", argv[1]);
+        fclose(p_file);
+        return (EXIT_FAILURE);
+    }
+
+    p_buf = (uint8_t *)malloc((size_t)file_len);
+    if ((p_buf                                          == NULL) ||
+        (fread(p_buf, 1u, (size_t)file_len, p_file) != (size_t)file_len)) {
+        fprintf(stderr, "%s: read error\n", argv[1]);
+        free(p_buf);
+        fclose(p_file);
+        return (EXIT_FAILURE);
+    }
+    fclose(p_file);
+                                                                /* ------------------- CHECK HEADER ------------------- */
+    dec.BufPtr = p_buf;
+    dec.Len    = (size_t)file_len;
+    dec.IsBigEndian = 0;
+    magic      = TraceRd32(&dec, TRACE_HDR_OFFSET_MAGIC);
+    if (magic != TRACE_MAGIC) {                                 /* See Note #1.                                         */
+        dec.IsBigEndian = 1;
+        magic      = TraceRd32(&dec, TRACE_HDR_OFFSET_MAGIC);
+    }
+    if (magic != TRACE_MAGIC) {
+        fprintf(stderr, "%s: not a SNTPc trace buffer\n", argv[1]);
+        free(p_buf);
+        return (EXIT_FAILURE);
+    }
+
+    record_nbr = TraceRd32(&dec, TRACE_HDR_OFFSET_RECORD_NBR);
+    seq_next   = TraceRd32(&dec, TRACE_HDR_OFFSET_SEQ_NEXT);
+    if ((TraceRd16(&dec, TRACE_HDR_OFFSET_VER)         != TRACE_VER       ) ||
+        (TraceRd16(&dec, TRACE_HDR_OFFSET_RECORD_SIZE) != TRACE_RECORD_LEN) ||
+        (record_nbr                                    == 0u              ) ||
+        (dec.Len < (TRACE_HDR_LEN + ((size_t)record_nbr * TRACE_RECORD_LEN)))) {
+        fprintf(stderr, "%s: unsupported trace buffer version or truncated dump\n", argv[1]);
+        free(p_buf);
+        return (EXIT_FAILURE);
+    }
+                                                                /* ------------------ PRINT RECORDS ------------------- */
+    seq_first = (seq_next > record_nbr) ? (seq_next - record_nbr) : 0u;
+    printf("%u record(s), %u overwritten\n", (unsigned)(seq_next - seq_first), (unsigned)seq_first);
+
+    for (seq = seq_first; seq != seq_next; seq++) {             /* See Note #2.                                         */
+        offset     = TRACE_HDR_LEN + ((size_t)(seq % record_nbr) * TRACE_RECORD_LEN);
+        seq_record = TraceRd32(&dec, offset + TRACE_RECORD_OFFSET_SEQ);
+        if (seq_record == TRACE_SEQ_NONE) {
+            printf("%10u  incomplete\n", (unsigned)seq);
+        } else if (seq_record != seq) {
+            printf("%10u  lost\n", (unsigned)seq);
+        } else {
+            TraceRecordPrint(&dec, offset, seq);
+        }
+    }
+
+    free(p_buf);
+
+    return (EXIT_SUCCESS);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         TraceRd16()
+*                                         TraceRd32()
+*                                         TraceRd64()
+*
+* Description : Read a field of the dump, in the byte order of the target.
+*
+* Argument(s) : p_dec       Pointer to the decoder state.
+*
+*               offset      Offset of the field in the dump.
+*
+* Return(s)   : Value of the field.
+*
+* Caller(s)   : main(),
+*               TraceRecordPrint().
+*
+* Note(s)     : (1) The caller MUST check that the field lies within the dump.
+*********************************************************************************************************
+*/
+
+static  uint16_t  TraceRd16 (const TRACE_DEC  *p_dec,
+                                   size_t      offset)
+{
+    const uint8_t  *p_src;
+
+
+    p_src = &p_dec->BufPtr[offset];
+    if (p_dec->IsBigEndian == 0) {
+        return ((uint16_t)(p_src[0] | ((unsigned)p_src[1] << 8u)));
+    }
+    return ((uint16_t)(p_src[1] | ((unsigned)p_src[0] << 8u)));
+}
+
+
+static  uint32_t  TraceRd32 (const TRACE_DEC  *p_dec,
+                                   size_t      offset)
+{
+    uint32_t  lo;
+    uint32_t  hi;
+
+
+    lo = TraceRd16(p_dec, offset);
+    hi = TraceRd16(p_dec, offset + 2u);
+    if (p_dec->IsBigEndian == 0) {
+        return (lo | (hi << 16u));
+    }
+    return (hi | (lo << 16u));
+}
+
+
+static  uint64_t  TraceRd64 (const TRACE_DEC  *p_dec,
+                                   size_t      offset)
+{
+    uint64_t  lo;
+    uint64_t  hi;
+
+
+    lo = TraceRd32(p_dec, offset);
+    hi = TraceRd32(p_dec, offset + 4u);
+    if (p_dec->IsBigEndian == 0) {
+        return (lo | (hi << 32u));
+    }
+    return (hi | (lo << 32u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TraceErrStrGet()
+*
+* Description : Get the name of an error code.
+*
+* Argument(s) : err         SNTPc_ERR code.
+*
+* Return(s)   : Name of the error code, or "?" if unknown.
+*
+* Caller(s)   : TraceRecordPrint().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  const  char  *TraceErrStrGet (uint32_t  err)
+{
+    if (err >= (sizeof(TraceErrNameTbl) / sizeof(TraceErrNameTbl[0]))) {
+        return ("?");
+    }
+    return (TraceErrNameTbl[err]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TraceKissPrint()
+*
+* Description : Print a kiss code as its four ASCII characters.
+*
+* Argument(s) : kiss_code   Kiss code, with the first character in the most significant octet.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : TraceRecordPrint().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  TraceKissPrint (uint32_t  kiss_code)
+{
+    unsigned  ix;
+    int       c;
+
+
+    for (ix = 0u; ix < 4u; ix++) {
+        c = (int)((kiss_code >> (24u - (ix * 8u))) & 0xFFu);
+        putchar(((c >= 0x20) && (c < 0x7F)) ? c : '.');
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         TraceRecordPrint()
+*
+* Description : Print a trace record.
+*
+* Argument(s) : p_dec       Pointer to the decoder state.
+*
+*               offset      Offset of the record in the dump.
+*
+*               seq         Sequence number of the record.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The timestamp is the local time of the target in 32.32 fixed point, printed in seconds
+*                   & microseconds.
+*
+*               (2) See 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #5' for the arguments of each event.
+*********************************************************************************************************
+*/
+
+static  void  TraceRecordPrint (const TRACE_DEC  *p_dec,
+                                      size_t      offset,
+                                      uint32_t    seq)
+{
+    uint64_t  ts;
+    uint32_t  evt_id;
+    uint32_t  arg0;
+    uint32_t  arg1;
+    uint32_t  arg2;
+    uint32_t  ts_us;
+
+
+    ts     = TraceRd64(p_dec, offset + TRACE_RECORD_OFFSET_TS);
+    evt_id = TraceRd16(p_dec, offset + TRACE_RECORD_OFFSET_EVT_ID);
+    arg0   = TraceRd16(p_dec, offset + TRACE_RECORD_OFFSET_ARG0);
+    arg1   = TraceRd32(p_dec, offset + TRACE_RECORD_OFFSET_ARG1);
+    arg2   = TraceRd32(p_dec, offset + TRACE_RECORD_OFFSET_ARG2);
+                                                                /* See Note #1.                                         */
+    ts_us  = (uint32_t)(((ts & 0xFFFFFFFFu) * 1000000u) >> 32u);
+    printf("%10u  %10u.%06u  ", (unsigned)seq, (unsigned)(ts >> 32u), (unsigned)ts_us);
+
+    switch (evt_id) {                                           /* See Note #2.                                         */
+        case TRACE_EVT_REQ:
+             printf("REQ      err=%s rtt_us=%u offset_us=%d\n",
+                    TraceErrStrGet(arg0), (unsigned)arg1, (int)(int32_t)arg2);
+             break;
+
+        case TRACE_EVT_TX:
+             printf("TX       err=%s sock=%d\n", TraceErrStrGet(arg0), (int)(int32_t)arg1);
+             break;
+
+        case TRACE_EVT_RX:
+             printf("RX       err=%s mode=%u vn=%u stratum=%u len=%u\n",
+                    TraceErrStrGet(arg0),
+                    (unsigned)((arg1 >> TRACE_CW_MODE_SHIFT)    & 0x07u),
+                    (unsigned)((arg1 >> TRACE_CW_VN_SHIFT)      & 0x07u),
+                    (unsigned)((arg1 >> TRACE_CW_STRATUM_SHIFT) & 0xFFu),
+                    (unsigned)arg2);
+             break;
+
+        case TRACE_EVT_KOD:
+             printf("KOD      code=");
+             TraceKissPrint(arg1);
+             printf("\n");
+             break;
+
+        case TRACE_EVT_BACKOFF:
+             printf("BACKOFF  code=");
+             TraceKissPrint(arg1);
+             printf(" dur_ms=%u\n", (unsigned)arg2);
+             break;
+
+        case TRACE_EVT_NTS_KE:
+             printf("NTS_KE   err=%s cookies=%u\n", TraceErrStrGet(arg0), (unsigned)arg1);
+             break;
+
+        case TRACE_EVT_SYNC:
+             printf("SYNC     %s poll_exp=%u offset_us=%d\n",
+                    (arg0 != 0u) ? "ok" : "fail", (unsigned)arg1, (int)(int32_t)arg2);
+             break;
+
+        default:
+             printf("EVT%-5u %u %u %u\n", (unsigned)evt_id, (unsigned)arg0, (unsigned)arg1, (unsigned)arg2);
+             break;
+    }
+}
@@ -0,0 +1,529 @@
+/*
+*********************************************************************************************************
+*                                              uC/SNTPc
+*                               Simple Mail Transfer Protocol (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                   SNTP CLIENT BINARY TRACE TEST
+*
+*                                              HOST TOOL
+*
+* Filename : sntp-c_trace_test.c
+* Version  : V2.01.00
+*********************************************************************************************************
+* Note(s)  : (1) This program runs on the host, not on the target. It writes records in the binary trace
+*                buffer of 'sntp-c_trace.c' & reads them back with the decoder of 'sntp-c_trace_dec.c', to
+*                check that the decoder is kept in sync with 'sntp-c.h' : layout of the buffer, event
+*                identifiers, error codes, ring buffer wrap & saturation of the signed arguments.
+*
+*            (2) It is linked with 'sntp-c_trace.c', built for the host with the include paths of the
+*                application (uC/CPU host port, uC/LIB, uC/TCPIP & the directory of a 'sntp-c_cfg.h' with
+*                SNTPc_TRACE_LEVEL at least TRACE_LEVEL_INFO & SNTPc_TRACE_BIN_EN enabled), e.g. :
+*
+*                    cc $(INC) -o sntp-c_trace_test Tool/sntp-c_trace_test.c Source/sntp-c_trace.c
+*
+*                & returns EXIT_SUCCESS if every check passes. If a file name is given, the buffer is also
+*                dumped to that file & decoded by the decoder, which prints its records :
+*
+*                    sntp-c_trace_test trace.bin
+*
+*            (3) The decoder is compiled in this program, its main() renamed to TraceDecMain(), so that the
+*                checks use its own layout constants & readers.
+*
+*            (4) The local time base is provided by this program in place of 'sntp-c_clk.c', so that the
+*                timestamps of the records are set by the checks.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <stddef.h>
+#include  <Source/sntp-c.h>
+#include  <Source/sntp-c_trace.h>
+
+#define  main  TraceDecMain                                     /* See Note #3.                                         */
+#include  "sntp-c_trace_dec.c"
+#undef   main
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  TRACE_TEST_TS              0xE3D1A2B380000000uLL       /* 2021-02-13 00:58:27.5 UTC, in 32.32 fixed point.     */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  SNTP_FIXED_TS  TraceTestLocalTS;                        /* Local time base (see Note #4).                       */
+
+static  CPU_INT32U     TraceTestNbr;
+static  CPU_INT32U     TraceTestFailNbr;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void         TraceTestChk       (      CPU_BOOLEAN   is_ok,
+                                         const CPU_CHAR     *p_name);
+
+static  void         TraceTestDecInit   (      TRACE_DEC    *p_dec);
+
+static  CPU_BOOLEAN  TraceTestRecordChk (const TRACE_DEC    *p_dec,
+                                               CPU_INT32U    seq,
+                                               CPU_INT16U    evt_id,
+                                               CPU_INT16U    arg0,
+                                               CPU_INT32U    arg1,
+                                               CPU_INT32U    arg2);
+
+static  void         TraceTestLayout    (void);
+
+static  void         TraceTestArg32S    (void);
+
+static  void         TraceTestWr        (void);
+
+static  void         TraceTestWrap      (void);
+
+static  void         TraceTestDump      (      char         *p_file_name);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run the binary trace test.
+*
+* Argument(s) : argc        Number of arguments.
+*
+*               argv        Arguments : the name of the file to dump the buffer to, optional.
+*
+* Return(s)   : EXIT_SUCCESS, if every check passed.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host C run-time.
+*
+* Note(s)     : (1) The checks of the records depend on their order : the buffer is never cleared.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    TraceTestLayout();
+    TraceTestArg32S();
+    TraceTestWr();                                              /* See Note #1.                                         */
+    TraceTestWrap();
+    if (argc == 2) {
+        TraceTestDump(argv[1]);
+    }
+
+    printf("%lu checks, %lu failed\n",
+           (unsigned long)TraceTestNbr,
+           (unsigned long)TraceTestFailNbr);
+
+    return ((TraceTestFailNbr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         SNTPc_ClkLocalGet()
+*
+* Description : Get the local time base of the test.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Local time set by the checks, in 32.32 fixed point.
+*
+* Caller(s)   : SNTPc_TraceWr().
+*
+* Note(s)     : (1) See 'sntp-c_trace_test.c  Note #4'.
+*********************************************************************************************************
+*/
+
+SNTP_FIXED_TS  SNTPc_ClkLocalGet (void)
+{
+    return (TraceTestLocalTS);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           TraceTestChk()
+*
+* Description : Count a check & report it if it failed.
+*
+* Argument(s) : is_ok       Result of the check.
+*
+*               p_name      Pointer to the name of the check.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  TraceTestChk (      CPU_BOOLEAN   is_ok,
+                            const CPU_CHAR     *p_name)
+{
+    TraceTestNbr++;
+    if (is_ok != DEF_YES) {
+        printf("FAIL  %s\n", p_name);
+        TraceTestFailNbr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         TraceTestDecInit()
+*
+* Description : Set up the decoder to read the trace buffer in place.
+*
+* Argument(s) : p_dec       Pointer to the decoder state.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) The byte order is detected from the magic number, as by the decoder.
+*********************************************************************************************************
+*/
+
+static  void  TraceTestDecInit (TRACE_DEC  *p_dec)
+{
+    p_dec->BufPtr      = (const uint8_t *)SNTPc_TraceBufGet();
+    p_dec->Len         =  sizeof(SNTPc_TRACE_BUF);
+    p_dec->IsBigEndian =  0;
+    if (TraceRd32(p_dec, TRACE_HDR_OFFSET_MAGIC) != TRACE_MAGIC) {
+        p_dec->IsBigEndian = 1;                                 /* See Note #1.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        TraceTestRecordChk()
+*
+* Description : Check a record read by the decoder.
+*
+* Argument(s) : p_dec       Pointer to the decoder state.
+*
+*               seq         Sequence number of the record.
+*
+*               evt_id      Expected event identifier.
+*
+*               arg0        Expected first  argument.
+*
+*               arg1        Expected second argument.
+*
+*               arg2        Expected third  argument.
+*
+* Return(s)   : DEF_YES, if the record holds the sequence number, the current local time & the arguments.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  TraceTestRecordChk (const TRACE_DEC   *p_dec,
+                                               CPU_INT32U   seq,
+                                               CPU_INT16U   evt_id,
+                                               CPU_INT16U   arg0,
+                                               CPU_INT32U   arg1,
+                                               CPU_INT32U   arg2)
+{
+    size_t  offset;
+
+
+    offset = TRACE_HDR_LEN + ((size_t)(seq % SNTPc_TRACE_BIN_NBR_RECORDS) * TRACE_RECORD_LEN);
+
+    if ((TraceRd32(p_dec, offset + TRACE_RECORD_OFFSET_SEQ)    != seq             ) ||
+        (TraceRd64(p_dec, offset + TRACE_RECORD_OFFSET_TS)     != TraceTestLocalTS) ||
+        (TraceRd16(p_dec, offset + TRACE_RECORD_OFFSET_EVT_ID) != evt_id          ) ||
+        (TraceRd16(p_dec, offset + TRACE_RECORD_OFFSET_ARG0)   != arg0            ) ||
+        (TraceRd32(p_dec, offset + TRACE_RECORD_OFFSET_ARG1)   != arg1            ) ||
+        (TraceRd32(p_dec, offset + TRACE_RECORD_OFFSET_ARG2)   != arg2            )) {
+        return (DEF_NO);
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TraceTestLayout()
+*
+* Description : Check that the layout constants of the decoder match the trace data types of 'sntp-c.h'.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The decoder names every error code of 'sntp-c.h', the last one being SNTPc_ERR_CLK_IN_USE
+*                   (see 'sntp-c.h  SNTPc STATISTICS DATA TYPES  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  TraceTestLayout (void)
+{
+    TRACE_DEC  dec;
+
+
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, Magic)      == TRACE_HDR_OFFSET_MAGIC), "hdr magic");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, Ver)        == TRACE_HDR_OFFSET_VER), "hdr ver");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, RecordSize) == TRACE_HDR_OFFSET_RECORD_SIZE), "hdr record size");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, RecordNbr)  == TRACE_HDR_OFFSET_RECORD_NBR), "hdr record nbr");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, SeqNext)    == TRACE_HDR_OFFSET_SEQ_NEXT), "hdr seq next");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_BUF, RecordTbl)  == TRACE_HDR_LEN), "hdr len");
+
+    TraceTestChk((CPU_BOOLEAN)(sizeof(SNTPc_TRACE_RECORD)            == TRACE_RECORD_LEN), "record len");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, TS)      == TRACE_RECORD_OFFSET_TS), "record ts");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, Seq)     == TRACE_RECORD_OFFSET_SEQ), "record seq");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, EvtId)   == TRACE_RECORD_OFFSET_EVT_ID), "record evt id");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, Arg0)    == TRACE_RECORD_OFFSET_ARG0), "record arg0");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, Arg1)    == TRACE_RECORD_OFFSET_ARG1), "record arg1");
+    TraceTestChk((CPU_BOOLEAN)(offsetof(SNTPc_TRACE_RECORD, Arg2)    == TRACE_RECORD_OFFSET_ARG2), "record arg2");
+
+    TraceTestChk((CPU_BOOLEAN)((SNTPc_TRACE_MAGIC    == TRACE_MAGIC   ) &&
+                               (SNTPc_TRACE_VER      == TRACE_VER     ) &&
+                               (SNTPc_TRACE_SEQ_NONE == TRACE_SEQ_NONE)), "layout : magic, ver & seq none");
+
+    TraceTestChk((CPU_BOOLEAN)((SNTPc_TRACE_EVT_REQ     == TRACE_EVT_REQ    ) &&
+                               (SNTPc_TRACE_EVT_TX      == TRACE_EVT_TX     ) &&
+                               (SNTPc_TRACE_EVT_RX      == TRACE_EVT_RX     ) &&
+                               (SNTPc_TRACE_EVT_KOD     == TRACE_EVT_KOD    ) &&
+                               (SNTPc_TRACE_EVT_BACKOFF == TRACE_EVT_BACKOFF) &&
+                               (SNTPc_TRACE_EVT_NTS_KE  == TRACE_EVT_NTS_KE ) &&
+                               (SNTPc_TRACE_EVT_SYNC    == TRACE_EVT_SYNC   )), "layout : evt ids");
+                                                                /* See Note #1.                                         */
+    TraceTestChk((CPU_BOOLEAN)(sizeof(TraceErrNameTbl) / sizeof(TraceErrNameTbl[0]) == SNTPc_ERR_CLK_IN_USE + 1u),
+                 "layout : err names");
+
+    TraceTestDecInit(&dec);
+    TraceTestChk((CPU_BOOLEAN)(TraceRd32(&dec, TRACE_HDR_OFFSET_MAGIC)       == TRACE_MAGIC),      "dec : magic");
+    TraceTestChk((CPU_BOOLEAN)(TraceRd16(&dec, TRACE_HDR_OFFSET_VER)         == TRACE_VER),        "dec : ver");
+    TraceTestChk((CPU_BOOLEAN)(TraceRd16(&dec, TRACE_HDR_OFFSET_RECORD_SIZE) == TRACE_RECORD_LEN), "dec : record size");
+    TraceTestChk((CPU_BOOLEAN)(TraceRd32(&dec, TRACE_HDR_OFFSET_RECORD_NBR)  == SNTPc_TRACE_BIN_NBR_RECORDS),
+                 "dec : record nbr");
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TraceTestArg32S()
+*
+* Description : Check the saturation of the signed arguments.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The argument is evaluated once (see 'sntp-c_trace.c  SNTPc_TraceArg32S()  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  TraceTestArg32S (void)
+{
+    CPU_INT64S  val;
+
+
+    TraceTestChk((CPU_BOOLEAN)(SNTPc_TRACE_ARG_32S(-5)               == 0xFFFFFFFBu), "arg 32s : negative");
+    TraceTestChk((CPU_BOOLEAN)(SNTPc_TRACE_ARG_32S(0x7FFFFFFF)       == 0x7FFFFFFFu), "arg 32s : max");
+    TraceTestChk((CPU_BOOLEAN)(SNTPc_TRACE_ARG_32S(1000000000000LL)  == 0x7FFFFFFFu), "arg 32s : saturated max");
+    TraceTestChk((CPU_BOOLEAN)(SNTPc_TRACE_ARG_32S(-1000000000000LL) == 0x80000001u), "arg 32s : saturated min");
+
+    val = 0;
+    (void)SNTPc_TRACE_ARG_32S(val++);                           /* See Note #1.                                         */
+    TraceTestChk((CPU_BOOLEAN)(val == 1), "arg 32s : evaluated once");
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TraceTestWr()
+*
+* Description : Check the records written in the buffer & their sequence numbers.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The buffer is written first by this check, from sequence number 0.
+*********************************************************************************************************
+*/
+
+static  void  TraceTestWr (void)
+{
+    TRACE_DEC  dec;
+
+
+    TraceTestLocalTS = TRACE_TEST_TS;
+    SNTPc_TraceWr(SNTPc_TRACE_EVT_REQ,  SNTPc_ERR_NONE, 1500u, SNTPc_TRACE_ARG_32S(-250));
+    TraceTestLocalTS += 1u;
+                                                                /* Kiss code "RATE".                                   */
+    SNTPc_TraceWr(SNTPc_TRACE_EVT_KOD,  0u,             0x52415445u, 0u);
+    TraceTestLocalTS += 1u;
+    SNTPc_TraceWr(SNTPc_TRACE_EVT_SYNC, DEF_OK,         6u,          SNTPc_TRACE_ARG_32S(42));
+
+    TraceTestDecInit(&dec);
+    TraceTestChk((CPU_BOOLEAN)(TraceRd32(&dec, TRACE_HDR_OFFSET_SEQ_NEXT) == 3u), "wr : seq next");
+    TraceTestChk(TraceTestRecordChk(&dec, 2u, TRACE_EVT_SYNC, DEF_OK, 6u, 42u), "wr : sync");
+
+    TraceTestLocalTS -= 1u;
+    TraceTestChk(TraceTestRecordChk(&dec, 1u, TRACE_EVT_KOD, 0u, 0x52415445u, 0u), "wr : kod");
+
+    TraceTestLocalTS -= 1u;
+    TraceTestChk(TraceTestRecordChk(&dec, 0u, TRACE_EVT_REQ, SNTPc_ERR_NONE, 1500u, 0xFFFFFF06u), "wr : req");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TraceTestWrap()
+*
+* Description : Check that the oldest records are overwritten once the ring buffer is full.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The first three records were written by TraceTestWr(). Record n is written at index
+*                   (n % SNTPc_TRACE_BIN_NBR_RECORDS) (see 'sntp-c.h  SNTPc TRACE DATA TYPES  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  TraceTestWrap (void)
+{
+    TRACE_DEC    dec;
+    CPU_INT32U   seq;
+    CPU_INT32U   seq_next;
+    CPU_BOOLEAN  is_ok;
+
+
+    TraceTestLocalTS = TRACE_TEST_TS + 0x100000000uLL;
+                                                                /* See Note #1.                                         */
+    for (seq = 3u; seq < SNTPc_TRACE_BIN_NBR_RECORDS + 5u; seq++) {
+        SNTPc_TraceWr(SNTPc_TRACE_EVT_TX, SNTPc_ERR_TX, seq, 0u);
+    }
+    seq_next = seq;
+
+    TraceTestDecInit(&dec);
+    TraceTestChk((CPU_BOOLEAN)(TraceRd32(&dec, TRACE_HDR_OFFSET_SEQ_NEXT) == seq_next), "wrap : seq next");
+
+    is_ok = DEF_YES;
+    for (seq = seq_next - SNTPc_TRACE_BIN_NBR_RECORDS; seq < seq_next; seq++) {
+        if (TraceTestRecordChk(&dec, seq, TRACE_EVT_TX, SNTPc_ERR_TX, seq, 0u) != DEF_YES) {
+            is_ok = DEF_NO;
+        }
+    }
+    TraceTestChk(is_ok, "wrap : last records");
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TraceTestDump()
+*
+* Description : Dump the trace buffer to a file & decode it with the decoder.
+*
+* Argument(s) : p_file_name     Pointer to the name of the file.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) See 'sntp-c_trace_test.c  Note #2'.
+*********************************************************************************************************
+*/
+
+static  void  TraceTestDump (char  *p_file_name)
+{
+    FILE  *p_file;
+    char  *dec_argv[3];
+    int    result;
+
+
+    p_file = fopen(p_file_name, "wb");
+    if (p_file == NULL) {
+        perror(p_file_name);
+        TraceTestChk(DEF_NO, "dump : open");
+        return;
+    }
+    result = (fwrite(SNTPc_TraceBufGet(), sizeof(SNTPc_TRACE_BUF), 1u, p_file) == 1u) ? 0 : -1;
+    if (fclose(p_file) != 0) {
+        result = -1;
+    }
+    TraceTestChk((CPU_BOOLEAN)(result == 0), "dump : write");
+
+    dec_argv[0] = "sntp-c_trace_dec";
+    dec_argv[1] = p_file_name;
+    dec_argv[2] = NULL;
+    result      = TraceDecMain(2, dec_argv);
+    TraceTestChk((CPU_BOOLEAN)(result == EXIT_SUCCESS), "dump : decoded");
+}